@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "core/batch/include/batch.hpp"
+#include "core/perf/include/perf.hpp"
+#include "core/task/func_tests/test_task.hpp"
+#include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+struct Batch {
+  std::vector<std::vector<int32_t>> in;
+  std::vector<std::vector<int32_t>> out;
+  std::vector<ppc::core::TaskDataPtr> task_data;
+
+  Batch(size_t num_instances, size_t instance_size) : in(num_instances), out(num_instances) {
+    for (size_t i = 0; i < num_instances; i++) {
+      in[i] = std::vector<int32_t>(instance_size, static_cast<int32_t>(i));
+      out[i] = std::vector<int32_t>(1, 0);
+      auto data = std::make_shared<ppc::core::TaskData>();
+      data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in[i].data()));
+      data->inputs_count.emplace_back(in[i].size());
+      data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out[i].data()));
+      data->outputs_count.emplace_back(out[i].size());
+      task_data.push_back(data);
+    }
+  }
+};
+
+std::shared_ptr<ppc::core::Task> MakeTestTask(const ppc::core::TaskDataPtr &task_data) {
+  return std::make_shared<ppc::test::task::TestTask<int32_t>>(task_data);
+}
+
+class ThrowingTask : public ppc::test::task::TestTask<int32_t> {
+ public:
+  explicit ThrowingTask(const ppc::core::TaskDataPtr &task_data) : TestTask<int32_t>(task_data) {}
+
+  bool RunImpl() override {
+    if (task_data->inputs_count[0] == 0) {
+      throw std::runtime_error("empty instance");
+    }
+    return TestTask<int32_t>::RunImpl();
+  }
+};
+
+void RunBatchPipeline(ppc::core::BatchTask &batch_task) {
+  ASSERT_TRUE(batch_task.Validation());
+  batch_task.PreProcessing();
+  batch_task.Run();
+  batch_task.PostProcessing();
+}
+
+}  // namespace
+
+TEST(batch_tests, check_across_instances) {
+  Batch batch(37, 100);
+  ppc::core::BatchTask batch_task(batch.task_data, MakeTestTask, MakeTestTask, ppc::core::BatchTask::kAcrossInstances);
+  EXPECT_EQ(batch_task.GetMode(), ppc::core::BatchTask::kAcrossInstances);
+  RunBatchPipeline(batch_task);
+  for (size_t i = 0; i < batch.out.size(); i++) {
+    EXPECT_EQ(batch.out[i][0], static_cast<int32_t>(i * 100));
+  }
+}
+
+TEST(batch_tests, check_within_instances) {
+  Batch batch(5, 100);
+  ppc::core::BatchTask batch_task(batch.task_data, MakeTestTask, MakeTestTask, ppc::core::BatchTask::kWithinInstances);
+  EXPECT_EQ(batch_task.GetMode(), ppc::core::BatchTask::kWithinInstances);
+  RunBatchPipeline(batch_task);
+  for (size_t i = 0; i < batch.out.size(); i++) {
+    EXPECT_EQ(batch.out[i][0], static_cast<int32_t>(i * 100));
+  }
+}
+
+TEST(batch_tests, check_factory_by_mode) {
+  Batch batch(4, 10);
+  size_t seq_created = 0;
+  size_t par_created = 0;
+  auto seq_factory = [&](const ppc::core::TaskDataPtr &task_data) {
+    seq_created++;
+    return MakeTestTask(task_data);
+  };
+  auto par_factory = [&](const ppc::core::TaskDataPtr &task_data) {
+    par_created++;
+    return MakeTestTask(task_data);
+  };
+  ppc::core::BatchTask across(batch.task_data, seq_factory, par_factory, ppc::core::BatchTask::kAcrossInstances);
+  EXPECT_EQ(seq_created, 4U);
+  EXPECT_EQ(par_created, 0U);
+  ppc::core::BatchTask within(batch.task_data, seq_factory, par_factory, ppc::core::BatchTask::kWithinInstances);
+  EXPECT_EQ(par_created, 4U);
+  EXPECT_EQ(across.GetInstances().size(), 4U);
+}
+
+TEST(batch_tests, check_select_mode) {
+  Batch small(8, 10);
+  Batch large(8, 1000);
+  EXPECT_EQ(ppc::core::BatchTask::SelectMode(large.task_data, 100), ppc::core::BatchTask::kWithinInstances);
+  Batch single(1, 10);
+  EXPECT_EQ(ppc::core::BatchTask::SelectMode(single.task_data, 100), ppc::core::BatchTask::kWithinInstances);
+  // across instances mode is useful only with several threads
+  const auto expected = ppc::util::GetPPCNumThreads() > 1 ? ppc::core::BatchTask::kAcrossInstances
+                                                          : ppc::core::BatchTask::kWithinInstances;
+  EXPECT_EQ(ppc::core::BatchTask::SelectMode(small.task_data, 100), expected);
+}
+
+TEST(batch_tests, check_invalid_instance) {
+  Batch batch(6, 10);
+  batch.task_data[3]->outputs_count[0] = 2;
+  ppc::core::BatchTask batch_task(batch.task_data, MakeTestTask, MakeTestTask);
+  EXPECT_FALSE(batch_task.Validation());
+}
+
+TEST(batch_tests, check_exception_in_instance) {
+  Batch batch(6, 10);
+  auto factory = [](const ppc::core::TaskDataPtr &task_data) -> std::shared_ptr<ppc::core::Task> {
+    return std::make_shared<ThrowingTask>(task_data);
+  };
+  batch.task_data[2]->inputs_count[0] = 0;
+  ppc::core::BatchTask batch_task(batch.task_data, factory, factory, ppc::core::BatchTask::kAcrossInstances);
+  ASSERT_TRUE(batch_task.Validation());
+  batch_task.PreProcessing();
+  EXPECT_THROW(batch_task.Run(), std::runtime_error);
+}
+
+TEST(batch_tests, check_perf_batch) {
+  for (auto mode : {ppc::core::BatchTask::kAcrossInstances, ppc::core::BatchTask::kWithinInstances}) {
+    Batch batch(16, 1000);
+    auto batch_task = std::make_shared<ppc::core::BatchTask>(batch.task_data, MakeTestTask, MakeTestTask, mode);
+
+    auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+    perf_attr->num_running = 5;
+    auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+    ppc::core::Perf perf_analyzer(batch_task);
+    perf_analyzer.PipelineRun(perf_attr, perf_results);
+    EXPECT_EQ(perf_results->input_size, 16U * 1000U);
+    EXPECT_EQ(perf_results->samples.size(), 5U);
+    for (size_t i = 0; i < batch.out.size(); i++) {
+      EXPECT_EQ(batch.out[i][0], static_cast<int32_t>(i * 1000));
+    }
+  }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+// Task which runs a batch of independent instances of the same task type.
+// Small instances are run in parallel across instances with a sequential kernel per instance,
+// large ones are run one by one with a parallel kernel inside every instance.
+class BatchTask : public Task {
+ public:
+  enum Mode : uint8_t { kAcrossInstances, kWithinInstances, kAuto };
+  using TaskFactory = std::function<std::shared_ptr<Task>(const TaskDataPtr &)>;
+  // instances with average summary inputs_count below this size are run across instances by kAuto
+  constexpr static size_t kDefaultSmallInstanceSize = 1 << 16;
+
+  BatchTask(const std::vector<TaskDataPtr> &batch, const TaskFactory &seq_factory, const TaskFactory &par_factory,
+            Mode mode = kAuto, size_t small_instance_size = kDefaultSmallInstanceSize);
+
+  [[nodiscard]] Mode GetMode() const { return mode_; }
+  [[nodiscard]] const std::vector<std::shared_ptr<Task>> &GetInstances() const { return instances_; }
+  static Mode SelectMode(const std::vector<TaskDataPtr> &batch, size_t small_instance_size);
+
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+ private:
+  Mode mode_;
+  std::vector<TaskDataPtr> batch_;
+  std::vector<std::shared_ptr<Task>> instances_;
+
+  // calls stage for every instance according to mode, returns true when all calls succeeded
+  bool ForEachInstance(const std::function<bool(Task &)> &stage) const;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,95 @@
+#include "core/batch/include/batch.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "core/pool/include/thread_pool.hpp"
+#include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// Summary TaskData of batch, it is used for reporting of input size only
+ppc::core::TaskDataPtr MakeBatchTaskData(const std::vector<ppc::core::TaskDataPtr> &batch) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  for (const auto &instance_data : batch) {
+    task_data->inputs.insert(task_data->inputs.end(), instance_data->inputs.begin(), instance_data->inputs.end());
+    task_data->inputs_count.insert(task_data->inputs_count.end(), instance_data->inputs_count.begin(),
+                                   instance_data->inputs_count.end());
+    task_data->outputs.insert(task_data->outputs.end(), instance_data->outputs.begin(), instance_data->outputs.end());
+    task_data->outputs_count.insert(task_data->outputs_count.end(), instance_data->outputs_count.begin(),
+                                    instance_data->outputs_count.end());
+  }
+  return task_data;
+}
+
+}  // namespace
+
+ppc::core::BatchTask::BatchTask(const std::vector<TaskDataPtr> &batch, const TaskFactory &seq_factory,
+                                const TaskFactory &par_factory, Mode mode, size_t small_instance_size)
+    : Task(MakeBatchTaskData(batch)),
+      mode_(mode == kAuto ? SelectMode(batch, small_instance_size) : mode),
+      batch_(batch) {
+  const auto &factory = (mode_ == kAcrossInstances) ? seq_factory : par_factory;
+  instances_.reserve(batch_.size());
+  for (const auto &instance_data : batch_) {
+    instances_.push_back(factory(instance_data));
+  }
+}
+
+ppc::core::BatchTask::Mode ppc::core::BatchTask::SelectMode(const std::vector<TaskDataPtr> &batch,
+                                                            size_t small_instance_size) {
+  if (batch.size() < 2 || ppc::util::GetPPCNumThreads() < 2) {
+    return kWithinInstances;
+  }
+  size_t total_size = 0;
+  for (const auto &instance_data : batch) {
+    for (auto count : instance_data->inputs_count) {
+      total_size += count;
+    }
+  }
+  return (total_size / batch.size() < small_instance_size) ? kAcrossInstances : kWithinInstances;
+}
+
+bool ppc::core::BatchTask::ForEachInstance(const std::function<bool(Task &)> &stage) const {
+  if (mode_ == kWithinInstances) {
+    return std::ranges::all_of(instances_, [&](const auto &instance) { return stage(*instance); });
+  }
+
+  std::atomic<bool> res = true;
+  ParallelFor(0, instances_.size(), [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      if (!stage(*instances_[i])) {
+        res = false;
+      }
+    }
+  });
+  return res;
+}
+
+bool ppc::core::BatchTask::ValidationImpl() {
+  if (instances_.empty()) {
+    return false;
+  }
+  // instances are measured together with batch, so they follow its state of testing
+  for (const auto &instance_data : batch_) {
+    instance_data->state_of_testing = task_data->state_of_testing;
+  }
+  return std::ranges::all_of(instances_, [](const auto &instance) { return instance->Validation(); });
+}
+
+bool ppc::core::BatchTask::PreProcessingImpl() {
+  return ForEachInstance([](Task &instance) { return instance.PreProcessing(); });
+}
+
+bool ppc::core::BatchTask::RunImpl() {
+  return ForEachInstance([](Task &instance) { return instance.Run(); });
+}
+
+bool ppc::core::BatchTask::PostProcessingImpl() {
+  return ForEachInstance([](Task &instance) { return instance.PostProcessing(); });
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+
+namespace {
+
+std::vector<double> RandomMatrix(size_t rows, size_t cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> matrix(rows * cols);
+  for (auto &value : matrix) {
+    value = dist(gen);
+  }
+  return matrix;
+}
+
+// C += A * B with the naive triple loop
+void ReferenceGemm(size_t m, size_t n, size_t k, const double *a, size_t lda, const double *b, size_t ldb, double *c,
+                   size_t ldc) {
+  for (size_t i = 0; i < m; i++) {
+    for (size_t p = 0; p < k; p++) {
+      for (size_t j = 0; j < n; j++) {
+        c[(i * ldc) + j] += a[(i * lda) + p] * b[(p * ldb) + j];
+      }
+    }
+  }
+}
+
+void CheckGemm(size_t m, size_t n, size_t k, ppc::core::GemmKernel kernel) {
+  const auto a = RandomMatrix(m, k, 1);
+  const auto b = RandomMatrix(k, n, 2);
+  auto c = RandomMatrix(m, n, 3);
+  auto expected = c;
+
+  ppc::core::Gemm(m, n, k, a.data(), k, b.data(), n, c.data(), n, kernel);
+  ReferenceGemm(m, n, k, a.data(), k, b.data(), n, expected.data(), n);
+
+  for (size_t i = 0; i < c.size(); i++) {
+    ASSERT_NEAR(c[i], expected[i], 1e-9 * static_cast<double>(k)) << "m=" << m << " n=" << n << " k=" << k;
+  }
+}
+
+void CheckAllSizes(ppc::core::GemmKernel kernel) {
+  if (!ppc::core::IsGemmKernelSupported(kernel)) {
+    GTEST_SKIP() << "kernel is not supported on this CPU";
+  }
+  // Edge tiles in every dimension and sizes crossing the panel boundaries
+  for (size_t m : {1, 5, 7, 97, 130}) {
+    for (size_t n : {1, 9, 17, 33}) {
+      for (size_t k : {1, 3, 257, 300}) {
+        CheckGemm(m, n, k, kernel);
+      }
+    }
+  }
+  CheckGemm(20, 2100, 40, kernel);
+}
+
+}  // namespace
+
+TEST(gemm_tests, check_scalar_kernel) { CheckAllSizes(ppc::core::GemmKernel::kScalar); }
+
+TEST(gemm_tests, check_avx2_kernel) { CheckAllSizes(ppc::core::GemmKernel::kAvx2); }
+
+TEST(gemm_tests, check_avx512_kernel) { CheckAllSizes(ppc::core::GemmKernel::kAvx512); }
+
+TEST(gemm_tests, check_auto_kernel) { CheckGemm(64, 64, 64, ppc::core::GemmKernel::kAuto); }
+
+TEST(gemm_tests, check_submatrix_strides) {
+  // Multiply the 3 x 4 block at (1, 2) of A by the 4 x 5 block at (2, 1) of B into the block at (2, 3) of C
+  const size_t size = 10;
+  const auto a = RandomMatrix(size, size, 4);
+  const auto b = RandomMatrix(size, size, 5);
+  std::vector<double> c(size * size, 0.0);
+  auto expected = c;
+
+  ppc::core::Gemm(3, 5, 4, &a[(1 * size) + 2], size, &b[(2 * size) + 1], size, &c[(2 * size) + 3], size);
+  ReferenceGemm(3, 5, 4, &a[(1 * size) + 2], size, &b[(2 * size) + 1], size, &expected[(2 * size) + 3], size);
+
+  for (size_t i = 0; i < c.size(); i++) {
+    EXPECT_NEAR(c[i], expected[i], 1e-12);
+  }
+}
+
+TEST(gemm_tests, check_empty_sizes) {
+  std::vector<double> c{1.0};
+  ppc::core::Gemm(1, 1, 0, nullptr, 0, nullptr, 1, c.data(), 1);
+  EXPECT_EQ(c[0], 1.0);
+}
+
+TEST(gemm_tests, detected_kernel_is_supported) {
+  const auto kernel = ppc::core::DetectGemmKernel();
+  EXPECT_NE(kernel, ppc::core::GemmKernel::kAuto);
+  EXPECT_TRUE(ppc::core::IsGemmKernelSupported(kernel));
+}
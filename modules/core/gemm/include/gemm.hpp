@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ppc::core {
+
+// Register-blocked micro-kernels for the packed GEMM. kAuto picks the widest one supported by the CPU.
+enum class GemmKernel : unsigned char { kAuto, kScalar, kAvx2, kAvx512 };
+
+// Best kernel available on the current CPU (never kAuto)
+GemmKernel DetectGemmKernel();
+// Returns false for SIMD kernels which are not compiled in or not supported by the current CPU
+bool IsGemmKernelSupported(GemmKernel kernel);
+
+// C[m x n] += A[m x k] * B[k x n]. All matrices are row-major, lda/ldb/ldc are the row strides (in elements),
+// so blocks of bigger matrices can be passed without copying. A and B are packed into cache-sized panels
+// (thread-local buffers), the call itself is single-threaded: parallel callers split C into disjoint blocks.
+void Gemm(size_t m, size_t n, size_t k, const double *a, size_t lda, const double *b, size_t ldb, double *c,
+          size_t ldc, GemmKernel kernel = GemmKernel::kAuto);
+
+}  // namespace ppc::core
@@ -0,0 +1,208 @@
+#include "core/gemm/include/gemm.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PPC_GEMM_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Panel sizes: a kKc x kNr sliver of B stays in L1, a kMc x kKc panel of A in L2, a kKc x kNc panel of B in L3
+constexpr size_t kKc = 256;
+constexpr size_t kMc = 96;
+constexpr size_t kNc = 2048;
+constexpr size_t kMaxTileSize = 6 * 16;
+
+// Computes a full mr x nr tile from packed panels into tile (row-major, row stride nr)
+using MicroKernel = void (*)(size_t kc, const double *a, const double *b, double *tile);
+
+struct KernelInfo {
+  size_t mr;
+  size_t nr;
+  MicroKernel fn;
+};
+
+template <size_t Mr, size_t Nr>
+void ScalarKernel(size_t kc, const double *a, const double *b, double *tile) {
+  std::array<double, Mr * Nr> acc{};
+  for (size_t p = 0; p < kc; p++) {
+    for (size_t r = 0; r < Mr; r++) {
+      const double ar = a[(p * Mr) + r];
+      for (size_t c = 0; c < Nr; c++) {
+        acc[(r * Nr) + c] += ar * b[(p * Nr) + c];
+      }
+    }
+  }
+  std::ranges::copy(acc, tile);
+}
+
+#ifdef PPC_GEMM_X86
+// 6 x 8 tile: 12 ymm accumulators, two loads of B and one broadcast of A per row and step
+__attribute__((target("avx2,fma"))) void Avx2Kernel(size_t kc, const double *a, const double *b, double *tile) {
+  __m256d acc[6][2];
+#pragma GCC unroll 6
+  for (size_t r = 0; r < 6; r++) {
+    acc[r][0] = _mm256_setzero_pd();
+    acc[r][1] = _mm256_setzero_pd();
+  }
+  for (size_t p = 0; p < kc; p++) {
+    const __m256d b0 = _mm256_loadu_pd(b + (p * 8));
+    const __m256d b1 = _mm256_loadu_pd(b + (p * 8) + 4);
+#pragma GCC unroll 6
+    for (size_t r = 0; r < 6; r++) {
+      const __m256d ar = _mm256_broadcast_sd(a + (p * 6) + r);
+      acc[r][0] = _mm256_fmadd_pd(ar, b0, acc[r][0]);
+      acc[r][1] = _mm256_fmadd_pd(ar, b1, acc[r][1]);
+    }
+  }
+#pragma GCC unroll 6
+  for (size_t r = 0; r < 6; r++) {
+    _mm256_storeu_pd(tile + (r * 8), acc[r][0]);
+    _mm256_storeu_pd(tile + (r * 8) + 4, acc[r][1]);
+  }
+}
+
+// 6 x 16 tile: 12 zmm accumulators
+__attribute__((target("avx512f"))) void Avx512Kernel(size_t kc, const double *a, const double *b, double *tile) {
+  __m512d acc[6][2];
+#pragma GCC unroll 6
+  for (size_t r = 0; r < 6; r++) {
+    acc[r][0] = _mm512_setzero_pd();
+    acc[r][1] = _mm512_setzero_pd();
+  }
+  for (size_t p = 0; p < kc; p++) {
+    const __m512d b0 = _mm512_loadu_pd(b + (p * 16));
+    const __m512d b1 = _mm512_loadu_pd(b + (p * 16) + 8);
+#pragma GCC unroll 6
+    for (size_t r = 0; r < 6; r++) {
+      const __m512d ar = _mm512_set1_pd(a[(p * 6) + r]);
+      acc[r][0] = _mm512_fmadd_pd(ar, b0, acc[r][0]);
+      acc[r][1] = _mm512_fmadd_pd(ar, b1, acc[r][1]);
+    }
+  }
+#pragma GCC unroll 6
+  for (size_t r = 0; r < 6; r++) {
+    _mm512_storeu_pd(tile + (r * 16), acc[r][0]);
+    _mm512_storeu_pd(tile + (r * 16) + 8, acc[r][1]);
+  }
+}
+#endif
+
+KernelInfo GetKernelInfo(ppc::core::GemmKernel kernel) {
+  if (kernel == ppc::core::GemmKernel::kAuto) {
+    kernel = ppc::core::DetectGemmKernel();
+  } else if (!ppc::core::IsGemmKernelSupported(kernel)) {
+    throw std::invalid_argument("GEMM kernel is not supported on this CPU");
+  }
+#ifdef PPC_GEMM_X86
+  if (kernel == ppc::core::GemmKernel::kAvx512) {
+    return {.mr = 6, .nr = 16, .fn = Avx512Kernel};
+  }
+  if (kernel == ppc::core::GemmKernel::kAvx2) {
+    return {.mr = 6, .nr = 8, .fn = Avx2Kernel};
+  }
+#endif
+  return {.mr = 4, .nr = 8, .fn = ScalarKernel<4, 8>};
+}
+
+// Packs an mc x kc block of A into strips of mr rows, each strip is stored column by column (zero-padded)
+void PackA(size_t mc, size_t kc, const double *a, size_t lda, size_t mr, double *dst) {
+  for (size_t ir = 0; ir < mc; ir += mr) {
+    const size_t rows = std::min(mr, mc - ir);
+    for (size_t p = 0; p < kc; p++) {
+      for (size_t r = 0; r < mr; r++) {
+        *dst++ = (r < rows) ? a[((ir + r) * lda) + p] : 0.0;
+      }
+    }
+  }
+}
+
+// Packs a kc x nc block of B into strips of nr columns, each strip is stored row by row (zero-padded)
+void PackB(size_t kc, size_t nc, const double *b, size_t ldb, size_t nr, double *dst) {
+  for (size_t jr = 0; jr < nc; jr += nr) {
+    const size_t cols = std::min(nr, nc - jr);
+    for (size_t p = 0; p < kc; p++) {
+      const double *row = b + (p * ldb) + jr;
+      for (size_t c = 0; c < nr; c++) {
+        *dst++ = (c < cols) ? row[c] : 0.0;
+      }
+    }
+  }
+}
+
+size_t RoundUp(size_t value, size_t step) { return (value + step - 1) / step * step; }
+
+}  // namespace
+
+ppc::core::GemmKernel ppc::core::DetectGemmKernel() {
+  static const GemmKernel kDetected = [] {
+#ifdef PPC_GEMM_X86
+    if (__builtin_cpu_supports("avx512f") != 0) {
+      return GemmKernel::kAvx512;
+    }
+    if (__builtin_cpu_supports("avx2") != 0 && __builtin_cpu_supports("fma") != 0) {
+      return GemmKernel::kAvx2;
+    }
+#endif
+    return GemmKernel::kScalar;
+  }();
+  return kDetected;
+}
+
+bool ppc::core::IsGemmKernelSupported(GemmKernel kernel) {
+  switch (kernel) {
+    case GemmKernel::kAuto:
+    case GemmKernel::kScalar:
+      return true;
+    case GemmKernel::kAvx2:
+      return DetectGemmKernel() == GemmKernel::kAvx2 || DetectGemmKernel() == GemmKernel::kAvx512;
+    case GemmKernel::kAvx512:
+      return DetectGemmKernel() == GemmKernel::kAvx512;
+  }
+  return false;
+}
+
+void ppc::core::Gemm(size_t m, size_t n, size_t k, const double *a, size_t lda, const double *b, size_t ldb,
+                     double *c, size_t ldc, GemmKernel kernel) {
+  if (m == 0 || n == 0 || k == 0) {
+    return;
+  }
+  const KernelInfo info = GetKernelInfo(kernel);
+
+  thread_local std::vector<double> a_pack;
+  thread_local std::vector<double> b_pack;
+  a_pack.resize(RoundUp(std::min(m, kMc), info.mr) * kKc);
+  b_pack.resize(RoundUp(std::min(n, kNc), info.nr) * kKc);
+  std::array<double, kMaxTileSize> tile{};
+
+  for (size_t jc = 0; jc < n; jc += kNc) {
+    const size_t nc = std::min(kNc, n - jc);
+    for (size_t pc = 0; pc < k; pc += kKc) {
+      const size_t kc = std::min(kKc, k - pc);
+      PackB(kc, nc, b + (pc * ldb) + jc, ldb, info.nr, b_pack.data());
+      for (size_t ic = 0; ic < m; ic += kMc) {
+        const size_t mc = std::min(kMc, m - ic);
+        PackA(mc, kc, a + (ic * lda) + pc, lda, info.mr, a_pack.data());
+        for (size_t jr = 0; jr < nc; jr += info.nr) {
+          const size_t cols = std::min(info.nr, nc - jr);
+          for (size_t ir = 0; ir < mc; ir += info.mr) {
+            const size_t rows = std::min(info.mr, mc - ir);
+            info.fn(kc, a_pack.data() + (ir * kc), b_pack.data() + (jr * kc), tile.data());
+            double *c_tile = c + ((ic + ir) * ldc) + jc + jr;
+            for (size_t r = 0; r < rows; r++) {
+              for (size_t cc = 0; cc < cols; cc++) {
+                c_tile[(r * ldc) + cc] += tile[(r * info.nr) + cc];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
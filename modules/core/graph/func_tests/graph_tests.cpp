@@ -0,0 +1,264 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/graph/include/graph.hpp"
+#include "core/graph/include/sssp.hpp"
+#include "core/task/include/task.hpp"
+
+#ifdef _OPENMP
+#include "core/sparse/include/sparse_omp.hpp"
+#endif
+
+namespace graph = ppc::core::graph;
+
+namespace {
+
+// Random graph with degree edges per vertex and weights in [1, max_weight]
+graph::CsrGraph RandomGraph(size_t n, size_t degree, int max_weight, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<std::uint32_t> target(0, n - 1);
+  std::uniform_int_distribution<int> weight(1, max_weight);
+  graph::CsrGraph g;
+  for (size_t u = 0; u < n; u++) {
+    for (size_t e = 0; e < degree; e++) {
+      g.targets.push_back(target(gen));
+      g.weights.push_back(weight(gen));
+    }
+    g.offsets.push_back(g.targets.size());
+  }
+  return g;
+}
+
+std::vector<int> Reference(const graph::CsrGraph &g, size_t source) {
+  std::vector<int> dist(g.NumVertices());
+  graph::Dijkstra(g.View(), source, dist);
+  return dist;
+}
+
+}  // namespace
+
+TEST(graph_tests, parse_adjacency_list) {
+  // 0 -> 1 (5), 0 -> 7 (dropped), 2 -> 0 (1); vertex 3 is missing from the input
+  const std::vector<int> data = {1, 5, 7, 2, -1, -1, 0, 1, -1};
+  graph::CsrGraph g;
+  ASSERT_TRUE(graph::ParseAdjacencyList(data, 4, g));
+  EXPECT_EQ(g.offsets, (std::vector<std::uint32_t>{0, 1, 1, 2, 2}));
+  EXPECT_EQ(g.targets, (std::vector<std::uint32_t>{1, 0}));
+  EXPECT_EQ(g.weights, (std::vector<int>{5, 1}));
+}
+
+TEST(graph_tests, parse_rejects_negative_weight) {
+  const std::vector<int> data = {1, -3, -1, -1};
+  graph::CsrGraph g;
+  EXPECT_FALSE(graph::ParseAdjacencyList(data, 2, g));
+}
+
+TEST(graph_tests, parse_strict_rejects_bad_edges_and_extra_data) {
+  graph::CsrGraph g;
+  EXPECT_TRUE(graph::ParseAdjacencyList(std::vector<int>{1, 5, -1, -1}, 2, g, graph::ParseMode::kStrict));
+  EXPECT_FALSE(graph::ParseAdjacencyList(std::vector<int>{2, 5, -1, -1}, 2, g, graph::ParseMode::kStrict));
+  EXPECT_FALSE(graph::ParseAdjacencyList(std::vector<int>{1, 5, -1, -1, 0}, 2, g, graph::ParseMode::kStrict));
+  EXPECT_TRUE(graph::ParseAdjacencyList(std::vector<int>{1, 5, -1, -1, 0}, 2, g));
+}
+
+TEST(graph_tests, dijkstra_path_and_unreachable) {
+  graph::CsrGraph g;
+  ASSERT_TRUE(graph::ParseAdjacencyList(std::vector<int>{1, 2, 2, 9, -1, 2, 3, -1, -1, -1}, 4, g));
+  EXPECT_EQ(Reference(g, 0), (std::vector<int>{0, 2, 5, graph::kUnreachable}));
+}
+
+TEST(graph_tests, build_from_edge_list_keeps_edge_order) {
+  const std::vector<graph::Edge> edges = {
+      {.from = 2, .to = 0, .weight = 4}, {.from = 0, .to = 1, .weight = 1}, {.from = 2, .to = 1, .weight = 2}};
+  const auto g = graph::BuildCsrGraph(4, edges);
+  EXPECT_EQ(g.offsets, (std::vector<std::uint32_t>{0, 1, 1, 3, 3}));
+  EXPECT_EQ(g.targets, (std::vector<std::uint32_t>{1, 0, 1}));
+  EXPECT_EQ(g.weights, (std::vector<int>{1, 4, 2}));
+  EXPECT_TRUE(graph::IsValidGraph(g.View()));
+
+  const std::vector<graph::Edge> bad = {{.from = 0, .to = 4, .weight = 1}};
+  EXPECT_THROW(graph::BuildCsrGraph(4, bad), std::invalid_argument);
+}
+
+TEST(graph_tests, parallel_build_matches_csr) {
+  const auto g = RandomGraph(3000, 7, 50, 7);
+  std::vector<graph::Edge> edges;
+  for (std::uint32_t u = 0; u < g.NumVertices(); u++) {
+    for (std::uint32_t e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+      edges.push_back({.from = u, .to = g.targets[e], .weight = g.weights[e]});
+    }
+  }
+  std::shuffle(edges.begin(), edges.end(), std::mt19937(8));
+  const auto seq = graph::BuildCsrGraph(g.NumVertices(), edges);
+  const auto stl = graph::BuildCsrGraph(g.NumVertices(), edges, graph::StlBackend{});
+  EXPECT_EQ(stl.offsets, g.offsets);
+  EXPECT_EQ(stl.targets, seq.targets);
+  EXPECT_EQ(stl.weights, seq.weights);
+}
+
+TEST(graph_tests, is_valid_graph) {
+  auto g = RandomGraph(10, 2, 5, 9);
+  EXPECT_TRUE(graph::IsValidGraph(g.View()));
+  g.weights[3] = -1;
+  EXPECT_FALSE(graph::IsValidGraph(g.View()));
+  g.weights[3] = 1;
+  g.targets[0] = 10;
+  EXPECT_FALSE(graph::IsValidGraph(g.View()));
+  g.targets[0] = 0;
+  std::swap(g.offsets[2], g.offsets[3]);
+  EXPECT_FALSE(graph::IsValidGraph(g.View()));
+}
+
+TEST(graph_tests, csr_inputs_are_zero_copy) {
+  const auto g = RandomGraph(100, 3, 9, 10);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  std::vector<int> legacy = {1, 2, -1};
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(legacy.data()));
+  task_data->inputs_count.emplace_back(legacy.size());
+  EXPECT_FALSE(graph::HasCsrInputs(*task_data));
+
+  task_data->AddInput(g.offsets.data(), g.offsets.size());
+  task_data->AddInput(g.targets.data(), g.targets.size());
+  task_data->AddInput(g.weights.data(), g.weights.size());
+  ASSERT_TRUE(graph::HasCsrInputs(*task_data, 1));
+  const auto view = graph::CsrInputs(*task_data, 1);
+  EXPECT_EQ(view.offsets.data(), g.offsets.data());
+  EXPECT_EQ(view.targets.data(), g.targets.data());
+  EXPECT_EQ(view.weights.data(), g.weights.data());
+  EXPECT_EQ(view.NumVertices(), 100);
+}
+
+TEST(graph_tests, graph_file_round_trip) {
+  const auto g = RandomGraph(500, 5, 20, 11);
+  const auto path = (std::filesystem::temp_directory_path() / "ppc_graph_tests.csr").string();
+  graph::WriteGraphFile(path, g.View());
+  {
+    const graph::MappedGraphFile file(path);
+    const auto view = file.View();
+    EXPECT_TRUE(std::ranges::equal(view.offsets, g.offsets));
+    EXPECT_TRUE(std::ranges::equal(view.targets, g.targets));
+    EXPECT_TRUE(std::ranges::equal(view.weights, g.weights));
+    std::vector<int> dist(view.NumVertices());
+    graph::DeltaStepping(view, 0, dist);
+    EXPECT_EQ(dist, Reference(g, 0));
+  }
+  // Truncated files are rejected
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+  EXPECT_THROW(graph::MappedGraphFile{path}, std::runtime_error);
+  std::filesystem::remove(path);
+  EXPECT_THROW(graph::MappedGraphFile{path}, std::runtime_error);
+}
+
+TEST(graph_tests, delta_stepping_matches_dijkstra) {
+  const auto g = RandomGraph(2000, 6, 100, 1);
+  const auto expected = Reference(g, 3);
+  for (const int delta : {0, 1, 7, 50, 1000}) {
+    std::vector<int> dist(g.NumVertices());
+    graph::DeltaStepping(g.View(), 3, dist, graph::SeqBackend{}, {.delta = delta});
+    EXPECT_EQ(dist, expected) << "delta=" << delta;
+  }
+}
+
+TEST(graph_tests, delta_stepping_stl_backend) {
+  const auto g = RandomGraph(5000, 4, 10, 2);
+  std::vector<int> dist(g.NumVertices());
+  graph::DeltaStepping(g.View(), 0, dist, graph::StlBackend{});
+  EXPECT_EQ(dist, Reference(g, 0));
+}
+
+#ifdef _OPENMP
+TEST(graph_tests, delta_stepping_omp_backend) {
+  const auto g = RandomGraph(5000, 4, 10, 3);
+  std::vector<int> dist(g.NumVertices());
+  graph::DeltaStepping(g.View(), 0, dist, ppc::core::sparse::OmpBackend{});
+  EXPECT_EQ(dist, Reference(g, 0));
+}
+#endif
+
+TEST(graph_tests, delta_stepping_huge_weights_and_zero_edges) {
+  // Weights far above delta raise it to keep the bucket ring small; zero weights stay in the same bucket
+  auto g = RandomGraph(1000, 3, 1 << 28, 4);
+  for (size_t e = 0; e < g.NumEdges(); e += 5) {
+    g.weights[e] = 0;
+  }
+  std::vector<int> dist(g.NumVertices());
+  graph::DeltaStepping(g.View(), 0, dist, graph::StlBackend{}, {.delta = 1});
+  EXPECT_EQ(dist, Reference(g, 0));
+}
+
+TEST(graph_tests, delta_stepping_isolated_source) {
+  graph::CsrGraph g;
+  ASSERT_TRUE(graph::ParseAdjacencyList(std::vector<int>{-1, 0, 1, -1, -1}, 3, g));
+  std::vector<int> dist(3);
+  graph::DeltaStepping(g.View(), 0, dist);
+  EXPECT_EQ(dist, (std::vector<int>{0, graph::kUnreachable, graph::kUnreachable}));
+}
+
+TEST(graph_tests, delta_stepping_rejects_bad_arguments) {
+  const auto g = RandomGraph(10, 2, 5, 5);
+  std::vector<int> dist(10);
+  std::vector<int> short_dist(9);
+  EXPECT_THROW(graph::DeltaStepping(g.View(), 10, dist), std::invalid_argument);
+  EXPECT_THROW(graph::DeltaStepping(g.View(), 0, short_dist), std::invalid_argument);
+  EXPECT_THROW(graph::DeltaStepping(g.View(), 0, dist, graph::SeqBackend{}, {.delta = -1}), std::invalid_argument);
+}
+
+TEST(graph_tests, task_sources) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  std::vector<int> legacy = {-1, -1};
+  int start = 1;
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(legacy.data()));
+  task_data->inputs_count.emplace_back(legacy.size());
+  EXPECT_EQ(graph::GraphInputsCount(*task_data), 1);
+  EXPECT_EQ(graph::TaskSources(*task_data, 1), (std::vector<std::uint32_t>{0}));
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&start));
+  task_data->inputs_count.emplace_back(sizeof(start));
+  EXPECT_EQ(graph::TaskSources(*task_data, 1), (std::vector<std::uint32_t>{1}));
+
+  std::vector<std::uint32_t> batch = {3, 0, 2};
+  task_data->AddInput(batch.data(), batch.size());
+  EXPECT_EQ(graph::TaskSources(*task_data, 2), batch);
+
+  // Three rows of 4 distances fit the batch, rows of 2 leave source 3 out of range
+  task_data->outputs_count.emplace_back(12);
+  EXPECT_TRUE(graph::ValidTaskSources(*task_data, 2));
+  task_data->outputs_count[0] = 6;
+  EXPECT_FALSE(graph::ValidTaskSources(*task_data, 2));
+
+  std::vector<std::uint32_t> empty;
+  task_data->AddInput(empty.data(), empty.size());
+  EXPECT_TRUE(graph::TaskSources(*task_data, 3).empty());
+  EXPECT_FALSE(graph::ValidTaskSources(*task_data, 3));
+}
+
+TEST(graph_tests, batched_shortest_paths_match_single_queries) {
+  const auto g = RandomGraph(3000, 5, 40, 12);
+  const std::vector<std::uint32_t> sources = {0, 17, 17, 2999, 1234, 5, 600, 2048, 9};
+  const size_t n = g.NumVertices();
+  std::vector<int> seq(sources.size() * n);
+  std::vector<int> stl(sources.size() * n);
+  graph::BatchedShortestPaths(g.View(), sources, seq);
+  graph::BatchedShortestPaths(g.View(), sources, stl, graph::StlBackend{});
+  for (size_t i = 0; i < sources.size(); i++) {
+    const auto expected = Reference(g, sources[i]);
+    EXPECT_TRUE(std::ranges::equal(std::span(seq).subspan(i * n, n), expected)) << "source " << sources[i];
+    EXPECT_TRUE(std::ranges::equal(std::span(stl).subspan(i * n, n), expected)) << "source " << sources[i];
+  }
+
+  std::vector<int> short_dist((sources.size() * n) - 1);
+  const std::vector<std::uint32_t> bad = {0, static_cast<std::uint32_t>(n)};
+  std::vector<int> dist(2 * n);
+  EXPECT_THROW(graph::BatchedShortestPaths(g.View(), sources, short_dist), std::invalid_argument);
+  EXPECT_THROW(graph::BatchedShortestPaths(g.View(), bad, dist), std::invalid_argument);
+}
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core::graph {
+
+// The graph algorithms run on the chunk backends of the sparse module (sparse_omp.hpp and sparse_tbb.hpp add
+// OpenMP and TBB)
+using sparse::SeqBackend;
+using sparse::StlBackend;
+
+// Distance of the vertices which are not reachable from the source
+constexpr int kUnreachable = std::numeric_limits<int>::max();
+
+// Read-only directed graph with non-negative integer weights in compressed sparse row form:
+// the edges of vertex u are targets/weights[offsets[u], offsets[u + 1]). Views do not own the arrays,
+// they can point into a CsrGraph, TaskData buffers or a mapped graph file.
+struct CsrGraphView {
+  std::span<const std::uint32_t> offsets;
+  std::span<const std::uint32_t> targets;
+  std::span<const int> weights;
+
+  [[nodiscard]] size_t NumVertices() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+  [[nodiscard]] size_t NumEdges() const { return targets.size(); }
+};
+
+// Graph owning its CSR arrays
+struct CsrGraph {
+  std::vector<std::uint32_t> offsets = {0};
+  std::vector<std::uint32_t> targets{};
+  std::vector<int> weights{};
+
+  [[nodiscard]] size_t NumVertices() const { return offsets.size() - 1; }
+  [[nodiscard]] size_t NumEdges() const { return targets.size(); }
+  [[nodiscard]] CsrGraphView View() const { return {.offsets = offsets, .targets = targets, .weights = weights}; }
+};
+
+struct Edge {
+  std::uint32_t from;
+  std::uint32_t to;
+  int weight;
+};
+
+// Offsets go from 0 to NumEdges() without decreasing, targets are vertices and weights are non-negative
+bool IsValidGraph(CsrGraphView graph);
+
+// How ParseAdjacencyList treats edges to vertices outside [0, num_vertices) and data after the last vertex:
+// kLenient drops them, kStrict fails
+enum class ParseMode : std::uint8_t { kLenient, kStrict };
+
+// Parses the adjacency encoding of the Dijkstra tasks: "dest weight" pairs of every vertex followed by -1.
+// Missing vertices get no edges. Returns false if the graph has a negative weight.
+bool ParseAdjacencyList(std::span<const int> data, size_t num_vertices, CsrGraph &graph,
+                        ParseMode mode = ParseMode::kLenient);
+
+// TaskData layout of a CSR graph: inputs first, first + 1 and first + 2 are offsets and targets (std::uint32_t)
+// and weights (int) added with TaskData::AddInput. Such inputs are recognized by their element types.
+constexpr size_t kCsrInputsCount = 3;
+bool HasCsrInputs(const TaskData &task_data, size_t first = 0);
+// Zero-copy view of the CSR inputs, throws if they are missing or have other types
+CsrGraphView CsrInputs(const TaskData &task_data, size_t first = 0);
+
+// Number of inputs taken by the graph of a task: kCsrInputsCount for CSR inputs, 1 for the adjacency stream
+size_t GraphInputsCount(const TaskData &task_data);
+
+// Sources of a shortest-path task in inputs[input]: a std::uint32_t buffer added with TaskData::AddInput is
+// a batch of sources, any other buffer holds one int vertex. Without the input the source is vertex 0.
+std::vector<std::uint32_t> TaskSources(const TaskData &task_data, size_t input);
+
+// True if TaskSources(task_data, input) is a non-empty batch whose rows evenly split outputs_count[0] and
+// every source is a vertex of a graph with that row length
+bool ValidTaskSources(const TaskData &task_data, size_t input);
+
+// Graph input of a task: CSR inputs (see HasCsrInputs) are used in place, otherwise inputs[0] holds the
+// adjacency stream, which is parsed once. The task's other inputs start at NextInput().
+class TaskGraph {
+ public:
+  TaskGraph() = default;
+  TaskGraph(const TaskGraph &) = delete;
+  TaskGraph &operator=(const TaskGraph &) = delete;
+
+  // Returns false for negative weights, malformed CSR arrays or CSR inputs with another number of vertices
+  bool Load(const TaskData &task_data, size_t num_vertices, ParseMode mode = ParseMode::kLenient);
+
+  [[nodiscard]] CsrGraphView View() const { return view_; }
+  [[nodiscard]] size_t NextInput() const { return next_input_; }
+
+ private:
+  CsrGraph storage_;
+  CsrGraphView view_;
+  size_t next_input_ = 1;
+};
+
+// Binary graph file: a 24-byte header ("PPCCSR" + version, vertices and edges as 64-bit integers) followed
+// by the offsets, targets and weights arrays in the native byte order
+void WriteGraphFile(const std::string &path, CsrGraphView graph);
+
+// Graph file mapped into memory; View() reads the arrays in place, pages are loaded on first access
+class MappedGraphFile {
+ public:
+  explicit MappedGraphFile(const std::string &path);
+  MappedGraphFile(const MappedGraphFile &) = delete;
+  MappedGraphFile &operator=(const MappedGraphFile &) = delete;
+  ~MappedGraphFile();
+
+  [[nodiscard]] CsrGraphView View() const { return view_; }
+
+ private:
+  void *data_ = nullptr;
+  size_t size_ = 0;
+  // Used instead of the mapping where mmap is not available
+  std::vector<std::uint64_t> buffer_;
+  CsrGraphView view_;
+};
+
+// Builds a CSR graph from an edge list; edges of every vertex keep their order in the list. Every chunk of
+// the list counts its sources separately, so the scatter needs no atomics (like sparse::Transpose).
+template <class Backend = SeqBackend>
+CsrGraph BuildCsrGraph(size_t num_vertices, std::span<const Edge> edges, const Backend &backend = {}) {
+  const auto out_of_range = [num_vertices](const Edge &e) { return e.from >= num_vertices || e.to >= num_vertices; };
+  if (edges.size() > std::numeric_limits<std::uint32_t>::max() || std::ranges::any_of(edges, out_of_range)) {
+    throw std::invalid_argument("BuildCsrGraph: too many edges or edge endpoint is out of range");
+  }
+  const size_t m = edges.size();
+  const size_t chunks =
+      std::clamp<size_t>(m / std::max<size_t>(num_vertices, 1), 1, std::max<size_t>(backend.Concurrency(), 1));
+  const auto bound = [&](size_t chunk) { return m * chunk / chunks; };
+
+  std::vector<size_t> counts(chunks * num_vertices, 0);
+  backend.ForEachChunk(chunks, [&](size_t chunk) {
+    size_t *chunk_counts = counts.data() + (chunk * num_vertices);
+    for (size_t e = bound(chunk); e < bound(chunk + 1); e++) {
+      chunk_counts[edges[e].from]++;
+    }
+  });
+
+  CsrGraph graph;
+  graph.offsets.assign(num_vertices + 1, 0);
+  size_t pos = 0;
+  for (size_t u = 0; u < num_vertices; u++) {
+    for (size_t chunk = 0; chunk < chunks; chunk++) {
+      const size_t count = counts[(chunk * num_vertices) + u];
+      counts[(chunk * num_vertices) + u] = pos;
+      pos += count;
+    }
+    graph.offsets[u + 1] = static_cast<std::uint32_t>(pos);
+  }
+
+  graph.targets.resize(m);
+  graph.weights.resize(m);
+  backend.ForEachChunk(chunks, [&](size_t chunk) {
+    size_t *chunk_pos = counts.data() + (chunk * num_vertices);
+    for (size_t e = bound(chunk); e < bound(chunk + 1); e++) {
+      const size_t dst = chunk_pos[edges[e].from]++;
+      graph.targets[dst] = edges[e].to;
+      graph.weights[dst] = edges[e].weight;
+    }
+  });
+  return graph;
+}
+
+// Heap storage of Dijkstra; reusing one workspace for many queries keeps its capacity
+struct DijkstraWorkspace {
+  std::vector<std::pair<int, std::uint32_t>> heap{};
+};
+
+// Serial Dijkstra with a binary heap, the reference for the parallel engines
+void Dijkstra(CsrGraphView graph, size_t source, std::span<int> dist);
+void Dijkstra(CsrGraphView graph, size_t source, std::span<int> dist, DijkstraWorkspace &workspace);
+
+}  // namespace ppc::core::graph
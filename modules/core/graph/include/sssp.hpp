@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "core/graph/include/graph.hpp"
+
+namespace ppc::core::graph {
+
+struct DeltaSteppingOptions {
+  // Bucket width: vertices with tentative distances in [b * delta, (b + 1) * delta) are relaxed together.
+  // Small values approach Dijkstra (less wasted work, more rounds), large ones approach Bellman-Ford.
+  // 0 picks max_weight / mean degree.
+  int delta = 0;
+};
+
+namespace detail {
+
+constexpr size_t kChunksPerThread = 4;
+// Upper bound on the number of buckets which can be non-empty at the same time, delta is raised to keep it
+constexpr std::int64_t kMaxLiveBuckets = 1 << 16;
+
+// Meyer and Sanders: delta about max_weight / mean degree keeps the re-relaxed edges per bucket small
+inline std::int64_t DefaultDelta(CsrGraphView graph, int max_weight) {
+  const auto edges = static_cast<std::int64_t>(graph.NumEdges());
+  const auto vertices = static_cast<std::int64_t>(graph.NumVertices());
+  return std::max<std::int64_t>(1, edges == 0 ? 1 : static_cast<std::int64_t>(max_weight) * vertices / edges);
+}
+
+// Lowers dist to candidate, returns true if this call did it
+inline bool RelaxMin(int &dist, int candidate) {
+  std::atomic_ref<int> ref(dist);
+  int current = ref.load(std::memory_order_relaxed);
+  while (candidate < current && !ref.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {
+  }
+  return candidate < current;
+}
+
+}  // namespace detail
+
+// Parallel delta-stepping SSSP. Each round takes the lowest non-empty bucket as the frontier, splits it into
+// chunks and relaxes all edges of its vertices with an atomic min; improved vertices are appended to the chunk's
+// own buffer, so no locks are taken, and the buffers are moved into one ring of buckets over the window of live
+// distances after the round.
+template <class Backend = SeqBackend>
+void DeltaStepping(CsrGraphView graph, size_t source, std::span<int> dist, const Backend &backend = {},
+                   DeltaSteppingOptions options = {}) {
+  const size_t n = graph.NumVertices();
+  if (dist.size() != n || source >= n || options.delta < 0) {
+    throw std::invalid_argument("DeltaStepping: bad source vertex, distances size or delta");
+  }
+  std::ranges::fill(dist, kUnreachable);
+  dist[source] = 0;
+
+  const int max_weight = graph.weights.empty() ? 0 : *std::ranges::max_element(graph.weights);
+  std::int64_t delta = options.delta > 0 ? options.delta : detail::DefaultDelta(graph, max_weight);
+  delta = std::max(delta, (max_weight / detail::kMaxLiveBuckets) + 1);
+  // Relaxing bucket b only reaches buckets b..b + max_weight / delta
+  const auto ring = static_cast<size_t>((max_weight / delta) + 2);
+
+  const size_t threads = backend.Concurrency();
+  const size_t chunks = threads == 1 ? 1 : threads * detail::kChunksPerThread;
+  std::vector<std::vector<std::uint32_t>> buckets(ring);
+  // (ring slot, vertex) pairs found by every chunk in the current round
+  std::vector<std::vector<std::pair<std::uint32_t, std::uint32_t>>> improved(chunks);
+  std::vector<std::uint32_t> frontier = {static_cast<std::uint32_t>(source)};
+  const std::uint32_t *targets = graph.targets.data();
+  const int *weights = graph.weights.data();
+
+  for (std::int64_t bucket = 0;;) {
+    const size_t active = std::min(chunks, frontier.size());
+    backend.ForEachChunk(active, [&](size_t chunk) {
+      auto &local = improved[chunk];
+      const size_t first = frontier.size() * chunk / active;
+      const size_t last = frontier.size() * (chunk + 1) / active;
+      for (size_t i = first; i < last; i++) {
+        const std::uint32_t u = frontier[i];
+        const int du = std::atomic_ref<int>(dist[u]).load(std::memory_order_relaxed);
+        // Stale entry: u was improved into an earlier bucket and has been relaxed from there
+        if (du / delta < bucket) {
+          continue;
+        }
+        // Plain locals: the atomics would otherwise make the compiler reload the graph arrays on every edge
+        const int limit = kUnreachable - du;
+        const std::uint32_t end = graph.offsets[u + 1];
+        for (std::uint32_t e = graph.offsets[u]; e < end; e++) {
+          const int w = weights[e];
+          const std::uint32_t v = targets[e];
+          if (w < limit && detail::RelaxMin(dist[v], du + w)) {
+            local.emplace_back(static_cast<std::uint32_t>(static_cast<size_t>((du + w) / delta) % ring), v);
+          }
+        }
+      }
+    });
+    for (size_t chunk = 0; chunk < active; chunk++) {
+      for (const auto &[slot, v] : improved[chunk]) {
+        buckets[slot].push_back(v);
+      }
+      improved[chunk].clear();
+    }
+
+    // Lowest non-empty bucket in the window [bucket, bucket + ring)
+    std::int64_t next = -1;
+    for (std::int64_t b = bucket; b < bucket + static_cast<std::int64_t>(ring) && next < 0; b++) {
+      if (!buckets[static_cast<size_t>(b) % ring].empty()) {
+        next = b;
+      }
+    }
+    if (next < 0) {
+      break;
+    }
+    bucket = next;
+
+    // The bucket becomes the frontier, the old frontier's storage is reused by the emptied slot
+    frontier.clear();
+    frontier.swap(buckets[static_cast<size_t>(bucket) % ring]);
+  }
+}
+
+// Shortest paths from a batch of sources: row i of dist (NumVertices() values) gets the distances from
+// sources[i]. The queries run in parallel across sources on the shared graph, one serial Dijkstra each;
+// every chunk reuses its heap for all of its queries.
+template <class Backend = SeqBackend>
+void BatchedShortestPaths(CsrGraphView graph, std::span<const std::uint32_t> sources, std::span<int> dist,
+                          const Backend &backend = {}) {
+  const size_t n = graph.NumVertices();
+  if (dist.size() != sources.size() * n || std::ranges::any_of(sources, [n](std::uint32_t s) { return s >= n; })) {
+    throw std::invalid_argument("BatchedShortestPaths: bad source vertex or distances size");
+  }
+  const size_t threads = backend.Concurrency();
+  const size_t chunks = std::min(sources.size(), threads == 1 ? 1 : threads * detail::kChunksPerThread);
+  backend.ForEachChunk(chunks, [&](size_t chunk) {
+    DijkstraWorkspace workspace;
+    for (size_t i = sources.size() * chunk / chunks; i < sources.size() * (chunk + 1) / chunks; i++) {
+      Dijkstra(graph, sources[i], dist.subspan(i * n, n), workspace);
+    }
+  });
+}
+
+}  // namespace ppc::core::graph
@@ -0,0 +1,270 @@
+#include "core/graph/include/graph.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <ios>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define PPC_GRAPH_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr std::array<char, 8> kFileMagic = {'P', 'P', 'C', 'C', 'S', 'R', '\0', '\1'};
+
+struct FileHeader {
+  std::array<char, 8> magic;
+  std::uint64_t vertices;
+  std::uint64_t edges;
+};
+
+// Places the arrays of a graph file image, throws if the sizes do not match the header
+ppc::core::graph::CsrGraphView ParseGraphImage(const void *data, size_t size, const std::string &path) {
+  FileHeader header{};
+  if (size < sizeof(header)) {
+    throw std::runtime_error("graph file is too short: " + path);
+  }
+  std::memcpy(&header, data, sizeof(header));
+  const std::uint64_t expected =
+      sizeof(header) + ((header.vertices + 1 + header.edges) * sizeof(std::uint32_t)) + (header.edges * sizeof(int));
+  if (header.magic != kFileMagic || header.vertices >= size || header.edges >= size || expected != size) {
+    throw std::runtime_error("not a graph file or truncated: " + path);
+  }
+  const auto *offsets = reinterpret_cast<const std::uint32_t *>(static_cast<const char *>(data) + sizeof(header));
+  const std::uint32_t *targets = offsets + header.vertices + 1;
+  const auto *weights = reinterpret_cast<const int *>(targets + header.edges);
+  return {.offsets = {offsets, header.vertices + 1},
+          .targets = {targets, header.edges},
+          .weights = {weights, header.edges}};
+}
+
+}  // namespace
+
+bool ppc::core::graph::IsValidGraph(CsrGraphView graph) {
+  const size_t n = graph.NumVertices();
+  if (graph.offsets.empty() || graph.offsets.front() != 0 || graph.offsets.back() != graph.NumEdges() ||
+      graph.weights.size() != graph.NumEdges()) {
+    return false;
+  }
+  return std::ranges::is_sorted(graph.offsets) &&
+         std::ranges::all_of(graph.targets, [n](std::uint32_t v) { return v < n; }) &&
+         std::ranges::all_of(graph.weights, [](int w) { return w >= 0; });
+}
+
+bool ppc::core::graph::HasCsrInputs(const TaskData &task_data, size_t first) {
+  const auto has_type = [&](size_t i, const std::type_info &type) {
+    return i < task_data.inputs_info.size() && task_data.inputs_info[i].element_type != nullptr &&
+           *task_data.inputs_info[i].element_type == type;
+  };
+  return has_type(first, typeid(std::uint32_t)) && has_type(first + 1, typeid(std::uint32_t)) &&
+         has_type(first + 2, typeid(int));
+}
+
+ppc::core::graph::CsrGraphView ppc::core::graph::CsrInputs(const TaskData &task_data, size_t first) {
+  return {.offsets = task_data.Input<const std::uint32_t>(first),
+          .targets = task_data.Input<const std::uint32_t>(first + 1),
+          .weights = task_data.Input<const int>(first + 2)};
+}
+
+size_t ppc::core::graph::GraphInputsCount(const TaskData &task_data) {
+  return HasCsrInputs(task_data) ? kCsrInputsCount : 1;
+}
+
+std::vector<std::uint32_t> ppc::core::graph::TaskSources(const TaskData &task_data, size_t input) {
+  if (input >= task_data.inputs.size()) {
+    return {0};
+  }
+  // Checked before the null test: an empty batch has no buffer and must stay empty
+  if (input < task_data.inputs_info.size() && task_data.inputs_info[input].element_type != nullptr &&
+      *task_data.inputs_info[input].element_type == typeid(std::uint32_t)) {
+    const auto sources = task_data.Input<const std::uint32_t>(input);
+    return {sources.begin(), sources.end()};
+  }
+  if (task_data.inputs[input] == nullptr) {
+    return {0};
+  }
+  return {static_cast<std::uint32_t>(*reinterpret_cast<const int *>(task_data.inputs[input]))};
+}
+
+bool ppc::core::graph::ValidTaskSources(const TaskData &task_data, size_t input) {
+  if (task_data.outputs_count.empty()) {
+    return false;
+  }
+  const auto sources = TaskSources(task_data, input);
+  if (sources.empty() || task_data.outputs_count[0] % sources.size() != 0) {
+    return false;
+  }
+  const size_t num_vertices = task_data.outputs_count[0] / sources.size();
+  return std::ranges::all_of(sources, [num_vertices](std::uint32_t s) { return s < num_vertices; });
+}
+
+bool ppc::core::graph::TaskGraph::Load(const TaskData &task_data, size_t num_vertices, ParseMode mode) {
+  if (HasCsrInputs(task_data)) {
+    view_ = CsrInputs(task_data);
+    next_input_ = kCsrInputsCount;
+    return view_.NumVertices() == num_vertices && IsValidGraph(view_);
+  }
+  const bool valid = ParseAdjacencyList(task_data.Input<const int>(0), num_vertices, storage_, mode);
+  view_ = storage_.View();
+  next_input_ = 1;
+  return valid;
+}
+
+void ppc::core::graph::WriteGraphFile(const std::string &path, CsrGraphView graph) {
+  if (graph.offsets.empty() || graph.weights.size() != graph.NumEdges()) {
+    throw std::invalid_argument("WriteGraphFile: inconsistent graph");
+  }
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  const FileHeader header{.magic = kFileMagic, .vertices = graph.NumVertices(), .edges = graph.NumEdges()};
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char *>(graph.offsets.data()),
+            static_cast<std::streamsize>(graph.offsets.size_bytes()));
+  out.write(reinterpret_cast<const char *>(graph.targets.data()),
+            static_cast<std::streamsize>(graph.targets.size_bytes()));
+  out.write(reinterpret_cast<const char *>(graph.weights.data()),
+            static_cast<std::streamsize>(graph.weights.size_bytes()));
+  if (!out) {
+    throw std::runtime_error("can't write graph file: " + path);
+  }
+}
+
+ppc::core::graph::MappedGraphFile::MappedGraphFile(const std::string &path) {
+#ifdef PPC_GRAPH_MMAP
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("can't open graph file: " + path);
+  }
+  struct stat st{};
+  if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+    close(fd);
+    throw std::runtime_error("can't read graph file: " + path);
+  }
+  size_ = static_cast<size_t>(st.st_size);
+  void *data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    throw std::runtime_error("can't map graph file: " + path);
+  }
+  data_ = data;
+  try {
+    view_ = ParseGraphImage(data_, size_, path);
+  } catch (...) {
+    munmap(data_, size_);
+    throw;
+  }
+#else
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  if (!in) {
+    throw std::runtime_error("can't open graph file: " + path);
+  }
+  size_ = static_cast<size_t>(in.tellg());
+  buffer_.resize((size_ + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+  in.seekg(0);
+  in.read(reinterpret_cast<char *>(buffer_.data()), static_cast<std::streamsize>(size_));
+  view_ = ParseGraphImage(buffer_.data(), size_, path);
+#endif
+}
+
+ppc::core::graph::MappedGraphFile::~MappedGraphFile() {
+#ifdef PPC_GRAPH_MMAP
+  if (data_ != nullptr) {
+    munmap(data_, size_);
+  }
+#endif
+}
+
+bool ppc::core::graph::ParseAdjacencyList(std::span<const int> data, size_t num_vertices, CsrGraph &graph,
+                                           ParseMode mode) {
+  graph.offsets.assign(1, 0);
+  graph.offsets.reserve(num_vertices + 1);
+  graph.targets.clear();
+  graph.weights.clear();
+  graph.targets.reserve(data.size() / 2);
+  graph.weights.reserve(data.size() / 2);
+
+  size_t i = 0;
+  while (i < data.size() && graph.NumVertices() < num_vertices) {
+    if (data[i] == -1) {
+      graph.offsets.push_back(static_cast<std::uint32_t>(graph.targets.size()));
+      i++;
+      continue;
+    }
+    if (i + 1 >= data.size()) {
+      break;
+    }
+    const auto dest = static_cast<size_t>(data[i]);
+    const int weight = data[i + 1];
+    if (weight < 0) {
+      return false;
+    }
+    if (dest >= num_vertices && mode == ParseMode::kStrict) {
+      return false;
+    }
+    if (dest < num_vertices) {
+      graph.targets.push_back(static_cast<std::uint32_t>(dest));
+      graph.weights.push_back(weight);
+    }
+    i += 2;
+  }
+  if (i < data.size() && mode == ParseMode::kStrict) {
+    return false;
+  }
+  // The edges after the last terminator belong to the next vertex, the rest of the vertices have none
+  while (graph.NumVertices() < num_vertices) {
+    graph.offsets.push_back(static_cast<std::uint32_t>(graph.targets.size()));
+  }
+  return true;
+}
+
+void ppc::core::graph::Dijkstra(CsrGraphView graph, size_t source, std::span<int> dist) {
+  DijkstraWorkspace workspace;
+  Dijkstra(graph, source, dist, workspace);
+}
+
+void ppc::core::graph::Dijkstra(CsrGraphView graph, size_t source, std::span<int> dist, DijkstraWorkspace &workspace) {
+  if (dist.size() != graph.NumVertices() || source >= graph.NumVertices()) {
+    throw std::invalid_argument("Dijkstra: bad source vertex or distances size");
+  }
+  std::ranges::fill(dist, kUnreachable);
+  dist[source] = 0;
+
+  // Min-heap on the workspace vector, so its storage survives between the queries
+  auto &heap = workspace.heap;
+  const std::greater<> later;
+  heap.clear();
+  heap.emplace_back(0, static_cast<std::uint32_t>(source));
+  while (!heap.empty()) {
+    std::ranges::pop_heap(heap, later);
+    const auto [d, u] = heap.back();
+    heap.pop_back();
+    if (d != dist[u]) {
+      continue;
+    }
+    for (std::uint32_t e = graph.offsets[u]; e < graph.offsets[u + 1]; e++) {
+      const auto candidate = static_cast<std::int64_t>(d) + graph.weights[e];
+      const std::uint32_t v = graph.targets[e];
+      if (candidate < dist[v]) {
+        dist[v] = static_cast<int>(candidate);
+        heap.emplace_back(dist[v], v);
+        std::ranges::push_heap(heap, later);
+      }
+    }
+  }
+}
@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "core/hull/include/hull.hpp"
+
+namespace hull = ppc::core::hull;
+
+namespace {
+
+struct IntPoint {
+  int x = 0;
+  int y = 0;
+
+  bool operator==(const IntPoint &) const = default;
+};
+
+struct DoublePoint {
+  double x = 0.0;
+  double y = 0.0;
+
+  bool operator==(const DoublePoint &) const = default;
+};
+
+// Gift wrapping in 64-bit integers: counterclockwise from the lowest point, the farthest point on collinear rays
+std::vector<IntPoint> ReferenceHull(const std::vector<IntPoint> &points) {
+  if (points.empty()) {
+    return {};
+  }
+  const auto start = *std::ranges::min_element(points, hull::BottomLeftLess{});
+  std::vector<IntPoint> res = {start};
+  auto current = start;
+  while (true) {
+    auto next = current;
+    for (const auto &p : points) {
+      const std::int64_t cross = ((static_cast<std::int64_t>(next.x) - current.x) * (p.y - current.y)) -
+                                 ((static_cast<std::int64_t>(next.y) - current.y) * (p.x - current.x));
+      if (next == current || cross < 0 ||
+          (cross == 0 && hull::SquaredDistance(current, p) > hull::SquaredDistance(current, next))) {
+        next = p;
+      }
+    }
+    if (next == start || next == current) {
+      return res;
+    }
+    res.push_back(next);
+    current = next;
+  }
+}
+
+template <class P, class Backend>
+std::vector<P> GrahamHull(const std::vector<P> &points, const Backend &backend) {
+  auto candidates = hull::AklToussaintFilter<P>(points, backend);
+  if (candidates.empty()) {
+    return {};
+  }
+  const auto pivot = *std::ranges::min_element(candidates, hull::BottomLeftLess{});
+  hull::SortByAngle(candidates, pivot, backend);
+  return hull::GrahamScan<P>(candidates, pivot);
+}
+
+std::vector<IntPoint> RandomPoints(size_t n, int range, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> coordinate(-range, range);
+  std::vector<IntPoint> points(n);
+  for (auto &p : points) {
+    p = {.x = coordinate(gen), .y = coordinate(gen)};
+  }
+  return points;
+}
+
+}  // namespace
+
+TEST(hull_tests, orientation_and_angle_order) {
+  const IntPoint o{.x = 0, .y = 0};
+  EXPECT_EQ(hull::Orientation(o, IntPoint{.x = 1, .y = 0}, IntPoint{.x = 0, .y = 1}), 1);
+  EXPECT_EQ(hull::Orientation(o, IntPoint{.x = 0, .y = 1}, IntPoint{.x = 1, .y = 0}), -1);
+  EXPECT_EQ(hull::Orientation(o, IntPoint{.x = 2, .y = 2}, IntPoint{.x = 5, .y = 5}), 0);
+  // 46341^2 overflows 32 bits
+  EXPECT_EQ(hull::Orientation(o, IntPoint{.x = 46341, .y = 46340}, IntPoint{.x = 46342, .y = 46341}), 1);
+
+  // Off the line by one unit in the last place: within the rounding error of the determinant
+  const DoublePoint a{.x = 0.1, .y = 0.1};
+  const DoublePoint b{.x = 0.3, .y = std::nextafter(0.3, 1.0)};
+  EXPECT_EQ(hull::Orientation(DoublePoint{}, a, b), 0);
+  EXPECT_EQ(hull::Orientation(DoublePoint{}, a, DoublePoint{.x = 0.3, .y = 0.3001}), 1);
+
+  const hull::AngleLess<IntPoint> less{.pivot = o};
+  EXPECT_TRUE(less({.x = 5, .y = 1}, {.x = 1, .y = 5}));
+  EXPECT_TRUE(less({.x = 1, .y = 1}, {.x = 2, .y = 2}));
+  EXPECT_FALSE(less({.x = 2, .y = 2}, {.x = 1, .y = 1}));
+  EXPECT_TRUE(less({.x = 1, .y = 1}, {.x = -1, .y = 0}));
+}
+
+TEST(hull_tests, hulls_match_gift_wrapping) {
+  std::vector<std::vector<IntPoint>> sets = {
+      {},
+      {{.x = 3, .y = 4}},
+      {{.x = 3, .y = 4}, {.x = 3, .y = 4}, {.x = 1, .y = 7}},
+      {{.x = 0, .y = 0}, {.x = 1, .y = 1}, {.x = 2, .y = 2}, {.x = -3, .y = -3}},
+      {{.x = 0, .y = 4}, {.x = 1, .y = 3}, {.x = 2, .y = 2}, {.x = 3, .y = 1}},
+      RandomPoints(3000, 10, 1),
+      RandomPoints(5000, 1000000, 2),
+      RandomPoints(100000, 1000, 3),
+  };
+  // Lattice points of a disk: long collinear runs on the hull edges
+  std::vector<IntPoint> disk;
+  for (int x = -150; x <= 150; x++) {
+    for (int y = -150; y <= 150; y++) {
+      if ((x * x) + (y * y) <= 150 * 150) {
+        disk.push_back({.x = x, .y = y});
+      }
+    }
+  }
+  std::ranges::shuffle(disk, std::mt19937(4));
+  sets.push_back(disk);
+
+  for (const auto &points : sets) {
+    const auto expected = ReferenceHull(points);
+    EXPECT_EQ(hull::ConvexHull<IntPoint>(points), expected) << points.size() << " points";
+    EXPECT_EQ(hull::ConvexHull<IntPoint>(points, hull::StlBackend{}), expected) << points.size() << " points";
+    EXPECT_EQ(GrahamHull(points, hull::SeqBackend{}), expected) << points.size() << " points";
+    EXPECT_EQ(GrahamHull(points, hull::StlBackend{}), expected) << points.size() << " points";
+  }
+}
+
+TEST(hull_tests, boundary_keeps_points_on_edges) {
+  std::vector<IntPoint> lattice;
+  for (int x = -40; x <= 40; x++) {
+    for (int y = -40; y <= 40; y++) {
+      if ((x * x) + (2 * y * y) <= 40 * 40) {
+        lattice.push_back({.x = x, .y = y});
+      }
+    }
+  }
+  std::ranges::shuffle(lattice, std::mt19937(6));
+  // Every point on the boundary: the chunk hulls are merged with their collinear runs
+  std::vector<IntPoint> perimeter;
+  for (int i = 0; i < 20000; i++) {
+    perimeter.insert(perimeter.end(), {{.x = i, .y = 0}, {.x = 20000, .y = i}, {.x = 20000 - i, .y = 20000},
+                                       {.x = 0, .y = 20000 - i}});
+  }
+  std::ranges::shuffle(perimeter, std::mt19937(7));
+
+  for (const auto &points : {lattice, perimeter, RandomPoints(100000, 300, 8)}) {
+    const auto vertices = hull::ConvexHull<IntPoint>(points);
+    std::vector<IntPoint> expected;
+    for (const auto &p : points) {
+      bool inside = true;
+      for (size_t i = 0; i < vertices.size(); i++) {
+        inside = inside && hull::Orientation(vertices[i], vertices[(i + 1) % vertices.size()], p) > 0;
+      }
+      if (!inside) {
+        expected.push_back(p);
+      }
+    }
+    std::ranges::sort(expected, hull::LeftBottomLess{});
+    expected.erase(std::ranges::unique(expected).begin(), expected.end());
+
+    for (const auto &boundary : {hull::ConvexHull<IntPoint>(points, hull::SeqBackend{}, hull::HullPoints::kBoundary),
+                                 hull::ConvexHull<IntPoint>(points, hull::StlBackend{}, hull::HullPoints::kBoundary)}) {
+      auto sorted = boundary;
+      std::ranges::sort(sorted, hull::LeftBottomLess{});
+      EXPECT_EQ(sorted, expected);
+      EXPECT_EQ(boundary.front(), vertices.front());
+      for (size_t i = 0; i < boundary.size(); i++) {
+        const auto &next = boundary[(i + 1) % boundary.size()];
+        EXPECT_GE(hull::Orientation(boundary[i], next, boundary[(i + 2) % boundary.size()]), 0);
+      }
+    }
+  }
+
+  const std::vector<IntPoint> line = {{.x = 3, .y = 1}, {.x = 0, .y = 4}, {.x = 2, .y = 2}, {.x = 3, .y = 1}};
+  const std::vector<IntPoint> along = {{.x = 3, .y = 1}, {.x = 2, .y = 2}, {.x = 0, .y = 4}};
+  EXPECT_EQ(hull::ConvexHull<IntPoint>(line, hull::SeqBackend{}, hull::HullPoints::kBoundary), along);
+  EXPECT_TRUE(hull::Collinear<IntPoint>(line));
+  EXPECT_FALSE(hull::Collinear<IntPoint>(lattice));
+}
+
+TEST(hull_tests, orient_hull_changes_start_and_direction) {
+  const std::vector<IntPoint> square = {{.x = 0, .y = 0}, {.x = 2, .y = 0}, {.x = 2, .y = 2}, {.x = 0, .y = 2}};
+  const auto top_left = [](const IntPoint &a, const IntPoint &b) { return a.x < b.x || (a.x == b.x && a.y > b.y); };
+  const std::vector<IntPoint> clockwise = {{.x = 0, .y = 2}, {.x = 2, .y = 2}, {.x = 2, .y = 0}, {.x = 0, .y = 0}};
+  EXPECT_EQ(hull::OrientHull(square, top_left, hull::Winding::kClockwise), clockwise);
+  const std::vector<IntPoint> counterclockwise = {
+      {.x = 0, .y = 2}, {.x = 0, .y = 0}, {.x = 2, .y = 0}, {.x = 2, .y = 2}};
+  EXPECT_EQ(hull::OrientHull(square, top_left, hull::Winding::kCounterclockwise), counterclockwise);
+
+  const std::vector<IntPoint> line = {{.x = 0, .y = 2}, {.x = 0, .y = 3}, {.x = 0, .y = 4}};
+  const std::vector<IntPoint> down = {{.x = 0, .y = 4}, {.x = 0, .y = 3}, {.x = 0, .y = 2}};
+  EXPECT_EQ(hull::OrientHull(line, top_left, hull::Winding::kClockwise), down);
+  EXPECT_EQ(hull::OrientHull(line, hull::LeftBottomLess{}, hull::Winding::kClockwise), line);
+}
+
+TEST(hull_tests, filter_keeps_hull_vertices_in_input_order) {
+  std::mt19937 gen(5);
+  std::uniform_real_distribution<double> coordinate(-1.0, 1.0);
+  std::vector<DoublePoint> points(200000);
+  for (auto &p : points) {
+    p = {.x = coordinate(gen), .y = coordinate(gen)};
+  }
+  const auto kept = hull::AklToussaintFilter<DoublePoint>(points, hull::StlBackend{});
+  // The octagon of a square covers most of it
+  EXPECT_LT(kept.size() * 5, points.size());
+  auto it = points.begin();
+  for (const auto &p : kept) {
+    it = std::find(it, points.end(), p);
+    ASSERT_NE(it, points.end());
+  }
+  std::vector<DoublePoint> sorted = points;
+  std::ranges::sort(sorted, hull::LeftBottomLess{});
+  for (const auto &vertex : hull::MonotoneChain<DoublePoint>(sorted)) {
+    EXPECT_NE(std::ranges::find(kept, vertex), kept.end());
+  }
+}
+
+TEST(hull_tests, parallel_angle_sort_matches_std_sort) {
+  auto points = RandomPoints(100000, 100, 6);
+  const auto pivot = *std::ranges::min_element(points, hull::BottomLeftLess{});
+  auto expected = points;
+  std::ranges::sort(expected, hull::AngleLess<IntPoint>{.pivot = pivot});
+  hull::SortByAngle(points, pivot, hull::StlBackend{});
+  EXPECT_EQ(points, expected);
+}
+
+// Random points and shuffled points of a circle on integers up to 2^24 held in doubles: every orientation is exact,
+// so all kernels return the same hull. The throughput on large sets is in the perf tests
+TEST(hull_tests, double_hulls_match_on_random_and_circle) {
+  const size_t n = 20000;
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<std::int32_t> coordinate(-(1 << 24), 1 << 24);
+  std::vector<DoublePoint> random(n);
+  for (auto &p : random) {
+    p = {.x = static_cast<double>(coordinate(gen)), .y = static_cast<double>(coordinate(gen))};
+  }
+  std::vector<DoublePoint> circle(n);
+  for (size_t i = 0; i < n; i++) {
+    const double angle = 2.0 * std::numbers::pi * static_cast<double>(i) / static_cast<double>(n);
+    circle[i] = {.x = std::round(std::cos(angle) * (1 << 24)), .y = std::round(std::sin(angle) * (1 << 24))};
+  }
+  std::ranges::shuffle(circle, gen);
+
+  for (const auto *points : {&random, &circle}) {
+    const auto seq = hull::ConvexHull<DoublePoint>(*points);
+    EXPECT_EQ(hull::ConvexHull<DoublePoint>(*points, hull::StlBackend{}), seq);
+    EXPECT_EQ(GrahamHull(*points, hull::SeqBackend{}), seq);
+    EXPECT_EQ(GrahamHull(*points, hull::StlBackend{}), seq);
+  }
+}
@@ -0,0 +1,388 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/merge/include/multiway_merge.hpp"
+#include "core/sparse/include/sparse.hpp"
+
+// Convex hulls of planar point sets with parallel kernels. A point is any type with x and y members, integer or
+// floating point. Hulls are counterclockwise from the lowest point (least y, then least x) and have no collinear
+// or repeated vertices unless the points on the edges are asked for; OrientHull gives other orders. Kernels take a
+// backend like the sparse module: SeqBackend and StlBackend, or OmpBackend and TbbBackend from
+// core/sparse/include/sparse_omp.hpp and sparse_tbb.hpp.
+namespace ppc::core::hull {
+
+using sparse::SeqBackend;
+using sparse::StlBackend;
+
+// Points of the boundary a hull keeps: its vertices, or every input point on it
+enum class HullPoints : std::uint8_t { kVertices, kBoundary };
+
+enum class Winding : std::uint8_t { kCounterclockwise, kClockwise };
+
+template <class P>
+concept PlanarPoint = std::default_initializable<P> && std::copyable<P> && requires(const P &p) {
+  requires std::is_arithmetic_v<std::remove_cvref_t<decltype(p.x)>>;
+  requires std::is_arithmetic_v<std::remove_cvref_t<decltype(p.y)>>;
+};
+
+namespace detail {
+
+// Orientation tests run in 64-bit integers for integer coordinates and in double otherwise
+template <class P>
+using Wide = std::conditional_t<std::is_integral_v<std::remove_cvref_t<decltype(std::declval<P>().x)>>, std::int64_t,
+                                double>;
+
+// Relative error bound of the double determinant of Orientation (Shewchuk's orient2d filter)
+constexpr double kOrientErrorBound = 3.3306690738754716e-16;
+
+// Points per chunk below which kernels do not split their input
+constexpr size_t kGrain = 1 << 14;
+
+template <class Backend>
+size_t ChunkCount(const Backend &backend, size_t size) {
+  return std::max<size_t>(std::min(size / kGrain, backend.Concurrency() * 4), 1);
+}
+
+inline size_t ChunkBegin(size_t size, size_t chunks, size_t chunk) { return size * chunk / chunks; }
+
+}  // namespace detail
+
+template <PlanarPoint P>
+bool SamePoint(const P &a, const P &b) {
+  return a.x == b.x && a.y == b.y;
+}
+
+// Least y, then least x: the first vertex of every hull
+struct BottomLeftLess {
+  template <PlanarPoint P>
+  bool operator()(const P &a, const P &b) const {
+    return a.y < b.y || (a.y == b.y && a.x < b.x);
+  }
+};
+
+// Least x, then least y: the order of the monotone chain
+struct LeftBottomLess {
+  template <PlanarPoint P>
+  bool operator()(const P &a, const P &b) const {
+    return a.x < b.x || (a.x == b.x && a.y < b.y);
+  }
+};
+
+// Sign of the turn o -> a -> b: 1 counterclockwise, -1 clockwise, 0 collinear. Exact for integer coordinates
+// within +-2^30; for floating point ones turns within the rounding error of the determinant count as collinear.
+template <PlanarPoint P>
+int Orientation(const P &o, const P &a, const P &b) {
+  using W = detail::Wide<P>;
+  const W left = (static_cast<W>(a.x) - static_cast<W>(o.x)) * (static_cast<W>(b.y) - static_cast<W>(o.y));
+  const W right = (static_cast<W>(a.y) - static_cast<W>(o.y)) * (static_cast<W>(b.x) - static_cast<W>(o.x));
+  if constexpr (std::is_floating_point_v<W>) {
+    const W bound = detail::kOrientErrorBound * (std::abs(left) + std::abs(right));
+    if (left - right > bound) {
+      return 1;
+    }
+    return right - left > bound ? -1 : 0;
+  } else {
+    return static_cast<int>(left > right) - static_cast<int>(left < right);
+  }
+}
+
+// Whether no three points make a turn: all of them are the same or lie on one line
+template <PlanarPoint P>
+bool Collinear(std::span<const P> points) {
+  const auto other = std::ranges::find_if(points, [&points](const P &p) { return !SamePoint(p, points.front()); });
+  if (other == points.end()) {
+    return true;
+  }
+  return std::all_of(other + 1, points.end(),
+                     [&](const P &p) { return Orientation(points.front(), *other, p) == 0; });
+}
+
+template <PlanarPoint P>
+detail::Wide<P> SquaredDistance(const P &a, const P &b) {
+  using W = detail::Wide<P>;
+  const W dx = static_cast<W>(a.x) - static_cast<W>(b.x);
+  const W dy = static_cast<W>(a.y) - static_cast<W>(b.y);
+  return (dx * dx) + (dy * dy);
+}
+
+// Polar angle order around pivot by the sign of cross products, nearer points first on a ray. It is a strict
+// weak order on points which are not below pivot nor left of it on its line, so pivot must be the lowest point.
+template <PlanarPoint P>
+struct AngleLess {
+  P pivot;
+
+  bool operator()(const P &a, const P &b) const {
+    const int turn = Orientation(pivot, a, b);
+    if (turn != 0) {
+      return turn > 0;
+    }
+    return SquaredDistance(pivot, a) < SquaredDistance(pivot, b);
+  }
+};
+
+// Hull of points sorted by LeftBottomLess with Andrew's monotone chain, counterclockwise from the first point.
+// A boundary of points on one line is all of them in their order.
+template <PlanarPoint P>
+std::vector<P> MonotoneChain(std::span<const P> sorted, HullPoints kept = HullPoints::kVertices) {
+  std::vector<P> points(sorted.begin(), sorted.end());
+  points.erase(std::ranges::unique(points, SamePoint<P>).begin(), points.end());
+  if (points.size() < 3 || (kept == HullPoints::kBoundary && Collinear<P>(points))) {
+    return points;
+  }
+  // Collinear turns drop the middle point unless the whole boundary is kept
+  const int min_turn = kept == HullPoints::kBoundary ? 0 : 1;
+  std::vector<P> hull(2 * points.size());
+  size_t k = 0;
+  for (const auto &p : points) {
+    while (k >= 2 && Orientation(hull[k - 2], hull[k - 1], p) < min_turn) {
+      k--;
+    }
+    hull[k++] = p;
+  }
+  const size_t lower = k + 1;
+  for (size_t i = points.size() - 1; i-- > 0;) {
+    while (k >= lower && Orientation(hull[k - 2], hull[k - 1], points[i]) < min_turn) {
+      k--;
+    }
+    hull[k++] = points[i];
+  }
+  hull.resize(k - 1);
+  return hull;
+}
+
+// Graham scan over points sorted by AngleLess{pivot}, pivot being the lowest point. Copies of pivot are skipped.
+template <PlanarPoint P>
+std::vector<P> GrahamScan(std::span<const P> sorted, const P &pivot) {
+  std::vector<P> hull = {pivot};
+  for (const auto &p : sorted) {
+    if (SamePoint(p, pivot)) {
+      continue;
+    }
+    while (hull.size() >= 2 && Orientation(hull[hull.size() - 2], hull.back(), p) <= 0) {
+      hull.pop_back();
+    }
+    hull.push_back(p);
+  }
+  return hull;
+}
+
+// Points which are not strictly inside the polygon of the extreme points in eight directions (Akl-Toussaint).
+// No hull vertex is dropped; uniformly random points mostly lie inside, points on a circle all stay.
+// The survivors keep their input order.
+template <PlanarPoint P, class Backend = SeqBackend>
+std::vector<P> AklToussaintFilter(std::span<const P> points, const Backend &backend = {}) {
+  using W = detail::Wide<P>;
+  // Extremes along (0, -1), (1, -1), (1, 0), (1, 1), (0, 1), (-1, 1), (-1, 0), (-1, -1)
+  constexpr std::array<std::pair<int, int>, 8> kDirections = {
+      {{0, -1}, {1, -1}, {1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}}};
+  const auto key = [](const P &p, std::pair<int, int> d) {
+    return (static_cast<W>(d.first) * static_cast<W>(p.x)) + (static_cast<W>(d.second) * static_cast<W>(p.y));
+  };
+  const size_t n = points.size();
+  if (n < 3) {
+    return {points.begin(), points.end()};
+  }
+  const size_t chunks = detail::ChunkCount(backend, n);
+
+  std::vector<std::array<size_t, 8>> extremes(chunks);
+  backend.ForEachChunk(chunks, [&](size_t chunk) {
+    const size_t first = detail::ChunkBegin(n, chunks, chunk);
+    const size_t last = detail::ChunkBegin(n, chunks, chunk + 1);
+    auto &best = extremes[chunk];
+    best.fill(first);
+    std::array<W, 8> best_key{};
+    for (size_t d = 0; d < kDirections.size(); d++) {
+      best_key[d] = key(points[first], kDirections[d]);
+    }
+    for (size_t i = first + 1; i < last; i++) {
+      for (size_t d = 0; d < kDirections.size(); d++) {
+        const W value = key(points[i], kDirections[d]);
+        if (value > best_key[d]) {
+          best_key[d] = value;
+          best[d] = i;
+        }
+      }
+    }
+  });
+  std::array<P, 8> corners;
+  for (size_t d = 0; d < kDirections.size(); d++) {
+    size_t best = extremes[0][d];
+    for (const auto &chunk_best : extremes) {
+      if (key(points[chunk_best[d]], kDirections[d]) > key(points[best], kDirections[d])) {
+        best = chunk_best[d];
+      }
+    }
+    corners[d] = points[best];
+  }
+  std::vector<P> sorted_corners(corners.begin(), corners.end());
+  std::ranges::sort(sorted_corners, LeftBottomLess{});
+  const auto polygon = MonotoneChain<P>(sorted_corners);
+  if (polygon.size() < 3) {
+    return {points.begin(), points.end()};
+  }
+  std::vector<std::pair<P, P>> edges;
+  for (size_t i = 0; i < polygon.size(); i++) {
+    edges.emplace_back(polygon[i], polygon[(i + 1) % polygon.size()]);
+  }
+
+  // Box between the extremes of the left and right, bottom and top directions: when its corners are in the
+  // polygon, points inside it are inside without the edge tests
+  const auto left = std::max({corners[5].x, corners[6].x, corners[7].x});
+  const auto right = std::min({corners[1].x, corners[2].x, corners[3].x});
+  const auto bottom = std::max({corners[7].y, corners[0].y, corners[1].y});
+  const auto top = std::min({corners[3].y, corners[4].y, corners[5].y});
+  const auto in_polygon = [&edges](decltype(left) x, decltype(bottom) y) {
+    P p;
+    p.x = x;
+    p.y = y;
+    return std::ranges::all_of(edges, [&p](const auto &edge) { return Orientation(edge.first, edge.second, p) >= 0; });
+  };
+  const bool use_box = left < right && bottom < top && in_polygon(left, bottom) && in_polygon(right, bottom) &&
+                       in_polygon(right, top) && in_polygon(left, top);
+  const auto inside = [&](const P &p) {
+    if (use_box && p.x > left && p.x < right && p.y > bottom && p.y < top) {
+      return true;
+    }
+    for (const auto &[a, b] : edges) {
+      if (Orientation(a, b, p) <= 0) {
+        return false;
+      }
+    }
+    return true;
+  };
+  std::vector<std::vector<P>> kept(chunks);
+  backend.ForEachChunk(chunks, [&](size_t chunk) {
+    const size_t last = detail::ChunkBegin(n, chunks, chunk + 1);
+    for (size_t i = detail::ChunkBegin(n, chunks, chunk); i < last; i++) {
+      if (!inside(points[i])) {
+        kept[chunk].push_back(points[i]);
+      }
+    }
+  });
+  std::vector<size_t> offsets(chunks + 1, 0);
+  for (size_t chunk = 0; chunk < chunks; chunk++) {
+    offsets[chunk + 1] = offsets[chunk] + kept[chunk].size();
+  }
+  std::vector<P> res(offsets.back());
+  backend.ForEachChunk(chunks, [&](size_t chunk) {
+    std::ranges::copy(kept[chunk], res.begin() + static_cast<std::ptrdiff_t>(offsets[chunk]));
+  });
+  return res;
+}
+
+// Sorts points by AngleLess{pivot}: chunks are sorted independently, then merged by the k-way merge engine with
+// every chunk of the output merged in parallel
+template <PlanarPoint P, class Backend = SeqBackend>
+void SortByAngle(std::vector<P> &points, const P &pivot, const Backend &backend = {}) {
+  const AngleLess<P> less{.pivot = pivot};
+  const size_t n = points.size();
+  const size_t chunks = detail::ChunkCount(backend, n);
+  if (chunks == 1) {
+    std::ranges::sort(points, less);
+    return;
+  }
+  std::vector<size_t> bounds(chunks + 1);
+  for (size_t chunk = 0; chunk <= chunks; chunk++) {
+    bounds[chunk] = detail::ChunkBegin(n, chunks, chunk);
+  }
+  backend.ForEachChunk(chunks, [&](size_t chunk) {
+    std::sort(points.begin() + static_cast<std::ptrdiff_t>(bounds[chunk]),
+              points.begin() + static_cast<std::ptrdiff_t>(bounds[chunk + 1]), less);
+  });
+  const auto runs = MakeRuns<P>(points, bounds);
+  std::vector<P> merged(n);
+  backend.ForEachChunk(chunks, [&](size_t part) {
+    MultiwayMergePart<P>(runs, merged, part, chunks, less);
+  });
+  points.swap(merged);
+}
+
+// Convex hull by divide and conquer: the Akl-Toussaint filter drops interior points, every chunk of the survivors
+// gets its monotone chain hull, and the chunk hulls are merged pairwise, all merges of a round in parallel.
+// The vertices of a hull are sorted by LeftBottomLess in linear time, so a merge is a linear merge of two sorted
+// lists followed by a linear monotone chain. With HullPoints::kBoundary the points on the edges stay, and points
+// on one line are all returned along it from the lowest one.
+template <PlanarPoint P, class Backend = SeqBackend>
+std::vector<P> ConvexHull(std::span<const P> points, const Backend &backend = {},
+                          HullPoints kept = HullPoints::kVertices) {
+  auto candidates = AklToussaintFilter(points, backend);
+  const size_t n = candidates.size();
+  const size_t chunks = detail::ChunkCount(backend, n);
+
+  // Vertices of a counterclockwise hull from its leftmost point: the lower chain rises up to the rightmost
+  // vertex, the upper chain falls back
+  const auto sorted_vertices = [](const std::vector<P> &hull) {
+    if (hull.size() < 3) {
+      return hull;
+    }
+    const auto right = std::ranges::max_element(hull, LeftBottomLess{});
+    std::vector<P> res(hull.size());
+    std::merge(hull.begin(), right + 1, hull.rbegin(), std::make_reverse_iterator(right + 1), res.begin(),
+               LeftBottomLess{});
+    return res;
+  };
+  std::vector<std::vector<P>> hulls(chunks);
+  backend.ForEachChunk(chunks, [&](size_t chunk) {
+    const auto first = candidates.begin() + static_cast<std::ptrdiff_t>(detail::ChunkBegin(n, chunks, chunk));
+    const auto last = candidates.begin() + static_cast<std::ptrdiff_t>(detail::ChunkBegin(n, chunks, chunk + 1));
+    std::sort(first, last, LeftBottomLess{});
+    hulls[chunk] = MonotoneChain<P>(std::span<const P>(first, last), kept);
+  });
+  for (size_t step = 1; step < chunks; step *= 2) {
+    backend.ForEachChunk((chunks + (2 * step) - 1) / (2 * step), [&](size_t pair) {
+      const size_t left = pair * 2 * step;
+      const size_t right = left + step;
+      if (right >= chunks) {
+        return;
+      }
+      const auto left_vertices = sorted_vertices(hulls[left]);
+      const auto right_vertices = sorted_vertices(hulls[right]);
+      std::vector<P> merged(left_vertices.size() + right_vertices.size());
+      std::ranges::merge(left_vertices, right_vertices, merged.begin(), LeftBottomLess{});
+      hulls[left] = MonotoneChain<P>(merged, kept);
+      hulls[right] = {};
+    });
+  }
+
+  // The chain starts from the leftmost vertex, hulls start from the lowest one
+  auto &chain = hulls[0];
+  if (kept == HullPoints::kBoundary && Collinear<P>(chain)) {
+    if (!chain.empty() && BottomLeftLess{}(chain.back(), chain.front())) {
+      std::ranges::reverse(chain);
+    }
+    return chain;
+  }
+  const auto lowest = std::ranges::min_element(chain, BottomLeftLess{});
+  std::vector<P> hull(lowest, chain.end());
+  hull.insert(hull.end(), chain.begin(), lowest);
+  return hull;
+}
+
+// Hull of ConvexHull from its least vertex by less in the given direction, for tasks with other conventions.
+// A hull on one line goes along it from its least end.
+template <PlanarPoint P, class Less>
+std::vector<P> OrientHull(std::vector<P> hull, Less less, Winding winding) {
+  if (Collinear<P>(hull)) {
+    if (!hull.empty() && less(hull.back(), hull.front())) {
+      std::ranges::reverse(hull);
+    }
+    return hull;
+  }
+  std::ranges::rotate(hull, std::ranges::min_element(hull, less));
+  if (winding == Winding::kClockwise) {
+    std::reverse(hull.begin() + 1, hull.end());
+  }
+  return hull;
+}
+
+}  // namespace ppc::core::hull
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/hull/include/hull.hpp"
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
+
+namespace hull = ppc::core::hull;
+
+namespace {
+
+struct Point {
+  double x = 0.0;
+  double y = 0.0;
+
+  bool operator==(const Point &) const = default;
+};
+
+// Size of the point sets, PPC_HULL_BENCH_POINTS if set (10^8 takes 1.6 GB per set)
+size_t BenchPoints() {
+  const std::string size_env = ppc::util::GetEnvVariable("PPC_HULL_BENCH_POINTS");
+  return size_env.empty() ? size_t{1} << 20 : std::strtoull(size_env.c_str(), nullptr, 10);
+}
+
+// Integer coordinates up to 2^24 held in doubles: every orientation is exact, so hulls compare exactly
+std::vector<Point> RandomPoints(size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<std::int32_t> coordinate(-(1 << 24), 1 << 24);
+  std::vector<Point> points(n);
+  for (auto &p : points) {
+    p = {.x = static_cast<double>(coordinate(gen)), .y = static_cast<double>(coordinate(gen))};
+  }
+  return points;
+}
+
+// Shuffled points of a circle of radius 2^24 rounded to integers: the filter drops almost nothing
+std::vector<Point> CirclePoints(size_t n, unsigned seed) {
+  std::vector<Point> points(n);
+  for (size_t i = 0; i < n; i++) {
+    const double angle = 2.0 * std::numbers::pi * static_cast<double>(i) / static_cast<double>(n);
+    points[i] = {.x = std::round(std::cos(angle) * (1 << 24)), .y = std::round(std::sin(angle) * (1 << 24))};
+  }
+  std::ranges::shuffle(points, std::mt19937(seed));
+  return points;
+}
+
+// Hull of the points given in inputs[0] into outputs[0]
+template <class Backend>
+class ConvexHullTask : public ppc::core::Task {
+ public:
+  explicit ConvexHullTask(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+
+  bool ValidationImpl() override { return task_data->inputs.size() == 1 && task_data->outputs.size() == 1; }
+
+  bool PreProcessingImpl() override {
+    points_ = reinterpret_cast<std::vector<Point> *>(task_data->inputs[0]);
+    return true;
+  }
+
+  bool RunImpl() override {
+    hull_ = hull::ConvexHull<Point>(*points_, Backend{});
+    return true;
+  }
+
+  bool PostProcessingImpl() override {
+    *reinterpret_cast<std::vector<Point> *>(task_data->outputs[0]) = std::move(hull_);
+    return true;
+  }
+
+ private:
+  std::vector<Point> *points_ = nullptr;
+  std::vector<Point> hull_;
+};
+
+template <class Backend>
+void RunHullPerf(std::vector<Point> points) {
+  const auto reference = hull::ConvexHull<Point>(points);
+  std::vector<Point> res;
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&points));
+  task_data->inputs_count.emplace_back(points.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(&res));
+  task_data->outputs_count.emplace_back(1);
+
+  auto task = std::make_shared<ConvexHullTask<Backend>>(task_data);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  ppc::core::Perf perf_analyzer(task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  EXPECT_EQ(res, reference);
+}
+
+}  // namespace
+
+TEST(hull_perf_tests, random_seq) { RunHullPerf<hull::SeqBackend>(RandomPoints(BenchPoints(), 7)); }
+
+TEST(hull_perf_tests, random_stl) { RunHullPerf<hull::StlBackend>(RandomPoints(BenchPoints(), 7)); }
+
+TEST(hull_perf_tests, circle_seq) { RunHullPerf<hull::SeqBackend>(CirclePoints(BenchPoints(), 7)); }
+
+TEST(hull_perf_tests, circle_stl) { RunHullPerf<hull::StlBackend>(CirclePoints(BenchPoints(), 7)); }
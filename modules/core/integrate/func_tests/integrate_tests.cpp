@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core/integrate/include/integrate.hpp"
+
+namespace integrate = ppc::core::integrate;
+
+namespace {
+
+double Polynomial(const std::span<double> &x) {
+  double value = 1.0;
+  for (const double c : x) {
+    value *= (c * c) + c + 1.0;
+  }
+  return value;
+}
+
+void PolynomialBatch(const integrate::PointBlock &points, std::span<double> values) {
+  std::ranges::fill(values, 1.0);
+  for (size_t d = 0; d < points.dims; d++) {
+    const auto x = points.Axis(d);
+    for (size_t i = 0; i < points.count; i++) {
+      values[i] *= (x[i] * x[i]) + x[i] + 1.0;
+    }
+  }
+}
+
+std::vector<integrate::GridAxis> MixedAxes() {
+  return {integrate::SimpsonAxis(0.0, 0.25, 5), integrate::TrapezoidAxis(-1.0, 0.5, 3),
+          integrate::MidpointAxis(2.0, 1.0, 4)};
+}
+
+}  // namespace
+
+TEST(integrate_tests, walker_matches_index_decomposition) {
+  const auto axes = MixedAxes();
+  const size_t size = integrate::GridSize(axes);
+  ASSERT_EQ(size, 60U);
+  integrate::GridWalker stepped(axes);
+  for (size_t index = 0; index < size; index++) {
+    integrate::GridWalker sought(axes);
+    sought.Seek(index);
+    size_t p = index;
+    double weight = 1.0;
+    for (size_t d = 0; d < axes.size(); d++) {
+      const size_t pos = p % axes[d].nodes.size();
+      p /= axes[d].nodes.size();
+      ASSERT_EQ(stepped.Position()[d], pos) << "index " << index;
+      ASSERT_EQ(stepped.Point()[d], axes[d].nodes[pos]);
+      ASSERT_EQ(sought.Point()[d], axes[d].nodes[pos]);
+      weight *= axes[d].weights[pos];
+    }
+    ASSERT_EQ(stepped.Weight(), weight);
+    ASSERT_EQ(sought.Weight(), weight);
+    stepped.Next();
+  }
+  // Past the end the walker starts over
+  EXPECT_EQ(stepped.Position()[2], 0U);
+}
+
+TEST(integrate_tests, fill_matches_stepping) {
+  const auto axes = MixedAxes();
+  for (const size_t start : {0, 3, 5, 59}) {
+    for (const size_t count : {1, 4, 17, 60}) {
+      integrate::GridWalker filled(axes);
+      integrate::GridWalker stepped(axes);
+      filled.Seek(start);
+      stepped.Seek(start);
+      std::vector<double> soa(axes.size() * count);
+      std::vector<double> weights(count);
+      filled.Fill(soa, count, weights);
+      for (size_t i = 0; i < count; i++) {
+        for (size_t d = 0; d < axes.size(); d++) {
+          ASSERT_EQ(soa[(d * count) + i], stepped.Point()[d]) << "start " << start << ", i " << i;
+        }
+        ASSERT_EQ(weights[i], stepped.Weight());
+        stepped.Next();
+      }
+      EXPECT_EQ(filled.Weight(), stepped.Weight());
+    }
+  }
+}
+
+TEST(integrate_tests, rules_integrate_polynomials) {
+  // Simpson is exact for cubics, the trapezoid and midpoint rules converge at O(h^2)
+  const auto cubic = [](double x) { return (x * x * x) - x + 2.0; };
+  const auto integral = [&](const integrate::GridAxis &axis, double step) {
+    double sum = 0.0;
+    for (size_t k = 0; k < axis.nodes.size(); k++) {
+      sum += axis.weights[k] * cubic(axis.nodes[k]);
+    }
+    return sum * step;
+  };
+  const double exact = (std::pow(3.0, 4) / 4) - (9.0 / 2) + 6.0 - ((1.0 / 4) - (1.0 / 2) + 2.0);
+  EXPECT_NEAR(integral(integrate::SimpsonAxis(1.0, 0.5, 5), 0.5 / 3), exact, 1e-12);
+  EXPECT_NEAR(integral(integrate::TrapezoidAxis(1.0, 0.002, 1001), 0.002), exact, 1e-4);
+  EXPECT_NEAR(integral(integrate::MidpointAxis(1.0, 0.002, 1000), 0.002), exact, 1e-4);
+}
+
+TEST(integrate_tests, batch_sum_matches_pointwise) {
+  const std::vector<integrate::GridAxis> axes = {integrate::SimpsonAxis(0.0, 0.01, 101),
+                                                 integrate::SimpsonAxis(-1.0, 0.02, 101),
+                                                 integrate::TrapezoidAxis(0.5, 0.1, 7)};
+  const size_t size = integrate::GridSize(axes);
+  const auto pointwise = integrate::Pointwise(Polynomial);
+  const auto batch = integrate::BatchOrPointwise(PolynomialBatch, Polynomial);
+  const double whole = integrate::WeightedGridSum(axes, 0, size, pointwise);
+  EXPECT_NEAR(integrate::WeightedGridSum(axes, 0, size, batch), whole, 1e-9 * whole);
+  const double split = integrate::WeightedGridSum(axes, 0, 1000, batch) +
+                       integrate::WeightedGridSum(axes, 1000, 1001, batch) +
+                       integrate::WeightedGridSum(axes, 1001, size, batch);
+  EXPECT_NEAR(split, whole, 1e-9 * whole);
+  EXPECT_EQ(integrate::WeightedGridSum(axes, 5, 5, batch), 0.0);
+  EXPECT_THROW(integrate::GridWalker({}), std::invalid_argument);
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace ppc::core::integrate {
+
+// Points of a batch in structure-of-arrays layout: coordinate d of point i is at data[(d * stride) + i]
+struct PointBlock {
+  const double *data = nullptr;
+  size_t dims = 0;
+  size_t count = 0;
+  size_t stride = 0;
+
+  [[nodiscard]] std::span<const double> Axis(size_t d) const { return {data + (d * stride), count}; }
+};
+
+// Integrand evaluated at a whole block per call: values[i] = f(point i), values.size() == points.count.
+// Loops over the Axis() spans are contiguous, so cheap integrands run on SIMD lanes and the call overhead
+// is paid once per block instead of once per point.
+using BatchIntegrand = void (*)(const PointBlock &points, std::span<double> values);
+// Integrand of one point, the form the tasks take
+using PointIntegrand = double (*)(const std::span<double> &point);
+
+using BlockFunction = std::function<void(const PointBlock &, std::span<double>)>;
+
+// Points per block of the integration engines
+constexpr size_t kBlockSize = 256;
+
+// Evaluates a point integrand at every point of a block, gathering the coordinates of each point
+BlockFunction Pointwise(PointIntegrand f);
+// The batch integrand if it is set, Pointwise(pointwise) otherwise
+BlockFunction BatchOrPointwise(BatchIntegrand batch, PointIntegrand pointwise);
+
+// Nodes of one grid axis and their quadrature weights
+struct GridAxis {
+  std::vector<double> nodes{};
+  std::vector<double> weights{};
+};
+
+// `count` nodes lo, lo + step, ... with Simpson weights 1 4 2 4 ... 2 4 1 (the last node weighs 1 whatever
+// its parity); SimpsonAxis(lo, (hi - lo) / n, n + 1) is the composite rule over n intervals for even n
+GridAxis SimpsonAxis(double lo, double step, size_t count);
+// `count` nodes lo, lo + step, ... with trapezoid weights 1/2 1 ... 1 1/2
+GridAxis TrapezoidAxis(double lo, double step, size_t count);
+// Midpoints of `count` cells of width step starting at lo, all weighing 1
+GridAxis MidpointAxis(double lo, double step, size_t count);
+
+// Number of points of the tensor grid of the axes
+size_t GridSize(std::span<const GridAxis> axes);
+
+// Walks the points of a tensor grid in the order of their flat index, axis 0 fastest. Seek decomposes
+// the index with a division per axis once; Next() moves like an odometer, so a step takes no division
+// and touches axis 0 only except on carries. Coordinates come from the node tables and the weight
+// product of axes 1.. is cached between carries. Throws if there are no axes or an axis has no nodes.
+class GridWalker {
+ public:
+  explicit GridWalker(std::span<const GridAxis> axes);
+
+  void Seek(size_t index);
+  void Next();
+
+  [[nodiscard]] std::span<const size_t> Position() const { return pos_; }
+  [[nodiscard]] std::span<const double> Point() const { return point_; }
+  // Product of the weights of the point over the axes
+  [[nodiscard]] double Weight() const { return axes_[0].weights[pos_[0]] * outer_[1]; }
+
+  // Writes the coordinates of the next weights.size() points to soa (coordinate d of point i at
+  // soa[(d * stride) + i]) and their weights, and moves past them
+  void Fill(std::span<double> soa, size_t stride, std::span<double> weights);
+
+ private:
+  // Refreshes the coordinates and weight products of axes [1, top]
+  void UpdateOuter(size_t top);
+
+  std::span<const GridAxis> axes_;
+  std::vector<size_t> pos_;
+  std::vector<double> point_;
+  // outer_[d] is the product of the weights of axes d.. at the current point, outer_[dims] = 1
+  std::vector<double> outer_;
+};
+
+// Sum of weight * f over the grid points with flat indices [first, last); the points are evaluated
+// kBlockSize at a time
+double WeightedGridSum(std::span<const GridAxis> axes, size_t first, size_t last, const BlockFunction &f);
+
+}  // namespace ppc::core::integrate
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "core/integrate/include/integrate.hpp"
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+
+namespace integrate = ppc::core::integrate;
+
+namespace {
+
+double Polynomial(const std::span<double> &x) {
+  double value = 1.0;
+  for (const double c : x) {
+    value *= (c * c) + c + 1.0;
+  }
+  return value;
+}
+
+void PolynomialBatch(const integrate::PointBlock &points, std::span<double> values) {
+  std::ranges::fill(values, 1.0);
+  for (size_t d = 0; d < points.dims; d++) {
+    const auto x = points.Axis(d);
+    for (size_t i = 0; i < points.count; i++) {
+      values[i] *= (x[i] * x[i]) + x[i] + 1.0;
+    }
+  }
+}
+
+// Coordinates by % and / per axis with a call per point, the loops of the former tasks
+double ModuloGridSum(const std::vector<integrate::GridAxis> &axes) {
+  std::vector<double> point(axes.size());
+  double sum = 0.0;
+  for (size_t index = 0; index < integrate::GridSize(axes); index++) {
+    size_t p = index;
+    double weight = 1.0;
+    for (size_t d = 0; d < axes.size(); d++) {
+      const size_t pos = p % axes[d].nodes.size();
+      p /= axes[d].nodes.size();
+      point[d] = axes[d].nodes[pos];
+      weight *= axes[d].weights[pos];
+    }
+    sum += weight * Polynomial(point);
+  }
+  return sum;
+}
+
+// Weighted sum of f over the grid given by the axes in inputs[0] into the double of outputs[0]
+class GridSumTask : public ppc::core::Task {
+ public:
+  GridSumTask(ppc::core::TaskDataPtr task_data, integrate::BlockFunction f)
+      : Task(std::move(task_data)), f_(std::move(f)) {}
+
+  bool ValidationImpl() override { return task_data->inputs.size() == 1 && task_data->outputs.size() == 1; }
+
+  bool PreProcessingImpl() override {
+    axes_ = reinterpret_cast<std::vector<integrate::GridAxis> *>(task_data->inputs[0]);
+    return true;
+  }
+
+  bool RunImpl() override {
+    sum_ = integrate::WeightedGridSum(*axes_, 0, integrate::GridSize(*axes_), f_);
+    return true;
+  }
+
+  bool PostProcessingImpl() override {
+    *reinterpret_cast<double *>(task_data->outputs[0]) = sum_;
+    return true;
+  }
+
+ private:
+  integrate::BlockFunction f_;
+  std::vector<integrate::GridAxis> *axes_ = nullptr;
+  double sum_ = 0.0;
+};
+
+// A cheap integrand on a grid of 10^7 points
+void RunGridSumPerf(integrate::BlockFunction f) {
+  std::vector<integrate::GridAxis> axes = {integrate::SimpsonAxis(0.0, 1e-3, 1001),
+                                           integrate::SimpsonAxis(0.0, 1e-3, 1001),
+                                           integrate::SimpsonAxis(0.0, 0.1, 11)};
+  const double reference = ModuloGridSum(axes);
+  double sum = 0.0;
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&axes));
+  task_data->inputs_count.emplace_back(integrate::GridSize(axes));
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(&sum));
+  task_data->outputs_count.emplace_back(1);
+
+  auto task = std::make_shared<GridSumTask>(task_data, std::move(f));
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  ppc::core::Perf perf_analyzer(task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  EXPECT_NEAR(sum, reference, 1e-9 * reference);
+}
+
+}  // namespace
+
+TEST(integrate_perf_tests, grid_sum_pointwise) { RunGridSumPerf(integrate::Pointwise(Polynomial)); }
+
+TEST(integrate_perf_tests, grid_sum_batch) { RunGridSumPerf(PolynomialBatch); }
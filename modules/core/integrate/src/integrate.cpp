@@ -0,0 +1,156 @@
+#include "core/integrate/include/integrate.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+ppc::core::integrate::BlockFunction ppc::core::integrate::Pointwise(PointIntegrand f) {
+  return [f](const PointBlock &points, std::span<double> values) {
+    std::vector<double> point(points.dims);
+    const std::span<double> view(point);
+    for (size_t i = 0; i < points.count; i++) {
+      for (size_t d = 0; d < points.dims; d++) {
+        point[d] = points.data[(d * points.stride) + i];
+      }
+      values[i] = f(view);
+    }
+  };
+}
+
+ppc::core::integrate::BlockFunction ppc::core::integrate::BatchOrPointwise(BatchIntegrand batch,
+                                                                          PointIntegrand pointwise) {
+  if (batch != nullptr) {
+    return batch;
+  }
+  return Pointwise(pointwise);
+}
+
+ppc::core::integrate::GridAxis ppc::core::integrate::SimpsonAxis(double lo, double step, size_t count) {
+  GridAxis axis;
+  axis.nodes.resize(count);
+  axis.weights.resize(count);
+  for (size_t k = 0; k < count; k++) {
+    axis.nodes[k] = lo + (static_cast<double>(k) * step);
+    axis.weights[k] = (k == 0 || k + 1 == count) ? 1.0 : (k % 2 != 0 ? 4.0 : 2.0);
+  }
+  return axis;
+}
+
+ppc::core::integrate::GridAxis ppc::core::integrate::TrapezoidAxis(double lo, double step, size_t count) {
+  GridAxis axis;
+  axis.nodes.resize(count);
+  axis.weights.resize(count);
+  for (size_t k = 0; k < count; k++) {
+    axis.nodes[k] = lo + (static_cast<double>(k) * step);
+    axis.weights[k] = (k == 0 || k + 1 == count) ? 0.5 : 1.0;
+  }
+  return axis;
+}
+
+ppc::core::integrate::GridAxis ppc::core::integrate::MidpointAxis(double lo, double step, size_t count) {
+  GridAxis axis;
+  axis.nodes.resize(count);
+  axis.weights.assign(count, 1.0);
+  for (size_t k = 0; k < count; k++) {
+    axis.nodes[k] = lo + ((static_cast<double>(k) + 0.5) * step);
+  }
+  return axis;
+}
+
+size_t ppc::core::integrate::GridSize(std::span<const GridAxis> axes) {
+  size_t size = 1;
+  for (const auto &axis : axes) {
+    size *= axis.nodes.size();
+  }
+  return size;
+}
+
+ppc::core::integrate::GridWalker::GridWalker(std::span<const GridAxis> axes)
+    : axes_(axes), pos_(axes.size(), 0), point_(axes.size()), outer_(axes.size() + 1, 1.0) {
+  const auto bad_axis = [](const GridAxis &axis) {
+    return axis.nodes.empty() || axis.weights.size() != axis.nodes.size();
+  };
+  if (axes.empty() || std::ranges::any_of(axes, bad_axis)) {
+    throw std::invalid_argument("GridWalker: no axes or an axis without nodes and weights");
+  }
+  Seek(0);
+}
+
+void ppc::core::integrate::GridWalker::Seek(size_t index) {
+  for (size_t d = 0; d < axes_.size(); d++) {
+    const size_t n = axes_[d].nodes.size();
+    pos_[d] = index % n;
+    index /= n;
+  }
+  point_[0] = axes_[0].nodes[pos_[0]];
+  UpdateOuter(axes_.size() - 1);
+}
+
+void ppc::core::integrate::GridWalker::Next() {
+  if (++pos_[0] < axes_[0].nodes.size()) {
+    point_[0] = axes_[0].nodes[pos_[0]];
+    return;
+  }
+  pos_[0] = 0;
+  point_[0] = axes_[0].nodes[0];
+  size_t d = 1;
+  while (d < axes_.size() && ++pos_[d] == axes_[d].nodes.size()) {
+    pos_[d++] = 0;
+  }
+  // Past the last point the walker wraps around to the first one
+  UpdateOuter(std::min(d, axes_.size() - 1));
+}
+
+void ppc::core::integrate::GridWalker::UpdateOuter(size_t top) {
+  for (size_t d = top; d >= 1; d--) {
+    point_[d] = axes_[d].nodes[pos_[d]];
+    outer_[d] = axes_[d].weights[pos_[d]] * outer_[d + 1];
+  }
+}
+
+void ppc::core::integrate::GridWalker::Fill(std::span<double> soa, size_t stride, std::span<double> weights) {
+  const auto &first_axis = axes_[0];
+  const size_t count = weights.size();
+  size_t i = 0;
+  // Runs along axis 0: the other coordinates and the weight product of the other axes stay the same
+  while (i < count) {
+    const size_t run = std::min(count - i, first_axis.nodes.size() - pos_[0]);
+    std::copy_n(first_axis.nodes.begin() + static_cast<std::ptrdiff_t>(pos_[0]), run, soa.begin() + i);
+    for (size_t r = 0; r < run; r++) {
+      weights[i + r] = first_axis.weights[pos_[0] + r] * outer_[1];
+    }
+    for (size_t d = 1; d < axes_.size(); d++) {
+      std::fill_n(soa.begin() + static_cast<std::ptrdiff_t>((d * stride) + i), run, point_[d]);
+    }
+    i += run;
+    pos_[0] += run - 1;
+    Next();
+  }
+}
+
+double ppc::core::integrate::WeightedGridSum(std::span<const GridAxis> axes, size_t first, size_t last,
+                                             const BlockFunction &f) {
+  if (first >= last) {
+    return 0.0;
+  }
+  GridWalker walker(axes);
+  walker.Seek(first);
+  const size_t dims = axes.size();
+  std::vector<double> coords(dims * kBlockSize);
+  std::array<double, kBlockSize> weights{};
+  std::array<double, kBlockSize> values{};
+  double sum = 0.0;
+  for (size_t begin = first; begin < last; begin += kBlockSize) {
+    const size_t count = std::min(kBlockSize, last - begin);
+    walker.Fill(coords, kBlockSize, std::span(weights).first(count));
+    f({.data = coords.data(), .dims = dims, .count = count, .stride = kBlockSize}, std::span(values).first(count));
+    for (size_t i = 0; i < count; i++) {
+      sum += weights[i] * values[i];
+    }
+  }
+  return sum;
+}
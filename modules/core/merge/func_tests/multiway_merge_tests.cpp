@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "core/merge/include/multiway_merge.hpp"
+
+namespace {
+
+// Sorted runs of random lengths with many equal values
+std::pair<std::vector<int>, std::vector<size_t>> MakeSortedRuns(size_t runs_count, size_t max_run_size,
+                                                                unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<size_t> size_dist(0, max_run_size);
+  std::uniform_int_distribution<int> value_dist(-50, 50);
+  std::vector<int> data;
+  std::vector<size_t> bounds{0};
+  for (size_t run = 0; run < runs_count; run++) {
+    const size_t run_size = size_dist(gen);
+    const auto run_begin = static_cast<std::ptrdiff_t>(data.size());
+    for (size_t i = 0; i < run_size; i++) {
+      data.push_back(value_dist(gen));
+    }
+    std::sort(data.begin() + run_begin, data.end());
+    bounds.push_back(data.size());
+  }
+  return {data, bounds};
+}
+
+}  // namespace
+
+TEST(multiway_merge_tests, check_merge) {
+  auto [data, bounds] = MakeSortedRuns(7, 1000, 1);
+  const auto runs = ppc::core::MakeRuns<int>(data, bounds);
+  std::vector<int> out(data.size());
+  ppc::core::MultiwayMerge<int>(runs, out.data());
+  std::ranges::sort(data);
+  EXPECT_EQ(out, data);
+}
+
+TEST(multiway_merge_tests, check_single_and_empty_runs) {
+  std::vector<int> data{1, 2, 3};
+  std::vector<size_t> bounds{0, 0, 3, 3};
+  const auto runs = ppc::core::MakeRuns<int>(data, bounds);
+  std::vector<int> out(data.size());
+  ppc::core::MultiwayMerge<int>(runs, out.data());
+  EXPECT_EQ(out, data);
+}
+
+TEST(multiway_merge_tests, check_split_ranks) {
+  auto [data, bounds] = MakeSortedRuns(5, 200, 2);
+  const auto runs = ppc::core::MakeRuns<int>(data, bounds);
+  std::vector<int> sorted = data;
+  std::ranges::sort(sorted);
+  for (size_t rank = 0; rank <= data.size(); rank++) {
+    const auto split = ppc::core::MultiwaySplit<int>(runs, rank);
+    size_t total = 0;
+    for (size_t i = 0; i < runs.size(); i++) {
+      total += split[i];
+      // everything left of the split is not greater than the rank-th element of the merge
+      if (split[i] > 0 && rank < sorted.size()) {
+        EXPECT_LE(runs[i][split[i] - 1], sorted[rank]);
+      }
+      if (split[i] < runs[i].size() && rank > 0) {
+        EXPECT_GE(runs[i][split[i]], sorted[rank - 1]);
+      }
+    }
+    EXPECT_EQ(total, rank);
+  }
+}
+
+TEST(multiway_merge_tests, check_parts_cover_output) {
+  for (unsigned seed = 0; seed < 20; seed++) {
+    auto [data, bounds] = MakeSortedRuns(1 + (seed % 9), 300, seed);
+    const auto runs = ppc::core::MakeRuns<int>(data, bounds);
+    std::vector<int> out(data.size());
+    const size_t parts_count = 1 + (seed % 6);
+    for (size_t part = 0; part < parts_count; part++) {
+      ppc::core::MultiwayMergePart<int>(runs, out, part, parts_count);
+    }
+    std::ranges::sort(data);
+    EXPECT_EQ(out, data);
+  }
+}
+
+TEST(multiway_merge_tests, check_stability) {
+  // values are compared by the first field only, the second one is the position in the input
+  using Item = std::pair<int, int>;
+  std::vector<Item> data{{1, 0}, {2, 1}, {2, 2}, {1, 3}, {2, 4}, {3, 5}, {1, 6}, {2, 7}};
+  std::vector<size_t> bounds{0, 3, 6, 8};
+  const auto runs = ppc::core::MakeRuns<Item>(data, bounds);
+  auto comp = [](const Item &a, const Item &b) { return a.first < b.first; };
+  for (size_t parts_count = 1; parts_count <= 4; parts_count++) {
+    std::vector<Item> out(data.size());
+    for (size_t part = 0; part < parts_count; part++) {
+      ppc::core::MultiwayMergePart<Item>(runs, out, part, parts_count, comp);
+    }
+    std::vector<Item> expected = data;
+    std::ranges::stable_sort(expected, comp);
+    EXPECT_EQ(out, expected);
+  }
+}
+
+TEST(multiway_merge_tests, check_custom_compare) {
+  std::vector<int> data{5, 3, 1, 6, 4, 2};
+  std::vector<size_t> bounds{0, 3, 6};
+  const auto runs = ppc::core::MakeRuns<int>(data, bounds);
+  std::vector<int> out(data.size());
+  ppc::core::MultiwayMergePart<int>(runs, out, 0, 2, std::greater<>());
+  ppc::core::MultiwayMergePart<int>(runs, out, 1, 2, std::greater<>());
+  EXPECT_EQ(out, std::vector<int>({6, 5, 4, 3, 2, 1}));
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ppc::core {
+
+// K-way merge of sorted runs which does not depend on a threading model: the output is cut into equal parts
+// by splitter search, and every part is merged independently with a loser tree, so P workers merge the whole
+// output in one pass by calling MultiwayMergePart(runs, out, part, P) for part = 0..P-1 in any order.
+// Merge is stable: equal elements keep the order of runs and the order inside a run.
+
+// Positions split[i] such that runs[i][0, split[i]) are exactly the first rank elements of the merge
+template <class T, class Compare = std::less<>>
+std::vector<size_t> MultiwaySplit(std::span<const std::span<const T>> runs, size_t rank, Compare comp = {}) {
+  const size_t runs_count = runs.size();
+  std::vector<size_t> lo(runs_count, 0);
+  std::vector<size_t> hi(runs_count);
+  for (size_t i = 0; i < runs_count; i++) {
+    hi[i] = runs[i].size();
+  }
+
+  // Every step takes the middle element of the widest range as a pivot and counts the elements
+  // which precede it in the merge, then the ranges of all runs are cut by the pivot position
+  std::vector<size_t> pos(runs_count);
+  while (true) {
+    size_t pivot_run = runs_count;
+    size_t widest = 0;
+    for (size_t i = 0; i < runs_count; i++) {
+      if (hi[i] - lo[i] > widest) {
+        widest = hi[i] - lo[i];
+        pivot_run = i;
+      }
+    }
+    if (pivot_run == runs_count) {
+      return lo;
+    }
+
+    const size_t pivot_pos = lo[pivot_run] + ((hi[pivot_run] - lo[pivot_run]) / 2);
+    const T &pivot = runs[pivot_run][pivot_pos];
+    size_t pivot_rank = 0;
+    for (size_t i = 0; i < runs_count; i++) {
+      auto begin = runs[i].begin() + static_cast<std::ptrdiff_t>(lo[i]);
+      auto end = runs[i].begin() + static_cast<std::ptrdiff_t>(hi[i]);
+      if (i == pivot_run) {
+        pos[i] = pivot_pos;
+      } else if (i < pivot_run) {
+        pos[i] = static_cast<size_t>(std::upper_bound(begin, end, pivot, comp) - runs[i].begin());
+      } else {
+        pos[i] = static_cast<size_t>(std::lower_bound(begin, end, pivot, comp) - runs[i].begin());
+      }
+      pivot_rank += pos[i];
+    }
+
+    if (pivot_rank < rank) {
+      lo = pos;
+      lo[pivot_run]++;
+    } else {
+      hi = pos;
+    }
+  }
+}
+
+// Tournament tree which keeps the loser of every match, so replacing the winner replays one leaf-to-root path
+template <class T, class Compare = std::less<>>
+class LoserTree {
+ public:
+  LoserTree(std::span<const std::span<const T>> runs, Compare comp = {})
+      : runs_(runs.begin(), runs.end()), next_(runs.size(), 0), losers_(runs.size()), comp_(std::move(comp)) {
+    const size_t runs_count = runs_.size();
+    if (runs_count == 1) {
+      losers_[0] = 0;
+      return;
+    }
+    // winners of the subtrees, leaves are stored in [runs_count, 2 * runs_count)
+    std::vector<size_t> winners(2 * runs_count);
+    for (size_t i = 0; i < runs_count; i++) {
+      winners[runs_count + i] = i;
+    }
+    for (size_t node = runs_count - 1; node > 0; node--) {
+      const size_t left = winners[2 * node];
+      const size_t right = winners[(2 * node) + 1];
+      winners[node] = Beats(left, right) ? left : right;
+      losers_[node] = Beats(left, right) ? right : left;
+    }
+    losers_[0] = winners[1];
+  }
+
+  [[nodiscard]] bool Empty() const { return next_[losers_[0]] == runs_[losers_[0]].size(); }
+
+  // Returns the smallest remaining element and removes it from its run
+  const T &Pop() {
+    size_t winner = losers_[0];
+    const T &res = runs_[winner][next_[winner]++];
+    for (size_t node = (winner + runs_.size()) / 2; node > 0; node /= 2) {
+      if (Beats(losers_[node], winner)) {
+        std::swap(losers_[node], winner);
+      }
+    }
+    losers_[0] = winner;
+    return res;
+  }
+
+ private:
+  std::vector<std::span<const T>> runs_;
+  std::vector<size_t> next_;
+  std::vector<size_t> losers_;
+  Compare comp_;
+
+  [[nodiscard]] bool Beats(size_t a, size_t b) const {
+    if (next_[a] == runs_[a].size()) {
+      return false;
+    }
+    if (next_[b] == runs_[b].size()) {
+      return true;
+    }
+    const T &value_a = runs_[a][next_[a]];
+    const T &value_b = runs_[b][next_[b]];
+    if (comp_(value_a, value_b)) {
+      return true;
+    }
+    if (comp_(value_b, value_a)) {
+      return false;
+    }
+    return a < b;
+  }
+};
+
+// Merges all runs into out, which must have room for all elements and must not overlap the runs
+template <class T, class Compare = std::less<>>
+void MultiwayMerge(std::span<const std::span<const T>> runs, T *out, Compare comp = {}) {
+  std::vector<std::span<const T>> nonempty;
+  for (const auto &run : runs) {
+    if (!run.empty()) {
+      nonempty.push_back(run);
+    }
+  }
+  if (nonempty.empty()) {
+    return;
+  }
+  if (nonempty.size() == 1) {
+    std::ranges::copy(nonempty[0], out);
+    return;
+  }
+  LoserTree<T, Compare> tree(nonempty, std::move(comp));
+  while (!tree.Empty()) {
+    *out++ = tree.Pop();
+  }
+}
+
+// Merges part `part` of `parts_count` equal ranges of the output. Parts do not overlap, so every worker writes
+// its own part and the workers together merge all sorted runs in one pass.
+template <class T, class Compare = std::less<>>
+void MultiwayMergePart(std::span<const std::span<const T>> runs, std::span<T> out, size_t part, size_t parts_count,
+                       Compare comp = {}) {
+  const size_t total = out.size();
+  const size_t rank_begin = total * part / parts_count;
+  const size_t rank_end = total * (part + 1) / parts_count;
+  if (rank_begin == rank_end) {
+    return;
+  }
+  const auto split_begin = MultiwaySplit(runs, rank_begin, comp);
+  const auto split_end = MultiwaySplit(runs, rank_end, comp);
+
+  std::vector<std::span<const T>> part_runs(runs.size());
+  for (size_t i = 0; i < runs.size(); i++) {
+    part_runs[i] = runs[i].subspan(split_begin[i], split_end[i] - split_begin[i]);
+  }
+  MultiwayMerge<T>(part_runs, out.data() + rank_begin, std::move(comp));
+}
+
+// Views of consecutive sorted runs of data, run i is [bounds[i], bounds[i + 1])
+template <class T>
+std::vector<std::span<const T>> MakeRuns(std::span<const T> data, std::span<const size_t> bounds) {
+  std::vector<std::span<const T>> runs;
+  for (size_t i = 0; i + 1 < bounds.size(); i++) {
+    runs.push_back(data.subspan(bounds[i], bounds[i + 1] - bounds[i]));
+  }
+  return runs;
+}
+
+}  // namespace ppc::core
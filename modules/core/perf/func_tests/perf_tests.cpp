@@ -2,10 +2,15 @@
 
 #include <chrono>
 #include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "core/perf/func_tests/test_task.hpp"
+#include "core/perf/include/hw_counters.hpp"
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
 
@@ -175,3 +180,284 @@ TEST(perf_tests, check_perf_task_float) {
   ASSERT_LE(perf_results->time_sec, ppc::core::PerfResults::kMaxTime);
   EXPECT_EQ(out[0], in.size());
 }
+
+TEST(perf_tests, check_perf_samples_statistic) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes: k-th measured run takes k seconds
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  perf_attr->num_warmup = 3;
+  double fake_time = 0.0;
+  double fake_step = 0.0;
+  perf_attr->current_timer = [&] {
+    fake_time += fake_step;
+    fake_step += 1.0;
+    return fake_time;
+  };
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+
+  ASSERT_EQ(perf_results->samples.size(), 10U);
+  EXPECT_DOUBLE_EQ(perf_results->time_sec, 55.0);
+  EXPECT_DOUBLE_EQ(perf_results->min_sec, 1.0);
+  EXPECT_DOUBLE_EQ(perf_results->max_sec, 10.0);
+  EXPECT_DOUBLE_EQ(perf_results->mean_sec, 5.5);
+  EXPECT_DOUBLE_EQ(perf_results->median_sec, 5.5);
+  EXPECT_DOUBLE_EQ(perf_results->p90_sec, 9.0);
+  EXPECT_DOUBLE_EQ(perf_results->p99_sec, 10.0);
+  EXPECT_NEAR(perf_results->stddev_sec, 3.0276503541, 1e-9);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_min_time) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes: every measured run takes 1 second
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 2;
+  perf_attr->min_time_sec = 5.0;
+  double fake_time = 0.0;
+  perf_attr->current_timer = [&] { return fake_time++; };
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+  EXPECT_EQ(perf_results->samples.size(), 5U);
+  EXPECT_DOUBLE_EQ(perf_results->time_sec, 5.0);
+
+  // Runs are limited by max_running when min_time_sec is unreachable
+  perf_attr->max_running = 3;
+  perf_attr->min_time_sec = 100.0;
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+  EXPECT_EQ(perf_results->samples.size(), 3U);
+  EXPECT_DOUBLE_EQ(perf_results->median_sec, 1.0);
+  EXPECT_DOUBLE_EQ(perf_results->stddev_sec, 0.0);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_results_file) {
+#ifndef _WIN32
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 3;
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+
+  const auto file_path = std::filesystem::temp_directory_path() / "ppc_perf_tests_results.jsonl";
+  std::filesystem::remove(file_path);
+  setenv("PPC_PERF_RESULTS_FILE", file_path.c_str(), 1);  // NOLINT(misc-include-cleaner)
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  unsetenv("PPC_PERF_RESULTS_FILE");  // NOLINT(misc-include-cleaner)
+
+  std::ifstream file(file_path);
+  std::string record;
+  int records_count = 0;
+  while (std::getline(file, record)) {
+    records_count++;
+    EXPECT_NE(record.find("\"type\":\"task_run\""), std::string::npos);
+    EXPECT_NE(record.find("\"input_size\":2000"), std::string::npos);
+    EXPECT_NE(record.find("\"samples\":[0.0000000000,0.0000000000,0.0000000000]"), std::string::npos);
+    EXPECT_NE(record.find("\"git_sha\":"), std::string::npos);
+  }
+  file.close();
+  std::filesystem::remove(file_path);
+  EXPECT_EQ(records_count, 2);
+#else
+  GTEST_SKIP();
+#endif
+}
+
+TEST(perf_tests, check_perf_hw_counters) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 3;
+  perf_attr->use_hw_counters = true;
+  // Every timer read takes 1 second: reads around the counter calls must not fall into the samples
+  double fake_time = 0.0;
+  perf_attr->current_timer = [&] { return fake_time++; };
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  ASSERT_EQ(perf_results->hw_counters.size(), 3U);
+  EXPECT_EQ(perf_results->samples, std::vector<double>(3, 1.0));
+  EXPECT_DOUBLE_EQ(perf_results->time_sec, 3.0);
+  EXPECT_EQ(perf_results->hw_counters_total.available, ppc::core::HwCounters().IsAvailable());
+  EXPECT_EQ(perf_results->hw_counters_total.scope, ppc::core::HwCounters().Scope());
+  if (perf_results->hw_counters_total.available) {
+    uint64_t instructions = 0;
+    for (const auto &values : perf_results->hw_counters) {
+      instructions += values.instructions;
+    }
+    EXPECT_EQ(perf_results->hw_counters_total.instructions, instructions);
+  }
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_hw_counters_values_sum) {
+  ppc::core::HwCountersValues total;
+  ppc::core::HwCountersValues values;
+  values.cycles = 10;
+  values.instructions = 20;
+  values.llc_misses = 1;
+  values.branch_misses = 2;
+  values.context_switches = 3;
+  values.available = true;
+  values.scope = ppc::core::HwCountersScope::kAllCpus;
+
+  total += values;
+  total += values;
+  total += ppc::core::HwCountersValues();
+  EXPECT_TRUE(total.available);
+  EXPECT_EQ(total.scope, ppc::core::HwCountersScope::kAllCpus);
+  EXPECT_STREQ(ppc::core::HwCountersScopeName(total.scope), "all_cpus");
+  EXPECT_EQ(total.cycles, 20U);
+  EXPECT_EQ(total.instructions, 40U);
+  EXPECT_EQ(total.llc_misses, 2U);
+  EXPECT_EQ(total.branch_misses, 4U);
+  EXPECT_EQ(total.context_switches, 6U);
+}
+
+TEST(perf_tests, check_perf_phases_time) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  perf_attr->num_warmup = 2;
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+  for (const auto &histogram : perf_results->phases_time) {
+    EXPECT_EQ(histogram.count, 10U);
+  }
+
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  EXPECT_EQ(perf_results->phases_time[ppc::core::Task::kValidation].count, 0U);
+  EXPECT_EQ(perf_results->phases_time[ppc::core::Task::kRun].count, 10U);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_prepared_run) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  perf_attr->use_prepared_run = true;
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  EXPECT_EQ(perf_results->phases_time[ppc::core::Task::kValidation].count, 0U);
+  EXPECT_EQ(perf_results->phases_time[ppc::core::Task::kPreProcessing].count, 10U);
+  EXPECT_EQ(perf_results->phases_time[ppc::core::Task::kRun].count, 10U);
+  EXPECT_EQ(perf_results->phases_time[ppc::core::Task::kPostProcessing].count, 10U);
+  EXPECT_EQ(out[0], in.size());
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace ppc::core {
+
+// What the counters of an interval cover
+enum class HwCountersScope : uint8_t {
+  kNone,
+  // Every online CPU: all threads of the process, pool threads included, but also whatever else
+  // ran on the machine meanwhile
+  kAllCpus,
+  // The calling thread and the threads it created that exited before Stop(); persistent
+  // OpenMP/TBB pools are missed. The fallback when per CPU counters are not permitted.
+  kThread,
+};
+
+// "all_cpus", "thread" or "none"
+const char* HwCountersScopeName(HwCountersScope scope);
+
+// Values of performance counters for one measured interval
+struct HwCountersValues {
+  uint64_t cycles = 0;
+  uint64_t instructions = 0;
+  uint64_t llc_misses = 0;
+  uint64_t branch_misses = 0;
+  uint64_t context_switches = 0;
+  // false when no counter could be opened (not Linux, perf_event_paranoid, containers)
+  bool available = false;
+  HwCountersScope scope = HwCountersScope::kNone;
+
+  HwCountersValues& operator+=(const HwCountersValues& other);
+};
+
+// Linux perf_event_open counters. Counts per CPU (one descriptor per event and CPU) when
+// perf_event_paranoid or CAP_PERFMON allow it, otherwise falls back to inherited counters of the
+// calling thread; Scope() tells which one is in use.
+class HwCounters {
+ public:
+  HwCounters();
+  HwCounters(const HwCounters&) = delete;
+  HwCounters& operator=(const HwCounters&) = delete;
+  ~HwCounters();
+
+  [[nodiscard]] bool IsAvailable() const;
+  [[nodiscard]] HwCountersScope Scope() const;
+  // reset and enable all opened counters
+  void Start();
+  // disable all opened counters and read their values
+  HwCountersValues Stop();
+
+ private:
+  enum Event : uint8_t { kCycles, kInstructions, kLlcMisses, kBranchMisses, kContextSwitches, kEventsCount };
+  using EventFds = std::array<int, kEventsCount>;
+  // opens every event for pid and cpu as perf_event_open takes them, -1 for the ones that fail
+  static EventFds OpenEvents(int pid, int cpu);
+
+  // one set per counted CPU, or a single one of the calling thread
+  std::vector<EventFds> fds_;
+  HwCountersScope scope_ = HwCountersScope::kNone;
+};
+
+}  // namespace ppc::core
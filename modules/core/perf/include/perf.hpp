@@ -3,7 +3,9 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
 
+#include "core/perf/include/hw_counters.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc::core {
@@ -11,12 +13,39 @@ namespace ppc::core {
 struct PerfAttr {
   // count of task's running
   uint64_t num_running;
+  // count of task's running before measurements (results are dropped)
+  uint64_t num_warmup = 0;
+  // minimal summary time of measured runs (in seconds), runs are repeated after num_running until it is reached
+  double min_time_sec = 0.0;
+  // upper bound of measured runs when min_time_sec is not reached
+  uint64_t max_running = 1000;
+  // collect HwCounters values for every measured run (also enabled by PPC_PERF_HW_COUNTERS=1)
+  bool use_hw_counters = false;
+  // TaskRun measures Task::RunPrepared() over task's data instead of Task::Run()
+  bool use_prepared_run = false;
   std::function<double()> current_timer = [&] { return 0.0; };
 };
 
 struct PerfResults {
   // measurement of task's time (in seconds)
   double time_sec = 0.0;
+  // time of every measured run (in seconds)
+  std::vector<double> samples;
+  // statistic of samples (in seconds)
+  double min_sec = 0.0;
+  double max_sec = 0.0;
+  double mean_sec = 0.0;
+  double median_sec = 0.0;
+  double p90_sec = 0.0;
+  double p99_sec = 0.0;
+  double stddev_sec = 0.0;
+  // performance counters of every measured run and their sum
+  std::vector<HwCountersValues> hw_counters;
+  HwCountersValues hw_counters_total;
+  // durations of task's stages during measured runs
+  Task::PhasesTime phases_time{};
+  // summary of task's inputs_count
+  uint64_t input_size = 0;
   enum TypeOfRunning : uint8_t { kPipeline, kTaskRun, kNone } type_of_running = kNone;
   constexpr static double kMaxTime = 10.0;
 };
@@ -35,11 +64,14 @@ class Perf {
   void TaskRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::shared_ptr<PerfResults>& perf_results) const;
   // Pint results for automation checkers
   static void PrintPerfStatistic(const std::shared_ptr<PerfResults>& perf_results);
+  // Fill min/max/mean/median/percentiles/stddev of perf_results from its samples
+  static void CalcSamplesStatistic(const std::shared_ptr<PerfResults>& perf_results);
 
  private:
   std::shared_ptr<Task> task_;
-  static void CommonRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::function<void()>& pipeline,
-                        const std::shared_ptr<PerfResults>& perf_results);
+  [[nodiscard]] uint64_t GetInputSize() const;
+  void CommonRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::function<void()>& pipeline,
+                 const std::shared_ptr<PerfResults>& perf_results) const;
 };
 
 }  // namespace ppc::core
@@ -0,0 +1,166 @@
+#include "core/perf/include/hw_counters.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+ppc::core::HwCountersValues& ppc::core::HwCountersValues::operator+=(const HwCountersValues& other) {
+  cycles += other.cycles;
+  instructions += other.instructions;
+  llc_misses += other.llc_misses;
+  branch_misses += other.branch_misses;
+  context_switches += other.context_switches;
+  available = available || other.available;
+  if (other.available) {
+    scope = other.scope;
+  }
+  return *this;
+}
+
+const char* ppc::core::HwCountersScopeName(HwCountersScope scope) {
+  switch (scope) {
+    case HwCountersScope::kAllCpus:
+      return "all_cpus";
+    case HwCountersScope::kThread:
+      return "thread";
+    case HwCountersScope::kNone:
+      break;
+  }
+  return "none";
+}
+
+bool ppc::core::HwCounters::IsAvailable() const { return scope_ != HwCountersScope::kNone; }
+
+ppc::core::HwCountersScope ppc::core::HwCounters::Scope() const { return scope_; }
+
+#ifdef __linux__
+
+namespace {
+
+// pid -1 with a cpu counts everything on that CPU, pid 0 with cpu -1 the calling thread and its children
+int OpenCounter(uint32_t type, uint64_t config, int pid, int cpu) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = 1;
+  attr.inherit = pid == 0 ? 1 : 0;
+  // context switches are kernel events, so only hardware ones are limited to user space
+  attr.exclude_kernel = type == PERF_TYPE_HARDWARE ? 1 : 0;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, pid, cpu, -1, 0));
+}
+
+uint64_t ReadCounter(int fd) {
+  // value, time_enabled, time_running
+  uint64_t data[3] = {0, 0, 0};
+  if (fd < 0 || read(fd, data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0) {
+    return 0;
+  }
+  // scale counter when it was multiplexed with other events
+  if (data[2] < data[1]) {
+    return static_cast<uint64_t>(static_cast<double>(data[0]) * static_cast<double>(data[1]) /
+                                 static_cast<double>(data[2]));
+  }
+  return data[0];
+}
+
+}  // namespace
+
+ppc::core::HwCounters::EventFds ppc::core::HwCounters::OpenEvents(int pid, int cpu) {
+  EventFds fds{};
+  fds[kCycles] = OpenCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, pid, cpu);
+  fds[kInstructions] = OpenCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, pid, cpu);
+  fds[kLlcMisses] = OpenCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, pid, cpu);
+  fds[kBranchMisses] = OpenCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, pid, cpu);
+  fds[kContextSwitches] = OpenCounter(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES, pid, cpu);
+  return fds;
+}
+
+ppc::core::HwCounters::HwCounters() {
+  const auto has_open = [](const EventFds& fds) { return std::ranges::any_of(fds, [](int fd) { return fd >= 0; }); };
+
+  // Offline CPUs fail to open and are skipped; without permission for per CPU counters none opens
+  const auto cpus = static_cast<int>(sysconf(_SC_NPROCESSORS_CONF));
+  for (int cpu = 0; cpu < cpus; cpu++) {
+    const auto fds = OpenEvents(-1, cpu);
+    if (has_open(fds)) {
+      fds_.push_back(fds);
+    }
+  }
+  if (!fds_.empty()) {
+    scope_ = HwCountersScope::kAllCpus;
+    return;
+  }
+
+  const auto fds = OpenEvents(0, -1);
+  if (has_open(fds)) {
+    fds_.push_back(fds);
+    scope_ = HwCountersScope::kThread;
+  }
+}
+
+ppc::core::HwCounters::~HwCounters() {
+  for (const auto& fds : fds_) {
+    for (int fd : fds) {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+  }
+}
+
+void ppc::core::HwCounters::Start() {
+  for (const auto& fds : fds_) {
+    for (int fd : fds) {
+      if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+  }
+}
+
+ppc::core::HwCountersValues ppc::core::HwCounters::Stop() {
+  for (const auto& fds : fds_) {
+    for (int fd : fds) {
+      if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      }
+    }
+  }
+
+  HwCountersValues values;
+  for (const auto& fds : fds_) {
+    values.cycles += ReadCounter(fds[kCycles]);
+    values.instructions += ReadCounter(fds[kInstructions]);
+    values.llc_misses += ReadCounter(fds[kLlcMisses]);
+    values.branch_misses += ReadCounter(fds[kBranchMisses]);
+    values.context_switches += ReadCounter(fds[kContextSwitches]);
+  }
+  values.available = IsAvailable();
+  values.scope = scope_;
+  return values;
+}
+
+#else
+
+ppc::core::HwCounters::HwCounters() = default;
+
+ppc::core::HwCounters::~HwCounters() = default;
+
+void ppc::core::HwCounters::Start() {}
+
+ppc::core::HwCountersValues ppc::core::HwCounters::Stop() { return {}; }
+
+#endif
@@ -2,7 +2,14 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <iomanip>
 #include <iostream>
@@ -10,8 +17,206 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
+#include "core/perf/include/hw_counters.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// Nearest-rank percentile of sorted samples, 0 < p <= 1
+double SortedPercentile(const std::vector<double>& sorted, double p) {
+  auto rank = static_cast<size_t>(std::ceil(p * static_cast<double>(sorted.size())));
+  return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+// Path of current perf test directory relative to the project root, e.g. "tasks/seq/example"
+std::string GetTestRelativePath() {
+  const std::filesystem::path test_file(::testing::UnitTest::GetInstance()->current_test_info()->file());
+  auto relative_path = test_file.lexically_relative(PPC_PATH_TO_PROJECT).generic_string();
+  if (relative_path.empty() || relative_path.starts_with("..")) {
+    relative_path = test_file.generic_string();
+  }
+
+  auto perf_tests_position = relative_path.find("perf_tests");
+  if (perf_tests_position != std::string::npos && perf_tests_position > 0) {
+    relative_path.erase(perf_tests_position - 1);
+  }
+  return relative_path;
+}
+
+std::string EscapeJson(const std::string& str) {
+  std::string res;
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      res += '\\';
+    }
+    res += c;
+  }
+  return res;
+}
+
+int GetNumProcesses() {
+  for (const auto* env_name : {"OMPI_COMM_WORLD_SIZE", "PMI_SIZE"}) {
+    auto env_value = ppc::util::GetEnvVariable(env_name);
+    if (!env_value.empty()) {
+      return std::atoi(env_value.c_str());
+    }
+  }
+  return 1;
+}
+
+std::string ReadFirstLine(const std::filesystem::path& path) {
+  std::ifstream file(path);
+  std::string line;
+  std::getline(file, line);
+  return line;
+}
+
+// Commit checked out in the project tree, read at run time so that it neither goes stale nor needs a rebuild.
+// Empty when the tree is not a plain git checkout.
+std::string ReadGitCommitSha() {
+  const auto git_dir = std::filesystem::path(PPC_PATH_TO_PROJECT) / ".git";
+  const auto head = ReadFirstLine(git_dir / "HEAD");
+  if (!head.starts_with("ref: ")) {
+    // detached HEAD holds the sha itself
+    return head;
+  }
+  const auto ref = head.substr(5);
+  auto sha = ReadFirstLine(git_dir / ref);
+  if (!sha.empty()) {
+    return sha;
+  }
+  // refs moved by git gc into "<sha> <ref>" lines
+  std::ifstream packed_refs(git_dir / "packed-refs");
+  std::string line;
+  while (std::getline(packed_refs, line)) {
+    if (line.ends_with(" " + ref)) {
+      return line.substr(0, line.find(' '));
+    }
+  }
+  return {};
+}
+
+std::string HwCountersToJson(const ppc::core::HwCountersValues& values) {
+  std::stringstream res;
+  res << "{\"cycles\":" << values.cycles << ",\"instructions\":" << values.instructions
+      << ",\"llc_misses\":" << values.llc_misses << ",\"branch_misses\":" << values.branch_misses
+      << ",\"context_switches\":" << values.context_switches << "}";
+  return res.str();
+}
+
+constexpr std::array<const char*, ppc::core::Task::kPhasesCount> kPhasesNames = {"validation", "pre_processing",
+                                                                                "run", "post_processing"};
+
+std::string PhasesTimeToJson(const ppc::core::Task::PhasesTime& phases_time) {
+  std::stringstream res;
+  res << std::setprecision(10) << std::fixed << "{";
+  for (size_t phase = 0; phase < phases_time.size(); phase++) {
+    const auto& histogram = phases_time[phase];
+    res << (phase == 0 ? "" : ",") << "\"" << kPhasesNames[phase] << "\":{\"count\":" << histogram.count
+        << ",\"total_sec\":" << histogram.total_sec << ",\"min_sec\":" << histogram.min_sec
+        << ",\"max_sec\":" << histogram.max_sec << ",\"buckets_us_log2\":[";
+    for (size_t i = 0; i < histogram.buckets.size(); i++) {
+      res << (i == 0 ? "" : ",") << histogram.buckets[i];
+    }
+    res << "]}";
+  }
+  res << "}";
+  return res.str();
+}
+
+// Append one JSON record per perf run to the file given by PPC_PERF_RESULTS_FILE
+void WritePerfRecord(const std::shared_ptr<ppc::core::PerfResults>& perf_results, const std::string& relative_path,
+                     const std::string& type_test_name) {
+  const auto file_path = ppc::util::GetEnvVariable("PPC_PERF_RESULTS_FILE");
+  if (file_path.empty()) {
+    return;
+  }
+
+  std::string implementation = "none";
+  std::string task_name = std::filesystem::path(relative_path).filename().string();
+  if (relative_path.starts_with("tasks/")) {
+    implementation = relative_path.substr(6, relative_path.find('/', 6) - 6);
+  }
+
+  auto git_sha = ppc::util::GetEnvVariable("PPC_GIT_COMMIT_SHA");
+  if (git_sha.empty()) {
+    git_sha = ReadGitCommitSha();
+  }
+  if (git_sha.empty()) {
+    git_sha = "unknown";
+  }
+
+  std::stringstream record;
+  record << std::setprecision(10) << std::fixed;
+  record << "{\"task\":\"" << EscapeJson(task_name) << "\",";
+  record << "\"implementation\":\"" << EscapeJson(implementation) << "\",";
+  record << "\"path\":\"" << EscapeJson(relative_path) << "\",";
+  record << "\"test\":\"" << EscapeJson(::testing::UnitTest::GetInstance()->current_test_info()->name()) << "\",";
+  record << "\"type\":\"" << type_test_name << "\",";
+  record << "\"threads\":" << ppc::util::GetPPCNumThreads() << ",";
+  record << "\"processes\":" << GetNumProcesses() << ",";
+  record << "\"input_size\":" << perf_results->input_size << ",";
+  record << "\"git_sha\":\"" << EscapeJson(git_sha) << "\",";
+  record << "\"time_sec\":" << perf_results->time_sec << ",";
+  record << "\"min_sec\":" << perf_results->min_sec << ",";
+  record << "\"median_sec\":" << perf_results->median_sec << ",";
+  record << "\"p90_sec\":" << perf_results->p90_sec << ",";
+  record << "\"p99_sec\":" << perf_results->p99_sec << ",";
+  record << "\"stddev_sec\":" << perf_results->stddev_sec << ",";
+  record << "\"samples\":[";
+  for (size_t i = 0; i < perf_results->samples.size(); i++) {
+    record << (i == 0 ? "" : ",") << perf_results->samples[i];
+  }
+  record << "]";
+  record << ",\"phases\":" << PhasesTimeToJson(perf_results->phases_time);
+  if (perf_results->hw_counters_total.available) {
+    record << ",\"hw_counters_scope\":\"" << ppc::core::HwCountersScopeName(perf_results->hw_counters_total.scope)
+           << "\"";
+    record << ",\"hw_counters_total\":" << HwCountersToJson(perf_results->hw_counters_total);
+    record << ",\"hw_counters\":[";
+    for (size_t i = 0; i < perf_results->hw_counters.size(); i++) {
+      record << (i == 0 ? "" : ",") << HwCountersToJson(perf_results->hw_counters[i]);
+    }
+    record << "]";
+  }
+  record << "}";
+
+  std::ofstream file(file_path, std::ios::app);
+  if (!file.is_open()) {
+    throw std::runtime_error("Can not open perf results file: " + file_path);
+  }
+  file << record.str() << '\n';
+}
+
+// Print stages breakdown and performance counters of perf run
+void PrintPerfDetails(const std::shared_ptr<ppc::core::PerfResults>& perf_results, const std::string& relative_path,
+                      const std::string& type_test_name) {
+  std::cout << relative_path << ":" << type_test_name << ":phases";
+  for (size_t phase = 0; phase < perf_results->phases_time.size(); phase++) {
+    const auto& histogram = perf_results->phases_time[phase];
+    if (histogram.count != 0) {
+      std::cout << " " << kPhasesNames[phase] << "=" << std::fixed << std::setprecision(10) << histogram.total_sec
+                << "(x" << histogram.count << ")";
+    }
+  }
+  std::cout << '\n';
+
+  const auto& hw_total = perf_results->hw_counters_total;
+  if (hw_total.available) {
+    const double ipc =
+        hw_total.cycles != 0 ? static_cast<double>(hw_total.instructions) / static_cast<double>(hw_total.cycles) : 0.0;
+    std::cout << relative_path << ":" << type_test_name
+              << ":counters scope=" << ppc::core::HwCountersScopeName(hw_total.scope) << " cycles=" << hw_total.cycles
+              << " instructions=" << hw_total.instructions << " ipc=" << std::fixed << std::setprecision(3) << ipc
+              << " llc_misses=" << hw_total.llc_misses << " branch_misses=" << hw_total.branch_misses
+              << " context_switches=" << hw_total.context_switches << '\n';
+  }
+}
+
+}  // namespace
 
 ppc::core::Perf::Perf(const std::shared_ptr<Task>& task_ptr) { SetTask(task_ptr); }
 
@@ -23,6 +228,7 @@ void ppc::core::Perf::SetTask(const std::shared_ptr<Task>& task_ptr) {
 void ppc::core::Perf::PipelineRun(const std::shared_ptr<PerfAttr>& perf_attr,
                                   const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
   perf_results->type_of_running = PerfResults::TypeOfRunning::kPipeline;
+  perf_results->input_size = GetInputSize();
 
   CommonRun(
       perf_attr,
@@ -38,10 +244,15 @@ void ppc::core::Perf::PipelineRun(const std::shared_ptr<PerfAttr>& perf_attr,
 void ppc::core::Perf::TaskRun(const std::shared_ptr<PerfAttr>& perf_attr,
                               const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
   perf_results->type_of_running = PerfResults::TypeOfRunning::kTaskRun;
+  perf_results->input_size = GetInputSize();
 
   task_->Validation();
   task_->PreProcessing();
-  CommonRun(perf_attr, [&]() { task_->Run(); }, perf_results);
+  if (perf_attr->use_prepared_run) {
+    CommonRun(perf_attr, [&]() { task_->RunPrepared(task_->GetData()); }, perf_results);
+  } else {
+    CommonRun(perf_attr, [&]() { task_->Run(); }, perf_results);
+  }
   task_->PostProcessing();
 
   task_->Validation();
@@ -50,20 +261,90 @@ void ppc::core::Perf::TaskRun(const std::shared_ptr<PerfAttr>& perf_attr,
   task_->PostProcessing();
 }
 
+uint64_t ppc::core::Perf::GetInputSize() const {
+  uint64_t input_size = 0;
+  for (auto count : task_->GetData()->inputs_count) {
+    input_size += count;
+  }
+  return input_size;
+}
+
 void ppc::core::Perf::CommonRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::function<void()>& pipeline,
-                                const std::shared_ptr<ppc::core::PerfResults>& perf_results) {
-  auto begin = perf_attr->current_timer();
-  for (uint64_t i = 0; i < perf_attr->num_running; i++) {
+                                const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
+  for (uint64_t i = 0; i < perf_attr->num_warmup; i++) {
+    pipeline();
+  }
+  task_->ResetPhasesTime();
+
+  perf_results->samples.clear();
+  perf_results->samples.reserve(perf_attr->num_running);
+  perf_results->hw_counters.clear();
+  perf_results->hw_counters_total = HwCountersValues();
+
+  std::unique_ptr<HwCounters> hw_counters;
+  if (perf_attr->use_hw_counters || ppc::util::GetEnvVariable("PPC_PERF_HW_COUNTERS") == "1") {
+    hw_counters = std::make_unique<HwCounters>();
+  }
+
+  const uint64_t max_running = std::max(perf_attr->max_running, perf_attr->num_running);
+  double elapsed = 0.0;
+  auto prev = perf_attr->current_timer();
+  for (uint64_t i = 0; i < max_running; i++) {
+    if (i >= perf_attr->num_running && elapsed >= perf_attr->min_time_sec) {
+      break;
+    }
+    // Counters are started before and read after the timed interval, so their syscalls are not measured
+    if (hw_counters) {
+      hw_counters->Start();
+      prev = perf_attr->current_timer();
+    }
     pipeline();
+    auto cur = perf_attr->current_timer();
+    if (hw_counters) {
+      perf_results->hw_counters.push_back(hw_counters->Stop());
+      perf_results->hw_counters_total += perf_results->hw_counters.back();
+    }
+    perf_results->samples.push_back(cur - prev);
+    elapsed += cur - prev;
+    prev = cur;
   }
-  auto end = perf_attr->current_timer();
-  perf_results->time_sec = end - begin;
+  perf_results->time_sec = elapsed;
+  perf_results->phases_time = task_->GetPhasesTime();
+  CalcSamplesStatistic(perf_results);
+}
+
+void ppc::core::Perf::CalcSamplesStatistic(const std::shared_ptr<PerfResults>& perf_results) {
+  if (perf_results->samples.empty()) {
+    perf_results->min_sec = perf_results->max_sec = perf_results->mean_sec = 0.0;
+    perf_results->median_sec = perf_results->p90_sec = perf_results->p99_sec = perf_results->stddev_sec = 0.0;
+    return;
+  }
+
+  std::vector<double> sorted = perf_results->samples;
+  std::ranges::sort(sorted);
+  const size_t n = sorted.size();
+
+  double sum = 0.0;
+  for (double s : sorted) {
+    sum += s;
+  }
+  const double mean = sum / static_cast<double>(n);
+  double sq_sum = 0.0;
+  for (double s : sorted) {
+    sq_sum += (s - mean) * (s - mean);
+  }
+
+  perf_results->min_sec = sorted.front();
+  perf_results->max_sec = sorted.back();
+  perf_results->mean_sec = mean;
+  perf_results->median_sec = (n % 2 == 1) ? sorted[n / 2] : (sorted[(n / 2) - 1] + sorted[n / 2]) / 2.0;
+  perf_results->p90_sec = SortedPercentile(sorted, 0.9);
+  perf_results->p99_sec = SortedPercentile(sorted, 0.99);
+  perf_results->stddev_sec = (n > 1) ? std::sqrt(sq_sum / static_cast<double>(n - 1)) : 0.0;
 }
 
 void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& perf_results) {
-  std::string relative_path(::testing::UnitTest::GetInstance()->current_test_info()->file());
-  std::string ppc_regex_template("parallel_programming_course");
-  std::string perf_regex_template("perf_tests");
+  std::string relative_path = GetTestRelativePath();
   std::string type_test_name;
 
   auto time_secs = perf_results->time_sec;
@@ -76,11 +357,9 @@ void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& per
     type_test_name = "none";
   }
 
-  auto first_found_position = relative_path.find(ppc_regex_template) + ppc_regex_template.length() + 1;
-  relative_path.erase(0, first_found_position);
+  WritePerfRecord(perf_results, relative_path, type_test_name);
 
-  auto last_found_position = relative_path.find(perf_regex_template) - 1;
-  relative_path.erase(last_found_position, relative_path.length() - 1);
+  PrintPerfDetails(perf_results, relative_path, type_test_name);
 
   std::stringstream perf_res_str;
   if (time_secs < PerfResults::kMaxTime) {
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "core/pool/include/thread_pool.hpp"
+
+TEST(thread_pool_tests, check_task_group) {
+  ppc::core::ThreadPool pool(4);
+  EXPECT_EQ(pool.GetNumThreads(), 4U);
+  std::atomic<int> counter = 0;
+  ppc::core::TaskGroup group(pool);
+  for (int i = 0; i < 1000; i++) {
+    group.Run([&counter] { counter++; });
+  }
+  group.Wait();
+  EXPECT_EQ(counter, 1000);
+}
+
+TEST(thread_pool_tests, check_single_thread_pool) {
+  ppc::core::ThreadPool pool(1);
+  EXPECT_EQ(pool.GetNumThreads(), 1U);
+  std::atomic<int> counter = 0;
+  ppc::core::TaskGroup group(pool);
+  for (int i = 0; i < 10; i++) {
+    group.Run([&counter] { counter++; });
+  }
+  group.Wait();
+  EXPECT_EQ(counter, 10);
+}
+
+TEST(thread_pool_tests, check_nested_task_groups) {
+  ppc::core::ThreadPool pool(3);
+  std::function<uint64_t(uint64_t)> fib = [&](uint64_t n) -> uint64_t {
+    if (n < 2) {
+      return n;
+    }
+    uint64_t a = 0;
+    ppc::core::TaskGroup group(pool);
+    group.Run([&] { a = fib(n - 1); });
+    const uint64_t b = fib(n - 2);
+    group.Wait();
+    return a + b;
+  };
+  EXPECT_EQ(fib(20), 6765U);
+}
+
+TEST(thread_pool_tests, check_exception) {
+  ppc::core::ThreadPool pool(4);
+  ppc::core::TaskGroup group(pool);
+  std::atomic<int> counter = 0;
+  for (int i = 0; i < 100; i++) {
+    group.Run([&counter, i] {
+      if (i == 42) {
+        throw std::runtime_error("job failed");
+      }
+      counter++;
+    });
+  }
+  EXPECT_THROW(group.Wait(), std::runtime_error);
+  EXPECT_EQ(counter, 99);
+  // group can be reused after an error
+  group.Run([&counter] { counter++; });
+  EXPECT_NO_THROW(group.Wait());
+  EXPECT_EQ(counter, 100);
+}
+
+TEST(thread_pool_tests, check_parallel_for) {
+  ppc::core::ThreadPool pool(4);
+  std::vector<int> data(10007, 0);
+  ppc::core::ParallelFor(
+      0, data.size(),
+      [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+          data[i]++;
+        }
+      },
+      16, pool);
+  EXPECT_TRUE(std::ranges::all_of(data, [](int value) { return value == 1; }));
+}
+
+TEST(thread_pool_tests, check_parallel_for_empty_range) {
+  ppc::core::ThreadPool pool(2);
+  bool called = false;
+  ppc::core::ParallelFor(5, 5, [&](size_t, size_t) { called = true; }, 1, pool);
+  EXPECT_FALSE(called);
+}
+
+TEST(thread_pool_tests, check_parallel_reduce) {
+  ppc::core::ThreadPool pool(4);
+  std::vector<uint64_t> data(100000);
+  std::iota(data.begin(), data.end(), 1);
+  const auto sum = ppc::core::ParallelReduce<uint64_t>(
+      0, data.size(), 0,
+      [&](size_t begin, size_t end) {
+        return std::accumulate(data.begin() + static_cast<std::ptrdiff_t>(begin),
+                               data.begin() + static_cast<std::ptrdiff_t>(end), uint64_t{0});
+      },
+      std::plus<>(), 1, pool);
+  EXPECT_EQ(sum, 100000ULL * 100001ULL / 2);
+}
+
+TEST(thread_pool_tests, check_parallel_reduce_is_deterministic) {
+  ppc::core::ThreadPool pool(4);
+  std::vector<double> data(50000);
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = 1.0 / static_cast<double>(i + 1);
+  }
+  auto reduce = [&] {
+    return ppc::core::ParallelReduce<double>(
+        0, data.size(), 0.0,
+        [&](size_t begin, size_t end) {
+          double res = 0.0;
+          for (size_t i = begin; i < end; i++) {
+            res += data[i];
+          }
+          return res;
+        },
+        std::plus<>(), 1, pool);
+  };
+  const double first = reduce();
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(reduce(), first);
+  }
+}
+
+TEST(thread_pool_tests, check_shared_instance) {
+  auto &pool = ppc::core::ThreadPool::Instance();
+  EXPECT_EQ(&pool, &ppc::core::ThreadPool::Instance());
+  EXPECT_GE(pool.GetNumThreads(), 1U);
+  std::atomic<int> counter = 0;
+  ppc::core::ParallelFor(0, 100, [&](size_t begin, size_t end) { counter += static_cast<int>(end - begin); });
+  EXPECT_EQ(counter, 100);
+}
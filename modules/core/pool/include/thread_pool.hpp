@@ -0,0 +1,122 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ppc::core {
+
+// Work-stealing thread pool. Every worker owns a deque of jobs: it pops its own jobs from the back and
+// steals from the front of the other deques. Jobs submitted from outside the pool go to a shared queue.
+// The thread waiting for a TaskGroup helps to execute jobs, so num_threads - 1 workers are created.
+class ThreadPool {
+ public:
+  using Job = std::function<void()>;
+
+  explicit ThreadPool(size_t num_threads);
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ~ThreadPool();
+
+  // Shared pool sized from ppc::util::GetPPCNumThreads()
+  static ThreadPool &Instance();
+
+  [[nodiscard]] size_t GetNumThreads() const { return workers_.size() + 1; }
+  void Submit(Job job);
+  // Executes one pending job in the calling thread, returns false when there are no pending jobs
+  bool TryRunPendingJob();
+
+ private:
+  struct JobQueue {
+    std::deque<Job> jobs;
+    std::mutex mutex;
+  };
+
+  // queues_[i] belongs to worker i, the last queue is shared by external threads
+  std::vector<std::unique_ptr<JobQueue>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<size_t> pending_jobs_ = 0;
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_cv_;
+  bool stop_ = false;
+
+  bool TryPopJob(size_t own_queue, Job &job);
+  void WorkerLoop(size_t index);
+};
+
+// Group of jobs which can be waited for together. The first exception thrown by a job is rethrown by Wait().
+class TaskGroup {
+ public:
+  explicit TaskGroup(ThreadPool &pool = ThreadPool::Instance()) : pool_(pool) {}
+  TaskGroup(const TaskGroup &) = delete;
+  TaskGroup &operator=(const TaskGroup &) = delete;
+  ~TaskGroup();
+
+  void Run(std::function<void()> job);
+  void Wait();
+
+ private:
+  ThreadPool &pool_;
+  std::atomic<size_t> pending_ = 0;
+  std::exception_ptr error_;
+  std::mutex error_mutex_;
+};
+
+// Splits [begin, end) into chunks of at least grain indices and calls body(chunk_begin, chunk_end) for each chunk
+template <class Body>
+void ParallelFor(size_t begin, size_t end, Body &&body, size_t grain = 1, ThreadPool &pool = ThreadPool::Instance()) {
+  if (begin >= end) {
+    return;
+  }
+  const size_t size = end - begin;
+  // a few chunks per thread smooth out imbalance between chunks
+  const size_t num_chunks = std::clamp<size_t>(size / std::max<size_t>(grain, 1), 1, pool.GetNumThreads() * 4);
+  if (num_chunks == 1) {
+    body(begin, end);
+    return;
+  }
+  TaskGroup group(pool);
+  for (size_t chunk = 1; chunk < num_chunks; chunk++) {
+    group.Run([&body, begin, size, num_chunks, chunk] {
+      body(begin + (size * chunk / num_chunks), begin + (size * (chunk + 1) / num_chunks));
+    });
+  }
+  body(begin, begin + (size / num_chunks));
+  group.Wait();
+}
+
+// Reduces map(chunk_begin, chunk_end) results of the chunks of [begin, end) with reduce.
+// Chunks are combined in order, so the result does not depend on scheduling.
+template <class T, class Map, class Reduce>
+T ParallelReduce(size_t begin, size_t end, T identity, Map &&map, Reduce &&reduce, size_t grain = 1,
+                 ThreadPool &pool = ThreadPool::Instance()) {
+  if (begin >= end) {
+    return identity;
+  }
+  const size_t size = end - begin;
+  const size_t num_chunks = std::clamp<size_t>(size / std::max<size_t>(grain, 1), 1, pool.GetNumThreads() * 4);
+  std::vector<T> partial(num_chunks, identity);
+  ParallelFor(
+      0, num_chunks,
+      [&](size_t first, size_t last) {
+        for (size_t chunk = first; chunk < last; chunk++) {
+          partial[chunk] = map(begin + (size * chunk / num_chunks), begin + (size * (chunk + 1) / num_chunks));
+        }
+      },
+      1, pool);
+  T res = identity;
+  for (auto &value : partial) {
+    res = reduce(res, value);
+  }
+  return res;
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,154 @@
+#include "core/pool/include/thread_pool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// Pool and queue index of the worker running in the current thread
+thread_local const ppc::core::ThreadPool *current_pool = nullptr;
+thread_local size_t current_queue = 0;
+
+}  // namespace
+
+ppc::core::ThreadPool::ThreadPool(size_t num_threads) {
+  const size_t num_workers = std::max<size_t>(num_threads, 1) - 1;
+  for (size_t i = 0; i <= num_workers; i++) {
+    queues_.push_back(std::make_unique<JobQueue>());
+  }
+  workers_.reserve(num_workers);
+  for (size_t i = 0; i < num_workers; i++) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this, i);
+  }
+}
+
+ppc::core::ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stop_ = true;
+  }
+  sleep_cv_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+ppc::core::ThreadPool &ppc::core::ThreadPool::Instance() {
+  static ThreadPool pool(std::max(ppc::util::GetPPCNumThreads(), 1));
+  return pool;
+}
+
+void ppc::core::ThreadPool::Submit(Job job) {
+  const size_t queue = (current_pool == this) ? current_queue : queues_.size() - 1;
+  {
+    std::lock_guard<std::mutex> lock(queues_[queue]->mutex);
+    queues_[queue]->jobs.push_back(std::move(job));
+  }
+  {
+    // the increment under sleep_mutex_ prevents a lost wakeup of a worker going to sleep
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    pending_jobs_++;
+  }
+  sleep_cv_.notify_one();
+}
+
+bool ppc::core::ThreadPool::TryPopJob(size_t own_queue, Job &job) {
+  if (pending_jobs_ == 0) {
+    return false;
+  }
+  // own jobs are taken LIFO for locality, the others are stolen FIFO
+  for (size_t i = 0; i < queues_.size(); i++) {
+    const size_t queue = (own_queue + i) % queues_.size();
+    std::lock_guard<std::mutex> lock(queues_[queue]->mutex);
+    auto &jobs = queues_[queue]->jobs;
+    if (jobs.empty()) {
+      continue;
+    }
+    if (i == 0) {
+      job = std::move(jobs.back());
+      jobs.pop_back();
+    } else {
+      job = std::move(jobs.front());
+      jobs.pop_front();
+    }
+    pending_jobs_--;
+    return true;
+  }
+  return false;
+}
+
+bool ppc::core::ThreadPool::TryRunPendingJob() {
+  Job job;
+  const size_t own_queue = (current_pool == this) ? current_queue : queues_.size() - 1;
+  if (!TryPopJob(own_queue, job)) {
+    return false;
+  }
+  job();
+  return true;
+}
+
+void ppc::core::ThreadPool::WorkerLoop(size_t index) {
+  current_pool = this;
+  current_queue = index;
+  Job job;
+  while (true) {
+    if (TryPopJob(index, job)) {
+      job();
+      job = nullptr;
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    sleep_cv_.wait(lock, [this] { return stop_ || pending_jobs_ > 0; });
+    if (stop_) {
+      return;
+    }
+  }
+}
+
+ppc::core::TaskGroup::~TaskGroup() {
+  try {
+    Wait();
+  } catch (...) {
+    // destructor must not throw, errors are reported by an explicit Wait()
+    (void)0;
+  }
+}
+
+void ppc::core::TaskGroup::Run(std::function<void()> job) {
+  pending_++;
+  pool_.Submit([this, job = std::move(job)] {
+    try {
+      job();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex_);
+      if (!error_) {
+        error_ = std::current_exception();
+      }
+    }
+    pending_--;
+  });
+}
+
+void ppc::core::TaskGroup::Wait() {
+  while (pending_ > 0) {
+    if (!pool_.TryRunPendingJob()) {
+      std::this_thread::yield();
+    }
+  }
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    std::swap(error, error_);
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
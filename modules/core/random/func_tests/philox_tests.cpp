@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "core/random/include/philox.hpp"
+
+using ppc::core::random::Philox;
+
+TEST(philox_tests, known_answers) {
+  // Random123 test vectors: (counter, key) -> block, counter = {block lo, block hi, stream lo, stream hi}
+  EXPECT_EQ(Philox::Generate(0, 0, 0), (Philox::Block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+  EXPECT_EQ(Philox::Generate(~0ULL, ~0ULL, ~0ULL), (Philox::Block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+  EXPECT_EQ(Philox::Generate(0x299f31d0a4093822ULL, 0x0370734413198a2eULL, 0x85a308d3243f6a88ULL),
+            (Philox::Block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST(philox_tests, discard_matches_stepping) {
+  Philox stepped(7, 3);
+  for (const std::uint64_t skip : {0, 1, 2, 3, 5, 17, 1000}) {
+    Philox jumped(7, 3);
+    jumped.Discard(stepped.Position() + skip);
+    for (std::uint64_t i = 0; i < skip; i++) {
+      stepped();
+    }
+    for (int i = 0; i < 9; i++) {
+      ASSERT_EQ(jumped(), stepped()) << "skip " << skip;
+    }
+  }
+}
+
+TEST(philox_tests, fill_uniform_matches_scalar) {
+  for (const size_t offset : {0, 1, 2, 6}) {
+    for (const size_t count : {0, 1, 31, 32, 33, 100, 1000}) {
+      Philox batch(11);
+      Philox scalar(11);
+      batch.Discard(offset);
+      scalar.Discard(offset);
+      std::vector<double> out(count);
+      batch.FillUniform(out, -2.0, 3.0);
+      for (size_t i = 0; i < count; i++) {
+        ASSERT_EQ(out[i], scalar.Uniform(-2.0, 3.0)) << "offset " << offset << ", count " << count << ", i " << i;
+      }
+      EXPECT_EQ(batch.Position(), scalar.Position());
+      EXPECT_EQ(batch(), scalar());
+    }
+  }
+}
+
+TEST(philox_tests, streams_and_seeds_differ) {
+  Philox a(1, 0);
+  Philox b(1, 1);
+  Philox c(2, 0);
+  int same = 0;
+  for (int i = 0; i < 1000; i++) {
+    const auto x = a();
+    same += static_cast<int>(x == b()) + static_cast<int>(x == c());
+  }
+  EXPECT_LT(same, 3);
+}
+
+TEST(philox_tests, sample_streams_do_not_depend_on_chunking) {
+  constexpr size_t kSamples = 1000;
+  constexpr size_t kDraws = 3;
+  auto serial = ppc::core::random::SampleStream(5, 0, kDraws);
+  std::vector<double> expected(kSamples * kDraws);
+  serial.FillUniform(expected);
+  for (const size_t chunk : {1, 7, 64, 999}) {
+    for (size_t first = 0; first < kSamples; first += chunk) {
+      auto gen = ppc::core::random::SampleStream(5, first, kDraws);
+      for (size_t s = first; s < std::min(first + chunk, kSamples); s++) {
+        for (size_t d = 0; d < kDraws; d++) {
+          ASSERT_EQ(gen.Uniform(), expected[(s * kDraws) + d]) << "chunk " << chunk;
+        }
+      }
+    }
+  }
+}
+
+TEST(philox_tests, uniform_moments_and_std_distributions) {
+  Philox gen(3);
+  std::vector<double> u(1 << 20);
+  gen.FillUniform(u);
+  double sum = 0.0;
+  double sum_sq = 0.0;
+  for (const double x : u) {
+    ASSERT_GE(x, 0.0);
+    ASSERT_LT(x, 1.0);
+    sum += x;
+    sum_sq += x * x;
+  }
+  const double n = static_cast<double>(u.size());
+  EXPECT_NEAR(sum / n, 0.5, 0.002);
+  EXPECT_NEAR((sum_sq / n) - ((sum / n) * (sum / n)), 1.0 / 12.0, 0.001);
+
+  std::normal_distribution<double> normal(1.0, 2.0);
+  double normal_sum = 0.0;
+  for (int i = 0; i < 100000; i++) {
+    normal_sum += normal(gen);
+  }
+  EXPECT_NEAR(normal_sum / 100000, 1.0, 0.05);
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace ppc::core::random {
+
+// Seed of the tasks which do not take one, so their runs are reproducible
+constexpr std::uint64_t kDefaultSeed = 0x9E3779B97F4A7C15ULL;
+
+// Philox4x32-10 counter-based generator (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3").
+// Block i of stream s is ten rounds of a keyed bijection of the 128-bit counter (i, s), so the generator has
+// 40 bytes of state, jumps to any position in O(1) and different streams never overlap. Meets the
+// UniformRandomBitGenerator requirements, so <random> distributions accept it.
+class Philox {
+ public:
+  using result_type = std::uint32_t;  // NOLINT(readability-identifier-naming)
+  using Block = std::array<std::uint32_t, 4>;
+
+  explicit Philox(std::uint64_t seed = kDefaultSeed, std::uint64_t stream = 0) : seed_(seed), stream_(stream) {}
+
+  static constexpr result_type min() { return 0; }  // NOLINT(readability-identifier-naming)
+  static constexpr result_type max() {              // NOLINT(readability-identifier-naming)
+    return std::numeric_limits<result_type>::max();
+  }
+
+  result_type operator()() {
+    if (position_ % 4 == 0) {
+      block_ = Generate(seed_, stream_, position_ / 4);
+    }
+    return block_[position_++ % 4];
+  }
+
+  // Skips n outputs
+  void Discard(std::uint64_t n) {
+    position_ += n;
+    if (position_ % 4 != 0) {
+      block_ = Generate(seed_, stream_, position_ / 4);
+    }
+  }
+  [[nodiscard]] std::uint64_t Position() const { return position_; }
+
+  // Uniform double in [0, 1) with 53 random bits, takes two outputs
+  double Uniform() {
+    const std::uint64_t high = (*this)();
+    return static_cast<double>(((high << 32) | (*this)()) >> 11) * 0x1.0p-53;
+  }
+  double Uniform(double lo, double hi) { return lo + ((hi - lo) * Uniform()); }
+
+  // The numbers of out.size() calls of Uniform(lo, hi); whole blocks are generated in SIMD lanes
+  void FillUniform(std::span<double> out, double lo = 0.0, double hi = 1.0);
+
+  static Block Generate(std::uint64_t seed, std::uint64_t stream, std::uint64_t counter) {
+    std::uint32_t x0 = static_cast<std::uint32_t>(counter);
+    std::uint32_t x1 = static_cast<std::uint32_t>(counter >> 32);
+    std::uint32_t x2 = static_cast<std::uint32_t>(stream);
+    std::uint32_t x3 = static_cast<std::uint32_t>(stream >> 32);
+    std::uint32_t k0 = static_cast<std::uint32_t>(seed);
+    std::uint32_t k1 = static_cast<std::uint32_t>(seed >> 32);
+    for (int round = 0; round < kRounds; round++) {
+      const std::uint64_t p0 = std::uint64_t{kMul0} * x0;
+      const std::uint64_t p1 = std::uint64_t{kMul1} * x2;
+      x0 = static_cast<std::uint32_t>(p1 >> 32) ^ x1 ^ k0;
+      x1 = static_cast<std::uint32_t>(p1);
+      x2 = static_cast<std::uint32_t>(p0 >> 32) ^ x3 ^ k1;
+      x3 = static_cast<std::uint32_t>(p0);
+      k0 += kWeyl0;
+      k1 += kWeyl1;
+    }
+    return {x0, x1, x2, x3};
+  }
+
+  static constexpr int kRounds = 10;
+  static constexpr std::uint32_t kMul0 = 0xD2511F53;
+  static constexpr std::uint32_t kMul1 = 0xCD9E8D57;
+  static constexpr std::uint32_t kWeyl0 = 0x9E3779B9;
+  static constexpr std::uint32_t kWeyl1 = 0xBB67AE85;
+
+ private:
+  std::uint64_t seed_;
+  std::uint64_t stream_;
+  std::uint64_t position_ = 0;
+  Block block_{};
+};
+
+// Generator positioned at sample `sample` of a sequence in which every sample takes `draws` uniform doubles.
+// Chunks of a parallel loop which start their generators this way draw together exactly the numbers of the
+// serial loop, whatever the chunk boundaries and the number of threads are.
+inline Philox SampleStream(std::uint64_t seed, std::uint64_t sample, std::size_t draws, std::uint64_t stream = 0) {
+  Philox gen(seed, stream);
+  gen.Discard(2 * draws * sample);
+  return gen;
+}
+
+}  // namespace ppc::core::random
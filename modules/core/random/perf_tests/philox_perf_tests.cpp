@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/random/include/philox.hpp"
+#include "core/task/include/task.hpp"
+
+using ppc::core::random::Philox;
+
+namespace {
+
+// Fills the doubles of outputs[0] with uniform numbers of Philox(1), one by one or in one batch
+class UniformTask : public ppc::core::Task {
+ public:
+  UniformTask(ppc::core::TaskDataPtr task_data, bool batched) : Task(std::move(task_data)), batched_(batched) {}
+
+  bool ValidationImpl() override { return task_data->outputs.size() == 1; }
+
+  bool PreProcessingImpl() override {
+    out_ = {reinterpret_cast<double *>(task_data->outputs[0]), task_data->outputs_count[0]};
+    return true;
+  }
+
+  bool RunImpl() override {
+    Philox gen(1);
+    if (batched_) {
+      gen.FillUniform(out_);
+      return true;
+    }
+    for (double &x : out_) {
+      x = gen.Uniform();
+    }
+    return true;
+  }
+
+  bool PostProcessingImpl() override { return true; }
+
+ private:
+  bool batched_;
+  std::span<double> out_;
+};
+
+void RunUniformPerf(bool batched) {
+  constexpr size_t kCount = 1 << 24;
+  std::vector<double> out(kCount);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  auto task = std::make_shared<UniformTask>(task_data, batched);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  ppc::core::Perf perf_analyzer(task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  Philox gen(1);
+  gen.Discard(2 * (kCount - 1));
+  EXPECT_EQ(out.back(), gen.Uniform());
+}
+
+}  // namespace
+
+TEST(philox_perf_tests, uniform_scalar) { RunUniformPerf(false); }
+
+TEST(philox_perf_tests, uniform_batched) { RunUniformPerf(true); }
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "core/solver/include/cg.hpp"
+#include "core/task/include/task.hpp"
+
+namespace solver = ppc::core::solver;
+
+namespace {
+
+// Finite difference Laplacian on a side^dims grid (5 points in 2D, 7 in 3D) with Dirichlet boundaries
+solver::CsrMatrix Laplacian(size_t side, size_t dims) {
+  size_t n = 1;
+  for (size_t d = 0; d < dims; d++) {
+    n *= side;
+  }
+  solver::CsrMatrix a;
+  a.rows = n;
+  a.cols = n;
+  a.row_ptr.reserve(n + 1);
+  for (size_t i = 0; i < n; i++) {
+    // Neighbours in ascending order: -stride for the outer axes first, then the diagonal, then +stride
+    size_t stride = 1;
+    std::vector<std::pair<size_t, double>> entries = {{i, 2.0 * static_cast<double>(dims)}};
+    for (size_t d = 0; d < dims; d++) {
+      const size_t pos = (i / stride) % side;
+      if (pos > 0) {
+        entries.emplace_back(i - stride, -1.0);
+      }
+      if (pos + 1 < side) {
+        entries.emplace_back(i + stride, -1.0);
+      }
+      stride *= side;
+    }
+    std::ranges::sort(entries);
+    for (const auto &[col, value] : entries) {
+      a.col_idx.push_back(static_cast<std::uint32_t>(col));
+      a.values.push_back(value);
+    }
+    a.row_ptr.push_back(static_cast<std::uint32_t>(a.values.size()));
+  }
+  return a;
+}
+
+std::vector<double> MultiplyByOnes(const solver::CsrMatrix &a) {
+  std::vector<double> b(a.rows, 0.0);
+  for (size_t i = 0; i < a.rows; i++) {
+    for (size_t e = a.row_ptr[i]; e < a.row_ptr[i + 1]; e++) {
+      b[i] += a.values[e];
+    }
+  }
+  return b;
+}
+
+}  // namespace
+
+TEST(cg_tests, preconditioners_and_precisions_converge) {
+  const auto a = Laplacian(30, 2);
+  const auto b = MultiplyByOnes(a);
+  std::vector<size_t> iterations;
+  for (const auto preconditioner : {solver::Preconditioner::kNone, solver::Preconditioner::kJacobi,
+                                    solver::Preconditioner::kIncompleteCholesky}) {
+    for (const auto precision : {solver::Precision::kDouble, solver::Precision::kMixed}) {
+      std::vector<double> x(a.rows, 0.0);
+      const solver::CgOptions options{.preconditioner = preconditioner, .precision = precision, .tolerance = 1e-9};
+      const auto result = solver::SolveCg(solver::View(a), b, x, options);
+      ASSERT_TRUE(result.converged);
+      EXPECT_LE(result.residual_norm, 1e-9);
+      for (const double value : x) {
+        ASSERT_NEAR(value, 1.0, 1e-7);
+      }
+      iterations.push_back(result.iterations);
+    }
+  }
+  // Jacobi does nothing for a constant diagonal, IC(0) roughly halves the iterations
+  EXPECT_EQ(iterations[2], iterations[0]);
+  EXPECT_LT(iterations[4] * 3, iterations[0] * 2);
+}
+
+TEST(cg_tests, incomplete_cholesky_is_exact_without_fill_in) {
+  // A tridiagonal matrix has no fill-in, so IC(0) is its Cholesky factor and PCG takes one step
+  const auto a = Laplacian(50, 1);
+  const auto b = MultiplyByOnes(a);
+  std::vector<double> x(a.rows, 0.0);
+  const auto result = solver::SolveCg(solver::View(a), b, x,
+                                      {.preconditioner = solver::Preconditioner::kIncompleteCholesky});
+  EXPECT_TRUE(result.converged);
+  EXPECT_EQ(result.iterations, 1U);
+}
+
+TEST(cg_tests, mixed_precision_reaches_double_accuracy) {
+  // Values that float cannot represent: the float A * p drifts from the double residual
+  auto a = Laplacian(20, 2);
+  for (auto &value : a.values) {
+    value *= 0.1;
+  }
+  const auto b = MultiplyByOnes(a);
+  std::vector<double> x(a.rows, 0.0);
+  const solver::CgOptions options{
+      .precision = solver::Precision::kMixed, .tolerance = 1e-11, .residual_replacement = 10};
+  const auto result = solver::SolveCg(solver::View(a), b, x, options);
+  EXPECT_TRUE(result.converged);
+  for (const double value : x) {
+    ASSERT_NEAR(value, 1.0, 1e-8);
+  }
+}
+
+TEST(cg_tests, backends_and_starting_point) {
+  const auto a = Laplacian(12, 3);
+  const auto b = MultiplyByOnes(a);
+  std::vector<double> seq(a.rows, 0.0);
+  std::vector<double> stl(a.rows, 0.5);
+  const auto seq_result = solver::SolveCg(solver::View(a), b, seq, {.preconditioner = solver::Preconditioner::kJacobi});
+  const auto stl_result = solver::SolveCg(solver::View(a), b, stl, {.preconditioner = solver::Preconditioner::kJacobi},
+                                          solver::StlBackend{});
+  EXPECT_TRUE(seq_result.converged);
+  EXPECT_TRUE(stl_result.converged);
+  for (size_t i = 0; i < a.rows; i++) {
+    EXPECT_NEAR(seq[i], 1.0, 1e-9);
+    EXPECT_NEAR(stl[i], 1.0, 1e-9);
+  }
+
+  std::vector<double> capped(a.rows, 0.0);
+  const auto capped_result = solver::SolveCg(solver::View(a), b, capped, {.max_iterations = 2});
+  EXPECT_FALSE(capped_result.converged);
+  EXPECT_EQ(capped_result.iterations, 2U);
+  EXPECT_TRUE(solver::IsPlainCg({}));
+  EXPECT_FALSE(solver::IsPlainCg({.max_iterations = 2}));
+  EXPECT_FALSE(solver::IsPlainCg({.tolerance = 1e-6}));
+  EXPECT_THROW(solver::SolveCg(solver::View(a), b, std::span(capped).first(3)), std::invalid_argument);
+}
+
+TEST(cg_tests, dense_and_task_data_inputs) {
+  const std::vector<double> dense = {4, 1, 0, 1, 3, 0, 0, 0, 2};
+  const auto a = solver::DenseToCsr(dense, 3);
+  EXPECT_EQ(a.row_ptr, (std::vector<std::uint32_t>{0, 2, 4, 5}));
+  EXPECT_EQ(a.col_idx, (std::vector<std::uint32_t>{0, 1, 0, 1, 2}));
+  EXPECT_TRUE(solver::IsValidCsr(solver::View(a)));
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(a.row_ptr.data(), a.row_ptr.size());
+  task_data->AddInput(a.col_idx.data(), a.col_idx.size());
+  task_data->AddInput(a.values.data(), a.values.size());
+  EXPECT_TRUE(solver::HasCsrInputs(*task_data));
+  EXPECT_EQ(solver::MatrixInputsCount(*task_data), solver::kCsrInputsCount);
+  solver::TaskMatrix matrix;
+  ASSERT_TRUE(matrix.LoadCsr(*task_data, 0));
+  EXPECT_EQ(matrix.View().rows, 3U);
+  EXPECT_EQ(matrix.View().values.data(), a.values.data());
+  // b after the matrix and x in outputs[0], one element per row each
+  std::vector<double> b = {1, 2, 3};
+  std::vector<double> x(3);
+  task_data->AddInput(b.data(), b.size());
+  task_data->AddOutput(x.data(), x.size() - 1);
+  EXPECT_FALSE(matrix.LoadCsrSystem(*task_data));
+  task_data->outputs_count[0] = x.size();
+  ASSERT_TRUE(matrix.LoadCsrSystem(*task_data));
+  EXPECT_EQ(matrix.Rhs().data(), b.data());
+
+  auto unsorted = a;
+  std::swap(unsorted.col_idx[0], unsorted.col_idx[1]);
+  EXPECT_FALSE(solver::IsValidCsr(solver::View(unsorted)));
+
+  auto dense_data = std::make_shared<ppc::core::TaskData>();
+  dense_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(const_cast<double *>(dense.data())));
+  dense_data->inputs_count.emplace_back(dense.size());
+  EXPECT_FALSE(solver::HasCsrInputs(*dense_data));
+  EXPECT_EQ(solver::MatrixInputsCount(*dense_data), 1U);
+}
@@ -0,0 +1,350 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+#include "core/task/include/task.hpp"
+
+// Preconditioned conjugate gradients for sparse symmetric positive definite systems in CSR form. The vector
+// kernels run on the chunk backends of the sparse module (sparse_omp.hpp and sparse_tbb.hpp add OpenMP and TBB);
+// a communicator policy lets the same iteration run over blocks of rows held by different processes:
+// LocalComm is the whole matrix in one process, MpiRowComm (cg_mpi.hpp) distributes it over MPI.
+namespace ppc::core::solver {
+
+using sparse::SeqBackend;
+using sparse::StlBackend;
+
+using CsrMatrix = sparse::CsrMatrix<double>;
+
+// Read-only CSR matrix, or the block of rows [offset, offset + rows) of one with column indices of the whole
+// matrix. Views do not own the arrays, they can point into a CsrMatrix or TaskData buffers.
+template <class T>
+struct CsrView {
+  size_t rows = 0;
+  size_t cols = 0;
+  std::span<const std::uint32_t> row_ptr;
+  std::span<const std::uint32_t> col_idx;
+  std::span<const T> values;
+
+  [[nodiscard]] size_t NonZeros() const { return values.size(); }
+};
+
+inline CsrView<double> View(const CsrMatrix &a) {
+  return {.rows = a.rows, .cols = a.cols, .row_ptr = a.row_ptr, .col_idx = a.col_idx, .values = a.values};
+}
+
+// row_ptr starts at 0 and does not decrease, columns are in range and ascending within every row
+bool IsValidCsr(CsrView<double> a);
+// Nonzeros of a dense row-major n x n matrix
+CsrMatrix DenseToCsr(std::span<const double> a, size_t n);
+
+// TaskData layout of a CSR matrix: inputs first, first + 1 and first + 2 are row_ptr and col_idx
+// (std::uint32_t) and values (double) added with TaskData::AddInput. Such inputs are recognized by their
+// element types, the matrix is square with row_ptr.size() - 1 rows.
+constexpr size_t kCsrInputsCount = 3;
+bool HasCsrInputs(const TaskData &task_data, size_t first = 0);
+// Zero-copy view of the CSR inputs, throws if they are missing or have other types
+CsrView<double> CsrInputs(const TaskData &task_data, size_t first = 0);
+// Number of inputs taken by the matrix at `first`: kCsrInputsCount for CSR inputs, 1 for a dense matrix
+size_t MatrixInputsCount(const TaskData &task_data, size_t first = 0);
+
+// Matrix of a solver task: CSR inputs are used in place, a dense matrix is converted once
+class TaskMatrix {
+ public:
+  TaskMatrix() = default;
+  TaskMatrix(const TaskMatrix &) = delete;
+  TaskMatrix &operator=(const TaskMatrix &) = delete;
+
+  // Returns false for malformed CSR arrays
+  bool LoadCsr(const TaskData &task_data, size_t first);
+  // A x = b with the CSR inputs at `first`, b (double) right after them and x in outputs[0]; returns false for
+  // malformed CSR arrays or if b or x do not have one element per row
+  bool LoadCsrSystem(const TaskData &task_data, size_t first = 0);
+  void LoadDense(std::span<const double> a, size_t n);
+
+  [[nodiscard]] CsrView<double> View() const { return view_; }
+  // b of the system read by LoadCsrSystem, in place
+  [[nodiscard]] std::span<const double> Rhs() const { return rhs_; }
+
+ private:
+  CsrMatrix storage_;
+  CsrView<double> view_;
+  std::span<const double> rhs_;
+};
+
+enum class Preconditioner : std::uint8_t {
+  kNone,
+  // Inverse of the diagonal
+  kJacobi,
+  // Zero fill-in incomplete Cholesky factorization, applied by two sequential triangular solves
+  kIncompleteCholesky,
+};
+
+enum class Precision : std::uint8_t {
+  kDouble,
+  // A * p reads a float copy of the values (half the memory traffic of the matrix) and accumulates in double;
+  // vectors and dot products stay double and the residual is recomputed from A in double periodically and
+  // before convergence is accepted
+  kMixed,
+};
+
+struct CgOptions {
+  Preconditioner preconditioner = Preconditioner::kNone;
+  Precision precision = Precision::kDouble;
+  // Stops when the 2-norm of the residual b - A x is at most tolerance, or after max_iterations
+  // (0: the number of unknowns)
+  double tolerance = 1e-10;
+  size_t max_iterations = 0;
+  // Iterations between residual replacements in kMixed
+  size_t residual_replacement = 50;
+};
+
+// Default options: unpreconditioned CG in double precision with the default stopping rule, what the dense
+// kernels of the tasks run. They have their own tolerances and iteration limits, so any other options need SolveCg.
+inline bool IsPlainCg(const CgOptions &options) {
+  const CgOptions defaults;
+  return options.preconditioner == Preconditioner::kNone && options.precision == Precision::kDouble &&
+         options.tolerance == defaults.tolerance && options.max_iterations == defaults.max_iterations;
+}
+
+struct CgResult {
+  size_t iterations = 0;
+  double residual_norm = 0.0;
+  bool converged = false;
+};
+
+// Single process: the local rows are the whole matrix
+struct LocalComm {
+  [[nodiscard]] size_t RowOffset() const { return 0; }
+  // Sums values over the processes in place
+  void SumAll(std::span<double> /*values*/) const {}
+  // The whole vector whose local rows are `local`, `buffer` may be used as storage
+  [[nodiscard]] std::span<const double> GatherAll(std::span<const double> local,
+                                                  std::vector<double> & /*buffer*/) const {
+    return local;
+  }
+};
+
+// Diagonal entries of rows [offset, offset + a.rows) inverted, throws if one is missing or not positive
+std::vector<double> InverseDiagonal(CsrView<double> a, size_t offset = 0);
+
+// Zero fill-in incomplete Cholesky factor L, A ~ L L^T, of the diagonal block of rows [offset, offset + a.rows).
+// Entries outside the block are dropped, so across processes it is block Jacobi with IC(0) blocks. A pivot which
+// is not positive is replaced by the diagonal entry of A, which keeps the factor usable for matrices that are
+// not M-matrices.
+class IncompleteCholesky {
+ public:
+  explicit IncompleteCholesky(CsrView<double> a, size_t offset = 0);
+
+  // z = (L L^T)^-1 r
+  void Apply(std::span<const double> r, std::span<double> z) const;
+
+ private:
+  // Rows of L with ascending columns, the diagonal entry last
+  std::vector<size_t> row_ptr_;
+  std::vector<size_t> col_idx_;
+  std::vector<double> values_;
+};
+
+namespace detail {
+
+// Runs body(first, last) over chunks of [0, size)
+template <class Backend, class Body>
+void ForRanges(const Backend &backend, size_t size, const Body &body) {
+  const size_t chunks = sparse::detail::ChunksCount(backend, size);
+  backend.ForEachChunk(chunks, [&](size_t chunk) { body(size * chunk / chunks, size * (chunk + 1) / chunks); });
+}
+
+// N sums over [0, size), terms(i, sums) adds the terms of index i. Chunk sums are added in chunk order, so
+// the result does not depend on scheduling.
+template <size_t N, class Backend, class Terms>
+std::array<double, N> Sums(const Backend &backend, size_t size, const Terms &terms) {
+  const size_t chunks = sparse::detail::ChunksCount(backend, size);
+  std::vector<std::array<double, N>> partial(chunks);
+  backend.ForEachChunk(chunks, [&](size_t chunk) {
+    std::array<double, N> sums{};
+    for (size_t i = size * chunk / chunks; i < size * (chunk + 1) / chunks; i++) {
+      terms(i, sums);
+    }
+    partial[chunk] = sums;
+  });
+  std::array<double, N> total{};
+  for (const auto &sums : partial) {
+    for (size_t k = 0; k < N; k++) {
+      total[k] += sums[k];
+    }
+  }
+  return total;
+}
+
+// y = A * x over chunks of rows with about equal numbers of nonzeros, accumulating in double
+template <class T, class Backend>
+void Multiply(const CsrView<T> &a, std::span<const size_t> bounds, std::span<const double> x, std::span<double> y,
+              const Backend &backend) {
+  backend.ForEachChunk(bounds.size() - 1, [&](size_t chunk) {
+    for (size_t i = bounds[chunk]; i < bounds[chunk + 1]; i++) {
+      double sum = 0.0;
+      for (size_t e = a.row_ptr[i]; e < a.row_ptr[i + 1]; e++) {
+        sum += static_cast<double>(a.values[e]) * x[a.col_idx[e]];
+      }
+      y[i] = sum;
+    }
+  });
+}
+
+}  // namespace detail
+
+// Solves A x = b starting from the given x. With a communicator other than LocalComm, `a` is the local block
+// of rows starting at comm.RowOffset() and b and x hold its rows; every iteration gathers the preconditioned
+// residual once for A z and sums all its dot products in one reduction.
+template <class Backend = SeqBackend, class Comm = LocalComm>
+CgResult SolveCg(CsrView<double> a, std::span<const double> b, std::span<double> x, const CgOptions &options = {},
+                 const Backend &backend = {}, const Comm &comm = {}) {
+  const size_t rows = a.rows;
+  if (b.size() != rows || x.size() != rows || a.row_ptr.size() != rows + 1 || comm.RowOffset() + rows > a.cols) {
+    throw std::invalid_argument("SolveCg: sizes of the matrix and the vectors do not match");
+  }
+
+  std::vector<double> inverse_diagonal;
+  std::optional<IncompleteCholesky> cholesky;
+  switch (options.preconditioner) {
+    case Preconditioner::kNone:
+      break;
+    case Preconditioner::kJacobi:
+      inverse_diagonal = InverseDiagonal(a, comm.RowOffset());
+      break;
+    case Preconditioner::kIncompleteCholesky:
+      cholesky.emplace(a, comm.RowOffset());
+      break;
+  }
+
+  const bool mixed = options.precision == Precision::kMixed;
+  std::vector<float> low_values;
+  CsrView<float> low{};
+  if (mixed) {
+    low_values.assign(a.values.begin(), a.values.end());
+    low = {.rows = rows, .cols = a.cols, .row_ptr = a.row_ptr, .col_idx = a.col_idx, .values = low_values};
+  }
+
+  const auto bounds =
+      sparse::detail::SplitByWeight<std::uint32_t>(a.row_ptr, sparse::detail::ChunksCount(backend, rows));
+  std::vector<double> gathered;
+  std::vector<double> r(rows);
+  std::vector<double> z(rows);
+  std::vector<double> w(rows);
+  std::vector<double> p(rows);
+  std::vector<double> s(rows);
+
+  const auto multiply = [&](std::span<const double> v, std::span<double> out, bool low_precision) {
+    const auto whole = comm.GatherAll(v, gathered);
+    if (low_precision) {
+      detail::Multiply(low, bounds, whole, out, backend);
+    } else {
+      detail::Multiply(a, bounds, whole, out, backend);
+    }
+  };
+  const auto compute_residual = [&] {
+    multiply(x, w, false);
+    detail::ForRanges(backend, rows, [&](size_t first, size_t last) {
+      for (size_t i = first; i < last; i++) {
+        r[i] = b[i] - w[i];
+      }
+    });
+  };
+  const auto precondition = [&] {
+    if (cholesky) {
+      cholesky->Apply(r, z);
+      return;
+    }
+    detail::ForRanges(backend, rows, [&](size_t first, size_t last) {
+      for (size_t i = first; i < last; i++) {
+        z[i] = inverse_diagonal.empty() ? r[i] : inverse_diagonal[i] * r[i];
+      }
+    });
+  };
+  // w = A z, then (r, z), (w, z) and (r, r) in one reduction
+  const auto reduce = [&] {
+    multiply(z, w, mixed);
+    auto sums = detail::Sums<3>(backend, rows, [&](size_t i, std::array<double, 3> &t) {
+      t[0] += r[i] * z[i];
+      t[1] += w[i] * z[i];
+      t[2] += r[i] * r[i];
+    });
+    comm.SumAll(sums);
+    return sums;
+  };
+
+  compute_residual();
+  precondition();
+  auto dots = reduce();
+
+  const size_t max_iterations = options.max_iterations == 0 ? a.cols : options.max_iterations;
+  CgResult result;
+  // The residual was computed from A and x rather than updated by recurrence
+  bool fresh = true;
+  // p = z and s = w instead of continuing the previous direction
+  bool restart = true;
+  double alpha = 0.0;
+  double r_z_old = 0.0;
+  while (true) {
+    if (std::sqrt(dots[2]) <= options.tolerance) {
+      // The recurrence of r drifts from b - A x by the rounding of the float values; restart from the true
+      // residual, which makes the rest of the run a step of iterative refinement
+      if (mixed && !fresh) {
+        compute_residual();
+        precondition();
+        dots = reduce();
+        fresh = true;
+        restart = true;
+        continue;
+      }
+      result.converged = true;
+      break;
+    }
+    if (result.iterations == max_iterations) {
+      break;
+    }
+
+    // Chronopoulos-Gear: s = A p follows the recurrence of p, and (p, A p) follows from the sums of reduce()
+    const double beta = restart ? 0.0 : dots[0] / r_z_old;
+    const double p_q = restart ? dots[1] : dots[1] - (beta * dots[0] / alpha);
+    // A is not positive definite along p, or the direction vanished in rounding
+    if (!(p_q > 0.0)) {
+      break;
+    }
+    alpha = dots[0] / p_q;
+    detail::ForRanges(backend, rows, [&](size_t first, size_t last) {
+      for (size_t i = first; i < last; i++) {
+        p[i] = z[i] + (beta * p[i]);
+        s[i] = w[i] + (beta * s[i]);
+        x[i] += alpha * p[i];
+        r[i] -= alpha * s[i];
+      }
+    });
+    result.iterations++;
+
+    fresh = mixed && options.residual_replacement != 0 && result.iterations % options.residual_replacement == 0;
+    if (fresh) {
+      compute_residual();
+    }
+    precondition();
+    const double r_r_old = dots[2];
+    r_z_old = dots[0];
+    dots = reduce();
+    // A replaced residual larger than the one before the step means the recurrence has drifted below what the
+    // float A * z resolves; p then has a scale the new r z product does not match, so the directions restart
+    restart = fresh && dots[2] > r_r_old;
+  }
+  result.residual_norm = std::sqrt(dots[2]);
+  return result;
+}
+
+}  // namespace ppc::core::solver
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <boost/mpi/collectives/all_gatherv.hpp>
+#include <boost/mpi/collectives/all_reduce.hpp>
+#include <boost/mpi/collectives/broadcast.hpp>
+#include <boost/mpi/collectives/gatherv.hpp>
+#include <boost/mpi/collectives/scatterv.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/serialization/vector.hpp>  // NOLINT(misc-include-cleaner) - needed for MPI serialization
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "core/solver/include/cg.hpp"
+
+namespace ppc::core::solver {
+
+// Contiguous blocks of rows held by the processes of a communicator, row_counts[k] rows on process k.
+// A * z gathers z with one all_gatherv, the dot products of an iteration are summed with one all_reduce.
+class MpiRowComm {
+ public:
+  MpiRowComm(const boost::mpi::communicator &world, std::vector<int> row_counts)
+      : world_(world), counts_(std::move(row_counts)), displs_(counts_.size(), 0) {
+    std::exclusive_scan(counts_.begin(), counts_.end(), displs_.begin(), 0);
+  }
+
+  [[nodiscard]] size_t RowOffset() const { return static_cast<size_t>(displs_[world_.rank()]); }
+
+  void SumAll(std::span<double> values) const {
+    std::vector<double> local(values.begin(), values.end());
+    boost::mpi::all_reduce(world_, local.data(), static_cast<int>(local.size()), values.data(), std::plus<>());
+  }
+
+  [[nodiscard]] std::span<const double> GatherAll(std::span<const double> local, std::vector<double> &buffer) const {
+    buffer.resize(static_cast<size_t>(displs_.back() + counts_.back()));
+    boost::mpi::all_gatherv(world_, local.data(), buffer.data(), counts_, displs_);
+    return buffer;
+  }
+
+  [[nodiscard]] const std::vector<int> &RowCounts() const { return counts_; }
+  [[nodiscard]] const std::vector<int> &RowDispls() const { return displs_; }
+
+ private:
+  const boost::mpi::communicator &world_;
+  std::vector<int> counts_;
+  std::vector<int> displs_;
+};
+
+// Rows of a matrix held by one process after ScatterRows, with column indices of the whole matrix
+struct RowBlock {
+  CsrMatrix matrix;
+  // Rows of every process
+  std::vector<int> row_counts;
+};
+
+// Splits the rows of `a`, which is read on root only, into contiguous blocks with about equal numbers of
+// nonzeros and sends every process its block
+inline RowBlock ScatterRows(const boost::mpi::communicator &world, CsrView<double> a, int root = 0) {
+  const auto size = static_cast<size_t>(world.size());
+  std::uint64_t n = a.rows;
+  std::vector<int> row_counts(size, 0);
+  std::vector<int> nnz_counts(size, 0);
+  if (world.rank() == root) {
+    const auto bounds = sparse::detail::SplitByWeight<std::uint32_t>(a.row_ptr, size);
+    for (size_t k = 0; k < size; k++) {
+      row_counts[k] = static_cast<int>(bounds[k + 1] - bounds[k]);
+      nnz_counts[k] = static_cast<int>(a.row_ptr[bounds[k + 1]] - a.row_ptr[bounds[k]]);
+    }
+  }
+  boost::mpi::broadcast(world, n, root);
+  boost::mpi::broadcast(world, row_counts, root);
+  boost::mpi::broadcast(world, nnz_counts, root);
+
+  std::vector<int> row_displs(size, 0);
+  std::vector<int> nnz_displs(size, 0);
+  std::exclusive_scan(row_counts.begin(), row_counts.end(), row_displs.begin(), 0);
+  std::exclusive_scan(nnz_counts.begin(), nnz_counts.end(), nnz_displs.begin(), 0);
+
+  // Row lengths travel instead of row_ptr, whose values depend on where the block starts
+  std::vector<std::uint32_t> lengths;
+  if (world.rank() == root) {
+    lengths.resize(a.rows);
+    for (size_t i = 0; i < a.rows; i++) {
+      lengths[i] = a.row_ptr[i + 1] - a.row_ptr[i];
+    }
+  }
+  const int rank = world.rank();
+  RowBlock block{.matrix = {}, .row_counts = row_counts};
+  auto &m = block.matrix;
+  m.rows = static_cast<size_t>(row_counts[rank]);
+  m.cols = n;
+  std::vector<std::uint32_t> local_lengths(m.rows);
+  m.col_idx.resize(static_cast<size_t>(nnz_counts[rank]));
+  m.values.resize(m.col_idx.size());
+  boost::mpi::scatterv(world, lengths.data(), row_counts, row_displs, local_lengths.data(), row_counts[rank], root);
+  boost::mpi::scatterv(world, a.col_idx.data(), nnz_counts, nnz_displs, m.col_idx.data(), nnz_counts[rank], root);
+  boost::mpi::scatterv(world, a.values.data(), nnz_counts, nnz_displs, m.values.data(), nnz_counts[rank], root);
+  m.row_ptr.assign(m.rows + 1, 0);
+  std::inclusive_scan(local_lengths.begin(), local_lengths.end(), m.row_ptr.begin() + 1);
+  return block;
+}
+
+// Local rows of a vector read on root
+inline std::vector<double> ScatterRows(const boost::mpi::communicator &world, std::span<const double> v,
+                                       const MpiRowComm &comm, int root = 0) {
+  std::vector<double> local(static_cast<size_t>(comm.RowCounts()[world.rank()]));
+  boost::mpi::scatterv(world, v.data(), comm.RowCounts(), comm.RowDispls(), local.data(),
+                       static_cast<int>(local.size()), root);
+  return local;
+}
+
+// Whole vector on root from the local rows of every process
+inline void GatherRows(const boost::mpi::communicator &world, std::span<const double> local, std::span<double> v,
+                       const MpiRowComm &comm, int root = 0) {
+  boost::mpi::gatherv(world, local.data(), static_cast<int>(local.size()), v.data(), comm.RowCounts(),
+                      comm.RowDispls(), root);
+}
+
+}  // namespace ppc::core::solver
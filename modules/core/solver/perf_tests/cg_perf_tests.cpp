@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/solver/include/cg.hpp"
+#include "core/task/include/task.hpp"
+
+namespace solver = ppc::core::solver;
+
+namespace {
+
+// 7 point finite difference Laplacian on a side^3 grid with Dirichlet boundaries
+solver::CsrMatrix Laplacian3d(size_t side) {
+  const size_t n = side * side * side;
+  solver::CsrMatrix a;
+  a.rows = n;
+  a.cols = n;
+  a.row_ptr.reserve(n + 1);
+  for (size_t i = 0; i < n; i++) {
+    size_t stride = 1;
+    std::vector<std::pair<size_t, double>> entries = {{i, 6.0}};
+    for (size_t d = 0; d < 3; d++) {
+      const size_t pos = (i / stride) % side;
+      if (pos > 0) {
+        entries.emplace_back(i - stride, -1.0);
+      }
+      if (pos + 1 < side) {
+        entries.emplace_back(i + stride, -1.0);
+      }
+      stride *= side;
+    }
+    std::ranges::sort(entries);
+    for (const auto &[col, value] : entries) {
+      a.col_idx.push_back(static_cast<std::uint32_t>(col));
+      a.values.push_back(value);
+    }
+    a.row_ptr.push_back(static_cast<std::uint32_t>(a.values.size()));
+  }
+  return a;
+}
+
+// Solves A x = b for the matrix in inputs[0] and b in inputs[1] from a zero start into outputs[0]
+class PoissonCgTask : public ppc::core::Task {
+ public:
+  PoissonCgTask(ppc::core::TaskDataPtr task_data, solver::CgOptions options)
+      : Task(std::move(task_data)), options_(options) {}
+
+  bool ValidationImpl() override { return task_data->inputs.size() == 2 && task_data->outputs.size() == 1; }
+
+  bool PreProcessingImpl() override {
+    a_ = reinterpret_cast<solver::CsrMatrix *>(task_data->inputs[0]);
+    b_ = reinterpret_cast<std::vector<double> *>(task_data->inputs[1]);
+    return true;
+  }
+
+  bool RunImpl() override {
+    x_.assign(a_->rows, 0.0);
+    result_ = solver::SolveCg(solver::View(*a_), *b_, x_, options_, solver::StlBackend{});
+    return result_.converged;
+  }
+
+  bool PostProcessingImpl() override {
+    *reinterpret_cast<std::vector<double> *>(task_data->outputs[0]) = std::move(x_);
+    return true;
+  }
+
+ private:
+  solver::CgOptions options_;
+  solver::CsrMatrix *a_ = nullptr;
+  std::vector<double> *b_ = nullptr;
+  std::vector<double> x_;
+  solver::CgResult result_;
+};
+
+// 3D Poisson problem with 64k unknowns: dense n x n storage would take 32 GB, CSR takes 5 MB
+void RunPoissonPerf(const solver::CgOptions &options) {
+  auto a = Laplacian3d(40);
+  // Row sums, so the solution is all ones
+  std::vector<double> b(a.rows, 0.0);
+  for (size_t i = 0; i < a.rows; i++) {
+    for (size_t e = a.row_ptr[i]; e < a.row_ptr[i + 1]; e++) {
+      b[i] += a.values[e];
+    }
+  }
+  std::vector<double> x;
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&a));
+  task_data->inputs_count.emplace_back(a.values.size());
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&b));
+  task_data->inputs_count.emplace_back(b.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(&x));
+  task_data->outputs_count.emplace_back(a.rows);
+
+  auto task = std::make_shared<PoissonCgTask>(task_data, options);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  ppc::core::Perf perf_analyzer(task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  ASSERT_EQ(x.size(), a.rows);
+  for (const double v : x) {
+    ASSERT_NEAR(v, 1.0, 1e-6);
+  }
+}
+
+}  // namespace
+
+TEST(cg_perf_tests, poisson_3d_plain) { RunPoissonPerf({.tolerance = 1e-8}); }
+
+TEST(cg_perf_tests, poisson_3d_jacobi) {
+  RunPoissonPerf({.preconditioner = solver::Preconditioner::kJacobi, .tolerance = 1e-8});
+}
+
+TEST(cg_perf_tests, poisson_3d_incomplete_cholesky) {
+  RunPoissonPerf({.preconditioner = solver::Preconditioner::kIncompleteCholesky, .tolerance = 1e-8});
+}
+
+TEST(cg_perf_tests, poisson_3d_mixed_precision) {
+  RunPoissonPerf({.precision = solver::Precision::kMixed, .tolerance = 1e-8});
+}
@@ -0,0 +1,177 @@
+#include "core/solver/include/cg.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <typeinfo>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+bool ppc::core::solver::IsValidCsr(CsrView<double> a) {
+  if (a.row_ptr.size() != a.rows + 1 || a.row_ptr.front() != 0 || a.row_ptr.back() != a.col_idx.size() ||
+      a.col_idx.size() != a.values.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.rows; i++) {
+    if (a.row_ptr[i] > a.row_ptr[i + 1]) {
+      return false;
+    }
+    for (size_t e = a.row_ptr[i]; e < a.row_ptr[i + 1]; e++) {
+      if (a.col_idx[e] >= a.cols || (e > a.row_ptr[i] && a.col_idx[e] <= a.col_idx[e - 1])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+ppc::core::solver::CsrMatrix ppc::core::solver::DenseToCsr(std::span<const double> a, size_t n) {
+  if (a.size() != n * n) {
+    throw std::invalid_argument("DenseToCsr: the matrix is not n x n");
+  }
+  CsrMatrix res;
+  res.rows = n;
+  res.cols = n;
+  res.row_ptr.reserve(n + 1);
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      if (a[(i * n) + j] != 0.0) {
+        res.col_idx.push_back(static_cast<std::uint32_t>(j));
+        res.values.push_back(a[(i * n) + j]);
+      }
+    }
+    if (res.values.size() > std::numeric_limits<std::uint32_t>::max()) {
+      throw std::invalid_argument("DenseToCsr: too many nonzeros for 32-bit indices");
+    }
+    res.row_ptr.push_back(static_cast<std::uint32_t>(res.values.size()));
+  }
+  return res;
+}
+
+bool ppc::core::solver::HasCsrInputs(const TaskData &task_data, size_t first) {
+  const auto has_type = [&](size_t i, const std::type_info &type) {
+    return i < task_data.inputs_info.size() && task_data.inputs_info[i].element_type != nullptr &&
+           *task_data.inputs_info[i].element_type == type;
+  };
+  return has_type(first, typeid(std::uint32_t)) && has_type(first + 1, typeid(std::uint32_t)) &&
+         has_type(first + 2, typeid(double));
+}
+
+ppc::core::solver::CsrView<double> ppc::core::solver::CsrInputs(const TaskData &task_data, size_t first) {
+  const auto row_ptr = task_data.Input<const std::uint32_t>(first);
+  const size_t rows = row_ptr.empty() ? 0 : row_ptr.size() - 1;
+  return {.rows = rows,
+          .cols = rows,
+          .row_ptr = row_ptr,
+          .col_idx = task_data.Input<const std::uint32_t>(first + 1),
+          .values = task_data.Input<const double>(first + 2)};
+}
+
+size_t ppc::core::solver::MatrixInputsCount(const TaskData &task_data, size_t first) {
+  return HasCsrInputs(task_data, first) ? kCsrInputsCount : 1;
+}
+
+bool ppc::core::solver::TaskMatrix::LoadCsr(const TaskData &task_data, size_t first) {
+  view_ = CsrInputs(task_data, first);
+  return !view_.row_ptr.empty() && IsValidCsr(view_);
+}
+
+bool ppc::core::solver::TaskMatrix::LoadCsrSystem(const TaskData &task_data, size_t first) {
+  const size_t b_input = first + kCsrInputsCount;
+  if (!LoadCsr(task_data, first) || task_data.inputs_count.size() <= b_input || task_data.outputs_count.empty() ||
+      task_data.inputs_count[b_input] != view_.rows || task_data.outputs_count[0] != view_.rows) {
+    return false;
+  }
+  rhs_ = task_data.Input<const double>(b_input);
+  return true;
+}
+
+void ppc::core::solver::TaskMatrix::LoadDense(std::span<const double> a, size_t n) {
+  storage_ = DenseToCsr(a, n);
+  view_ = solver::View(storage_);
+}
+
+std::vector<double> ppc::core::solver::InverseDiagonal(CsrView<double> a, size_t offset) {
+  std::vector<double> res(a.rows);
+  for (size_t i = 0; i < a.rows; i++) {
+    double diagonal = 0.0;
+    for (size_t e = a.row_ptr[i]; e < a.row_ptr[i + 1]; e++) {
+      if (a.col_idx[e] == offset + i) {
+        diagonal = a.values[e];
+      }
+    }
+    if (!(diagonal > 0.0)) {
+      throw std::invalid_argument("InverseDiagonal: diagonal entry is missing or not positive");
+    }
+    res[i] = 1.0 / diagonal;
+  }
+  return res;
+}
+
+ppc::core::solver::IncompleteCholesky::IncompleteCholesky(CsrView<double> a, size_t offset) {
+  const size_t n = a.rows;
+  row_ptr_.reserve(n + 1);
+  row_ptr_.push_back(0);
+  // Row i of L scattered by column while it is computed, and where its entries are
+  std::vector<double> row(n, 0.0);
+  std::vector<size_t> diagonal_pos(n);
+  for (size_t i = 0; i < n; i++) {
+    const size_t begin = col_idx_.size();
+    double diagonal = 0.0;
+    for (size_t e = a.row_ptr[i]; e < a.row_ptr[i + 1]; e++) {
+      const size_t col = a.col_idx[e];
+      if (col < offset || col > offset + i) {
+        continue;
+      }
+      if (col == offset + i) {
+        diagonal = a.values[e];
+        continue;
+      }
+      // L_ik = (a_ik - sum over j < k of L_ij L_kj) / L_kk; both rows are known left of k
+      const size_t k = col - offset;
+      double value = a.values[e];
+      for (size_t f = row_ptr_[k]; f < diagonal_pos[k]; f++) {
+        value -= values_[f] * row[col_idx_[f]];
+      }
+      value /= values_[diagonal_pos[k]];
+      row[k] = value;
+      col_idx_.push_back(k);
+      values_.push_back(value);
+    }
+    if (!(diagonal > 0.0)) {
+      throw std::invalid_argument("IncompleteCholesky: diagonal entry is missing or not positive");
+    }
+    double pivot = diagonal;
+    for (size_t f = begin; f < col_idx_.size(); f++) {
+      pivot -= values_[f] * values_[f];
+      row[col_idx_[f]] = 0.0;
+    }
+    diagonal_pos[i] = col_idx_.size();
+    col_idx_.push_back(i);
+    values_.push_back(std::sqrt(pivot > 0.0 ? pivot : diagonal));
+    row_ptr_.push_back(col_idx_.size());
+  }
+}
+
+void ppc::core::solver::IncompleteCholesky::Apply(std::span<const double> r, std::span<double> z) const {
+  const size_t n = row_ptr_.size() - 1;
+  // L y = r
+  for (size_t i = 0; i < n; i++) {
+    double value = r[i];
+    for (size_t e = row_ptr_[i]; e + 1 < row_ptr_[i + 1]; e++) {
+      value -= values_[e] * z[col_idx_[e]];
+    }
+    z[i] = value / values_[row_ptr_[i + 1] - 1];
+  }
+  // L^T z = y, walking the rows of L backwards
+  for (size_t i = n; i-- > 0;) {
+    z[i] /= values_[row_ptr_[i + 1] - 1];
+    for (size_t e = row_ptr_[i]; e + 1 < row_ptr_[i + 1]; e++) {
+      z[col_idx_[e]] -= values_[e] * z[i];
+    }
+  }
+}
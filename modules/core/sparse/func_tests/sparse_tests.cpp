@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "core/pool/include/thread_pool.hpp"
+#include "core/sparse/include/sparse.hpp"
+
+#ifdef _OPENMP
+#include "core/sparse/include/sparse_omp.hpp"
+#endif
+
+namespace sparse = ppc::core::sparse;
+
+namespace {
+
+// Dense row-major matrix with about density * rows * cols nonzeros
+template <class T>
+std::vector<T> RandomDense(size_t rows, size_t cols, double density, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  std::bernoulli_distribution nonzero(density);
+  std::vector<T> dense(rows * cols, T{});
+  for (auto &x : dense) {
+    if (nonzero(gen)) {
+      if constexpr (std::is_same_v<T, std::complex<double>>) {
+        x = T{value(gen), value(gen)};
+      } else {
+        x = static_cast<T>(value(gen));
+      }
+    }
+  }
+  return dense;
+}
+
+template <class T, class Index = std::uint32_t>
+sparse::CsrMatrix<T, Index> ToCsr(const std::vector<T> &dense, size_t rows, size_t cols) {
+  sparse::CsrMatrix<T, Index> m{.rows = rows, .cols = cols};
+  for (size_t i = 0; i < rows; i++) {
+    for (size_t j = 0; j < cols; j++) {
+      if (dense[(i * cols) + j] != T{}) {
+        m.col_idx.push_back(static_cast<Index>(j));
+        m.values.push_back(dense[(i * cols) + j]);
+      }
+    }
+    m.row_ptr.push_back(static_cast<Index>(m.values.size()));
+  }
+  return m;
+}
+
+template <class T, class Index>
+std::vector<T> ToDense(const sparse::CsrMatrix<T, Index> &m) {
+  std::vector<T> dense(m.rows * m.cols, T{});
+  for (size_t i = 0; i < m.rows; i++) {
+    for (auto e = m.row_ptr[i]; e < m.row_ptr[i + 1]; e++) {
+      dense[(i * m.cols) + m.col_idx[e]] += m.values[e];
+    }
+  }
+  return dense;
+}
+
+template <class T>
+std::vector<T> DenseMultiply(const std::vector<T> &a, const std::vector<T> &b, size_t m, size_t k, size_t n) {
+  std::vector<T> c(m * n, T{});
+  for (size_t i = 0; i < m; i++) {
+    for (size_t p = 0; p < k; p++) {
+      for (size_t j = 0; j < n; j++) {
+        c[(i * n) + j] += a[(i * k) + p] * b[(p * n) + j];
+      }
+    }
+  }
+  return c;
+}
+
+template <class T>
+void ExpectNear(const std::vector<T> &actual, const std::vector<T> &expected) {
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); i++) {
+    EXPECT_NEAR(std::abs(actual[i] - expected[i]), 0.0, 1e-12) << "at " << i;
+  }
+}
+
+template <class T, class Index, class Backend>
+void CheckSpGemm(const Backend &backend, sparse::SpGemmAccumulator accumulator) {
+  const size_t m = 37;
+  const size_t k = 53;
+  const size_t n = 29;
+  const auto a = RandomDense<T>(m, k, 0.1, 1);
+  const auto b = RandomDense<T>(k, n, 0.2, 2);
+  const auto c = sparse::SpGemm(ToCsr<T, Index>(a, m, k), ToCsr<T, Index>(b, k, n), backend,
+                                {.accumulator = accumulator});
+  EXPECT_EQ(c.rows, m);
+  EXPECT_EQ(c.cols, n);
+  for (size_t i = 0; i < m; i++) {
+    for (auto e = c.row_ptr[i] + 1; e < c.row_ptr[i + 1]; e++) {
+      EXPECT_LT(c.col_idx[e - 1], c.col_idx[e]);
+    }
+  }
+  ExpectNear(ToDense(c), DenseMultiply(a, b, m, k, n));
+}
+
+}  // namespace
+
+TEST(sparse_tests, csr_ccs_round_trip) {
+  const auto dense = RandomDense<double>(40, 70, 0.1, 3);
+  const auto a = ToCsr(dense, 40, 70);
+  for (const bool parallel : {false, true}) {
+    const auto ccs = parallel ? sparse::ToCcs(a, sparse::StlBackend{}) : sparse::ToCcs(a);
+    ASSERT_EQ(ccs.col_ptr.size(), 71U);
+    for (size_t j = 0; j < 70; j++) {
+      for (auto e = ccs.col_ptr[j]; e < ccs.col_ptr[j + 1]; e++) {
+        EXPECT_EQ(ccs.values[e], dense[(ccs.row_idx[e] * 70) + j]);
+      }
+    }
+    const auto back = parallel ? sparse::ToCsr(ccs, sparse::StlBackend{}) : sparse::ToCsr(ccs);
+    EXPECT_EQ(back.row_ptr, a.row_ptr);
+    EXPECT_EQ(back.col_idx, a.col_idx);
+    EXPECT_EQ(back.values, a.values);
+  }
+}
+
+TEST(sparse_tests, transpose_matches_dense) {
+  const auto dense = RandomDense<double>(300, 20, 0.5, 4);
+  const auto t = sparse::Transpose(ToCsr(dense, 300, 20), sparse::StlBackend{});
+  ASSERT_EQ(t.rows, 20U);
+  ASSERT_EQ(t.cols, 300U);
+  const auto t_dense = ToDense(t);
+  for (size_t i = 0; i < 300; i++) {
+    for (size_t j = 0; j < 20; j++) {
+      EXPECT_EQ(t_dense[(j * 300) + i], dense[(i * 20) + j]);
+    }
+  }
+}
+
+TEST(sparse_tests, spmv_csr_and_ccs) {
+  using Complex = std::complex<double>;
+  const auto dense = RandomDense<Complex>(50, 60, 0.2, 5);
+  const auto x = RandomDense<Complex>(60, 1, 1.0, 6);
+  const auto expected = DenseMultiply(dense, x, 50, 60, 1);
+  const auto csr = ToCsr(dense, 50, 60);
+  const auto ccs = sparse::ToCcs(csr);
+
+  std::vector<Complex> y(50);
+  sparse::SpMV<Complex>(csr, x, y);
+  ExpectNear(y, expected);
+  sparse::SpMV<Complex>(csr, x, y, sparse::StlBackend{});
+  ExpectNear(y, expected);
+  sparse::SpMV<Complex>(ccs, x, y);
+  ExpectNear(y, expected);
+  sparse::SpMV<Complex>(ccs, x, y, sparse::StlBackend{});
+  ExpectNear(y, expected);
+}
+
+TEST(sparse_tests, spgemm_seq) {
+  CheckSpGemm<double, std::uint32_t>(sparse::SeqBackend{}, sparse::SpGemmAccumulator::kAuto);
+  CheckSpGemm<double, std::uint32_t>(sparse::SeqBackend{}, sparse::SpGemmAccumulator::kDense);
+  CheckSpGemm<double, std::uint32_t>(sparse::SeqBackend{}, sparse::SpGemmAccumulator::kSparse);
+}
+
+TEST(sparse_tests, spgemm_stl) {
+  CheckSpGemm<double, std::uint32_t>(sparse::StlBackend{}, sparse::SpGemmAccumulator::kAuto);
+  CheckSpGemm<double, std::uint32_t>(sparse::StlBackend{}, sparse::SpGemmAccumulator::kDense);
+  CheckSpGemm<double, std::uint32_t>(sparse::StlBackend{}, sparse::SpGemmAccumulator::kSparse);
+}
+
+TEST(sparse_tests, spgemm_complex_64bit_indices) {
+  CheckSpGemm<std::complex<double>, std::uint64_t>(sparse::StlBackend{}, sparse::SpGemmAccumulator::kAuto);
+  CheckSpGemm<std::complex<double>, std::int64_t>(sparse::SeqBackend{}, sparse::SpGemmAccumulator::kSparse);
+}
+
+#ifdef _OPENMP
+TEST(sparse_tests, spgemm_omp) {
+  CheckSpGemm<double, int>(sparse::OmpBackend{}, sparse::SpGemmAccumulator::kAuto);
+  CheckSpGemm<double, int>(sparse::OmpBackend{}, sparse::SpGemmAccumulator::kSparse);
+}
+#endif
+
+TEST(sparse_tests, spgemm_ccs) {
+  const auto a = RandomDense<double>(30, 40, 0.15, 7);
+  const auto b = RandomDense<double>(40, 25, 0.15, 8);
+  const auto c = sparse::SpGemm(sparse::ToCcs(ToCsr(a, 30, 40)), sparse::ToCcs(ToCsr(b, 40, 25)),
+                                sparse::StlBackend{});
+  EXPECT_EQ(c.rows, 30U);
+  EXPECT_EQ(c.cols, 25U);
+  ExpectNear(ToDense(sparse::ToCsr(c)), DenseMultiply(a, b, 30, 40, 25));
+}
+
+TEST(sparse_tests, spgemm_views) {
+  const auto a = ToCsr<double, int>(RandomDense<double>(12, 9, 0.3, 11), 12, 9);
+  const auto b = ToCsr<double, int>(RandomDense<double>(9, 14, 0.3, 12), 9, 14);
+  using View = sparse::CsrView<double, int>;
+  const auto c = sparse::SpGemm(View{.rows = a.rows, .cols = a.cols, .row_ptr = a.row_ptr, .col_idx = a.col_idx,
+                                     .values = a.values},
+                                View{.rows = b.rows, .cols = b.cols, .row_ptr = b.row_ptr, .col_idx = b.col_idx,
+                                     .values = b.values});
+  const auto expected = sparse::SpGemm(a, b);
+  EXPECT_EQ(c.row_ptr, expected.row_ptr);
+  EXPECT_EQ(c.col_idx, expected.col_idx);
+  EXPECT_EQ(c.values, expected.values);
+
+  const auto a_ccs = sparse::ToCcs(a);
+  const auto b_ccs = sparse::ToCcs(b);
+  using CcsView = sparse::CcsView<double, int>;
+  const auto c_ccs = sparse::SpGemm(CcsView{.rows = a_ccs.rows, .cols = a_ccs.cols, .col_ptr = a_ccs.col_ptr,
+                                            .row_idx = a_ccs.row_idx, .values = a_ccs.values},
+                                    CcsView{.rows = b_ccs.rows, .cols = b_ccs.cols, .col_ptr = b_ccs.col_ptr,
+                                            .row_idx = b_ccs.row_idx, .values = b_ccs.values});
+  EXPECT_EQ(c_ccs.col_ptr, sparse::SpGemm(a_ccs, b_ccs).col_ptr);
+}
+
+TEST(sparse_tests, spgemm_drop_zeros) {
+  // Row [1, 1] times columns [1, -1] and [1, 1]: the first product cancels out
+  const sparse::CsrMatrix<double> a{.rows = 1, .cols = 2, .row_ptr = {0, 2}, .col_idx = {0, 1}, .values = {1, 1}};
+  const sparse::CsrMatrix<double> b{
+      .rows = 2, .cols = 2, .row_ptr = {0, 2, 4}, .col_idx = {0, 1, 0, 1}, .values = {1, 1, -1, 1}};
+  const auto kept = sparse::SpGemm(a, b);
+  EXPECT_EQ(kept.col_idx, (std::vector<std::uint32_t>{0, 1}));
+  EXPECT_EQ(kept.values, (std::vector<double>{0, 2}));
+  const auto dropped = sparse::SpGemm(a, b, sparse::SeqBackend{}, {.drop_zeros = true});
+  EXPECT_EQ(dropped.row_ptr, (std::vector<std::uint32_t>{0, 1}));
+  EXPECT_EQ(dropped.col_idx, (std::vector<std::uint32_t>{1}));
+  EXPECT_EQ(dropped.values, (std::vector<double>{2}));
+}
+
+TEST(sparse_tests, throws_on_wrong_sizes) {
+  const auto a = ToCsr(RandomDense<double>(5, 6, 0.5, 9), 5, 6);
+  std::vector<double> x(5);
+  std::vector<double> y(5);
+  EXPECT_THROW(sparse::SpMV<double>(a, x, y), std::invalid_argument);
+  EXPECT_THROW(sparse::SpGemm(a, a), std::invalid_argument);
+  auto broken = a;
+  broken.row_ptr.pop_back();
+  EXPECT_THROW(sparse::ToCcs(broken), std::invalid_argument);
+}
@@ -0,0 +1,481 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "core/pool/include/thread_pool.hpp"
+
+// Sparse matrices in compressed row (CSR) and compressed column (CCS) storage with parallel kernels.
+// Values may be real or complex, indices any integral type (32-bit by default, 64-bit for big matrices).
+// Every kernel takes a backend which runs independent chunks of work: SeqBackend and StlBackend live here,
+// OmpBackend and TbbBackend in sparse_omp.hpp and sparse_tbb.hpp. Work is split by nonzeros, not by rows.
+namespace ppc::core::sparse {
+
+template <class T, std::integral Index = std::uint32_t>
+struct CsrMatrix {
+  size_t rows = 0;
+  size_t cols = 0;
+  std::vector<Index> row_ptr = {0};
+  std::vector<Index> col_idx{};
+  std::vector<T> values{};
+
+  [[nodiscard]] size_t NonZeros() const { return values.size(); }
+};
+
+template <class T, std::integral Index = std::uint32_t>
+struct CcsMatrix {
+  size_t rows = 0;
+  size_t cols = 0;
+  std::vector<Index> col_ptr = {0};
+  std::vector<Index> row_idx{};
+  std::vector<T> values{};
+
+  [[nodiscard]] size_t NonZeros() const { return values.size(); }
+};
+
+// CSR and CCS arrays owned by the caller, so a task can multiply its own storage without copying it
+template <class T, std::integral Index = std::uint32_t>
+struct CsrView {
+  size_t rows = 0;
+  size_t cols = 0;
+  std::span<const Index> row_ptr;
+  std::span<const Index> col_idx;
+  std::span<const T> values;
+};
+
+template <class T, std::integral Index = std::uint32_t>
+struct CcsView {
+  size_t rows = 0;
+  size_t cols = 0;
+  std::span<const Index> col_ptr;
+  std::span<const Index> row_idx;
+  std::span<const T> values;
+};
+
+// Runs body(chunk) for chunk = 0..chunks-1 in the calling thread
+struct SeqBackend {
+  [[nodiscard]] size_t Concurrency() const { return 1; }
+
+  template <class Body>
+  void ForEachChunk(size_t chunks, const Body &body) const {
+    for (size_t chunk = 0; chunk < chunks; chunk++) {
+      body(chunk);
+    }
+  }
+};
+
+// Runs chunks on the shared work-stealing pool
+class StlBackend {
+ public:
+  explicit StlBackend(ThreadPool &pool = ThreadPool::Instance()) : pool_(pool) {}
+
+  [[nodiscard]] size_t Concurrency() const { return pool_.GetNumThreads(); }
+
+  template <class Body>
+  void ForEachChunk(size_t chunks, const Body &body) const {
+    ParallelFor(
+        0, chunks,
+        [&body](size_t first, size_t last) {
+          for (size_t chunk = first; chunk < last; chunk++) {
+            body(chunk);
+          }
+        },
+        1, pool_);
+  }
+
+ private:
+  ThreadPool &pool_;
+};
+
+enum class SpGemmAccumulator : std::uint8_t {
+  // Dense rows are scanned over all columns, sparse rows track and sort their columns
+  kAuto,
+  kDense,
+  kSparse,
+};
+
+struct SpGemmOptions {
+  SpGemmAccumulator accumulator = SpGemmAccumulator::kAuto;
+  // Removes entries whose products cancel out to exactly zero
+  bool drop_zeros = false;
+};
+
+namespace detail {
+
+// A row counts as dense when it has at least 1/kDenseRowFactor of all columns
+constexpr size_t kDenseRowFactor = 16;
+constexpr size_t kChunksPerThread = 4;
+
+// Compressed storage seen as major lines (rows of CSR, columns of CCS) of minor indices
+template <class T, class Index>
+struct CompressedView {
+  size_t major;
+  size_t minor;
+  std::span<const Index> ptr;
+  std::span<const Index> idx;
+  std::span<const T> val;
+};
+
+template <class T, class Index>
+struct Compressed {
+  std::vector<Index> ptr;
+  std::vector<Index> idx;
+  std::vector<T> val;
+};
+
+template <class T, class Index>
+CompressedView<T, Index> View(const CsrMatrix<T, Index> &m) {
+  return {m.rows, m.cols, m.row_ptr, m.col_idx, m.values};
+}
+
+template <class T, class Index>
+CompressedView<T, Index> View(const CcsMatrix<T, Index> &m) {
+  return {m.cols, m.rows, m.col_ptr, m.row_idx, m.values};
+}
+
+template <class T, class Index>
+CompressedView<T, Index> View(const CsrView<T, Index> &m) {
+  return {m.rows, m.cols, m.row_ptr, m.col_idx, m.values};
+}
+
+template <class T, class Index>
+CompressedView<T, Index> View(const CcsView<T, Index> &m) {
+  return {m.cols, m.rows, m.col_ptr, m.row_idx, m.values};
+}
+
+template <class T, class Index>
+void CheckShape(const CompressedView<T, Index> &m) {
+  if (m.ptr.size() != m.major + 1 || m.idx.size() != m.val.size() ||
+      static_cast<size_t>(m.ptr.back()) != m.val.size()) {
+    throw std::invalid_argument("sparse matrix has inconsistent compressed storage");
+  }
+}
+
+template <class Backend>
+size_t ChunksCount(const Backend &backend, size_t lines) {
+  const size_t threads = backend.Concurrency();
+  return std::clamp<size_t>(threads == 1 ? 1 : threads * kChunksPerThread, 1, std::max<size_t>(lines, 1));
+}
+
+// Bounds of chunks of lines with about equal weight; prefix[i] is the total weight of lines [0, i)
+template <class Weight>
+std::vector<size_t> SplitByWeight(std::span<const Weight> prefix, size_t chunks) {
+  const size_t lines = prefix.size() - 1;
+  const auto total = static_cast<size_t>(prefix.back());
+  std::vector<size_t> bounds;
+  bounds.reserve(chunks + 1);
+  bounds.push_back(0);
+  for (size_t chunk = 1; chunk < chunks; chunk++) {
+    const auto target = static_cast<Weight>(total * chunk / chunks);
+    const auto it = std::lower_bound(prefix.begin() + static_cast<std::ptrdiff_t>(bounds.back()), prefix.end(), target);
+    bounds.push_back(std::min<size_t>(it - prefix.begin(), lines));
+  }
+  bounds.push_back(lines);
+  return bounds;
+}
+
+// Transposes compressed storage. Every chunk of major lines counts its minor indices separately, so the scatter
+// needs no atomics; the number of chunks is limited to keep the counters within the size of the matrix.
+template <class T, class Index, class Backend>
+Compressed<T, Index> Transpose(const CompressedView<T, Index> &m, const Backend &backend) {
+  CheckShape(m);
+  const size_t nnz = m.val.size();
+  const size_t chunks =
+      std::clamp<size_t>(nnz / std::max<size_t>(m.minor, 1), 1, std::max<size_t>(backend.Concurrency(), 1));
+  const auto bounds = SplitByWeight<Index>(m.ptr, std::min(chunks, std::max<size_t>(m.major, 1)));
+  const size_t chunks_count = bounds.size() - 1;
+
+  std::vector<size_t> counts(chunks_count * m.minor, 0);
+  backend.ForEachChunk(chunks_count, [&](size_t chunk) {
+    size_t *chunk_counts = counts.data() + (chunk * m.minor);
+    for (auto e = static_cast<size_t>(m.ptr[bounds[chunk]]); e < static_cast<size_t>(m.ptr[bounds[chunk + 1]]); e++) {
+      chunk_counts[static_cast<size_t>(m.idx[e])]++;
+    }
+  });
+
+  Compressed<T, Index> res;
+  res.ptr.assign(m.minor + 1, 0);
+  size_t pos = 0;
+  for (size_t line = 0; line < m.minor; line++) {
+    for (size_t chunk = 0; chunk < chunks_count; chunk++) {
+      const size_t count = counts[(chunk * m.minor) + line];
+      counts[(chunk * m.minor) + line] = pos;
+      pos += count;
+    }
+    res.ptr[line + 1] = static_cast<Index>(pos);
+  }
+
+  res.idx.resize(nnz);
+  res.val.resize(nnz);
+  backend.ForEachChunk(chunks_count, [&](size_t chunk) {
+    size_t *chunk_pos = counts.data() + (chunk * m.minor);
+    for (size_t line = bounds[chunk]; line < bounds[chunk + 1]; line++) {
+      for (auto e = static_cast<size_t>(m.ptr[line]); e < static_cast<size_t>(m.ptr[line + 1]); e++) {
+        const size_t dst = chunk_pos[static_cast<size_t>(m.idx[e])]++;
+        res.idx[dst] = static_cast<Index>(line);
+        res.val[dst] = m.val[e];
+      }
+    }
+  });
+  return res;
+}
+
+// Per-thread row accumulator of Gustavson's SpGEMM. Stamps mark the columns touched by the current row,
+// they only grow, so the buffers are reused between rows and calls without clearing.
+template <class T>
+struct RowAccumulator {
+  std::vector<T> values;
+  std::vector<size_t> marker;
+  std::vector<size_t> cols;
+  size_t stamp = 0;
+
+  void Prepare(size_t width) {
+    if (values.size() != width) {
+      values.assign(width, T{});
+      marker.assign(width, 0);
+    }
+  }
+};
+
+template <class T>
+RowAccumulator<T> &LocalAccumulator(size_t width) {
+  thread_local RowAccumulator<T> acc;
+  acc.Prepare(width);
+  return acc;
+}
+
+// C = A * B for compressed storages taken as row-major: row i of C combines the rows of B selected by row i of A
+template <class T, class Index, class Backend>
+Compressed<T, Index> SpGemm(const CompressedView<T, Index> &a, const CompressedView<T, Index> &b,
+                            const Backend &backend, const SpGemmOptions &options) {
+  CheckShape(a);
+  CheckShape(b);
+  if (a.minor != b.major) {
+    throw std::invalid_argument("sparse matrix sizes do not match for multiplication");
+  }
+  const size_t rows = a.major;
+  const size_t width = b.minor;
+  const auto b_row = [&b](Index k) {
+    return std::pair{static_cast<size_t>(b.ptr[static_cast<size_t>(k)]),
+                     static_cast<size_t>(b.ptr[static_cast<size_t>(k) + 1])};
+  };
+
+  // Chunks of rows with about the same number of multiplications
+  std::vector<size_t> flops(rows + 1, 0);
+  for (size_t i = 0; i < rows; i++) {
+    size_t row_flops = 1;
+    for (auto e = static_cast<size_t>(a.ptr[i]); e < static_cast<size_t>(a.ptr[i + 1]); e++) {
+      const auto [first, last] = b_row(a.idx[e]);
+      row_flops += last - first;
+    }
+    flops[i + 1] = flops[i] + row_flops;
+  }
+  const auto bounds = SplitByWeight<size_t>(flops, ChunksCount(backend, rows));
+  const size_t chunks_count = bounds.size() - 1;
+
+  // Symbolic pass: exact number of structural nonzeros of every row
+  std::vector<size_t> row_nnz(rows, 0);
+  backend.ForEachChunk(chunks_count, [&](size_t chunk) {
+    auto &acc = LocalAccumulator<T>(width);
+    for (size_t i = bounds[chunk]; i < bounds[chunk + 1]; i++) {
+      const size_t stamp = ++acc.stamp;
+      size_t count = 0;
+      for (auto e = static_cast<size_t>(a.ptr[i]); e < static_cast<size_t>(a.ptr[i + 1]) && count < width; e++) {
+        const auto [first, last] = b_row(a.idx[e]);
+        for (size_t f = first; f < last; f++) {
+          const auto col = static_cast<size_t>(b.idx[f]);
+          if (acc.marker[col] != stamp) {
+            acc.marker[col] = stamp;
+            count++;
+          }
+        }
+      }
+      row_nnz[i] = count;
+    }
+  });
+
+  Compressed<T, Index> res;
+  res.ptr.assign(rows + 1, 0);
+  std::vector<size_t> row_begin(rows + 1, 0);
+  for (size_t i = 0; i < rows; i++) {
+    row_begin[i + 1] = row_begin[i] + row_nnz[i];
+  }
+  res.idx.resize(row_begin[rows]);
+  res.val.resize(row_begin[rows]);
+
+  // Numeric pass: every row is written to its own slot in ascending column order
+  backend.ForEachChunk(chunks_count, [&](size_t chunk) {
+    auto &acc = LocalAccumulator<T>(width);
+    for (size_t i = bounds[chunk]; i < bounds[chunk + 1]; i++) {
+      const bool dense = options.accumulator == SpGemmAccumulator::kDense ||
+                         (options.accumulator == SpGemmAccumulator::kAuto && row_nnz[i] * kDenseRowFactor >= width);
+      const size_t stamp = ++acc.stamp;
+      if (dense) {
+        std::ranges::fill(acc.values, T{});
+      }
+      acc.cols.clear();
+      for (auto e = static_cast<size_t>(a.ptr[i]); e < static_cast<size_t>(a.ptr[i + 1]); e++) {
+        const T a_val = a.val[e];
+        const auto [first, last] = b_row(a.idx[e]);
+        for (size_t f = first; f < last; f++) {
+          const auto col = static_cast<size_t>(b.idx[f]);
+          if (dense) {
+            acc.values[col] += a_val * b.val[f];
+            acc.marker[col] = stamp;
+          } else if (acc.marker[col] != stamp) {
+            acc.marker[col] = stamp;
+            acc.values[col] = a_val * b.val[f];
+            acc.cols.push_back(col);
+          } else {
+            acc.values[col] += a_val * b.val[f];
+          }
+        }
+      }
+
+      size_t pos = row_begin[i];
+      const auto emit = [&](size_t col) {
+        if (!options.drop_zeros || acc.values[col] != T{}) {
+          res.idx[pos] = static_cast<Index>(col);
+          res.val[pos] = acc.values[col];
+          pos++;
+        }
+      };
+      if (dense) {
+        for (size_t col = 0; col < width; col++) {
+          if (acc.marker[col] == stamp) {
+            emit(col);
+          }
+        }
+      } else {
+        std::ranges::sort(acc.cols);
+        std::ranges::for_each(acc.cols, emit);
+      }
+      row_nnz[i] = pos - row_begin[i];
+    }
+  });
+
+  // Squeeze out the slots of dropped zeros
+  for (size_t i = 0; i < rows; i++) {
+    const auto dst = static_cast<size_t>(res.ptr[i]);
+    if (dst != row_begin[i]) {
+      std::copy_n(res.idx.begin() + static_cast<std::ptrdiff_t>(row_begin[i]), row_nnz[i],
+                  res.idx.begin() + static_cast<std::ptrdiff_t>(dst));
+      std::copy_n(res.val.begin() + static_cast<std::ptrdiff_t>(row_begin[i]), row_nnz[i],
+                  res.val.begin() + static_cast<std::ptrdiff_t>(dst));
+    }
+    res.ptr[i + 1] = static_cast<Index>(dst + row_nnz[i]);
+  }
+  res.idx.resize(static_cast<size_t>(res.ptr[rows]));
+  res.val.resize(static_cast<size_t>(res.ptr[rows]));
+  return res;
+}
+
+}  // namespace detail
+
+template <class T, class Index, class Backend = SeqBackend>
+CcsMatrix<T, Index> ToCcs(const CsrMatrix<T, Index> &a, const Backend &backend = {}) {
+  auto t = detail::Transpose(detail::View(a), backend);
+  return {a.rows, a.cols, std::move(t.ptr), std::move(t.idx), std::move(t.val)};
+}
+
+template <class T, class Index, class Backend = SeqBackend>
+CsrMatrix<T, Index> ToCsr(const CcsMatrix<T, Index> &a, const Backend &backend = {}) {
+  auto t = detail::Transpose(detail::View(a), backend);
+  return {a.rows, a.cols, std::move(t.ptr), std::move(t.idx), std::move(t.val)};
+}
+
+template <class T, class Index, class Backend = SeqBackend>
+CsrMatrix<T, Index> Transpose(const CsrMatrix<T, Index> &a, const Backend &backend = {}) {
+  auto t = detail::Transpose(detail::View(a), backend);
+  return {a.cols, a.rows, std::move(t.ptr), std::move(t.idx), std::move(t.val)};
+}
+
+// y = A * x
+template <class T, class Index, class Backend = SeqBackend>
+void SpMV(const CsrMatrix<T, Index> &a, std::span<const T> x, std::span<T> y, const Backend &backend = {}) {
+  detail::CheckShape(detail::View(a));
+  if (x.size() != a.cols || y.size() != a.rows) {
+    throw std::invalid_argument("vector sizes do not match the sparse matrix");
+  }
+  const auto bounds = detail::SplitByWeight<Index>(a.row_ptr, detail::ChunksCount(backend, a.rows));
+  backend.ForEachChunk(bounds.size() - 1, [&](size_t chunk) {
+    for (size_t i = bounds[chunk]; i < bounds[chunk + 1]; i++) {
+      T sum{};
+      for (auto e = static_cast<size_t>(a.row_ptr[i]); e < static_cast<size_t>(a.row_ptr[i + 1]); e++) {
+        sum += a.values[e] * x[static_cast<size_t>(a.col_idx[e])];
+      }
+      y[i] = sum;
+    }
+  });
+}
+
+// y = A * x. Every chunk of columns scatters into its own partial vector, the partials are summed by rows.
+template <class T, class Index, class Backend = SeqBackend>
+void SpMV(const CcsMatrix<T, Index> &a, std::span<const T> x, std::span<T> y, const Backend &backend = {}) {
+  detail::CheckShape(detail::View(a));
+  if (x.size() != a.cols || y.size() != a.rows) {
+    throw std::invalid_argument("vector sizes do not match the sparse matrix");
+  }
+  const size_t chunks = std::clamp<size_t>(a.NonZeros() / std::max<size_t>(a.rows, 1), 1,
+                                           std::min(backend.Concurrency(), std::max<size_t>(a.cols, 1)));
+  const auto bounds = detail::SplitByWeight<Index>(a.col_ptr, chunks);
+  const size_t chunks_count = bounds.size() - 1;
+  std::vector<T> partial((chunks_count - 1) * a.rows, T{});
+  std::ranges::fill(y, T{});
+  backend.ForEachChunk(chunks_count, [&](size_t chunk) {
+    T *out = (chunk == 0) ? y.data() : partial.data() + ((chunk - 1) * a.rows);
+    for (size_t j = bounds[chunk]; j < bounds[chunk + 1]; j++) {
+      for (auto e = static_cast<size_t>(a.col_ptr[j]); e < static_cast<size_t>(a.col_ptr[j + 1]); e++) {
+        out[static_cast<size_t>(a.row_idx[e])] += a.values[e] * x[j];
+      }
+    }
+  });
+  if (chunks_count > 1) {
+    const size_t row_chunks = detail::ChunksCount(backend, a.rows);
+    backend.ForEachChunk(row_chunks, [&](size_t chunk) {
+      for (size_t i = a.rows * chunk / row_chunks; i < a.rows * (chunk + 1) / row_chunks; i++) {
+        for (size_t p = 0; p + 1 < chunks_count; p++) {
+          y[i] += partial[(p * a.rows) + i];
+        }
+      }
+    });
+  }
+}
+
+// C = A * B (Gustavson's row-wise algorithm with a symbolic pass, so the result is allocated exactly once)
+template <class T, class Index, class Backend = SeqBackend>
+CsrMatrix<T, Index> SpGemm(const CsrMatrix<T, Index> &a, const CsrMatrix<T, Index> &b, const Backend &backend = {},
+                           const SpGemmOptions &options = {}) {
+  auto c = detail::SpGemm(detail::View(a), detail::View(b), backend, options);
+  return {a.rows, b.cols, std::move(c.ptr), std::move(c.idx), std::move(c.val)};
+}
+
+// C = A * B computed as C^T = B^T * A^T: the CCS arrays of a matrix are the CSR arrays of its transpose
+template <class T, class Index, class Backend = SeqBackend>
+CcsMatrix<T, Index> SpGemm(const CcsMatrix<T, Index> &a, const CcsMatrix<T, Index> &b, const Backend &backend = {},
+                           const SpGemmOptions &options = {}) {
+  auto c = detail::SpGemm(detail::View(b), detail::View(a), backend, options);
+  return {a.rows, b.cols, std::move(c.ptr), std::move(c.idx), std::move(c.val)};
+}
+
+template <class T, class Index, class Backend = SeqBackend>
+CsrMatrix<T, Index> SpGemm(const CsrView<T, Index> &a, const CsrView<T, Index> &b, const Backend &backend = {},
+                           const SpGemmOptions &options = {}) {
+  auto c = detail::SpGemm(detail::View(a), detail::View(b), backend, options);
+  return {a.rows, b.cols, std::move(c.ptr), std::move(c.idx), std::move(c.val)};
+}
+
+template <class T, class Index, class Backend = SeqBackend>
+CcsMatrix<T, Index> SpGemm(const CcsView<T, Index> &a, const CcsView<T, Index> &b, const Backend &backend = {},
+                           const SpGemmOptions &options = {}) {
+  auto c = detail::SpGemm(detail::View(b), detail::View(a), backend, options);
+  return {a.rows, b.cols, std::move(c.ptr), std::move(c.idx), std::move(c.val)};
+}
+
+}  // namespace ppc::core::sparse
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <omp.h>
+
+#include <cstddef>
+
+#include "core/sparse/include/sparse.hpp"
+
+namespace ppc::core::sparse {
+
+// Runs chunks with a dynamically scheduled OpenMP loop
+struct OmpBackend {
+  [[nodiscard]] size_t Concurrency() const { return static_cast<size_t>(omp_get_max_threads()); }
+
+  template <class Body>
+  void ForEachChunk(size_t chunks, const Body &body) const {
+#pragma omp parallel for schedule(dynamic, 1)
+    for (int chunk = 0; chunk < static_cast<int>(chunks); chunk++) {
+      body(static_cast<size_t>(chunk));
+    }
+  }
+};
+
+}  // namespace ppc::core::sparse
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/task_arena.h>
+
+#include <cstddef>
+
+#include "core/sparse/include/sparse.hpp"
+
+namespace ppc::core::sparse {
+
+// Runs chunks as TBB tasks in the current arena
+struct TbbBackend {
+  [[nodiscard]] size_t Concurrency() const {
+    return static_cast<size_t>(oneapi::tbb::this_task_arena::max_concurrency());
+  }
+
+  template <class Body>
+  void ForEachChunk(size_t chunks, const Body &body) const {
+    oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<size_t>(0, chunks, 1),
+                              [&body](const oneapi::tbb::blocked_range<size_t> &r) {
+                                for (size_t chunk = r.begin(); chunk < r.end(); chunk++) {
+                                  body(chunk);
+                                }
+                              });
+  }
+};
+
+}  // namespace ppc::core::sparse
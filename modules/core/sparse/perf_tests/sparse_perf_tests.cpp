@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <utility>
+
+#include "core/perf/include/perf.hpp"
+#include "core/sparse/include/sparse.hpp"
+#include "core/task/include/task.hpp"
+
+namespace sparse = ppc::core::sparse;
+
+namespace {
+
+using Matrix = sparse::CsrMatrix<double>;
+
+// Random n x n matrix with per_row nonzeros in every row
+Matrix RandomMatrix(size_t n, size_t per_row, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<std::uint32_t> col(0, n - 1);
+  Matrix a{.rows = n, .cols = n};
+  for (size_t i = 0; i < n; i++) {
+    for (size_t e = 0; e < per_row; e++) {
+      a.col_idx.push_back(col(gen));
+    }
+    std::sort(a.col_idx.end() - static_cast<std::ptrdiff_t>(per_row), a.col_idx.end());
+    a.values.resize(a.col_idx.size(), 1.0);
+    a.row_ptr.push_back(a.col_idx.size());
+  }
+  return a;
+}
+
+// Squares the matrix given in inputs[0] into outputs[0]
+template <class Backend>
+class SpGemmTask : public ppc::core::Task {
+ public:
+  SpGemmTask(ppc::core::TaskDataPtr task_data, sparse::SpGemmOptions options)
+      : Task(std::move(task_data)), options_(options) {}
+
+  bool ValidationImpl() override { return task_data->inputs.size() == 1 && task_data->outputs.size() == 1; }
+
+  bool PreProcessingImpl() override {
+    a_ = reinterpret_cast<Matrix *>(task_data->inputs[0]);
+    return true;
+  }
+
+  bool RunImpl() override {
+    c_ = sparse::SpGemm(*a_, *a_, Backend{}, options_);
+    return true;
+  }
+
+  bool PostProcessingImpl() override {
+    *reinterpret_cast<Matrix *>(task_data->outputs[0]) = std::move(c_);
+    return true;
+  }
+
+ private:
+  sparse::SpGemmOptions options_;
+  Matrix *a_ = nullptr;
+  Matrix c_;
+};
+
+template <class Backend>
+void RunSpGemmPerf(sparse::SpGemmAccumulator accumulator) {
+  auto a = RandomMatrix(10000, 8, 10);
+  const auto reference = sparse::SpGemm(a, a, sparse::SeqBackend{}, {.accumulator = sparse::SpGemmAccumulator::kSparse});
+  Matrix c;
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&a));
+  task_data->inputs_count.emplace_back(a.values.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(&c));
+  task_data->outputs_count.emplace_back(1);
+
+  auto task = std::make_shared<SpGemmTask<Backend>>(task_data, sparse::SpGemmOptions{.accumulator = accumulator});
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  ppc::core::Perf perf_analyzer(task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  EXPECT_EQ(c.row_ptr, reference.row_ptr);
+  EXPECT_EQ(c.col_idx, reference.col_idx);
+  EXPECT_EQ(c.values, reference.values);
+}
+
+}  // namespace
+
+TEST(sparse_perf_tests, spgemm_seq_sparse_accumulator) {
+  RunSpGemmPerf<sparse::SeqBackend>(sparse::SpGemmAccumulator::kSparse);
+}
+
+TEST(sparse_perf_tests, spgemm_seq_dense_accumulator) {
+  RunSpGemmPerf<sparse::SeqBackend>(sparse::SpGemmAccumulator::kDense);
+}
+
+TEST(sparse_perf_tests, spgemm_seq_auto_accumulator) {
+  RunSpGemmPerf<sparse::SeqBackend>(sparse::SpGemmAccumulator::kAuto);
+}
+
+TEST(sparse_perf_tests, spgemm_stl_auto_accumulator) {
+  RunSpGemmPerf<sparse::StlBackend>(sparse::SpGemmAccumulator::kAuto);
+}
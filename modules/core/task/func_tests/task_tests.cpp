@@ -3,6 +3,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <stdexcept>
+#include <typeinfo>
 #include <vector>
 
 #include "core/task/func_tests/test_task.hpp"
@@ -178,6 +180,200 @@ TEST(task_tests, check_wrong_order) {
   ASSERT_ANY_THROW(test_task.PostProcessing());
 }
 
+TEST(task_tests, check_phases_time) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::test::task::TestTask<int32_t> test_task(task_data);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.Run();
+  test_task.PostProcessing();
+
+  const auto &phases_time = test_task.GetPhasesTime();
+  EXPECT_EQ(phases_time[ppc::core::Task::kValidation].count, 1U);
+  EXPECT_EQ(phases_time[ppc::core::Task::kPreProcessing].count, 1U);
+  EXPECT_EQ(phases_time[ppc::core::Task::kRun].count, 2U);
+  EXPECT_EQ(phases_time[ppc::core::Task::kPostProcessing].count, 1U);
+  EXPECT_LE(phases_time[ppc::core::Task::kRun].min_sec, phases_time[ppc::core::Task::kRun].max_sec);
+
+  test_task.ResetPhasesTime();
+  EXPECT_EQ(test_task.GetPhasesTime()[ppc::core::Task::kRun].count, 0U);
+}
+
+TEST(task_tests, check_phase_time_histogram) {
+  ppc::core::PhaseTimeHistogram histogram;
+  histogram.Add(0.0000005);
+  histogram.Add(0.000001);
+  histogram.Add(0.000003);
+  histogram.Add(1e6);
+
+  EXPECT_EQ(histogram.count, 4U);
+  EXPECT_EQ(histogram.buckets[0], 1U);
+  EXPECT_EQ(histogram.buckets[1], 1U);
+  EXPECT_EQ(histogram.buckets[2], 1U);
+  EXPECT_EQ(histogram.buckets[ppc::core::PhaseTimeHistogram::kBucketsCount - 1], 1U);
+  EXPECT_DOUBLE_EQ(histogram.min_sec, 0.0000005);
+  EXPECT_DOUBLE_EQ(histogram.max_sec, 1e6);
+}
+
+TEST(task_tests, check_typed_views) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+  std::vector<double> out(2, 0.0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  auto input = task_data->Input<const int32_t>(0);
+  EXPECT_EQ(input.data(), in.data());
+  EXPECT_EQ(input.size(), in.size());
+
+  auto output = task_data->Output<double>(0);
+  output[1] = 2.0;
+  EXPECT_EQ(out[1], 2.0);
+  EXPECT_FALSE(task_data->IsInPlace(0, 0));
+
+  EXPECT_THROW((void)task_data->Input<int32_t>(1), std::out_of_range);
+  EXPECT_THROW((void)task_data->Output<double>(1), std::out_of_range);
+}
+
+TEST(task_tests, check_typed_views_alignment) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+
+  // Create task_data with unaligned and empty buffers
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()) + 1);
+  task_data->inputs_count.emplace_back(in.size() - 1);
+  task_data->inputs.emplace_back(nullptr);
+  task_data->inputs_count.emplace_back(0);
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()) + 1);
+  task_data->outputs_count.emplace_back(1);
+
+  EXPECT_THROW((void)task_data->Input<int32_t>(0), std::invalid_argument);
+  EXPECT_NO_THROW((void)task_data->Input<uint8_t>(0));
+  EXPECT_TRUE(task_data->Input<int32_t>(1).empty());
+  EXPECT_TRUE(task_data->IsInPlace(0, 0));
+  EXPECT_FALSE(task_data->IsInPlace(1, 0));
+}
+
+TEST(task_tests, check_buffer_info) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+  std::vector<double> out(1, 0.0);
+
+  // Create task_data with described buffers
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->AddInput(in.data(), in.size() / 2, 2 * sizeof(int32_t));
+  task_data->AddOutput(out.data(), out.size());
+
+  ASSERT_EQ(task_data->inputs_info.size(), 2U);
+  EXPECT_EQ(task_data->inputs_info[0].element_type, nullptr);
+  EXPECT_EQ(*task_data->inputs_info[1].element_type, typeid(int32_t));
+  EXPECT_EQ(task_data->inputs_info[1].element_size, sizeof(int32_t));
+  EXPECT_EQ(task_data->inputs_info[1].stride, 2 * sizeof(int32_t));
+  EXPECT_EQ(task_data->inputs_count[1], in.size() / 2);
+
+  // Views of undescribed buffers are not checked, described ones need dense buffer of the same type
+  EXPECT_NO_THROW((void)task_data->Input<const float>(0));
+  EXPECT_THROW((void)task_data->Input<const int32_t>(1), std::invalid_argument);
+  EXPECT_THROW((void)task_data->Output<float>(0), std::invalid_argument);
+  EXPECT_EQ(task_data->Output<double>(0).size(), out.size());
+}
+
+TEST(task_tests, check_large_counts) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  const std::size_t large_count = std::size_t{1} << 33U;
+  task_data->inputs_count.emplace_back(large_count);
+  EXPECT_EQ(task_data->inputs_count[0], large_count);
+}
+
+TEST(task_tests, check_run_prepared) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::test::task::TestTask<int32_t> test_task(task_data);
+  ASSERT_ANY_THROW(test_task.RunPrepared(task_data));
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+
+  // Run prepared task over new buffers of the same sizes
+  std::vector<int32_t> new_in(20, 2);
+  std::vector<int32_t> new_out(1, 0);
+  auto new_task_data = std::make_shared<ppc::core::TaskData>();
+  new_task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(new_in.data()));
+  new_task_data->inputs_count.emplace_back(new_in.size());
+  new_task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(new_out.data()));
+  new_task_data->outputs_count.emplace_back(new_out.size());
+  ASSERT_TRUE(test_task.RunPrepared(new_task_data));
+  EXPECT_EQ(new_out[0], 40);
+  ASSERT_TRUE(test_task.RunPrepared(task_data));
+  EXPECT_EQ(out[0], 20);
+  test_task.PostProcessing();
+
+  // Buffers of other size class are rejected
+  std::vector<int32_t> other_in(10, 1);
+  auto other_task_data = std::make_shared<ppc::core::TaskData>(*task_data);
+  other_task_data->inputs[0] = reinterpret_cast<uint8_t *>(other_in.data());
+  other_task_data->inputs_count[0] = other_in.size();
+  EXPECT_FALSE(test_task.RunPrepared(other_task_data));
+  EXPECT_EQ(test_task.GetPhasesTime()[ppc::core::Task::kRun].count, 2U);
+}
+
+TEST(task_tests, check_run_prepared_rejects_other_buffers) {
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(in.data(), in.size());
+  task_data->AddOutput(out.data(), out.size());
+  ppc::test::task::PickyRebindTask<int32_t> test_task(task_data);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+
+  // Same sizes, other element type
+  std::vector<float> float_in(20, 1.0F);
+  auto float_task_data = std::make_shared<ppc::core::TaskData>();
+  float_task_data->AddInput(float_in.data(), float_in.size());
+  float_task_data->AddOutput(out.data(), out.size());
+  EXPECT_FALSE(test_task.RunPrepared(float_task_data));
+
+  // Failed rebinding keeps the task on its old buffers
+  std::vector<int32_t> zero_in(20, 0);
+  auto zero_task_data = std::make_shared<ppc::core::TaskData>();
+  zero_task_data->AddInput(zero_in.data(), zero_in.size());
+  zero_task_data->AddOutput(out.data(), out.size());
+  EXPECT_FALSE(test_task.RunPrepared(zero_task_data));
+  EXPECT_EQ(test_task.GetData(), task_data);
+  ASSERT_TRUE(test_task.RunPrepared(task_data));
+  EXPECT_EQ(out[0], 20);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -46,4 +46,15 @@ class FakeSlowTask : public TestTask<T> {
   }
 };
 
+// Task which cannot be rebound to buffers with zero in the first input element
+template <class T>
+class PickyRebindTask : public TestTask<T> {
+ public:
+  explicit PickyRebindTask(const ppc::core::TaskDataPtr &task_data) : TestTask<T>(task_data) {}
+
+  bool RebindImpl() override {
+    return reinterpret_cast<T *>(this->task_data->inputs[0])[0] != 0 && TestTask<T>::PreProcessingImpl();
+  }
+};
+
 }  // namespace ppc::test::task
@@ -1,27 +1,128 @@
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
 #include <vector>
 
 namespace ppc::core {
 
 struct TaskData {
+  // Optional description of buffer's elements (filled by AddInput/AddOutput)
+  struct BufferInfo {
+    // type of elements, nullptr when it is unknown
+    const std::type_info *element_type = nullptr;
+    // size of one element (in bytes)
+    std::size_t element_size = 0;
+    // distance between neighbour elements (in bytes), equals element_size for dense buffers
+    std::size_t stride = 0;
+  };
+
   std::vector<uint8_t *> inputs;
-  std::vector<std::uint32_t> inputs_count;
+  std::vector<std::size_t> inputs_count;
+  std::vector<BufferInfo> inputs_info{};
   std::vector<uint8_t *> outputs;
-  std::vector<std::uint32_t> outputs_count;
+  std::vector<std::size_t> outputs_count;
+  std::vector<BufferInfo> outputs_info{};
   enum StateOfTesting : uint8_t { kFunc, kPerf } state_of_testing;
+
+  // Add buffer of count elements together with its description
+  template <class T>
+  void AddInput(T *data, std::size_t count, std::size_t stride = sizeof(T)) {
+    AddBuffer(inputs, inputs_count, inputs_info, data, count, stride);
+  }
+  template <class T>
+  void AddOutput(T *data, std::size_t count, std::size_t stride = sizeof(T)) {
+    AddBuffer(outputs, outputs_count, outputs_info, data, count, stride);
+  }
+
+  // Typed views of buffers without copying, count of buffer is treated as count of T elements.
+  // Use const T for read-only access, e.g. task_data->Input<const int>(0)
+  template <class T>
+  [[nodiscard]] std::span<T> Input(size_t i) const {
+    return MakeView<T>(inputs, inputs_count, inputs_info, i, "input");
+  }
+  template <class T>
+  [[nodiscard]] std::span<T> Output(size_t i) const {
+    return MakeView<T>(outputs, outputs_count, outputs_info, i, "output");
+  }
+
+  // true when caller passed the same buffer as input and output to work in place
+  [[nodiscard]] bool IsInPlace(size_t input_index, size_t output_index) const {
+    return input_index < inputs.size() && output_index < outputs.size() &&
+           inputs[input_index] == outputs[output_index];
+  }
+
+ private:
+  template <class T>
+  static void AddBuffer(std::vector<uint8_t *> &buffers, std::vector<std::size_t> &counts,
+                        std::vector<BufferInfo> &infos, T *data, std::size_t count, std::size_t stride) {
+    // keep infos aligned with buffers which were added without description
+    infos.resize(buffers.size());
+    buffers.emplace_back(reinterpret_cast<uint8_t *>(const_cast<std::remove_cv_t<T> *>(data)));
+    counts.emplace_back(count);
+    infos.emplace_back(BufferInfo{.element_type = &typeid(std::remove_cv_t<T>), .element_size = sizeof(T),
+                                  .stride = stride});
+  }
+
+  template <class T>
+  static std::span<T> MakeView(const std::vector<uint8_t *> &buffers, const std::vector<std::size_t> &counts,
+                               const std::vector<BufferInfo> &infos, size_t i, const std::string &kind) {
+    if (i >= buffers.size() || i >= counts.size()) {
+      throw std::out_of_range("TaskData has no " + kind + " buffer " + std::to_string(i));
+    }
+    if (i < infos.size() && infos[i].element_type != nullptr) {
+      if (*infos[i].element_type != typeid(std::remove_cv_t<T>)) {
+        throw std::invalid_argument("TaskData " + kind + " buffer " + std::to_string(i) + " has other element type");
+      }
+      if (infos[i].stride != sizeof(T)) {
+        throw std::invalid_argument("TaskData " + kind + " buffer " + std::to_string(i) + " is not dense");
+      }
+    }
+    if (buffers[i] == nullptr) {
+      if (counts[i] != 0) {
+        throw std::invalid_argument("TaskData " + kind + " buffer " + std::to_string(i) + " is null");
+      }
+      return {};
+    }
+    if (reinterpret_cast<std::uintptr_t>(buffers[i]) % alignof(T) != 0) {
+      throw std::invalid_argument("TaskData " + kind + " buffer " + std::to_string(i) + " is not aligned for type");
+    }
+    return {reinterpret_cast<T *>(buffers[i]), counts[i]};
+  }
 };
 
 using TaskDataPtr = std::shared_ptr<ppc::core::TaskData>;
 
+// Histogram of durations of one task's stage
+struct PhaseTimeHistogram {
+  // bucket 0 counts durations below 1 us, bucket i counts durations in [2^(i-1), 2^i) us,
+  // the last bucket counts everything longer
+  constexpr static size_t kBucketsCount = 32;
+  std::array<uint64_t, kBucketsCount> buckets{};
+  uint64_t count = 0;
+  // summary, minimal and maximal duration (in seconds)
+  double total_sec = 0.0;
+  double min_sec = 0.0;
+  double max_sec = 0.0;
+
+  void Add(double time_sec);
+};
+
 // Memory of inputs and outputs need to be initialized before create object of
 // Task class
 class Task {
  public:
+  enum Phase : uint8_t { kValidation, kPreProcessing, kRun, kPostProcessing, kPhasesCount };
+  using PhasesTime = std::array<PhaseTimeHistogram, kPhasesCount>;
+
   explicit Task(TaskDataPtr task_data);
 
   // set input and output data
@@ -39,9 +140,22 @@ class Task {
   // post-processing of output data
   virtual bool PostProcessing();
 
+  // Prepared mode: after successful Validation() and PreProcessing() runs the task over new buffers of the same
+  // sizes (RebindImpl() -> RunImpl() -> PostProcessingImpl()) without new validation, returns false when sizes or
+  // element descriptions differ. The task keeps its old buffers when RebindImpl() fails.
+  bool RunPrepared(TaskDataPtr new_task_data);
+
   // get input and output data
   [[nodiscard]] TaskDataPtr GetData() const;
 
+  // task accepts the same buffer as inputs[0] and outputs[0] (see TaskData::IsInPlace)
+  // and works directly on it without private copies of input
+  [[nodiscard]] virtual bool IsInPlaceSupported() const { return false; }
+
+  // durations of stages' implementations since creation or last ResetPhasesTime()
+  [[nodiscard]] const PhasesTime &GetPhasesTime() const;
+  void ResetPhasesTime();
+
   virtual ~Task();
 
  protected:
@@ -60,11 +174,18 @@ class Task {
   // implementation of "post_processing" function
   virtual bool PostProcessingImpl() = 0;
 
+  // binding of prepared task to new buffers of the same sizes, should reuse already allocated memory
+  virtual bool RebindImpl() { return PreProcessingImpl(); }
+
  private:
   std::vector<std::string> functions_order_;
   std::vector<std::string> right_functions_order_ = {"Validation", "PreProcessing", "Run", "PostProcessing"};
   const double max_test_time_ = 1.0;
   std::chrono::high_resolution_clock::time_point tmp_time_point_;
+  PhasesTime phases_time_;
+  bool validated_ = false;
+  bool prepared_ = false;
+  void AddPhaseTime(Phase phase, std::chrono::high_resolution_clock::time_point begin);
 };
 
 }  // namespace ppc::core
@@ -1,15 +1,41 @@
 #include "core/task/include/task.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// true when both buffers are described the same way, undescribed buffers only match undescribed ones
+bool SameBufferInfos(const std::vector<ppc::core::TaskData::BufferInfo>& a,
+                     const std::vector<ppc::core::TaskData::BufferInfo>& b, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    const auto x = (i < a.size()) ? a[i] : ppc::core::TaskData::BufferInfo{};
+    const auto y = (i < b.size()) ? b[i] : ppc::core::TaskData::BufferInfo{};
+    if ((x.element_type == nullptr) != (y.element_type == nullptr) ||
+        (x.element_type != nullptr && *x.element_type != *y.element_type) || x.element_size != y.element_size ||
+        x.stride != y.stride) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
 
 void ppc::core::Task::SetData(TaskDataPtr task_data_ptr) {
   task_data_ptr->state_of_testing = TaskData::StateOfTesting::kFunc;
   functions_order_.clear();
+  validated_ = prepared_ = false;
   this->task_data = std::move(task_data_ptr);
 }
 
@@ -19,22 +45,97 @@ ppc::core::Task::Task(TaskDataPtr task_data) { SetData(std::move(task_data)); }
 
 bool ppc::core::Task::Validation() {
   InternalOrderTest();
-  return ValidationImpl();
+  const auto begin = std::chrono::high_resolution_clock::now();
+  const bool res = ValidationImpl();
+  AddPhaseTime(kValidation, begin);
+  validated_ = res;
+  prepared_ = false;
+  return res;
 }
 
 bool ppc::core::Task::PreProcessing() {
   InternalOrderTest();
-  return PreProcessingImpl();
+  const auto begin = std::chrono::high_resolution_clock::now();
+  const bool res = PreProcessingImpl();
+  AddPhaseTime(kPreProcessing, begin);
+  prepared_ = validated_ && res;
+  return res;
 }
 
 bool ppc::core::Task::Run() {
   InternalOrderTest();
-  return RunImpl();
+  const auto begin = std::chrono::high_resolution_clock::now();
+  const bool res = RunImpl();
+  AddPhaseTime(kRun, begin);
+  return res;
 }
 
 bool ppc::core::Task::PostProcessing() {
   InternalOrderTest();
-  return PostProcessingImpl();
+  const auto begin = std::chrono::high_resolution_clock::now();
+  const bool res = PostProcessingImpl();
+  AddPhaseTime(kPostProcessing, begin);
+  return res;
+}
+
+bool ppc::core::Task::RunPrepared(TaskDataPtr new_task_data) {
+  if (!prepared_) {
+    throw std::invalid_argument("TASK IS NOT PREPARED: Validation() and PreProcessing() need to be done first");
+  }
+  if (new_task_data->inputs.size() != task_data->inputs.size() ||
+      new_task_data->outputs.size() != task_data->outputs.size() ||
+      new_task_data->inputs_count != task_data->inputs_count ||
+      new_task_data->outputs_count != task_data->outputs_count ||
+      !SameBufferInfos(new_task_data->inputs_info, task_data->inputs_info, task_data->inputs.size()) ||
+      !SameBufferInfos(new_task_data->outputs_info, task_data->outputs_info, task_data->outputs.size())) {
+    return false;
+  }
+  new_task_data->state_of_testing = task_data->state_of_testing;
+  // RebindImpl() reads the new buffers through task_data, the old ones are restored when it fails
+  auto old_task_data = std::exchange(task_data, std::move(new_task_data));
+  auto begin = std::chrono::high_resolution_clock::now();
+  bool res = RebindImpl();
+  AddPhaseTime(kPreProcessing, begin);
+  if (!res) {
+    task_data = std::move(old_task_data);
+    return false;
+  }
+  // prepared run right after PreProcessing() counts as Run(), so the usual PostProcessing() may follow
+  if (functions_order_.back() == "PreProcessing") {
+    functions_order_.emplace_back("Run");
+  }
+
+  begin = std::chrono::high_resolution_clock::now();
+  res = RunImpl();
+  AddPhaseTime(kRun, begin);
+  if (!res) {
+    return false;
+  }
+
+  begin = std::chrono::high_resolution_clock::now();
+  res = PostProcessingImpl();
+  AddPhaseTime(kPostProcessing, begin);
+  return res;
+}
+
+void ppc::core::PhaseTimeHistogram::Add(double time_sec) {
+  const auto time_us = static_cast<uint64_t>(time_sec * 1e6);
+  const auto bucket = std::min<size_t>(std::bit_width(time_us), kBucketsCount - 1);
+  buckets[bucket]++;
+  min_sec = (count == 0) ? time_sec : std::min(min_sec, time_sec);
+  max_sec = (count == 0) ? time_sec : std::max(max_sec, time_sec);
+  total_sec += time_sec;
+  count++;
+}
+
+const ppc::core::Task::PhasesTime& ppc::core::Task::GetPhasesTime() const { return phases_time_; }
+
+void ppc::core::Task::ResetPhasesTime() { phases_time_ = PhasesTime(); }
+
+void ppc::core::Task::AddPhaseTime(Phase phase, std::chrono::high_resolution_clock::time_point begin) {
+  auto end = std::chrono::high_resolution_clock::now();
+  auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+  phases_time_[phase].Add(static_cast<double>(duration) * 1e-9);
 }
 
 void ppc::core::Task::InternalOrderTest(const std::string& str) {
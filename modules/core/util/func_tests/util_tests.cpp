@@ -34,3 +34,15 @@ TEST(util_tests, check_set_env) {
   GTEST_SKIP();
 #endif
 }
+
+TEST(util_tests, check_get_env_variable) {
+#ifndef _WIN32
+  setenv("PPC_UTIL_TEST_VARIABLE", "value", 1);  // NOLINT(misc-include-cleaner)
+  EXPECT_EQ(ppc::util::GetEnvVariable("PPC_UTIL_TEST_VARIABLE"), "value");
+
+  unsetenv("PPC_UTIL_TEST_VARIABLE");  // NOLINT(misc-include-cleaner)
+  EXPECT_TRUE(ppc::util::GetEnvVariable("PPC_UTIL_TEST_VARIABLE").empty());
+#else
+  GTEST_SKIP();
+#endif
+}
@@ -4,6 +4,8 @@
 namespace ppc::util {
 
 std::string GetAbsolutePath(const std::string &relative_path);
+// Value of environment variable or empty string when it is not set
+std::string GetEnvVariable(const std::string &name);
 int GetPPCNumThreads();
 
 }  // namespace ppc::util
@@ -16,17 +16,22 @@ std::string ppc::util::GetAbsolutePath(const std::string &relative_path) {
   return path.string();
 }
 
-int ppc::util::GetPPCNumThreads() {
+std::string ppc::util::GetEnvVariable(const std::string &name) {
 #ifdef _WIN32
   size_t len;
-  char omp_env[100];
-  errno_t err = getenv_s(&len, omp_env, sizeof(omp_env), "OMP_NUM_THREADS");
+  char env_value[4096];
+  errno_t err = getenv_s(&len, env_value, sizeof(env_value), name.c_str());
   if (err != 0 || len == 0) {
-    omp_env[0] = '\0';
+    env_value[0] = '\0';
   }
 #else
-  const char *omp_env = std::getenv("OMP_NUM_THREADS");
+  const char *env_value = std::getenv(name.c_str());
 #endif
-  int num_threads = (omp_env != nullptr) ? std::atoi(omp_env) : 1;
+  return (env_value != nullptr) ? std::string(env_value) : std::string();
+}
+
+int ppc::util::GetPPCNumThreads() {
+  const std::string omp_env = GetEnvVariable("OMP_NUM_THREADS");
+  int num_threads = !omp_env.empty() ? std::atoi(omp_env.c_str()) : 1;
   return num_threads;
 }
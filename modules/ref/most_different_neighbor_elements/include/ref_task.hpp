@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "core/task/include/task.hpp"
@@ -14,12 +15,8 @@ class MostDifferentNeighborElements : public ppc::core::Task {
  public:
   explicit MostDifferentNeighborElements(ppc::core::TaskDataPtr task_data) : Task(task_data) {}
   bool PreProcessingImpl() override {
-    // Init vectors
-    input_ = std::vector<InOutType>(task_data->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(task_data->inputs[0]);
-    for (unsigned i = 0; i < task_data->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init view of input without copying
+    input_ = task_data->Input<const InOutType>(0);
     // Init value for output
     l_elem_ = r_elem_ = 0;
     l_elem_index_ = r_elem_index_ = 0;
@@ -32,15 +29,11 @@ class MostDifferentNeighborElements : public ppc::core::Task {
   }
 
   bool RunImpl() override {
-    auto rotate_in = input_;
-    int rot_left = 1;
-    rotate(rotate_in.begin(), rotate_in.begin() + rot_left, rotate_in.end());
-
-    auto temp_res = std::vector<InOutType>(input_.size());
-    std::transform(input_.begin(), input_.end(), rotate_in.begin(), temp_res.begin(),
+    auto temp_res = std::vector<InOutType>(input_.size() - 1);
+    std::transform(input_.begin(), input_.end() - 1, input_.begin() + 1, temp_res.begin(),
                    [](InOutType x, InOutType y) { return std::abs(x - y); });
 
-    auto result = std::max_element(temp_res.begin(), temp_res.end() - 1);
+    auto result = std::max_element(temp_res.begin(), temp_res.end());
     l_elem_index_ = static_cast<IndexType>(std::distance(temp_res.begin(), result));
     l_elem_ = input_[l_elem_index_];
 
@@ -58,7 +51,7 @@ class MostDifferentNeighborElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  std::span<const InOutType> input_;
   InOutType l_elem_, r_elem_;
   IndexType l_elem_index_, r_elem_index_;
 };
@@ -1,10 +1,12 @@
 import argparse
+import json
 import os
 import re
 import xlsxwriter
 
 parser = argparse.ArgumentParser()
-parser.add_argument('-i', '--input', help='Input file path (logs of perf tests, .txt)', required=True)
+parser.add_argument('-i', '--input', required=True,
+                    help='Input file path (logs of perf tests, .txt, or PPC_PERF_RESULTS_FILE records, .jsonl)')
 parser.add_argument('-o', '--output', help='Output file path (path to .xlsx table)', required=True)
 args = parser.parse_args()
 logs_path = os.path.abspath(args.input)
@@ -12,36 +14,64 @@ xlsx_path = os.path.abspath(args.output)
 
 list_of_type_of_tasks = ["all", "mpi", "omp", "seq", "stl", "tbb"]
 
-result_tables = {"pipeline": {}, "task_run": {}}
-set_of_task_name = []
+perf_types = ["pipeline", "task_run"]
 
-logs_file = open(logs_path, "r")
-logs_lines = logs_file.readlines()
-for line in logs_lines:
-    pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
-    result = re.findall(pattern, line)
-    if len(result):
-        task_name = result[0][1]
-        perf_type = result[0][2]
-        set_of_task_name.append(task_name)
-        result_tables[perf_type][task_name] = {}
 
-        for ttype in list_of_type_of_tasks:
-            result_tables[perf_type][task_name][ttype] = -1.0
+def get_workers_count(record):
+    # Number of workers the implementation used: threads, processes or both
+    if record["implementation"] == "seq":
+        return 1
+    if record["implementation"] in ["omp", "stl", "tbb"]:
+        return record["threads"]
+    if record["implementation"] == "mpi":
+        return record["processes"]
+    return record["threads"] * record["processes"]
 
-for line in logs_lines:
-    pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
-    result = re.findall(pattern, line)
-    if len(result):
-        task_type = result[0][0]
-        task_name = result[0][1]
-        perf_type = result[0][2]
-        perf_time = float(result[0][3])
-        if perf_time < 0.05:
-            msg = f"Performance time = {perf_time} < 0.05 second : for {task_type} - {task_name} - {perf_type} \n"
-            raise Exception(msg)
-        result_tables[perf_type][task_name][task_type] = perf_time
 
+def read_log_records(path):
+    # Records scraped from "tasks/<type>/<name>:<perf_type>:<time>" lines of perf tests log,
+    # the log has no thread counts, so every record is a single point at PROC_COUNT workers
+    cpu_num = os.environ.get("PROC_COUNT")
+    if cpu_num is None:
+        raise EnvironmentError("Required environment variable 'PROC_COUNT' is not set.")
+    records = []
+    with open(path, "r") as logs_file:
+        for line in logs_file.readlines():
+            pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
+            result = re.findall(pattern, line)
+            if len(result):
+                records.append((result[0][0], result[0][1], result[0][2], float(result[0][3]), int(cpu_num)))
+    return records
+
+
+def read_json_records(path):
+    # Records written by ppc::core::Perf into PPC_PERF_RESULTS_FILE (one JSON object per line)
+    records = []
+    with open(path, "r") as results_file:
+        for line in results_file:
+            if not line.strip():
+                continue
+            record = json.loads(line)
+            if record["type"] not in perf_types or record["implementation"] not in list_of_type_of_tasks:
+                continue
+            perf_time = record["time_sec"] if record["time_sec"] < 10.0 else -1.0
+            records.append((record["implementation"], record["task"], record["type"], perf_time,
+                            get_workers_count(record)))
+    return records
+
+
+if logs_path.endswith(".jsonl") or logs_path.endswith(".json"):
+    perf_records = read_json_records(logs_path)
+else:
+    perf_records = read_log_records(logs_path)
+
+# result_tables[perf_type][task_name][task_type][workers] = time
+result_tables = {perf_type: {} for perf_type in perf_types}
+for task_type, task_name, perf_type, perf_time, workers in perf_records:
+    if perf_time < 0.05:
+        msg = f"Performance time = {perf_time} < 0.05 second : for {task_type} - {task_name} - {perf_type} \n"
+        raise Exception(msg)
+    result_tables[perf_type].setdefault(task_name, {}).setdefault(task_type, {})[workers] = perf_time
 
 for table_name in result_tables:
     workbook = xlsxwriter.Workbook(os.path.join(xlsx_path, table_name + '_perf_table.xlsx'))
@@ -49,56 +79,53 @@ for table_name in result_tables:
     worksheet.set_column('A:Z', 23)
     right_bold_border = workbook.add_format({'bold': True, 'right': 2, 'bottom': 2})
     bottom_bold_border = workbook.add_format({'bold': True, 'bottom': 2})
-    cpu_num = os.environ.get("PROC_COUNT")
-    if cpu_num is None:
-        raise EnvironmentError("Required environment variable 'PROC_COUNT' is not set.")
-    cpu_num = int(cpu_num)
-    worksheet.write(0, 0, "cpu_num = " + str(cpu_num), right_bold_border)
+    right_border = workbook.add_format({'right': 2})
 
-    it = 1
-    for type_of_task in list_of_type_of_tasks:
-        worksheet.write(0, it, "T_" + type_of_task + "(" + str(cpu_num) + ")", bottom_bold_border)
+    workers_list = sorted({workers for task_times in result_tables[table_name].values()
+                           for type_times in task_times.values() for workers in type_times})
+    worksheet.write(0, 0, "task", bottom_bold_border)
+    worksheet.write(0, 1, "type", right_bold_border)
+    it = 2
+    for workers in workers_list:
+        worksheet.write(0, it, "T(" + str(workers) + ")", bottom_bold_border)
         it += 1
-        worksheet.write(0, it, "S(" + str(cpu_num) + ")" + " = " +
-                        "T_seq(" + str(cpu_num) + ")" + " / " +
-                        "T_" + type_of_task + "(" + str(cpu_num) + ")", bottom_bold_border)
+        worksheet.write(0, it, "S(" + str(workers) + ") = T_seq / T(" + str(workers) + ")", bottom_bold_border)
         it += 1
-        worksheet.write(0, it, "Eff(" + str(cpu_num) + ")" + " = " +
-                        "S(" + str(cpu_num) + ")" + " / " + str(cpu_num), right_bold_border)
+        worksheet.write(0, it, "Eff(" + str(workers) + ") = S(" + str(workers) + ") / " + str(workers),
+                        right_bold_border)
         it += 1
 
-    it = 1
-    for task_name in list(set(set_of_task_name)):
-        worksheet.write(it, 0, task_name, workbook.add_format({'bold': True, 'right': 2}))
-        it += 1
-
-    it_i = 1
     it_j = 1
-    right_border = workbook.add_format({'right': 2})
-    for task_name in list(set(set_of_task_name)):
+    for task_name in sorted(result_tables[table_name]):
+        task_times = result_tables[table_name][task_name]
+        if "seq" not in task_times:
+            print(f"Warning! Sequential time of task '{task_name}' is not found in results")
+            seq_time = -1.0
+        else:
+            seq_time = task_times["seq"][min(task_times["seq"])]
         for type_of_task in list_of_type_of_tasks:
-            if task_name not in result_tables[table_name].keys():
-                print(f"Warning! Task '{task_name}' is not found in results")
-                worksheet.write(it_j, it_i, "Error!")
+            if type_of_task not in task_times:
+                continue
+            worksheet.write(it_j, 0, task_name, workbook.add_format({'bold': True}))
+            worksheet.write(it_j, 1, type_of_task, workbook.add_format({'bold': True, 'right': 2}))
+            it_i = 2
+            for workers in workers_list:
+                if workers not in task_times[type_of_task]:
+                    it_i += 3
+                    continue
+                par_time = task_times[type_of_task][workers]
+                if par_time <= 0 or seq_time <= 0:
+                    speed_up = -1
+                else:
+                    speed_up = seq_time / par_time
+                efficiency = speed_up / workers
+                worksheet.write(it_j, it_i, par_time)
                 it_i += 1
-                worksheet.write(it_j, it_i, "Error!")
+                worksheet.write(it_j, it_i, speed_up)
                 it_i += 1
-                worksheet.write(it_j, it_i, "Error!")
+                worksheet.write(it_j, it_i, efficiency, right_border)
                 it_i += 1
-                continue
-            par_time = result_tables[table_name][task_name][type_of_task]
-            seq_time = result_tables[table_name][task_name]["seq"]
-            if par_time == 0:
-                speed_up = -1
-            else:
-                speed_up = seq_time / par_time
-            efficiency = speed_up / cpu_num
-            worksheet.write(it_j, it_i, par_time)
-            it_i += 1
-            worksheet.write(it_j, it_i, speed_up)
-            it_i += 1
-            worksheet.write(it_j, it_i, efficiency, right_border)
-            it_i += 1
-        it_i = 1
-        it_j += 1
+                print(f"{task_name}:{type_of_task}:{table_name}:workers={workers}:time={par_time}:"
+                      f"speedup={speed_up:.3f}:efficiency={efficiency:.3f}")
+            it_j += 1
     workbook.close()
@@ -11,9 +11,23 @@ def init_cmd_args():
     parser.add_argument(
         "--running-type",
         required=True,
-        choices=["threads", "processes", "performance", "performance-list"],
+        choices=["threads", "processes", "performance", "performance-sweep", "performance-list"],
         help="Specify the execution mode. Choose 'threads' for multithreading or 'processes' for multiprocessing."
     )
+    parser.add_argument(
+        "--max-threads",
+        required=False,
+        type=int,
+        default=None,
+        help="Upper bound of threads for 'performance-sweep' (default: OMP_NUM_THREADS)."
+    )
+    parser.add_argument(
+        "--max-processes",
+        required=False,
+        type=int,
+        default=None,
+        help="Upper bound of MPI processes for 'performance-sweep' (default: PROC_COUNT)."
+    )
     parser.add_argument(
         "--additional-mpi-args",
         required=False,
@@ -79,8 +93,8 @@ class PPCRunner:
             os.environ.update(env_vars)
 
     @staticmethod
-    def __run_exec(command):
-        result = subprocess.run(command, shell=True, env=os.environ)
+    def __run_exec(command, env=None):
+        result = subprocess.run(command, shell=True, env=env if env is not None else os.environ)
         if result.returncode != 0:
             raise Exception(f"Subprocess return {result.returncode}.")
 
@@ -171,6 +185,39 @@ class PPCRunner:
         self.__run_exec(f"{self.work_dir / 'seq_perf_tests'} {self.__get_gtest_settings(1)}")
         self.__run_exec(f"{self.work_dir / 'stl_perf_tests'} {self.__get_gtest_settings(1)}")
         self.__run_exec(f"{self.work_dir / 'tbb_perf_tests'} {self.__get_gtest_settings(1)}")
+        self.__run_exec(f"{self.work_dir / 'core_perf_tests'} {self.__get_gtest_settings(1)}")
+
+    def run_performance_sweep(self, max_threads, max_processes, additional_mpi_args):
+        # Every point is a separate launch, so OpenMP, TBB and ppc::core::ThreadPool
+        # pick up the limit from OMP_NUM_THREADS from scratch
+        if max_threads is None:
+            max_threads = int(os.environ.get("OMP_NUM_THREADS", "1"))
+        if max_processes is None:
+            max_processes = int(os.environ.get("PROC_COUNT", "1"))
+
+        def point_env(num_threads):
+            env = os.environ.copy()
+            env["OMP_NUM_THREADS"] = str(num_threads)
+            return env
+
+        self.__run_exec(f"{self.work_dir / 'seq_perf_tests'} {self.__get_gtest_settings(1)}", point_env(1))
+        for num_threads in range(1, max_threads + 1):
+            print(f"Performance sweep: {num_threads} thread(s)")
+            for task_type in ["omp", "stl", "tbb"]:
+                if task_type == "omp" and os.environ.get("CLANG_BUILD") == "1":
+                    continue
+                self.__run_exec(f"{self.work_dir / f'{task_type}_perf_tests'} {self.__get_gtest_settings(1)}",
+                                point_env(num_threads))
+
+        if os.environ.get("ASAN_RUN"):
+            return
+        for num_processes in range(1, max_processes + 1):
+            print(f"Performance sweep: {num_processes} process(es)")
+            mpi_running = f"{self.mpi_exec} {additional_mpi_args} -np {num_processes}"
+            self.__run_exec(f"{mpi_running} {self.work_dir / 'mpi_perf_tests'} {self.__get_gtest_settings(1)}",
+                            point_env(1))
+            self.__run_exec(f"{mpi_running} {self.work_dir / 'all_perf_tests'} {self.__get_gtest_settings(1)}",
+                            point_env(max_threads))
 
     def run_performance_list(self):
         for task_type in ["all", "mpi", "omp", "seq", "stl", "tbb"]:
@@ -192,6 +239,9 @@ if __name__ == "__main__":
         ppc_runner.run_processes(args_dict["additional_mpi_args"])
     elif args_dict["running_type"] == "performance":
         ppc_runner.run_performance()
+    elif args_dict["running_type"] == "performance-sweep":
+        ppc_runner.run_performance_sweep(args_dict["max_threads"], args_dict["max_processes"],
+                                         args_dict["additional_mpi_args"])
     elif args_dict["running_type"] == "performance-list":
         ppc_runner.run_performance_list()
     else:
@@ -47,21 +47,11 @@ class TestTaskALL : public ppc::core::Task {
 
   std::vector<Point> input_points_;
   std::vector<Point> convex_hull_;
-  Point pivot_;
   std::vector<Point> local_points_;
-  std::vector<Point> globally_sorted_points_;
 
   bool InitializeRun(size_t& current_total_num_points_ref, int& current_rank_in_active_comm_out);
-  size_t DistributePointsAndBroadcastPivot(int current_rank_in_active_comm);
-  int SortLocalAndGatherSortedPoints(int current_rank_in_active_comm);
-  void ConstructFinalHullOnRoot(int current_rank_in_active_comm, int total_sorted_points_count);
-
-  static Point FindPivot(const std::vector<Point>& points);
-  static bool CompareAngles(const Point& p1, const Point& p2, const Point& pivot);
-  static double CrossProduct(const Point& o, const Point& a, const Point& b);
-  static void RemoveDuplicates(std::vector<Point>& points);
-  static std::vector<Point> BuildHull(const std::vector<Point>& sorted_points, const Point& pivot);
-  static void LocalParallelSort(std::vector<Point>& points, const Point& pivot_for_sort);
+  void DistributePoints(size_t total_num_points, int current_rank_in_active_comm);
+  void ConstructFinalHullOnRoot(int current_rank_in_active_comm);
 };
 
 }  // namespace alputov_i_graham_scan_all
\ No newline at end of file
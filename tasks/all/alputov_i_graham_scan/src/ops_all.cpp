@@ -3,17 +3,13 @@
 #include <mpi.h>
 
 #include <algorithm>
-#include <cmath>
 #include <cstddef>
-#include <iterator>
-#include <ranges>
-#include <stdexcept>
-#include <thread>
 #include <utility>
 #include <vector>
 
+#include "core/hull/include/hull.hpp"
+#include "core/sparse/include/sparse.hpp"
 #include "core/task/include/task.hpp"
-#include "core/util/include/util.hpp"
 
 namespace alputov_i_graham_scan_all {
 
@@ -145,110 +141,42 @@ bool TestTaskALL::InitializeRun(size_t& current_total_num_points_ref, int& curre
   return true;
 }
 
-size_t TestTaskALL::DistributePointsAndBroadcastPivot(int current_rank_in_active_comm) {
-  if (current_rank_in_active_comm == 0) {
-    pivot_ = FindPivot(input_points_);
-  }
-  MPI_Bcast(&pivot_, 1, mpi_point_datatype_, 0, active_comm_);
-
-  std::vector<Point> points_to_sort_globally_on_root;
-  if (current_rank_in_active_comm == 0) {
-    for (const auto& p : input_points_) {
-      if (p != pivot_) {
-        points_to_sort_globally_on_root.push_back(p);
-      }
-    }
-  }
-
-  size_t num_points_to_scatter = 0;
-  if (current_rank_in_active_comm == 0) {
-    num_points_to_scatter = points_to_sort_globally_on_root.size();
-  }
-  MPI_Bcast(&num_points_to_scatter, 1, MPI_UNSIGNED_LONG, 0, active_comm_);
-
-  if (num_points_to_scatter == 0) {
-    return 0;
+void TestTaskALL::DistributePoints(size_t total_num_points, int current_rank_in_active_comm) {
+  std::vector<int> send_counts(active_procs_count_);
+  std::vector<int> displs(active_procs_count_);
+  for (int i = 0; i < active_procs_count_; ++i) {
+    displs[i] = static_cast<int>(total_num_points * i / active_procs_count_);
+    send_counts[i] = static_cast<int>(total_num_points * (i + 1) / active_procs_count_) - displs[i];
   }
 
-  std::vector<int> send_counts_for_scatterv(active_procs_count_);
-  std::vector<int> displs_for_scatterv(active_procs_count_);
-  int local_recv_count = 0;
-
-  if (current_rank_in_active_comm == 0) {
-    int base_count = static_cast<int>(num_points_to_scatter / static_cast<size_t>(active_procs_count_));
-    int remainder = static_cast<int>(num_points_to_scatter % static_cast<size_t>(active_procs_count_));
-    displs_for_scatterv[0] = 0;
-    for (int i = 0; i < active_procs_count_; ++i) {
-      send_counts_for_scatterv[i] = base_count + (i < remainder ? 1 : 0);
-      if (i > 0) {
-        displs_for_scatterv[i] = displs_for_scatterv[i - 1] + send_counts_for_scatterv[i - 1];
-      }
-    }
-  }
-
-  MPI_Scatter((current_rank_in_active_comm == 0) ? send_counts_for_scatterv.data() : nullptr, 1, MPI_INT,
-              &local_recv_count, 1, MPI_INT, 0, active_comm_);
-
-  local_points_.resize(local_recv_count);
-  MPI_Scatterv((current_rank_in_active_comm == 0) ? points_to_sort_globally_on_root.data() : nullptr,
-               (current_rank_in_active_comm == 0) ? send_counts_for_scatterv.data() : nullptr,
-               (current_rank_in_active_comm == 0) ? displs_for_scatterv.data() : nullptr, mpi_point_datatype_,
-               local_points_.data(), local_recv_count, mpi_point_datatype_, 0, active_comm_);
-
-  return num_points_to_scatter;
+  local_points_.resize(send_counts[current_rank_in_active_comm]);
+  MPI_Scatterv((current_rank_in_active_comm == 0) ? input_points_.data() : nullptr, send_counts.data(), displs.data(),
+               mpi_point_datatype_, local_points_.data(), static_cast<int>(local_points_.size()), mpi_point_datatype_,
+               0, active_comm_);
 }
 
-int TestTaskALL::SortLocalAndGatherSortedPoints(int current_rank_in_active_comm) {
-  if (!local_points_.empty()) {
-    LocalParallelSort(local_points_, pivot_);
-  }
-
-  std::vector<int> local_sizes_recv_on_root;
-  if (current_rank_in_active_comm == 0) {
-    local_sizes_recv_on_root.resize(active_procs_count_);
-  }
-  int my_local_size_after_sort = static_cast<int>(local_points_.size());
+void TestTaskALL::ConstructFinalHullOnRoot(int current_rank_in_active_comm) {
+  // Every hull vertex is a vertex of the hull of its block, so the root only merges the block hulls
+  const ppc::core::sparse::StlBackend backend;
+  const auto local_hull = ppc::core::hull::ConvexHull<Point>(local_points_, backend);
+  int local_hull_size = static_cast<int>(local_hull.size());
 
-  MPI_Gather(&my_local_size_after_sort, 1, MPI_INT,
-             (current_rank_in_active_comm == 0) ? local_sizes_recv_on_root.data() : nullptr, 1, MPI_INT, 0,
-             active_comm_);
+  std::vector<int> hull_sizes(active_procs_count_);
+  MPI_Gather(&local_hull_size, 1, MPI_INT, hull_sizes.data(), 1, MPI_INT, 0, active_comm_);
 
-  int total_sorted_points_count = 0;
-  std::vector<int> displs_for_gatherv;
+  std::vector<int> displs(active_procs_count_);
+  std::vector<Point> hull_vertices;
   if (current_rank_in_active_comm == 0) {
-    displs_for_gatherv.resize(active_procs_count_);
-
-    globally_sorted_points_.clear();
-    for (int i = 0; i < active_procs_count_; ++i) {
-      total_sorted_points_count += local_sizes_recv_on_root[i];
-      if (i > 0) {
-        displs_for_gatherv[i] = displs_for_gatherv[i - 1] + local_sizes_recv_on_root[i - 1];
-      }
+    for (int i = 1; i < active_procs_count_; ++i) {
+      displs[i] = displs[i - 1] + hull_sizes[i - 1];
     }
-    globally_sorted_points_.resize(total_sorted_points_count);
+    hull_vertices.resize(displs.back() + hull_sizes.back());
   }
+  MPI_Gatherv(local_hull.data(), local_hull_size, mpi_point_datatype_, hull_vertices.data(), hull_sizes.data(),
+              displs.data(), mpi_point_datatype_, 0, active_comm_);
 
-  MPI_Gatherv(local_points_.data(), my_local_size_after_sort, mpi_point_datatype_,
-              (current_rank_in_active_comm == 0) ? globally_sorted_points_.data() : nullptr,
-              (current_rank_in_active_comm == 0) ? local_sizes_recv_on_root.data() : nullptr,
-              (current_rank_in_active_comm == 0) ? displs_for_gatherv.data() : nullptr, mpi_point_datatype_, 0,
-              active_comm_);
-
-  return total_sorted_points_count;
-}
-
-void TestTaskALL::ConstructFinalHullOnRoot(int current_rank_in_active_comm, int total_sorted_points_count) {
   if (current_rank_in_active_comm == 0) {
-    if (total_sorted_points_count > 0) {
-      LocalParallelSort(globally_sorted_points_, pivot_);
-      RemoveDuplicates(globally_sorted_points_);
-    }
-
-    if (globally_sorted_points_.empty()) {
-      convex_hull_ = {pivot_};
-    } else {
-      convex_hull_ = BuildHull(globally_sorted_points_, pivot_);
-    }
+    convex_hull_ = ppc::core::hull::ConvexHull<Point>(hull_vertices, backend);
   }
 }
 
@@ -260,17 +188,8 @@ bool TestTaskALL::RunImpl() {
     return true;
   }
 
-  size_t num_points_to_scatter = DistributePointsAndBroadcastPivot(current_rank_in_active_comm);
-
-  if (num_points_to_scatter == 0) {
-    if (current_rank_in_active_comm == 0) {
-      convex_hull_ = {pivot_};
-    }
-    return true;
-  }
-
-  int total_sorted_points_count = SortLocalAndGatherSortedPoints(current_rank_in_active_comm);
-  ConstructFinalHullOnRoot(current_rank_in_active_comm, total_sorted_points_count);
+  DistributePoints(current_total_num_points, current_rank_in_active_comm);
+  ConstructFinalHullOnRoot(current_rank_in_active_comm);
 
   return true;
 }
@@ -289,117 +208,4 @@ bool TestTaskALL::PostProcessingImpl() {
   return true;
 }
 
-Point TestTaskALL::FindPivot(const std::vector<Point>& points) {
-  if (points.empty()) {
-    throw std::runtime_error("Cannot find pivot in empty set of points. ");
-  }
-  return *std::ranges::min_element(points, [](const Point& a, const Point& b) { return a < b; });
-}
-
-double TestTaskALL::CrossProduct(const Point& o, const Point& a, const Point& b) {
-  return ((a.x - o.x) * (b.y - o.y)) - ((a.y - o.y) * (b.x - o.x));
-}
-
-bool TestTaskALL::CompareAngles(const Point& p1, const Point& p2, const Point& pivot) {
-  double cross = CrossProduct(pivot, p1, p2);
-  constexpr double kEpsilon = 1e-9;
-
-  if (std::abs(cross) < kEpsilon) {
-    double dist1_sq = ((p1.x - pivot.x) * (p1.x - pivot.x)) + ((p1.y - pivot.y) * (p1.y - pivot.y));
-    double dist2_sq = ((p2.x - pivot.x) * (p2.x - pivot.x)) + ((p2.y - pivot.y) * (p2.y - pivot.y));
-    return dist1_sq < dist2_sq;
-  }
-  return cross > 0;
-}
-
-void TestTaskALL::RemoveDuplicates(std::vector<Point>& points) {
-  if (points.empty()) {
-    return;
-  }
-  points.erase(std::ranges::unique(points).begin(), points.end());
-}
-
-std::vector<Point> TestTaskALL::BuildHull(const std::vector<Point>& sorted_points, const Point& pivot) {
-  std::vector<Point> hull;
-  if (sorted_points.empty()) {
-    hull.push_back(pivot);
-    return hull;
-  }
-
-  hull.push_back(pivot);
-  hull.push_back(sorted_points[0]);
-
-  if (sorted_points.size() == 1) {
-    return hull;
-  }
-
-  for (size_t i = 1; i < sorted_points.size(); ++i) {
-    const Point& p = sorted_points[i];
-    while (hull.size() >= 2 && CrossProduct(hull[hull.size() - 2], hull.back(), p) < 1e-9) {
-      hull.pop_back();
-    }
-    hull.push_back(p);
-  }
-
-  while (hull.size() >= 3 && CrossProduct(hull[hull.size() - 2], hull.back(), hull[0]) < 1e-9) {
-    hull.pop_back();
-  }
-  if (hull.size() >= 3 && CrossProduct(hull.back(), hull[0], hull[1]) < 1e-9) {
-    hull.erase(hull.begin());
-  }
-
-  return hull;
-}
-
-void TestTaskALL::LocalParallelSort(std::vector<Point>& points, const Point& pivot_for_sort) {
-  if (points.size() <= 1) {
-    return;
-  }
-
-  auto comparator = [&](const Point& a, const Point& b) { return CompareAngles(a, b, pivot_for_sort); };
-
-  const auto n = points.size();
-  const auto num_threads_hint = static_cast<size_t>(ppc::util::GetPPCNumThreads());
-  const size_t num_threads =
-      std::max(static_cast<size_t>(1),
-               std::min({n / 500, num_threads_hint, static_cast<size_t>(std::thread::hardware_concurrency())}));
-
-  if (num_threads <= 1 || n < 500) {
-    std::ranges::sort(points, comparator);
-    return;
-  }
-
-  std::vector<std::thread> threads;
-  threads.reserve(num_threads);
-  std::vector<size_t> chunk_offsets(num_threads + 1);
-
-  for (size_t i = 0; i <= num_threads; ++i) {
-    chunk_offsets[i] = (i * n) / num_threads;
-  }
-
-  using DifferenceType = typename std::vector<Point>::difference_type;
-
-  for (size_t i = 0; i < num_threads; ++i) {
-    threads.emplace_back([&points, comparator, start_offset = chunk_offsets[i], end_offset = chunk_offsets[i + 1]]() {
-      if (start_offset < end_offset) {
-        auto start_it = std::next(points.begin(), static_cast<DifferenceType>(start_offset));
-        auto end_it = std::next(points.begin(), static_cast<DifferenceType>(end_offset));
-        std::ranges::sort(std::ranges::subrange(start_it, end_it), comparator);
-      }
-    });
-  }
-
-  for (auto& t : threads) {
-    t.join();
-  }
-
-  for (size_t i = 1; i < num_threads; ++i) {
-    auto first_unsorted_chunk_start = std::next(points.begin(), static_cast<DifferenceType>(chunk_offsets[i]));
-    auto first_unsorted_chunk_end = std::next(points.begin(), static_cast<DifferenceType>(chunk_offsets[i + 1]));
-    if (points.begin() < first_unsorted_chunk_start && first_unsorted_chunk_start < first_unsorted_chunk_end) {
-      std::inplace_merge(points.begin(), first_unsorted_chunk_start, first_unsorted_chunk_end, comparator);
-    }
-  }
-}
-
 }  // namespace alputov_i_graham_scan_all
\ No newline at end of file
@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <boost/mpi/collectives/gather.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <boost/serialization/vector.hpp>  // NOLINT(misc-include-cleaner) - needed for MPI serialization
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -136,3 +138,40 @@ TEST(burykin_m_radix_all, EmptyVector) {
 
   CompareResults(expected, output);
 }
+
+TEST(burykin_m_radix_all, DistributedOutput) {
+  boost::mpi::communicator world;
+  constexpr size_t kSize = 5000;
+  std::vector<int> input;
+  if (world.rank() == 0) {
+    // Skewed input with many duplicates: most buckets get few distinct values
+    input = GenerateRandomVector(kSize, -3, 3);
+    const auto spread = GenerateRandomVector(kSize / 10, -1000000, 1000000);
+    input.insert(input.end(), spread.begin(), spread.end());
+  }
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    task_data->inputs.push_back(reinterpret_cast<uint8_t*>(input.data()));
+    task_data->inputs_count.push_back(static_cast<std::uint32_t>(input.size()));
+  }
+
+  burykin_m_radix_all::RadixALL task(task_data, burykin_m_radix_all::OutputMode::kDistributed);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  const auto& local = task.LocalResult();
+  EXPECT_TRUE(std::ranges::is_sorted(local));
+  std::vector<std::vector<int>> parts;
+  boost::mpi::gather(world, local, parts, 0);
+  if (world.rank() == 0) {
+    std::vector<int> joined;
+    for (const auto& part : parts) {
+      joined.insert(joined.end(), part.begin(), part.end());
+    }
+    std::ranges::sort(input);
+    EXPECT_EQ(joined, input);
+  }
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -8,16 +10,28 @@
 
 namespace burykin_m_radix_all {
 
+// Where the sorted sequence ends up: gathered into the output buffer of rank 0, or left distributed with
+// every rank holding a consecutive range of it (see RadixALL::LocalResult)
+enum class OutputMode : std::uint8_t { kGathered, kDistributed };
+
+// Distributed sample sort: every rank radix sorts its share of the input, regular samples of the local runs
+// give size - 1 splitters, the buckets are exchanged with MPI_Alltoallv and every rank merges the runs it
+// received. No rank holds more than its bucket until the optional final gatherv.
 class RadixALL : public ppc::core::Task {
  public:
-  explicit RadixALL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  explicit RadixALL(ppc::core::TaskDataPtr task_data, OutputMode mode = OutputMode::kGathered)
+      : Task(std::move(task_data)), mode_(mode) {}
 
   bool ValidationImpl() override;
   bool PreProcessingImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
+  // Sorted elements of this rank after Run; concatenated in rank order they are the sorted input
+  [[nodiscard]] const std::vector<int>& LocalResult() const { return local_data_; }
+
  private:
+  OutputMode mode_;
   std::vector<int> input_, output_;
   std::vector<int> local_data_;
   boost::mpi::communicator world_;
@@ -32,17 +46,14 @@ class RadixALL : public ppc::core::Task {
   static void MergeResults(std::vector<int>& result, const std::vector<int>& negatives,
                            const std::vector<int>& positives);
 
-  // MPI distribution and merging functions
-  std::vector<int> DistributeData(const std::vector<int>& data, int rank, int size);
-  std::vector<int> GatherAndMerge(const std::vector<int>& local_sorted, int rank, int size);
-
-  // Simple merge function
-  static std::vector<int> MergeTwoSorted(const std::vector<int>& left, const std::vector<int>& right);
+  // Sample sort stages
+  void ScatterInput(std::size_t array_size);
+  [[nodiscard]] std::vector<int> SelectSplitters() const;
+  void ExchangeBuckets(const std::vector<int>& splitters);
+  void GatherOutput();
 
-  static void CalculateDistribution(const std::vector<int>& data, int size, std::vector<int>& send_counts,
+  static void CalculateDistribution(std::size_t total_size, int size, std::vector<int>& send_counts,
                                     std::vector<int>& displs);
-  void ScatterDataFromRoot(const std::vector<int>& data, const std::vector<int>& send_counts,
-                           const std::vector<int>& displs, int size, std::vector<int>& local_data);
 };
 
 }  // namespace burykin_m_radix_all
\ No newline at end of file
@@ -1,22 +1,36 @@
 #include "all/burykin_m_radix/include/ops_all.hpp"
 
+#include <mpi.h>
 #include <omp.h>
 
 #include <algorithm>
 #include <boost/mpi/collectives.hpp>
+#include <boost/mpi/collectives/all_gather.hpp>
+#include <boost/mpi/collectives/all_to_all.hpp>
 #include <boost/mpi/collectives/broadcast.hpp>
+#include <boost/mpi/collectives/gather.hpp>
+#include <boost/mpi/collectives/gatherv.hpp>
+#include <boost/mpi/collectives/scatterv.hpp>
 #include <boost/mpi/communicator.hpp>
-#include <boost/serialization/vector.hpp>  // NOLINT(misc-include-cleaner) - needed for MPI serialization
 #include <cmath>
 #include <cstddef>
 #include <cstring>
+#include <limits>
 #include <numeric>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+
+namespace {
+// Regular samples each rank contributes to the splitter selection
+constexpr int kSamplesPerRank = 64;
+}  // namespace
+
 bool burykin_m_radix_all::RadixALL::ValidationImpl() {
   if (world_.rank() == 0) {
-    return task_data->inputs_count[0] == task_data->outputs_count[0];
+    return mode_ == OutputMode::kDistributed || task_data->inputs_count[0] == task_data->outputs_count[0];
   }
   return true;
 }
@@ -31,42 +45,35 @@ bool burykin_m_radix_all::RadixALL::PreProcessingImpl() {
 }
 
 bool burykin_m_radix_all::RadixALL::RunImpl() {
-  int size = world_.size();
-  int rank = world_.rank();
-
   // Broadcast array size to all processes
   size_t array_size = 0;
-  if (rank == 0) {
+  if (world_.rank() == 0) {
     array_size = input_.size();
   }
   boost::mpi::broadcast(world_, array_size, 0);
 
+  local_data_.clear();
   if (array_size == 0) {
-    if (rank == 0) {
+    if (world_.rank() == 0) {
       output_.clear();
     }
     return true;
   }
 
-  // Distribute data using scatter approach
-  local_data_ = DistributeData(input_, rank, size);
-
-  // Sort local data - check if data is not empty before sorting
-  if (!local_data_.empty()) {
-    RadixSortLocal(local_data_);
+  ScatterInput(array_size);
+  RadixSortLocal(local_data_);
+  if (world_.size() > 1) {
+    ExchangeBuckets(SelectSplitters());
+  }
+  if (mode_ == OutputMode::kGathered) {
+    GatherOutput();
   }
-
-  // Synchronize before gathering to ensure all processes have completed sorting
-  world_.barrier();
-
-  // Gather and merge results using tree-based approach
-  output_ = GatherAndMerge(local_data_, rank, size);
 
   return true;
 }
 
 bool burykin_m_radix_all::RadixALL::PostProcessingImpl() {
-  if (world_.rank() == 0) {
+  if (world_.rank() == 0 && mode_ == OutputMode::kGathered) {
     if (!output_.empty()) {
       std::memcpy(task_data->outputs[0], output_.data(), output_.size() * sizeof(int));
     }
@@ -202,13 +209,8 @@ void burykin_m_radix_all::RadixALL::CountingSortByDigit(std::vector<int>& arr, i
   arr = std::move(output);
 }
 
-void burykin_m_radix_all::RadixALL::CalculateDistribution(const std::vector<int>& data, int size,
+void burykin_m_radix_all::RadixALL::CalculateDistribution(std::size_t total_size, int size,
                                                           std::vector<int>& send_counts, std::vector<int>& displs) {
-  if (data.empty()) {
-    return;  // send_counts already initialized to 0
-  }
-
-  const size_t total_size = data.size();
   const size_t base_chunk = total_size / size;
   const size_t remainder = total_size % size;
 
@@ -220,111 +222,94 @@ void burykin_m_radix_all::RadixALL::CalculateDistribution(const std::vector<int>
   }
 }
 
-void burykin_m_radix_all::RadixALL::ScatterDataFromRoot(const std::vector<int>& data,
-                                                        const std::vector<int>& send_counts,
-                                                        const std::vector<int>& displs, int size,
-                                                        std::vector<int>& local_data) {
-  for (int i = 0; i < size; ++i) {
-    if (i == 0) {
-      // Process 0 keeps its own portion
-      if (send_counts[0] > 0) {
-        std::copy(data.begin(), data.begin() + send_counts[0], local_data.begin());
-      }
-    } else {
-      // Send to other processes
-      if (send_counts[i] > 0) {
-        std::vector<int> chunk(data.begin() + displs[i], data.begin() + displs[i] + send_counts[i]);
-        world_.send(i, 0, chunk);
-      } else {
-        // Send empty chunk
-        std::vector<int> empty_chunk;
-        world_.send(i, 0, empty_chunk);
-      }
-    }
-  }
-}
-
-std::vector<int> burykin_m_radix_all::RadixALL::DistributeData(const std::vector<int>& data, int rank, int size) {
-  std::vector<int> local_data;
+void burykin_m_radix_all::RadixALL::ScatterInput(std::size_t array_size) {
+  const int size = world_.size();
   std::vector<int> send_counts(size, 0);
   std::vector<int> displs(size, 0);
+  CalculateDistribution(array_size, size, send_counts, displs);
 
-  if (rank == 0) {
-    CalculateDistribution(data, size, send_counts, displs);
-  }
-
-  // Broadcast distribution info to all processes
-  boost::mpi::broadcast(world_, send_counts, 0);
-
-  // Resize local buffer based on what this process should receive
-  local_data.resize(send_counts[rank]);
-
-  // Distribute data
-  if (rank == 0) {
-    ScatterDataFromRoot(data, send_counts, displs, size, local_data);
-  } else {
-    world_.recv(0, 0, local_data);
-  }
-
-  return local_data;
+  local_data_.resize(send_counts[world_.rank()]);
+  boost::mpi::scatterv(world_, input_.data(), send_counts, displs, local_data_.data(),
+                       static_cast<int>(local_data_.size()), 0);
 }
 
-std::vector<int> burykin_m_radix_all::RadixALL::GatherAndMerge(const std::vector<int>& local_sorted, int rank,
-                                                               int size) {
-  std::vector<int> current_data = local_sorted;
-
-  // Tree-based reduction for better scalability
-  for (int step = 1; step < size; step *= 2) {
-    if (rank % (2 * step) == 0) {
-      // Receiver
-      int sender = rank + step;
-      if (sender < size) {
-        std::vector<int> received_data;
-        // Always receive - sender will always send (even empty data)
-        world_.recv(sender, 0, received_data);
-        current_data = MergeTwoSorted(current_data, received_data);
-      }
-    } else if (rank % step == 0) {
-      // Sender - always send current data (even if empty)
-      int receiver = rank - step;
-      world_.send(receiver, 0, current_data);
-      break;
+std::vector<int> burykin_m_radix_all::RadixALL::SelectSplitters() const {
+  // Regular samples of the sorted local run; a rank without elements offers the largest value, which only
+  // moves splitters up
+  const size_t local_size = local_data_.size();
+  std::vector<int> samples(kSamplesPerRank, std::numeric_limits<int>::max());
+  if (local_size > 0) {
+    for (size_t j = 0; j < samples.size(); ++j) {
+      samples[j] = local_data_[(((2 * j) + 1) * local_size) / (2 * samples.size())];
     }
   }
 
-  return current_data;
-}
+  std::vector<int> all_samples;
+  boost::mpi::all_gather(world_, samples.data(), kSamplesPerRank, all_samples);
+  std::ranges::sort(all_samples);
 
-std::vector<int> burykin_m_radix_all::RadixALL::MergeTwoSorted(const std::vector<int>& left,
-                                                               const std::vector<int>& right) {
-  if (left.empty()) {
-    return right;
-  }
-  if (right.empty()) {
-    return left;
+  // Splitter i closes bucket i: rank i receives the elements in (splitters[i - 1], splitters[i]]
+  std::vector<int> splitters(world_.size() - 1);
+  for (size_t i = 0; i < splitters.size(); ++i) {
+    splitters[i] = all_samples[(i + 1) * kSamplesPerRank];
   }
+  return splitters;
+}
 
-  std::vector<int> result;
-  result.reserve(left.size() + right.size());
+void burykin_m_radix_all::RadixALL::ExchangeBuckets(const std::vector<int>& splitters) {
+  const int size = world_.size();
 
-  size_t i = 0;
-  size_t j = 0;
-  while (i < left.size() && j < right.size()) {
-    if (left[i] <= right[j]) {
-      result.push_back(left[i++]);
-    } else {
-      result.push_back(right[j++]);
-    }
+  // The local run is sorted, so bucket i is the range up to the upper bound of splitter i
+  std::vector<int> send_counts(size, 0);
+  std::vector<int> send_displs(size, 0);
+  auto bucket_begin = local_data_.begin();
+  for (int i = 0; i < size; ++i) {
+    const auto bucket_end = i + 1 < size ? std::upper_bound(bucket_begin, local_data_.end(), splitters[i])
+                                         : local_data_.end();
+    send_displs[i] = static_cast<int>(bucket_begin - local_data_.begin());
+    send_counts[i] = static_cast<int>(bucket_end - bucket_begin);
+    bucket_begin = bucket_end;
   }
 
-  while (i < left.size()) {
-    result.push_back(left[i++]);
+  std::vector<int> recv_counts;
+  boost::mpi::all_to_all(world_, send_counts, recv_counts);
+  std::vector<int> recv_displs(size, 0);
+  std::exclusive_scan(recv_counts.begin(), recv_counts.end(), recv_displs.begin(), 0);
+  const auto received_size = static_cast<size_t>(recv_displs.back() + recv_counts.back());
+
+  std::vector<int> received(received_size);
+  MPI_Alltoallv(local_data_.data(), send_counts.data(), send_displs.data(), MPI_INT, received.data(),
+                recv_counts.data(), recv_displs.data(), MPI_INT, world_);
+
+  // The received buckets are sorted runs, one per source rank; threads merge equal slices of the result
+  std::vector<size_t> bounds(size + 1, 0);
+  for (int i = 0; i < size; ++i) {
+    bounds[i + 1] = bounds[i] + recv_counts[i];
   }
-  while (j < right.size()) {
-    result.push_back(right[j++]);
+  const auto runs = ppc::core::MakeRuns<int>(received, bounds);
+  const int parts = omp_get_max_threads();
+  local_data_.resize(received_size);
+
+#pragma omp parallel for
+  for (int part = 0; part < parts; part++) {
+    ppc::core::MultiwayMergePart<int>(runs, local_data_, part, parts);
   }
+}
 
-  return result;
+void burykin_m_radix_all::RadixALL::GatherOutput() {
+  // Ranks hold consecutive ranges of the sorted sequence, so gathering them in rank order is the result
+  const int local_size = static_cast<int>(local_data_.size());
+  std::vector<int> counts;
+  boost::mpi::gather(world_, local_size, counts, 0);
+
+  if (world_.rank() == 0) {
+    std::vector<int> displs(counts.size(), 0);
+    std::exclusive_scan(counts.begin(), counts.end(), displs.begin(), 0);
+    output_.resize(input_.size());
+    boost::mpi::gatherv(world_, local_data_.data(), local_size, output_.data(), counts, displs, 0);
+  } else {
+    boost::mpi::gatherv(world_, local_data_.data(), local_size, 0);
+  }
 }
 
 void burykin_m_radix_all::RadixALL::SplitBySign(const std::vector<int>& arr, std::vector<int>& negatives,
@@ -1,10 +1,6 @@
 #pragma once
 
-#include <omp.h>
-
-#include <algorithm>
 #include <boost/mpi/communicator.hpp>
-#include <cmath>
 #include <compare>
 #include <cstddef>
 #include <utility>
@@ -15,7 +11,6 @@
 namespace ermolaev_v_graham_scan_all {
 
 constexpr size_t kMinInputPoints = 3;
-constexpr size_t kMinStackPoints = 2;
 
 class Point {
  public:
@@ -53,79 +48,6 @@ class TestTaskALL : public ppc::core::Task {
  private:
   std::vector<Point> input_, local_points_, output_;
   boost::mpi::communicator world_;
-
-  static int CrossProduct(const Point& p1, const Point& p2, const Point& p3);
-  size_t IndexOfMinElement();
-  bool CheckGrahamNecessaryConditions();
-  void GrahamScan();
-  bool IsAllCollinear();
-  bool IsAllSame();
-
-  template <typename Iterator, typename Comparator>
-  void ParallelSort(Iterator begin, Iterator end, Comparator comp);
 };
 
-}  // namespace ermolaev_v_graham_scan_all
-
-template <typename Iterator, typename Comparator>
-void ermolaev_v_graham_scan_all::TestTaskALL::ParallelSort(Iterator begin, Iterator end, Comparator comp) {
-  const size_t n = std::distance(begin, end);
-
-  if (n <= 1) {
-    return;
-  }
-
-  const int num_threads = omp_get_max_threads();
-  std::vector<std::vector<typename Iterator::value_type>> sorted_chunks(num_threads);
-
-#pragma omp parallel
-  {
-    const int thread_id = omp_get_thread_num();
-    const size_t chunk_size = std::max(n / num_threads, size_t(1));
-    const size_t start_idx = thread_id * chunk_size;
-    const size_t end_idx = (thread_id == num_threads - 1) ? n : start_idx + chunk_size;
-
-    if (start_idx < n) {
-      std::vector<typename Iterator::value_type> chunk(begin + start_idx, begin + end_idx);
-      std::sort(chunk.begin(), chunk.end(), comp);
-      sorted_chunks[thread_id] = std::move(chunk);
-    }
-  }
-
-  std::vector<size_t> sizes(num_threads, 0);
-  std::transform(sorted_chunks.begin(), sorted_chunks.end(), sizes.begin(),
-                 [](const auto& chunk) { return chunk.size(); });
-
-  const int levels = static_cast<int>(std::ceil(std::log2(num_threads)));
-  std::vector<typename Iterator::value_type> temp;
-  int source = 0;
-
-  for (int level = 0; level < levels; level++) {
-    int step = 1 << level;
-    int h = step << 1;
-
-#pragma omp parallel for schedule(dynamic) private(temp, source)
-    for (int i = 0; i < num_threads; i += h) {
-      source = i + step;
-      if (source < num_threads && sizes[i] > 0 && sizes[source] > 0) {
-        temp.clear();
-        temp.reserve(sizes[i] + sizes[source]);
-
-        std::merge(sorted_chunks[i].begin(), sorted_chunks[i].end(), sorted_chunks[source].begin(),
-                   sorted_chunks[source].end(), std::back_inserter(temp), comp);
-
-        sorted_chunks[i].swap(temp);
-
-        sizes[i] += sizes[source];
-        sizes[source] = 0;
-      }
-    }
-  }
-
-  for (int i = 0; i < num_threads; i++) {
-    if (sizes[i] > 0) {
-      std::copy(sorted_chunks[i].begin(), sorted_chunks[i].end(), begin);
-      return;
-    }
-  }
-}
\ No newline at end of file
+}  // namespace ermolaev_v_graham_scan_all
\ No newline at end of file
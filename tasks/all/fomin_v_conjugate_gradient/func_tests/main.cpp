@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <boost/mpi/communicator.hpp>
 #include <cmath>
 #include <cstddef>
@@ -8,6 +9,7 @@
 #include <vector>
 
 #include "all/fomin_v_conjugate_gradient/include/ops_all.hpp"
+#include "core/solver/include/cg.hpp"
 #include "core/task/include/task.hpp"
 
 TEST(FominVConjugateGradientAll, test_small_system) {
@@ -68,6 +70,51 @@ TEST(FominVConjugateGradientAll, test_large_system) {
   }
 }
 
+TEST(FominVConjugateGradientAll, pipelined_matches_fused) {
+  constexpr int kCount = 50;
+  std::vector<double> input((kCount * kCount) + kCount, 0.0);
+  for (int i = 0; i < kCount; ++i) {
+    input[(i * kCount) + i] = 4.0;
+    if (i > 0) {
+      input[(i * kCount) + (i - 1)] = -1.0;
+    }
+    if (i < kCount - 1) {
+      input[(i * kCount) + (i + 1)] = -1.0;
+    }
+    input[(kCount * kCount) + i] = static_cast<double>(i % 7);
+  }
+
+  std::vector<std::vector<double>> results;
+  for (const bool pipelined : {false, true}) {
+    std::vector<double> out(kCount, 0.0);
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(input.data()));
+    task_data->inputs_count.emplace_back(input.size());
+    task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    task_data->outputs_count.emplace_back(out.size());
+
+    fomin_v_conjugate_gradient::FominVConjugateGradientAll task(task_data);
+    task.pipelined = pipelined;
+    ASSERT_TRUE(task.Validation());
+    task.PreProcessing();
+    task.Run();
+    task.PostProcessing();
+    EXPECT_GT(task.iterations, 0);
+    EXPECT_LT(task.iterations, kCount);
+    EXPECT_GT(task.iterations_per_second, 0.0);
+    results.push_back(out);
+  }
+
+  for (int i = 0; i < kCount; ++i) {
+    double residual = input[(kCount * kCount) + i];
+    for (int j = 0; j < kCount; ++j) {
+      residual -= input[(i * kCount) + j] * results[1][j];
+    }
+    EXPECT_NEAR(residual, 0.0, 1e-6);
+    EXPECT_NEAR(results[1][i], results[0][i], 1e-6);
+  }
+}
+
 TEST(FominVConjugateGradientAll, DotProduct) {
   boost::mpi::communicator world;
   std::vector<double> a = {1.0, 2.0, 3.0};
@@ -149,3 +196,43 @@ TEST(FominVConjugateGradientAll, VectorScalarMultiply) {
 
   EXPECT_EQ(result, expected);
 }
+
+TEST(FominVConjugateGradientAll, csr_input_preconditioned) {
+  // Tridiagonal 5, 1 with 200 rows, solution of ones
+  constexpr size_t kCount = 200;
+  std::vector<uint32_t> row_ptr = {0};
+  std::vector<uint32_t> col_idx;
+  std::vector<double> values;
+  std::vector<double> b(kCount, 0.0);
+  for (size_t i = 0; i < kCount; ++i) {
+    for (size_t j = (i == 0 ? 0 : i - 1); j <= std::min(i + 1, kCount - 1); ++j) {
+      col_idx.push_back(static_cast<uint32_t>(j));
+      values.push_back(i == j ? 5.0 : 1.0);
+      b[i] += values.back();
+    }
+    row_ptr.push_back(static_cast<uint32_t>(values.size()));
+  }
+
+  for (const auto precision : {ppc::core::solver::Precision::kDouble, ppc::core::solver::Precision::kMixed}) {
+    std::vector<double> out(kCount, 0.0);
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->AddInput(row_ptr.data(), row_ptr.size());
+    task_data->AddInput(col_idx.data(), col_idx.size());
+    task_data->AddInput(values.data(), values.size());
+    task_data->AddInput(b.data(), b.size());
+    task_data->AddOutput(out.data(), out.size());
+
+    fomin_v_conjugate_gradient::FominVConjugateGradientAll task(task_data);
+    task.SetSolverOptions(
+        {.preconditioner = ppc::core::solver::Preconditioner::kIncompleteCholesky, .precision = precision});
+    ASSERT_TRUE(task.Validation());
+    task.PreProcessing();
+    task.Run();
+    task.PostProcessing();
+
+    EXPECT_GT(task.iterations, 0);
+    for (size_t i = 0; i < kCount; ++i) {
+      ASSERT_NEAR(out[i], 1.0, 1e-9);
+    }
+  }
+}
@@ -4,10 +4,16 @@
 #include <utility>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
 #include "core/task/include/task.hpp"
 
 namespace fomin_v_conjugate_gradient {
 
+// Rows of A and of every CG vector are split into contiguous blocks over the ranks. An iteration makes one
+// all_gatherv of the vector to multiply and one all_reduce of the two dot products it needs (Chronopoulos-Gear
+// CG). With `pipelined` set the reduction is nonblocking and overlaps the next matrix-vector product
+// (Ghysels-Vanroose CG) at the cost of three more vectors. CSR inputs and options other than the defaults run
+// SolveCg over blocks of rows with about equal numbers of nonzeros instead.
 class FominVConjugateGradientAll : public ppc::core::Task {
  public:
   explicit FominVConjugateGradientAll(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -23,10 +29,18 @@ class FominVConjugateGradientAll : public ppc::core::Task {
   static std::vector<double> VectorSub(const std::vector<double>& a, const std::vector<double>& b);
   static std::vector<double> VectorScalarMultiply(const std::vector<double>& v, double scalar);
   [[nodiscard]] std::vector<double> GetLocalA() const { return local_a_; }
+  // Options other than the defaults (see IsPlainCg) solve a dense A with the sparse solver too; set on
+  // every process
+  void SetSolverOptions(const ppc::core::solver::CgOptions& options) { solver_options_ = options; }
 
   int n;
   int max_iter = 1000;
   double epsilon = 1e-6;
+  bool pipelined = false;
+
+  // Statistics of the last Run
+  int iterations = 0;
+  double iterations_per_second = 0.0;
 
  private:
   std::vector<double> a_;
@@ -36,6 +50,25 @@ class FominVConjugateGradientAll : public ppc::core::Task {
   std::vector<double> local_a_;
   std::vector<double> local_b_;
   int rows_per_proc_;
+  // Rows of every rank, the layout of all_gatherv
+  std::vector<int> row_counts_;
+  std::vector<int> row_displs_;
+  // Whole vector gathered for the local rows of the product
+  std::vector<double> gathered_;
+  // CSR inputs (row_ptr, col_idx, values, b) or solver options other than plain CG
+  bool sparse_ = false;
+  ppc::core::solver::TaskMatrix matrix_;  // Whole matrix, on rank 0
+  ppc::core::solver::CsrMatrix local_sparse_;
+  ppc::core::solver::CgOptions solver_options_;
+
+  // out = local rows of A * x for the full vector x
+  void MultiplyRows(const std::vector<double>& x, std::vector<double>& out) const;
+  // out = local rows of A * v, where v is distributed like the rows
+  void MultiplyDistributed(const std::vector<double>& v, std::vector<double>& out);
+  void RunFused(std::vector<double>& x);
+  void RunPipelined(std::vector<double>& x);
+  void DistributeSparse();
+  bool RunSparse(std::vector<double>& x);
 };
 
 }  // namespace fomin_v_conjugate_gradient
\ No newline at end of file
@@ -1,21 +1,44 @@
 #include "all/fomin_v_conjugate_gradient/include/ops_all.hpp"
 
+#include <mpi.h>
 #include <oneapi/tbb/blocked_range.h>
 #include <oneapi/tbb/parallel_for.h>
 #include <oneapi/tbb/parallel_reduce.h>
 
+#include <array>
 #include <boost/mpi/collectives.hpp>
+#include <boost/mpi/collectives/all_gatherv.hpp>
 #include <boost/mpi/collectives/all_reduce.hpp>
 #include <boost/mpi/collectives/broadcast.hpp>
-#include <boost/mpi/collectives/gatherv.hpp>
 #include <boost/mpi/collectives/scatterv.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <boost/serialization/vector.hpp>  // NOLINT
+#include <chrono>
 #include <cmath>
 #include <cstddef>
 #include <functional>
+#include <span>
+#include <utility>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
+#include "core/solver/include/cg_mpi.hpp"
+#include "core/sparse/include/sparse_tbb.hpp"
+
+namespace {
+
+// Local parts of (r, r) and (r, w), summed over the ranks in one reduction
+std::array<double, 2> LocalDots(const std::vector<double>& r, const std::vector<double>& w) {
+  std::array<double, 2> dots{};
+  for (size_t i = 0; i < r.size(); ++i) {
+    dots[0] += r[i] * r[i];
+    dots[1] += r[i] * w[i];
+  }
+  return dots;
+}
+
+}  // namespace
+
 double fomin_v_conjugate_gradient::FominVConjugateGradientAll::DotProduct(const boost::mpi::communicator& world,
                                                                           const std::vector<double>& a,
                                                                           const std::vector<double>& b) {
@@ -34,36 +57,33 @@ double fomin_v_conjugate_gradient::FominVConjugateGradientAll::DotProduct(const
   return global_sum;
 }
 
-std::vector<double> fomin_v_conjugate_gradient::FominVConjugateGradientAll::MatrixVectorMultiply(
-    const std::vector<double>& x) const {
-  std::vector<double> local_result(rows_per_proc_, 0.0);
-
+void fomin_v_conjugate_gradient::FominVConjugateGradientAll::MultiplyRows(const std::vector<double>& x,
+                                                                        std::vector<double>& out) const {
+  out.resize(rows_per_proc_);
   tbb::parallel_for(tbb::blocked_range<int>(0, rows_per_proc_), [&](const tbb::blocked_range<int>& r) {
     for (int i = r.begin(); i < r.end(); ++i) {
       double sum = 0.0;
       for (int j = 0; j < n; ++j) {
         sum += local_a_[(i * n) + j] * x[j];
       }
-      local_result[i] = sum;
+      out[i] = sum;
     }
   });
+}
 
-  std::vector<double> global_result;
-  if (world_.rank() == 0) {
-    global_result.resize(n);
-  }
+void fomin_v_conjugate_gradient::FominVConjugateGradientAll::MultiplyDistributed(const std::vector<double>& v,
+                                                                               std::vector<double>& out) {
+  boost::mpi::all_gatherv(world_, v.data(), gathered_.data(), row_counts_, row_displs_);
+  MultiplyRows(gathered_, out);
+}
 
-  std::vector<int> sizes(world_.size());
-  std::vector<int> displs(world_.size(), 0);
-  int remainder = n % world_.size();
-  for (int i = 0; i < world_.size(); ++i) {
-    sizes[i] = (n / world_.size()) + (i < remainder ? 1 : 0);
-    if (i > 0) {
-      displs[i] = displs[i - 1] + sizes[i - 1];
-    }
-  }
-  gatherv(world_, local_result.data(), rows_per_proc_, global_result.data(), sizes, displs, 0);
-  broadcast(world_, global_result, 0);
+std::vector<double> fomin_v_conjugate_gradient::FominVConjugateGradientAll::MatrixVectorMultiply(
+    const std::vector<double>& x) const {
+  std::vector<double> local_result;
+  MultiplyRows(x, local_result);
+
+  std::vector<double> global_result(n);
+  boost::mpi::all_gatherv(world_, local_result.data(), global_result.data(), row_counts_, row_displs_);
   return global_result;
 }
 
@@ -95,7 +115,11 @@ std::vector<double> fomin_v_conjugate_gradient::FominVConjugateGradientAll::Vect
 }
 
 bool fomin_v_conjugate_gradient::FominVConjugateGradientAll::PreProcessingImpl() {
-  if (world_.rank() == 0) {
+  sparse_ = false;
+  if (world_.rank() == 0 && ppc::core::solver::HasCsrInputs(*task_data)) {
+    b_.assign(matrix_.Rhs().begin(), matrix_.Rhs().end());
+    sparse_ = true;
+  } else if (world_.rank() == 0) {
     unsigned input_size = task_data->inputs_count[0];
     auto* in_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
     std::vector<double> input(in_ptr, in_ptr + input_size);
@@ -103,10 +127,18 @@ bool fomin_v_conjugate_gradient::FominVConjugateGradientAll::PreProcessingImpl()
     n = static_cast<int>((-1.0 + std::sqrt(1 + (4 * input_size))) / 2);
     a_ = std::vector<double>(input.begin(), input.begin() + (n * n));
     b_ = std::vector<double>(input.begin() + (n * n), input.end());
+    if (!ppc::core::solver::IsPlainCg(solver_options_)) {
+      matrix_.LoadDense(a_, n);
+      sparse_ = true;
+    }
   }
 
+  broadcast(world_, sparse_, 0);
+  if (sparse_) {
+    DistributeSparse();
+    return true;
+  }
   broadcast(world_, n, 0);
-  broadcast(world_, b_, 0);
 
   int remainder = n % world_.size();
   rows_per_proc_ = n / world_.size();
@@ -130,6 +162,9 @@ bool fomin_v_conjugate_gradient::FominVConjugateGradientAll::PreProcessingImpl()
     }
   }
 
+  row_counts_ = counts_b;
+  row_displs_ = displs_b;
+  gathered_.assign(n, 0.0);
   local_a_.resize(rows_per_proc_ * n);
   local_b_.resize(rows_per_proc_);
 
@@ -144,7 +179,21 @@ bool fomin_v_conjugate_gradient::FominVConjugateGradientAll::PreProcessingImpl()
   return true;
 }
 
+void fomin_v_conjugate_gradient::FominVConjugateGradientAll::DistributeSparse() {
+  auto block = ppc::core::solver::ScatterRows(world_, matrix_.View());
+  n = static_cast<int>(block.matrix.cols);
+  rows_per_proc_ = static_cast<int>(block.matrix.rows);
+  local_sparse_ = std::move(block.matrix);
+  const ppc::core::solver::MpiRowComm comm(world_, std::move(block.row_counts));
+  row_counts_ = comm.RowCounts();
+  row_displs_ = comm.RowDispls();
+  local_b_ = ppc::core::solver::ScatterRows(world_, b_, comm);
+}
+
 bool fomin_v_conjugate_gradient::FominVConjugateGradientAll::ValidationImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    return matrix_.LoadCsrSystem(*task_data);
+  }
   unsigned int input_size = task_data->inputs_count[0];
   const int calculated_n = static_cast<int>((-1.0 + std::sqrt(1 + (4 * input_size))) / 2);
   return (static_cast<unsigned int>(calculated_n * (calculated_n + 1)) == input_size) &&
@@ -152,37 +201,115 @@ bool fomin_v_conjugate_gradient::FominVConjugateGradientAll::ValidationImpl() {
 }
 
 bool fomin_v_conjugate_gradient::FominVConjugateGradientAll::RunImpl() {
-  std::vector<double> x(n, 0.0);
-  std::vector<double> r = b_;
-  std::vector<double> p = r;
+  std::vector<double> x(rows_per_proc_, 0.0);
 
-  double rs_old = DotProduct(world_, r, r);
+  iterations = 0;
+  bool converged = true;
+  const auto start = std::chrono::steady_clock::now();
+  if (sparse_) {
+    converged = RunSparse(x);
+  } else if (pipelined) {
+    RunPipelined(x);
+  } else {
+    RunFused(x);
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  iterations_per_second = elapsed.count() > 0.0 ? iterations / elapsed.count() : 0.0;
 
-  for (int iter = 0; iter < max_iter; ++iter) {
-    std::vector<double> ap = MatrixVectorMultiply(p);
-    double p_ap = DotProduct(world_, p, ap);
+  output_.resize(n);
+  boost::mpi::all_gatherv(world_, x.data(), output_.data(), row_counts_, row_displs_);
+
+  return converged;
+}
+
+void fomin_v_conjugate_gradient::FominVConjugateGradientAll::RunFused(std::vector<double>& x) {
+  std::vector<double> r = local_b_;
+  std::vector<double> w;
+  MultiplyDistributed(r, w);
+  std::vector<double> p(rows_per_proc_, 0.0);
+  std::vector<double> s(rows_per_proc_, 0.0);
 
-    broadcast(world_, p_ap, 0);
+  // s = A p is kept by recurrence, so an iteration multiplies by A once: w = A r
+  double gamma_old = 0.0;
+  double alpha = 0.0;
+  for (int iter = 0; iter < max_iter; ++iter) {
+    std::array<double, 2> dots{};
+    const auto local_dots = LocalDots(r, w);
+    boost::mpi::all_reduce(world_, local_dots.data(), 2, dots.data(), std::plus<>());
+    if (std::sqrt(dots[0]) < epsilon) {
+      break;
+    }
+    const double beta = iter == 0 ? 0.0 : dots[0] / gamma_old;
+    const double p_ap = iter == 0 ? dots[1] : dots[1] - (beta * dots[0] / alpha);
     if (std::abs(p_ap) < 1e-12) {
       break;
     }
-    double alpha = rs_old / p_ap;
-    x = VectorAdd(x, VectorScalarMultiply(p, alpha));
-    r = VectorSub(r, VectorScalarMultiply(ap, alpha));
+    alpha = dots[0] / p_ap;
 
-    double rs_new = DotProduct(world_, r, r);
-    broadcast(world_, rs_new, 0);
-    if (std::sqrt(rs_new) < epsilon) {
-      break;
+    for (int i = 0; i < rows_per_proc_; ++i) {
+      p[i] = r[i] + (beta * p[i]);
+      s[i] = w[i] + (beta * s[i]);
+      x[i] += alpha * p[i];
+      r[i] -= alpha * s[i];
     }
-    double beta = rs_new / rs_old;
-    p = VectorAdd(r, VectorScalarMultiply(p, beta));
-    rs_old = rs_new;
+    MultiplyDistributed(r, w);
+    gamma_old = dots[0];
+    ++iterations;
   }
+}
 
-  output_ = x;
+void fomin_v_conjugate_gradient::FominVConjugateGradientAll::RunPipelined(std::vector<double>& x) {
+  std::vector<double> r = local_b_;
+  std::vector<double> w;
+  MultiplyDistributed(r, w);
+  std::vector<double> q;
+  std::vector<double> p(rows_per_proc_, 0.0);
+  std::vector<double> s(rows_per_proc_, 0.0);
+  std::vector<double> z(rows_per_proc_, 0.0);
 
-  return true;
+  // Recurrences keep w = A r, s = A p and z = A s, so q = A w is the only product and does not depend on
+  // the dot products being reduced
+  double gamma_old = 0.0;
+  double alpha = 0.0;
+  for (int iter = 0; iter < max_iter; ++iter) {
+    std::array<double, 2> dots{};
+    const auto local_dots = LocalDots(r, w);
+    MPI_Request request = MPI_REQUEST_NULL;
+    MPI_Iallreduce(local_dots.data(), dots.data(), 2, MPI_DOUBLE, MPI_SUM, world_, &request);
+    MultiplyDistributed(w, q);
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+    if (std::sqrt(dots[0]) < epsilon) {
+      break;
+    }
+    const double beta = iter == 0 ? 0.0 : dots[0] / gamma_old;
+    const double p_ap = iter == 0 ? dots[1] : dots[1] - (beta * dots[0] / alpha);
+    if (std::abs(p_ap) < 1e-12) {
+      break;
+    }
+    alpha = dots[0] / p_ap;
+
+    for (int i = 0; i < rows_per_proc_; ++i) {
+      z[i] = q[i] + (beta * z[i]);
+      s[i] = w[i] + (beta * s[i]);
+      p[i] = r[i] + (beta * p[i]);
+      x[i] += alpha * p[i];
+      r[i] -= alpha * s[i];
+      w[i] -= alpha * z[i];
+    }
+    gamma_old = dots[0];
+    ++iterations;
+  }
+}
+
+bool fomin_v_conjugate_gradient::FominVConjugateGradientAll::RunSparse(std::vector<double>& x) {
+  // SolveCg runs the recurrences of RunFused, one all_gatherv and one all_reduce per iteration. The
+  // preconditioners are block Jacobi across processes, the blocks being the local rows
+  const ppc::core::solver::MpiRowComm comm(world_, row_counts_);
+  const auto result = ppc::core::solver::SolveCg(ppc::core::solver::View(local_sparse_), local_b_, x, solver_options_,
+                                                 ppc::core::sparse::TbbBackend{}, comm);
+  iterations = static_cast<int>(result.iterations);
+  return result.converged;
 }
 
 bool fomin_v_conjugate_gradient::FominVConjugateGradientAll::PostProcessingImpl() {
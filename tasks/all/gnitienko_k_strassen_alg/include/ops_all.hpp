@@ -22,7 +22,7 @@ class StrassenAlgAll : public ppc::core::Task {
   std::vector<double> input_2_;
   std::vector<double> output_;
   int size_{};
-  int TRIVIAL_MULTIPLICATION_BOUND_ = 32;
+  int TRIVIAL_MULTIPLICATION_BOUND_ = 128;
   int extend_ = 0;
   boost::mpi::communicator world_;
 
@@ -8,10 +8,11 @@
 #include <boost/mpi/nonblocking.hpp>
 #include <boost/mpi/request.hpp>
 #include <cmath>
+#include <core/gemm/include/gemm.hpp>
+#include <core/pool/include/thread_pool.hpp>
 #include <core/util/include/util.hpp>
 #include <cstddef>
 #include <functional>
-#include <thread>
 #include <utility>
 #include <vector>
 
@@ -75,14 +76,9 @@ void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::SubMatrix(const std::ve
 void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::TrivialMultiply(const std::vector<double>& a,
                                                                          const std::vector<double>& b,
                                                                          std::vector<double>& c, int size) {
-  for (int i = 0; i < size; ++i) {
-    for (int j = 0; j < size; ++j) {
-      c[(i * size) + j] = 0;
-      for (int k = 0; k < size; ++k) {
-        c[(i * size) + j] += a[(i * size) + k] * b[(k * size) + j];
-      }
-    }
-  }
+  const auto n = static_cast<size_t>(size);
+  std::fill_n(c.begin(), n * n, 0.0);
+  ppc::core::Gemm(n, n, n, a.data(), n, b.data(), n, c.data(), n);
 }
 
 void gnitienko_k_strassen_algorithm_all::ParallelizeTasks(const std::vector<std::function<void(int)>>& tasks,
@@ -91,25 +87,18 @@ void gnitienko_k_strassen_algorithm_all::ParallelizeTasks(const std::vector<std:
   int current_threads = std::min(avaliable_threads, total_tasks);
   int remaining_threads = std::max(avaliable_threads - current_threads, 0);
 
-  std::vector<std::thread> threads;
-  std::vector<int> threads_for_subtask(total_tasks, 0);
-
-  for (int i = 0; i < total_tasks; ++i) {
-    threads_for_subtask[i] = (i < remaining_threads) ? 1 : 0;
-  }
-
+  // Subtasks are run by the shared pool, so recursive calls do not spawn new threads
+  ppc::core::TaskGroup group;
   for (int i = 0; i < current_threads; ++i) {
-    int sub_threads = threads_for_subtask[i];
-    threads.emplace_back([&, i, sub_threads]() { tasks[i](sub_threads); });
+    int sub_threads = (i < remaining_threads) ? 1 : 0;
+    group.Run([&tasks, i, sub_threads]() { tasks[i](sub_threads); });
   }
 
   for (int i = current_threads; i < total_tasks; ++i) {
     tasks[i](0);
   }
 
-  for (auto& t : threads) {
-    t.join();
-  }
+  group.Wait();
 }
 
 void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::StrassenMultiply(const std::vector<double>& a,
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "all/karaseva_e_congrad/include/ops_mpi.hpp"
+#include "core/solver/include/cg.hpp"
 #include "core/task/include/task.hpp"
 
 namespace {
@@ -46,6 +47,27 @@ std::vector<double> MultiplyMatrixVector(const std::vector<double>& a_matrix, co
   return result;
 }
 
+// 1D Laplacian with a varying diagonal in CSR form
+ppc::core::solver::CsrMatrix GenerateTridiagonal(size_t n) {
+  ppc::core::solver::CsrMatrix a;
+  a.rows = n;
+  a.cols = n;
+  for (size_t i = 0; i < n; ++i) {
+    if (i > 0) {
+      a.col_idx.push_back(static_cast<uint32_t>(i - 1));
+      a.values.push_back(-1.0);
+    }
+    a.col_idx.push_back(static_cast<uint32_t>(i));
+    a.values.push_back(2.5 + (0.1 * static_cast<double>(i % 7)));
+    if (i + 1 < n) {
+      a.col_idx.push_back(static_cast<uint32_t>(i + 1));
+      a.values.push_back(-1.0);
+    }
+    a.row_ptr.push_back(static_cast<uint32_t>(a.values.size()));
+  }
+  return a;
+}
+
 }  // namespace
 
 TEST(karaseva_e_congrad_mpi, test_small_matrix_2x2) {
@@ -262,4 +284,40 @@ TEST(karaseva_e_congrad_mpi, single_iteration_convergence) {
   for (size_t i = 0; i < kSize; ++i) {
     EXPECT_NEAR(solution[i], x_expected[i], kTolerance);
   }
-}
\ No newline at end of file
+}
+TEST(karaseva_e_congrad_mpi, csr_input_with_preconditioners) {
+  constexpr size_t kN = 500;
+  auto a = GenerateTridiagonal(kN);
+  std::vector<double> x_expected(kN);
+  for (size_t i = 0; i < kN; ++i) {
+    x_expected[i] = static_cast<double>(i % 11) - 5.0;
+  }
+  std::vector<double> b(kN, 0.0);
+  for (size_t i = 0; i < kN; ++i) {
+    for (size_t e = a.row_ptr[i]; e < a.row_ptr[i + 1]; ++e) {
+      b[i] += a.values[e] * x_expected[a.col_idx[e]];
+    }
+  }
+
+  for (const auto preconditioner : {ppc::core::solver::Preconditioner::kJacobi,
+                                    ppc::core::solver::Preconditioner::kIncompleteCholesky}) {
+    std::vector<double> x(kN, 0.0);
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->AddInput(a.row_ptr.data(), a.row_ptr.size());
+    task_data->AddInput(a.col_idx.data(), a.col_idx.size());
+    task_data->AddInput(a.values.data(), a.values.size());
+    task_data->AddInput(b.data(), b.size());
+    task_data->AddOutput(x.data(), x.size());
+
+    karaseva_e_congrad_mpi::TestTaskMPI task(task_data);
+    task.SetSolverOptions({.preconditioner = preconditioner, .precision = ppc::core::solver::Precision::kMixed});
+    ASSERT_TRUE(task.Validation());
+    task.PreProcessing();
+    task.Run();
+    task.PostProcessing();
+
+    for (size_t i = 0; i < kN; ++i) {
+      ASSERT_NEAR(x[i], x_expected[i], 1e-8);
+    }
+  }
+}
@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
 #include "core/task/include/task.hpp"
 
 namespace karaseva_e_congrad_mpi {
@@ -18,13 +19,28 @@ class TestTaskMPI : public ppc::core::Task {
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
+  // Options other than the defaults (see IsPlainCg) solve a dense A with the sparse solver too; set on
+  // every process
+  void SetSolverOptions(const ppc::core::solver::CgOptions& options) { solver_options_ = options; }
+
  private:
+  // Scatters blocks of rows with about equal numbers of nonzeros and the matching rows of b
+  void DistributeSparse();
+
   std::vector<double> a_local_;  // Local part of matrix
   std::vector<double> b_;        // Full RHS vector
   std::vector<double> x_;        // Solution vector
   uint64_t global_size_{};       // Global system size
   int rank_ = 0;                 // Process rank
   int world_size_ = 1;           // Total processes
+
+  // CSR inputs (row_ptr, col_idx, values, b) or solver options other than plain CG
+  bool sparse_ = false;
+  ppc::core::solver::TaskMatrix matrix_;  // Whole matrix, on rank 0
+  ppc::core::solver::CsrMatrix a_sparse_;  // Local rows
+  std::vector<int> row_counts_;
+  std::vector<double> b_local_;
+  ppc::core::solver::CgOptions solver_options_;
 };
 
 }  // namespace karaseva_e_congrad_mpi
\ No newline at end of file
@@ -3,17 +3,35 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <boost/mpi/communicator.hpp>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <utility>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
+#include "core/solver/include/cg_mpi.hpp"
+#include "core/sparse/include/sparse_omp.hpp"
+
 using namespace karaseva_e_congrad_mpi;
 
 bool TestTaskMPI::PreProcessingImpl() {
   MPI_Comm_rank(MPI_COMM_WORLD, &rank_);
   MPI_Comm_size(MPI_COMM_WORLD, &world_size_);
 
+  int sparse = 0;
+  if (rank_ == 0) {
+    sparse = ppc::core::solver::HasCsrInputs(*task_data) || !ppc::core::solver::IsPlainCg(solver_options_) ? 1 : 0;
+  }
+  MPI_Bcast(&sparse, 1, MPI_INT, 0, MPI_COMM_WORLD);
+  sparse_ = sparse != 0;
+  if (sparse_) {
+    DistributeSparse();
+    return true;
+  }
+
   if (rank_ == 0) {
     global_size_ = static_cast<uint64_t>(task_data->inputs_count[1]);
   }
@@ -62,12 +80,37 @@ bool TestTaskMPI::PreProcessingImpl() {
   return true;
 }
 
+void TestTaskMPI::DistributeSparse() {
+  boost::mpi::communicator world;
+  if (rank_ == 0) {
+    if (ppc::core::solver::HasCsrInputs(*task_data)) {
+      b_.assign(matrix_.Rhs().begin(), matrix_.Rhs().end());
+    } else {
+      auto* a_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
+      matrix_.LoadDense(std::span<const double>(a_ptr, global_size_ * global_size_), global_size_);
+      auto* b_ptr = reinterpret_cast<double*>(task_data->inputs[1]);
+      b_.assign(b_ptr, b_ptr + global_size_);
+    }
+  }
+
+  auto block = ppc::core::solver::ScatterRows(world, matrix_.View());
+  global_size_ = block.matrix.cols;
+  a_sparse_ = std::move(block.matrix);
+  row_counts_ = std::move(block.row_counts);
+  const ppc::core::solver::MpiRowComm comm(world, row_counts_);
+  b_local_ = ppc::core::solver::ScatterRows(world, b_, comm);
+  x_.assign(global_size_, 0.0);
+}
+
 bool TestTaskMPI::ValidationImpl() {
   MPI_Comm_rank(MPI_COMM_WORLD, &rank_);
   MPI_Comm_size(MPI_COMM_WORLD, &world_size_);
 
   bool validation_result = true;
-  if (rank_ == 0) {
+  if (rank_ == 0 && ppc::core::solver::HasCsrInputs(*task_data)) {
+    validation_result = matrix_.LoadCsrSystem(*task_data) && matrix_.View().rows > 0;
+    global_size_ = matrix_.View().rows;
+  } else if (rank_ == 0) {
     global_size_ = static_cast<uint64_t>(task_data->inputs_count[1]);
     validation_result =
         (task_data->inputs_count[0] == global_size_ * global_size_) && (task_data->outputs_count[0] == global_size_);
@@ -141,6 +184,16 @@ void MatrixVectorMultiply(const std::vector<double>& a_local, std::vector<double
 }  // namespace
 
 bool TestTaskMPI::RunImpl() {
+  if (sparse_) {
+    // Block Jacobi across processes for the preconditioners, the blocks being the local rows
+    boost::mpi::communicator world;
+    const ppc::core::solver::MpiRowComm comm(world, row_counts_);
+    std::vector<double> x_local(a_sparse_.rows, 0.0);
+    const auto result = ppc::core::solver::SolveCg(ppc::core::solver::View(a_sparse_), b_local_, x_local,
+                                                   solver_options_, ppc::core::sparse::OmpBackend{}, comm);
+    ppc::core::solver::GatherRows(world, x_local, x_, comm);
+    return result.converged;
+  }
   std::vector<double> r(global_size_);
   std::vector<double> p(global_size_);
   std::vector<double> ap(global_size_);
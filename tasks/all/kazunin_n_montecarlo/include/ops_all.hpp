@@ -15,9 +15,9 @@
 #include <cstddef>
 #include <functional>
 #include <numeric>
-#include <random>
 #include <utility>
 
+#include "core/random/include/philox.hpp"
 #include "core/task/include/task.hpp"
 #include "core/util/include/util.hpp"
 
@@ -47,26 +47,22 @@ class MonteCarloAll : public ppc::core::Task {
   bool RunImpl() override {
     boost::mpi::broadcast(world_, precision_, 0);
     boost::mpi::broadcast(world_, limits_, 0);
-    std::ranges::generate(generators_, [&, i = 0]() mutable { return MakeGenerator(limits_[i++]); });
 
     const auto numproc = static_cast<std::size_t>(world_.size());
+    const auto rank = static_cast<std::size_t>(world_.rank());
     const auto delta = precision_ / numproc;
     const auto offset = precision_ % numproc;
 
-    const auto iters = delta + static_cast<std::size_t>(static_cast<std::size_t>(world_.rank()) < offset);
+    // The ranks take consecutive sample ranges, so the samples do not depend on the number of processes
+    const auto first = (rank * delta) + std::min(rank, offset);
+    const auto last = first + delta + static_cast<std::size_t>(rank < offset);
 
     oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
     double proc_sum = arena.execute([&] {
       return oneapi::tbb::parallel_reduce(
-          oneapi::tbb::blocked_range<std::size_t>(0, iters, iters / arena.max_concurrency()), 0.0,
+          oneapi::tbb::blocked_range<std::size_t>(first, last, 1024), 0.0,
           [&](const tbb::blocked_range<std::size_t>& range, double sum) {
-            std::array<double, N> random_args;
-            const auto generators = generators_;
-            for (std::size_t iter = range.begin(); iter < range.end(); ++iter) {
-              std::ranges::generate(random_args, [&generators, j = 0]() mutable { return generators[j++](); });
-              sum += f_(random_args);
-            }
-            return sum;
+            return sum + SampleSum(range.begin(), range.end());
           },
           std::plus<>());
     });
@@ -85,18 +81,24 @@ class MonteCarloAll : public ppc::core::Task {
   }
 
  private:
-  std::function<double()> MakeGenerator(const std::pair<double, double>& interval) {
-    std::uniform_real_distribution<double> distrib(interval.first, interval.second);
-    std::mt19937 engine(seedgen_());
-    return [distrib, engine]() mutable { return distrib(engine); };
+  // Sum of f_ over samples [first, last) of one fixed sequence: every chunk jumps to its own samples
+  double SampleSum(std::size_t first, std::size_t last) const {
+    auto gen = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, N);
+    std::array<double, N> random_args;
+    double sum = 0.0;
+    for (std::size_t iter = first; iter < last; ++iter) {
+      for (std::size_t j = 0; j < N; ++j) {
+        random_args[j] = gen.Uniform(limits_[j].first, limits_[j].second);
+      }
+      sum += f_(random_args);
+    }
+    return sum;
   }
 
   F f_;
   std::size_t precision_;
   double total_space_;
   std::array<std::pair<double, double>, N> limits_;
-  std::array<std::function<double()>, N> generators_;
-  std::random_device seedgen_;
   double result_;
   boost::mpi::communicator world_;
 };
@@ -118,22 +120,13 @@ class MonteCarloSeq : public ppc::core::Task {
   bool PreProcessingImpl() override {
     precision_ = *reinterpret_cast<std::size_t*>(task_data->inputs[0]);
     limits_ = *reinterpret_cast<decltype(limits_)*>(task_data->inputs[1]);
-    std::ranges::generate(generators_, [&, i = 0]() mutable { return MakeGenerator(limits_[i++]); });
     total_space_ = std::accumulate(
         limits_.begin(), limits_.end(), 1.0,
         [](const double acc, const std::pair<double, double>& limit) { return acc * (limit.second - limit.first); });
     return true;
   }
   bool RunImpl() override {
-    double sum = 0.0;
-
-    std::array<double, N> random_args;
-    for (std::size_t iter = 0; iter < precision_; ++iter) {
-      std::ranges::generate(random_args, [this, j = 0]() mutable { return generators_[j++](); });
-      sum += f_(random_args);
-    }
-
-    result_ = (total_space_ * sum) / precision_;
+    result_ = (total_space_ * SampleSum(0, precision_)) / precision_;
     return true;
   }
   bool PostProcessingImpl() override {
@@ -142,18 +135,24 @@ class MonteCarloSeq : public ppc::core::Task {
   }
 
  private:
-  std::function<double()> MakeGenerator(const std::pair<double, double>& interval) {
-    std::uniform_real_distribution<double> distrib(interval.first, interval.second);
-    std::mt19937 engine(seedgen_());
-    return [distrib, engine]() mutable { return distrib(engine); };
+  // Sum of f_ over samples [first, last) of one fixed sequence: every chunk jumps to its own samples
+  double SampleSum(std::size_t first, std::size_t last) const {
+    auto gen = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, N);
+    std::array<double, N> random_args;
+    double sum = 0.0;
+    for (std::size_t iter = first; iter < last; ++iter) {
+      for (std::size_t j = 0; j < N; ++j) {
+        random_args[j] = gen.Uniform(limits_[j].first, limits_[j].second);
+      }
+      sum += f_(random_args);
+    }
+    return sum;
   }
 
   F f_;
   std::size_t precision_;
   double total_space_;
   std::array<std::pair<double, double>, N> limits_;
-  std::array<std::function<double()>, N> generators_;
-  std::random_device seedgen_;
   double result_;
 };
 
@@ -5,14 +5,14 @@
 #include <algorithm>
 #include <cmath>
 #include <complex>
-#include <core/util/include/util.hpp>
 #include <cstddef>
 #include <iostream>
-#include <map>
-#include <thread>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
+
 void kolodkin_g_multiplication_matrix_all::SparseMatrixCRS::AddValue(int row, Complex value, int col) {
   for (int j = rowPtr[row]; j < rowPtr[row + 1]; ++j) {
     if (colIndices[j] == col) {
@@ -40,10 +40,6 @@ bool kolodkin_g_multiplication_matrix_all::AreEqualElems(const Complex& a, const
   return std::abs(a.real() - b.real()) < epsilon && std::abs(a.imag() - b.imag()) < epsilon;
 }
 
-void kolodkin_g_multiplication_matrix_all::AddResult(std::vector<CoordVal>& results, int row, int col, Complex val) {
-  results.push_back({row, col, val});
-}
-
 std::vector<Complex> kolodkin_g_multiplication_matrix_all::ParseMatrixIntoVec(const SparseMatrixCRS& mat) {
   std::vector<Complex> res = {};
   res.reserve(5 + mat.values.size() + mat.colIndices.size() + mat.rowPtr.size());
@@ -115,41 +111,6 @@ kolodkin_g_multiplication_matrix_all::SparseMatrixCRS kolodkin_g_multiplication_
   return res;
 }
 
-kolodkin_g_multiplication_matrix_all::SparseMatrixCRS kolodkin_g_multiplication_matrix_all::BuildResultMatrix(
-    const std::vector<kolodkin_g_multiplication_matrix_all::CoordVal>& all_results, int a_num_rows, int b_num_cols) {
-  kolodkin_g_multiplication_matrix_all::SparseMatrixCRS c(a_num_rows, b_num_cols);
-  std::map<std::pair<int, int>, Complex> result_map;
-
-  for (const auto& rv : all_results) {
-    result_map[{rv.row, rv.col}] += rv.value;
-  }
-
-  c.rowPtr.resize(a_num_rows + 1);
-  c.values.reserve(result_map.size());
-  c.colIndices.reserve(result_map.size());
-
-  c.rowPtr[0] = 0;
-
-  for (int i = 0; i < a_num_rows; ++i) {
-    for (auto& kv : result_map) {
-      if (kv.first.first == i && kv.second != Complex(0)) {
-        c.colIndices.push_back(kv.first.second);
-        c.values.push_back(kv.second);
-      }
-    }
-    c.rowPtr[i + 1] = static_cast<int>(c.colIndices.size());
-
-    for (auto it = result_map.begin(); it != result_map.end();) {
-      if (it->first.first == i) {
-        it = result_map.erase(it);
-      } else {
-        ++it;
-      }
-    }
-  }
-  return c;
-}
-
 bool kolodkin_g_multiplication_matrix_all::TestTaskALL::PreProcessingImpl() {
   // Init value for input and output
   unsigned int input_size = task_data->inputs_count[0];
@@ -183,102 +144,67 @@ bool kolodkin_g_multiplication_matrix_all::TestTaskALL::ValidationImpl() {
 }
 
 bool kolodkin_g_multiplication_matrix_all::TestTaskALL::RunImpl() {
-  int rank = 0;
-  int size = 0;
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-  MPI_Comm_size(MPI_COMM_WORLD, &size);
-  int a_num_rows = A_.numRows;
-  int a_num_cols = A_.numCols;
-  int b_num_rows = B_.numRows;
-  int b_num_cols = B_.numCols;
-
-  MPI_Bcast(&a_num_rows, 1, MPI_INT, 0, MPI_COMM_WORLD);
-  MPI_Bcast(&a_num_cols, 1, MPI_INT, 0, MPI_COMM_WORLD);
-  MPI_Bcast(&b_num_rows, 1, MPI_INT, 0, MPI_COMM_WORLD);
-  MPI_Bcast(&b_num_cols, 1, MPI_INT, 0, MPI_COMM_WORLD);
-
-  int row_per_proc = a_num_rows / size;
-  int remainder = a_num_rows % size;
-
-  int start_row = (rank * row_per_proc) + std::min(rank, remainder);
-  int end_row = start_row + row_per_proc + (rank < remainder ? 1 : 0);
-
-  std::vector<CoordVal> local_results;
-
-  int num_threads = ppc::util::GetPPCNumThreads();
-
-  std::vector<std::thread> threads(num_threads);
-  std::vector<std::vector<CoordVal>> thread_results(num_threads);
-  int chunk_size = (end_row - start_row) / num_threads;
-  int current_start = start_row;
-
-  auto process_part = [&](int start_i, int end_i, int thread_index) {
-    std::vector<CoordVal>& local_thread_results = thread_results[thread_index];
-    for (int i = start_i; i < end_i; ++i) {
-      for (int j_idx = A_.rowPtr[i]; j_idx < A_.rowPtr[i + 1]; ++j_idx) {
-        int col_a = A_.colIndices[j_idx];
-        Complex value_a = A_.values[j_idx];
-
-        for (int k_idx = B_.rowPtr[col_a]; k_idx < B_.rowPtr[col_a + 1]; ++k_idx) {
-          int col_b = B_.colIndices[k_idx];
-          Complex value_b = B_.values[k_idx];
-
-          AddResult(local_thread_results, i, col_b, value_a * value_b);
-        }
+  const int rank = world_.rank();
+  const int size = world_.size();
+  const int row_per_proc = A_.numRows / size;
+  const int remainder = A_.numRows % size;
+  const int start_row = (rank * row_per_proc) + std::min(rank, remainder);
+  const int end_row = start_row + row_per_proc + (rank < remainder ? 1 : 0);
+
+  // Rows of A owned by this process, with offsets counted from its first row
+  const int first = A_.rowPtr[start_row];
+  const auto local_nnz_a = static_cast<size_t>(A_.rowPtr[end_row] - first);
+  std::vector<int> local_row_ptr(A_.rowPtr.begin() + start_row, A_.rowPtr.begin() + end_row + 1);
+  for (auto& offset : local_row_ptr) {
+    offset -= first;
+  }
+  const auto local_cols = std::span<const int>(A_.colIndices).subspan(first, local_nnz_a);
+  const auto local_values = std::span<const Complex>(A_.values).subspan(first, local_nnz_a);
+  using View = ppc::core::sparse::CsrView<Complex, int>;
+  const View a{.rows = static_cast<size_t>(end_row - start_row), .cols = static_cast<size_t>(A_.numCols),
+               .row_ptr = local_row_ptr, .col_idx = local_cols, .values = local_values};
+  const View b{.rows = static_cast<size_t>(B_.numRows), .cols = static_cast<size_t>(B_.numCols),
+               .row_ptr = B_.rowPtr, .col_idx = B_.colIndices, .values = B_.values};
+  // Sums which cancel out to zero are not stored
+  const auto local = ppc::core::sparse::SpGemm(a, b, ppc::core::sparse::StlBackend{}, {.drop_zeros = true});
+
+  const int local_rows = end_row - start_row;
+  const auto local_nnz = static_cast<int>(local.NonZeros());
+  std::vector<int> row_lengths(local_rows);
+  for (int i = 0; i < local_rows; ++i) {
+    row_lengths[i] = local.row_ptr[i + 1] - local.row_ptr[i];
+  }
+
+  std::vector<int> rows_count(size);
+  std::vector<int> rows_displs(size);
+  std::vector<int> nnz_count(size);
+  std::vector<int> nnz_displs(size);
+  MPI_Gather(&local_nnz, 1, MPI_INT, nnz_count.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
+  SparseMatrixCRS c(A_.numRows, B_.numCols);
+  if (rank == 0) {
+    for (int proc = 0; proc < size; ++proc) {
+      rows_count[proc] = row_per_proc + (proc < remainder ? 1 : 0);
+      if (proc > 0) {
+        rows_displs[proc] = rows_displs[proc - 1] + rows_count[proc - 1];
+        nnz_displs[proc] = nnz_displs[proc - 1] + nnz_count[proc - 1];
       }
     }
-  };
-
-  for (int t = 0; t < num_threads; ++t) {
-    int thread_start = current_start + (chunk_size * t);
-    int thread_end = (t == num_threads - 1) ? end_row : thread_start + chunk_size;
-    threads[t] = std::thread(process_part, thread_start, thread_end, t);
-  }
-  for (auto& th : threads) {
-    th.join();
-  }
-  for (const auto& vec : thread_results) {
-    local_results.insert(local_results.end(), vec.begin(), vec.end());
+    c.colIndices.resize(nnz_displs[size - 1] + nnz_count[size - 1]);
+    c.values.resize(c.colIndices.size());
   }
-
-  int local_size_bytes = static_cast<int>(local_results.size() * sizeof(CoordVal));
-
-  std::vector<int> recv_counts(size);
-  MPI_Gather(&local_size_bytes, 1, MPI_INT, recv_counts.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
+  MPI_Gatherv(row_lengths.data(), local_rows, MPI_INT, c.rowPtr.data() + 1, rows_count.data(), rows_displs.data(),
+              MPI_INT, 0, MPI_COMM_WORLD);
+  MPI_Gatherv(local.col_idx.data(), local_nnz, MPI_INT, c.colIndices.data(), nnz_count.data(), nnz_displs.data(),
+              MPI_INT, 0, MPI_COMM_WORLD);
+  MPI_Gatherv(local.values.data(), local_nnz, MPI_C_DOUBLE_COMPLEX, c.values.data(), nnz_count.data(),
+              nnz_displs.data(), MPI_C_DOUBLE_COMPLEX, 0, MPI_COMM_WORLD);
 
   if (rank == 0) {
-    std::vector<int> displs(size);
-    if (!displs.empty()) {
-      displs[0] = 0;
-      for (int i = 1; i < size; ++i) {
-        displs[i] = displs[i - 1] + recv_counts[i - 1];
-      }
-    }
-    int total_bytes = displs[size - 1] + recv_counts[size - 1];
-
-    std::vector<char> recv_buffer(total_bytes);
-
-    std::vector<CoordVal> send_buffer(local_results.begin(), local_results.end());
-
-    MPI_Gatherv(send_buffer.data(), static_cast<int>(send_buffer.size() * sizeof(CoordVal)), MPI_BYTE,
-                recv_buffer.data(), recv_counts.data(), displs.data(), MPI_BYTE, 0, MPI_COMM_WORLD);
-
-    std::vector<CoordVal> all_results;
-    all_results.reserve(total_bytes / sizeof(CoordVal));
-    auto* ptr = reinterpret_cast<CoordVal*>(recv_buffer.data());
-    size_t count_coords = total_bytes / sizeof(CoordVal);
-    for (size_t i = 0; i < count_coords; ++i) {
-      all_results.push_back(ptr[i]);
+    for (int i = 0; i < A_.numRows; ++i) {
+      c.rowPtr[i + 1] += c.rowPtr[i];
     }
-    kolodkin_g_multiplication_matrix_all::SparseMatrixCRS c(a_num_rows, b_num_cols);
-    c = BuildResultMatrix(all_results, a_num_rows, b_num_cols);
     output_ = ParseMatrixIntoVec(c);
-
-  } else {
-    MPI_Gatherv(local_results.data(), static_cast<int>(local_results.size() * sizeof(CoordVal)), MPI_BYTE, nullptr,
-                nullptr, nullptr, MPI_BYTE, 0, MPI_COMM_WORLD);
   }
-
   return true;
 }
 
@@ -1,19 +1,18 @@
 ﻿#include "all/konkov_i_sparse_matmul_ccs/include/ops_all.hpp"
 
-#include <algorithm>
 #include <boost/mpi/collectives/broadcast.hpp>
 #include <boost/mpi/collectives/gather.hpp>
 #include <boost/serialization/tracking.hpp>
 #include <boost/serialization/tracking_enum.hpp>
 #include <boost/serialization/vector.hpp>  // NOLINT
 #include <core/task/include/task.hpp>
-#include <core/util/include/util.hpp>
 #include <cstddef>
-#include <thread>
-#include <unordered_map>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
+
 // NOLINTNEXTLINE
 BOOST_CLASS_TRACKING(std::vector<double>, boost::serialization::track_never)
 // NOLINTNEXTLINE
@@ -57,56 +56,6 @@ bool SparseMatmulTask::PreProcessingImpl() {
   return true;
 }
 
-void SparseMatmulTask::ProcessColumn(int col_b, int start_col, std::vector<double>& local_values,
-                                     std::vector<int>& local_rows, std::vector<int>& local_col_ptr) {
-  std::unordered_map<int, double> column_result;
-
-  for (int j = B_col_ptr[col_b]; j < B_col_ptr[col_b + 1]; ++j) {
-    int row_b = B_row_indices[j];
-    double val_b = B_values[j];
-
-    for (int k = A_col_ptr[row_b]; k < A_col_ptr[row_b + 1]; ++k) {
-      int row_a = A_row_indices[k];
-      double val_a = A_values[k];
-      column_result[row_a] += val_a * val_b;
-    }
-  }
-
-  std::vector<std::pair<int, double>> sorted_entries;
-  for (const auto& [row, val] : column_result) {
-    if (val != 0.0) {
-      sorted_entries.emplace_back(row, val);
-    }
-  }
-  std::ranges::sort(sorted_entries, {}, &std::pair<int, double>::first);
-
-  int local_col = col_b - start_col;
-  local_col_ptr[local_col + 1] = static_cast<int>(sorted_entries.size());
-
-  for (const auto& [row, val] : sorted_entries) {
-    local_rows.push_back(row);
-    local_values.push_back(val);
-  }
-}
-
-void SparseMatmulTask::MergeThreadResults(const std::vector<std::vector<double>>& thread_values,
-                                          const std::vector<std::vector<int>>& thread_rows,
-                                          const std::vector<std::vector<int>>& thread_col_ptrs,
-                                          std::vector<double>& local_values, std::vector<int>& local_rows,
-                                          std::vector<int>& local_col_ptr, int num_local_cols, int num_threads) {
-  for (int local_col = 0; local_col < num_local_cols; ++local_col) {
-    for (int t = 0; t < num_threads; ++t) {
-      int start = thread_col_ptrs[t][local_col];
-      int end = thread_col_ptrs[t][local_col + 1];
-      for (int i = start; i < end; ++i) {
-        local_values.push_back(thread_values[t][i]);
-        local_rows.push_back(thread_rows[t][i]);
-      }
-    }
-    local_col_ptr[local_col + 1] = static_cast<int>(local_values.size());
-  }
-}
-
 bool SparseMatmulTask::RunImpl() {
   int rank = world_.rank();
   int size = world_.size();
@@ -118,39 +67,25 @@ bool SparseMatmulTask::RunImpl() {
   int end_col = start_col + ((rank < extra_cols) ? (base_cols + 1) : base_cols);
   int num_local_cols = end_col - start_col;
 
-  std::vector<double> local_values;
-  std::vector<int> local_rows;
-  std::vector<int> local_col_ptr(num_local_cols + 1, 0);
-
-  int num_threads = std::max(ppc::util::GetPPCNumThreads(), 1);
-
-  std::vector<std::vector<double>> thread_values(num_threads);
-  std::vector<std::vector<int>> thread_rows(num_threads);
-  std::vector<std::vector<int>> thread_col_ptrs(num_threads, std::vector<int>(num_local_cols + 1, 0));
-
-  auto worker = [&](int thread_id) {
-    for (int col = start_col + thread_id; col < end_col; col += num_threads) {
-      int local_col = col - start_col;
-      size_t initial_size = thread_values[thread_id].size();
-      ProcessColumn(col, start_col, thread_values[thread_id], thread_rows[thread_id], thread_col_ptrs[thread_id]);
-      thread_col_ptrs[thread_id][local_col + 1] = static_cast<int>(thread_values[thread_id].size() - initial_size);
-    }
-    for (int lc = 1; lc <= num_local_cols; ++lc) {
-      thread_col_ptrs[thread_id][lc] += thread_col_ptrs[thread_id][lc - 1];
-    }
-  };
-
-  std::vector<std::thread> threads;
-  threads.reserve(num_threads);
-  for (int t = 0; t < num_threads; ++t) {
-    threads.emplace_back(worker, t);
-  }
-  for (auto& t : threads) {
-    t.join();
+  // Columns of B owned by this process, with offsets counted from its first column
+  const int first = B_col_ptr[start_col];
+  const auto local_nnz_b = static_cast<size_t>(B_col_ptr[end_col] - first);
+  std::vector<int> local_b_col_ptr(B_col_ptr.begin() + start_col, B_col_ptr.begin() + end_col + 1);
+  for (auto& offset : local_b_col_ptr) {
+    offset -= first;
   }
-
-  MergeThreadResults(thread_values, thread_rows, thread_col_ptrs, local_values, local_rows, local_col_ptr,
-                     num_local_cols, num_threads);
+  const auto local_b_rows = std::span<const int>(B_row_indices).subspan(first, local_nnz_b);
+  const auto local_b_values = std::span<const double>(B_values).subspan(first, local_nnz_b);
+  using View = ppc::core::sparse::CcsView<double, int>;
+  const View a{.rows = static_cast<size_t>(rowsA), .cols = static_cast<size_t>(colsA), .col_ptr = A_col_ptr,
+               .row_idx = A_row_indices, .values = A_values};
+  const View b{.rows = static_cast<size_t>(rowsB), .cols = static_cast<size_t>(num_local_cols),
+               .col_ptr = local_b_col_ptr, .row_idx = local_b_rows, .values = local_b_values};
+  // Sums which cancel out to zero are not stored
+  auto local = ppc::core::sparse::SpGemm(a, b, ppc::core::sparse::StlBackend{}, {.drop_zeros = true});
+  std::vector<double> local_values = std::move(local.values);
+  std::vector<int> local_rows = std::move(local.row_idx);
+  std::vector<int> local_col_ptr = std::move(local.col_ptr);
 
   std::vector<int> proc_start_cols(size);
   std::vector<int> proc_end_cols(size);
@@ -9,11 +9,11 @@
 #include <cstddef>
 #include <functional>
 #include <numeric>
-#include <thread>
+#include <span>
 #include <utility>
 #include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/sparse/include/sparse.hpp"
 
 namespace korneeva_e_sparse_matrix_mult_complex_ccs_all {
 
@@ -34,6 +34,26 @@ void DistributeColumns(int rank, int size, int total_cols, int& start_col, int&
     end_col = total_cols;
   }
 }
+
+// Entries which cancel out up to rounding are not stored
+void DropNearZeros(ppc::core::sparse::CcsMatrix<Complex, int>& m) {
+  size_t pos = 0;
+  size_t begin = 0;
+  for (size_t j = 0; j < m.cols; ++j) {
+    const auto end = static_cast<size_t>(m.col_ptr[j + 1]);
+    for (size_t e = begin; e < end; ++e) {
+      if (std::abs(m.values[e].real()) > 1e-10 || std::abs(m.values[e].imag()) > 1e-10) {
+        m.row_idx[pos] = m.row_idx[e];
+        m.values[pos] = m.values[e];
+        ++pos;
+      }
+    }
+    begin = end;
+    m.col_ptr[j + 1] = static_cast<int>(pos);
+  }
+  m.row_idx.resize(pos);
+  m.values.resize(pos);
+}
 }  // namespace
 
 bool SparseMatrixMultComplexCCS::PreProcessingImpl() {
@@ -64,62 +84,11 @@ bool SparseMatrixMultComplexCCS::ValidationImpl() {
   return true;
 }
 
-void SparseMatrixMultComplexCCS::ProcessColumnRange(int start_col, int end_col,
-                                                    std::vector<std::vector<std::pair<Complex, int>>>& column_results,
-                                                    const std::vector<int>& col_indices) {
-  int num_threads = std::max(1, std::min(ppc::util::GetPPCNumThreads(), end_col - start_col));
-  if ((end_col - start_col) < num_threads * 2) {
-    for (int j = start_col; j < end_col; ++j) {
-      ComputeColumn(col_indices[j - start_col], column_results[j - start_col]);
-    }
-  } else {
-    std::vector<std::thread> threads;
-    threads.reserve(num_threads);
-    int cols_per_thread = (end_col - start_col) / num_threads;
-    int remaining_thread_cols = (end_col - start_col) % num_threads;
-    int thread_start = start_col;
-
-    auto compute_range = [&](int thread_start, int thread_end) {
-      for (int j = thread_start; j < thread_end; ++j) {
-        ComputeColumn(col_indices[j - start_col], column_results[j - start_col]);
-      }
-    };
-
-    for (int i = 0; i < num_threads; ++i) {
-      int cols = cols_per_thread + (i < remaining_thread_cols ? 1 : 0);
-      int thread_end = thread_start + cols;
-      threads.emplace_back(compute_range, thread_start, thread_end);
-      thread_start = thread_end;
-    }
-    for (auto& thread : threads) {
-      thread.join();
-    }
-  }
-}
-
-void SparseMatrixMultComplexCCS::CollectLocalResults(
-    const std::vector<std::vector<std::pair<Complex, int>>>& column_results, int start_col, int end_col,
-    std::vector<Complex>& local_values, std::vector<int>& local_row_indices, std::vector<int>& local_col_offsets,
-    int& local_nnz) {
-  local_nnz = 0;
-  local_values.clear();
-  local_row_indices.clear();
-  local_col_offsets.assign(end_col - start_col + 1, 0);
-  for (int j = 0; j < end_col - start_col; ++j) {
-    const auto& col_data = column_results[j];
-    for (const auto& [value, row_idx] : col_data) {
-      local_values.push_back(value);
-      local_row_indices.push_back(row_idx);
-    }
-    local_nnz += static_cast<int>(col_data.size());
-    local_col_offsets[j + 1] = local_nnz;
-  }
-}
-
-void SparseMatrixMultComplexCCS::GatherGlobalResults(
-    int rank, int size, int total_cols, int local_nnz, const std::vector<Complex>& local_values,
-    const std::vector<int>& local_row_indices, const std::vector<std::vector<std::pair<Complex, int>>>& column_results,
-    int start_col, int end_col) {
+void SparseMatrixMultComplexCCS::GatherGlobalResults(int rank, int size, int total_cols,
+                                                     const std::vector<Complex>& local_values,
+                                                     const std::vector<int>& local_row_indices,
+                                                     const std::vector<int>& local_col_offsets, int start_col) {
+  const auto local_nnz = static_cast<int>(local_values.size());
   std::vector<int> all_nnz;
   boost::mpi::all_gather(world_, local_nnz, all_nnz);
   int total_nnz = std::accumulate(all_nnz.begin(), all_nnz.end(), 0);
@@ -143,8 +112,8 @@ void SparseMatrixMultComplexCCS::GatherGlobalResults(
   }
 
   std::vector<int> local_col_counts(total_cols, 0);
-  for (int j = 0; j < end_col - start_col; ++j) {
-    local_col_counts[start_col + j] = static_cast<int>(column_results[j].size());
+  for (size_t j = 0; j + 1 < local_col_offsets.size(); ++j) {
+    local_col_counts[start_col + j] = local_col_offsets[j + 1] - local_col_offsets[j];
   }
 
   std::vector<int> global_col_counts(total_cols);
@@ -173,76 +142,31 @@ bool SparseMatrixMultComplexCCS::RunImpl() {
   int end_col = 0;
   DistributeColumns(rank, size, total_cols, start_col, end_col);
 
-  std::vector<std::vector<std::pair<Complex, int>>> column_results(end_col - start_col);
-  std::vector<int> col_indices(end_col - start_col);
-  std::iota(col_indices.begin(), col_indices.end(), start_col);
-
-  if (end_col > start_col) {
-    ProcessColumnRange(start_col, end_col, column_results, col_indices);
-  }
-
-  std::vector<Complex> local_values;
-  std::vector<int> local_row_indices;
-  std::vector<int> local_col_offsets;
-  int local_nnz = 0;
-  CollectLocalResults(column_results, start_col, end_col, local_values, local_row_indices, local_col_offsets,
-                      local_nnz);
-
-  GatherGlobalResults(rank, size, total_cols, local_nnz, local_values, local_row_indices, column_results, start_col,
-                      end_col);
+  // Columns of B owned by this process, with offsets counted from its first column
+  const int first = matrix2_->col_offsets[start_col];
+  const auto local_nnz_b = static_cast<size_t>(matrix2_->col_offsets[end_col] - first);
+  std::vector<int> local_b_offsets(matrix2_->col_offsets.begin() + start_col,
+                                   matrix2_->col_offsets.begin() + end_col + 1);
+  for (auto& offset : local_b_offsets) {
+    offset -= first;
+  }
+  const auto local_b_rows = std::span<const int>(matrix2_->row_indices).subspan(first, local_nnz_b);
+  const auto local_b_values = std::span<const Complex>(matrix2_->values).subspan(first, local_nnz_b);
+  using View = ppc::core::sparse::CcsView<Complex, int>;
+  const View a{.rows = static_cast<size_t>(matrix1_->rows), .cols = static_cast<size_t>(matrix1_->cols),
+               .col_ptr = matrix1_->col_offsets, .row_idx = matrix1_->row_indices, .values = matrix1_->values};
+  const View b{.rows = static_cast<size_t>(matrix2_->rows), .cols = static_cast<size_t>(end_col - start_col),
+               .col_ptr = local_b_offsets, .row_idx = local_b_rows, .values = local_b_values};
+  auto local = ppc::core::sparse::SpGemm(a, b, ppc::core::sparse::StlBackend{});
+  DropNearZeros(local);
+
+  GatherGlobalResults(rank, size, total_cols, local.values, local.row_idx, local.col_ptr, start_col);
 
   boost::mpi::broadcast(world_, result_, 0);
 
   return true;
 }
 
-Complex SparseMatrixMultComplexCCS::ComputeElement(int row_idx, int col_start2, int col_end2) {
-  Complex sum(0.0, 0.0);
-  for (int k = 0; k < matrix1_->cols; ++k) {
-    int col_start1 = matrix1_->col_offsets[k];
-    int col_end1 = matrix1_->col_offsets[k + 1];
-    sum += ComputeContribution(row_idx, k, col_start1, col_end1, col_start2, col_end2);
-  }
-  return sum;
-}
-
-Complex SparseMatrixMultComplexCCS::ComputeContribution(int row_idx, int k, int col_start1, int col_end1,
-                                                        int col_start2, int col_end2) {
-  Complex contribution(0.0, 0.0);
-  for (int p = col_start1; p < col_end1; ++p) {
-    if (matrix1_->row_indices[p] != row_idx) {
-      continue;
-    }
-    for (int q = col_start2; q < col_end2; ++q) {
-      if (matrix2_->row_indices[q] != k) {
-        continue;
-      }
-      contribution += matrix1_->values[p] * matrix2_->values[q];
-    }
-  }
-  return contribution;
-}
-
-void SparseMatrixMultComplexCCS::ComputeColumn(int col_idx, std::vector<std::pair<Complex, int>>& column_data) {
-  if (col_idx >= matrix2_->cols) {
-    return;
-  }
-  int col_start2 = matrix2_->col_offsets[col_idx];
-  int col_end2 = matrix2_->col_offsets[col_idx + 1];
-  if (col_start2 < 0 || col_end2 > matrix2_->nnz || col_start2 > col_end2) {
-    return;
-  }
-
-  column_data.resize(0);
-  column_data.reserve(std::min(matrix1_->rows, matrix2_->nnz));
-  for (int i = 0; i < matrix1_->rows; ++i) {
-    Complex sum = ComputeElement(i, col_start2, col_end2);
-    if (std::abs(sum.real()) > 1e-10 || std::abs(sum.imag()) > 1e-10) {
-      column_data.emplace_back(sum, i);
-    }
-  }
-}
-
 bool SparseMatrixMultComplexCCS::PostProcessingImpl() {
   if (world_.rank() == 0) {
     *reinterpret_cast<SparseMatrixCCS*>(task_data->outputs[0]) = result_;
@@ -6,16 +6,31 @@
 #include <memory>
 #include <numbers>
 #include <numeric>
+#include <span>
 #include <utility>
 #include <vector>
 
 #include "../include/mci_all.hpp"
 #include "../include/mci_common.hpp"
 #include "../include/mci_seq.hpp"
+#include "core/integrate/include/integrate.hpp"
 #include "core/task/include/task.hpp"
 
 using namespace krylov_m_monte_carlo;
 
+namespace {
+
+void BatchIntegrand(const ppc::core::integrate::PointBlock& points, std::span<double> values) {
+  const auto x = points.Axis(0);
+  const auto y = points.Axis(1);
+  const auto z = points.Axis(2);
+  for (std::size_t i = 0; i < points.count; ++i) {
+    values[i] = (x[i] * y[i]) + (z[i] * z[i]);
+  }
+}
+
+}  // namespace
+
 using DeterminedTestCase = std::pair<IntegrationParams, double>;
 
 class krylov_m_monte_carlo_all_test  // NOLINT(readability-identifier-naming)
@@ -24,7 +39,8 @@ class krylov_m_monte_carlo_all_test  // NOLINT(readability-identifier-naming)
   void RunTest(IntegrationParams&& params, double ref) {  // NOLINT(readability-function-cognitive-complexity)
     double out{};
 
-    IntegrationParams workers_params = {.func = params.func, .bounds = {}, .iterations = {}};
+    IntegrationParams workers_params = {
+        .func = params.func, .bounds = {}, .iterations = {}, .batch_func = params.batch_func};
     std::shared_ptr<ppc::core::TaskData> task_data =
         world.rank() == 0 ? params.CreateTaskData(out) : workers_params.CreateTaskData(out);
 
@@ -90,6 +106,32 @@ TEST_F(krylov_m_monte_carlo_all_test, sample_5d) {
       5, [](const Point& x) { return std::pow(std::numbers::e, -std::reduce(x.begin(), x.end(), 0.)); }, 50'000));
 }
 
+TEST_F(krylov_m_monte_carlo_all_test, batch_integrand_matches_pointwise) {
+  auto params = GenerateSampleParams(3, [](const Point& x) { return (x[0] * x[1]) + (x[2] * x[2]); }, 100'003);
+  double pointwise{};
+  if (world.rank() == 0) {
+    TaskSequential task(params.CreateTaskData(pointwise));
+    ASSERT_TRUE(task.Validation());
+    task.PreProcessing();
+    task.Run();
+    task.PostProcessing();
+  }
+
+  params.batch_func = BatchIntegrand;
+  IntegrationParams workers_params = {
+      .func = params.func, .bounds = {}, .iterations = {}, .batch_func = params.batch_func};
+  double batch{};
+  TaskALL task(world.rank() == 0 ? params.CreateTaskData(batch) : workers_params.CreateTaskData(batch));
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  if (world.rank() == 0) {
+    EXPECT_NEAR(batch, pointwise, 1e-12 * std::abs(pointwise));
+  }
+}
+
 TEST_F(krylov_m_monte_carlo_all_test, validation_failure) {
   if (world.rank() != 0) {
     return;
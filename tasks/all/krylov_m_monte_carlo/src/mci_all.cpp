@@ -10,7 +10,6 @@
 #include <functional>
 #include <future>
 #include <numeric>
-#include <random>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -36,38 +35,28 @@ bool krylov_m_monte_carlo::TaskALL::PostProcessingImpl() {
 
 bool krylov_m_monte_carlo::TaskALL::RunImpl() {
   const auto func = params->func;
+  const auto batch_func = params->batch_func;
   boost::mpi::broadcast(world_, params, 0);
   if (world_.rank() != 0) {
     params->func = func;
+    params->batch_func = batch_func;
     ApplyParams();
   }
 
-  const auto dimensions = params->Dimensions();
-
+  // Every process and thread jumps to its own samples of the shared sequence, so the result does not depend
+  // on their numbers
   const auto global_iterations = params->iterations;
-  const auto node_iterations = [this, &global_iterations] {
-    const auto nodes = world_.size();
+  const auto [node_first, node_iterations] = [this, &global_iterations] {
+    const auto nodes = static_cast<std::size_t>(world_.size());
+    const auto rank = static_cast<std::size_t>(world_.rank());
     const std::size_t amount = global_iterations / nodes;
     const std::size_t threshold = global_iterations % nodes;
     //
-    return amount + (static_cast<std::size_t>(world_.rank()) < threshold ? 1 : 0);
+    return std::pair{(rank * amount) + std::min(rank, threshold), amount + (rank < threshold ? 1 : 0)};
   }();
 
-  std::random_device dev;
-  std::mt19937 gen(dev());
-
-  const auto calculation_thread = [&](std::size_t local_iterations, std::promise<double>&& promise) {
-    auto local_gen = gen;
-    std::vector<double> x(dimensions);
-    double partial_sum = 0.;
-    for (std::size_t _ = 0; _ < local_iterations; ++_) {
-      for (std::size_t p = 0; p < dimensions; ++p) {
-        x[p] = dists[p](local_gen);
-      }
-      partial_sum += func(x);
-    }
-
-    promise.set_value(partial_sum);
+  const auto calculation_thread = [&](std::size_t first, std::size_t last, std::promise<double>&& promise) {
+    promise.set_value(SampleSum(first, last));
   };
 
   const std::size_t node_workers = ppc::util::GetPPCNumThreads();
@@ -77,11 +66,13 @@ bool krylov_m_monte_carlo::TaskALL::RunImpl() {
     const std::size_t threshold = node_iterations % node_workers;
 
     std::vector<std::thread> threads(node_workers);
+    std::size_t first = node_first;
     for (std::size_t i = 0; i < node_workers; i++) {
       const std::size_t assigned = amount + ((i < threshold) ? 1 : 0);
       std::promise<double> promise;
       futures[i] = promise.get_future();
-      threads[i] = std::thread(calculation_thread, assigned, std::move(promise));
+      threads[i] = std::thread(calculation_thread, first, first + assigned, std::move(promise));
+      first += assigned;
     }
     std::ranges::for_each(threads, [](auto& thread) { thread.join(); });
   }
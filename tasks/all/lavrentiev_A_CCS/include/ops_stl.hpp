@@ -1,49 +1,25 @@
 #pragma once
 
 #include <boost/mpi/communicator.hpp>
-#include <cmath>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
 #include "core/task/include/task.hpp"
 
 namespace lavrentiev_a_ccs_all {
-struct Sparse {
-  std::pair<int, int> size;
-  std::vector<double> elements;
-  std::vector<int> rows;
-  std::vector<int> columnsSum;
-  template <typename Archive>
-  // NOLINTNEXTLINE(readability-identifier-naming)
-  void serialize(Archive& archive, const unsigned int) {
-    archive & size.first;
-    archive & size.second;
-    archive & elements;
-    archive & rows;
-    archive & columnsSum;
-  }
-};
+
+using Sparse = ppc::core::sparse::CcsMatrix<double, int>;
+
 class CCSALL : public ppc::core::Task {
  private:
-  [[nodiscard]] bool IsEmpty() const;
   static Sparse ConvertToSparse(std::pair<int, int> size, const std::vector<double>& values);
-  static Sparse Transpose(const Sparse& sparse);
-  static Sparse MatMul(const Sparse& matrix1, const Sparse& matrix2, int interval_begin, int interval_end);
-  static int GetElementsCount(int index, const std::vector<int>& columns_sum);
   static std::vector<double> ConvertFromSparse(const Sparse& matrix);
-  static int CalculateStartIndex(int index, const std::vector<int>& columns_sum);
-  static double Accumulate(int i_index, int j_index, const Sparse& matrix1, const Sparse& matrix2);
-  void GetDisplacements();
-  void CollectSizes();
 
   Sparse A_;
   Sparse B_;
   Sparse Answer_;
-  Sparse Process_data_;
-  std::vector<int> elements_sizes_;
   boost::mpi::communicator world_;
-  std::vector<int> displ_;
-  std::vector<int> sum_sizes_;
 
  public:
   explicit CCSALL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/mpi/communicator.hpp>
+#include <cstddef>
 #include <functional>
 #include <utility>
 #include <vector>
@@ -22,6 +23,9 @@ class TestTaskAll : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
+  // sum of the integrand over samples [first, last) of a sequence fixed by the default seed
+  [[nodiscard]] double SampleSum(std::size_t first, std::size_t last) const;
+
   std::vector<double> integrationBounds_;
   std::function<IntegrandFunction> integrand_;
   double result_{};
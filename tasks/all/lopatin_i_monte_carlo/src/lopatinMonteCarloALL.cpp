@@ -1,18 +1,17 @@
 #include "all/lopatin_i_monte_carlo/include/lopatinMonteCarloALL.hpp"
 
-#include <omp.h>
-
 #include <algorithm>
 #include <boost/mpi/collectives/broadcast.hpp>
 #include <boost/mpi/collectives/reduce.hpp>
 #include <boost/serialization/vector.hpp>  // NOLINT(*-include-cleaner)
 #include <cmath>
 #include <cstddef>
-#include <ctime>
+#include <cstdint>
 #include <functional>
-#include <random>
 #include <vector>
 
+#include "core/random/include/philox.hpp"
+
 namespace lopatin_i_monte_carlo_all {
 
 bool TestTaskAll::ValidationImpl() {
@@ -55,31 +54,18 @@ bool TestTaskAll::RunImpl() {
     volume *= (integrationBounds_[(2 * j) + 1] - integrationBounds_[2 * j]);
   }
 
-  // distributing iterations
+  // distributing iterations: every process takes a consecutive range of the samples
   const int world_size = world_.size();
   const int world_rank = world_.rank();
-  const int local_iterations = (iterations_ / world_size) + (world_rank < (iterations_ % world_size) ? 1 : 0);
+  const auto first = static_cast<std::int64_t>((world_rank * (iterations_ / world_size)) +
+                                               std::min(world_rank, iterations_ % world_size));
+  const auto last = first + (iterations_ / world_size) + (world_rank < (iterations_ % world_size) ? 1 : 0);
 
+  constexpr std::int64_t kChunk = 1024;
   double local_sum = 0.0;
-#pragma omp parallel reduction(+ : local_sum)
-  {
-    // init random numbers generator
-    std::random_device rd;
-    std::seed_seq seed{rd(), static_cast<unsigned>(std::time(nullptr)), static_cast<unsigned>(world_rank),
-                       static_cast<unsigned>(omp_get_thread_num())};
-    std::mt19937 local_rnd(seed);
-    std::uniform_real_distribution<> dis(0.0, 1.0);
-
-#pragma omp for
-    for (int i = 0; i < local_iterations; ++i) {
-      std::vector<double> point(d);
-      for (size_t j = 0; j < d; ++j) {
-        const double min = integrationBounds_[2 * j];
-        const double max = integrationBounds_[(2 * j) + 1];
-        point[j] = min + (max - min) * dis(local_rnd);
-      }
-      local_sum += integrand_(point);
-    }
+#pragma omp parallel for schedule(dynamic) reduction(+ : local_sum)
+  for (std::int64_t begin = first; begin < last; begin += kChunk) {
+    local_sum += SampleSum(begin, std::min(begin + kChunk, last));
   }
 
   double global_sum = 0.0;
@@ -92,6 +78,22 @@ bool TestTaskAll::RunImpl() {
   return true;
 }
 
+double TestTaskAll::SampleSum(std::size_t first, std::size_t last) const {
+  const size_t d = integrationBounds_.size() / 2;  // dimensions
+
+  // sample i takes the uniforms [i * d, (i + 1) * d) of the fixed sequence
+  auto rnd = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, d);
+  std::vector<double> point(d);
+  double sum = 0.0;
+  for (size_t i = first; i < last; ++i) {
+    for (size_t j = 0; j < d; ++j) {
+      point[j] = rnd.Uniform(integrationBounds_[2 * j], integrationBounds_[(2 * j) + 1]);
+    }
+    sum += integrand_(point);
+  }
+  return sum;
+}
+
 bool TestTaskAll::PostProcessingImpl() {
   if (world_.rank() == 0) {
     auto* output_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/graph.hpp"
 #include "core/task/include/task.hpp"
 
 namespace muhina_m_dijkstra_all {
@@ -20,11 +21,12 @@ class TestTaskALL : public ppc::core::Task {
 
  private:
   boost::mpi::communicator world_;
-  std::vector<int> graph_data_;
+  ppc::core::graph::CsrGraph graph_;
+  bool valid_graph_ = false;
+  size_t start_input_ = 1;
   std::vector<int> distances_;
   size_t start_vertex_;
   size_t num_vertices_;
-  static const int kEndOfVertexList;
 };
 
 }  // namespace muhina_m_dijkstra_all
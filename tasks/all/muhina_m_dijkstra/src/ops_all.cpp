@@ -11,13 +11,15 @@
 #include <boost/mpi/collectives/broadcast.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/operations.hpp>
+#include <boost/serialization/vector.hpp>  // IWYU pragma: keep
 #include <climits>
 #include <cstddef>
 #include <functional>
-#include <iterator>
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/graph.hpp"
+
 namespace {
 bool ProcessLocalQueue(oneapi::tbb::concurrent_priority_queue<std::pair<int, int>, std::greater<>>& pq,
                        int& local_distance, int& local_vertex) {
@@ -41,15 +43,15 @@ std::pair<int, int> SynchronizeMinDistance(boost::mpi::communicator& world, int
   return global_min;
 }
 
-void ProcessNeighbors(size_t u, const std::vector<std::vector<std::pair<size_t, int>>>& adj_list,
-                      std::vector<int>& local_distances,
+void ProcessNeighbors(size_t u, const ppc::core::graph::CsrGraph& graph, std::vector<int>& local_distances,
                       oneapi::tbb::concurrent_priority_queue<std::pair<int, int>, std::greater<>>& pq,
                       oneapi::tbb::spin_mutex& mutex) {
   oneapi::tbb::parallel_for(
-      oneapi::tbb::blocked_range<size_t>(0, adj_list[u].size()), [&](const oneapi::tbb::blocked_range<size_t>& r) {
+      oneapi::tbb::blocked_range<size_t>(graph.offsets[u], graph.offsets[u + 1]),
+      [&](const oneapi::tbb::blocked_range<size_t>& r) {
         for (size_t i = r.begin(); i != r.end(); ++i) {
-          const size_t v = adj_list[u][i].first;
-          const int weight = adj_list[u][i].second;
+          const size_t v = graph.targets[i];
+          const int weight = graph.weights[i];
           const int new_dist =
               (local_distances[u] == INT_MAX || weight == INT_MAX) ? INT_MAX : local_distances[u] + weight;
 
@@ -71,8 +73,8 @@ void SynchronizeDistances(boost::mpi::communicator& world, std::vector<int>& loc
   std::ranges::copy(global_distances.begin(), global_distances.end(), local_distances.begin());
 }
 
-void RunDijkstraAlgorithm(const std::vector<std::vector<std::pair<size_t, int>>>& adj_list, std::vector<int>& distances,
-                          size_t start_vertex, boost::mpi::communicator& world, size_t num_vertices) {
+void RunDijkstraAlgorithm(const ppc::core::graph::CsrGraph& graph, std::vector<int>& distances, size_t start_vertex,
+                          boost::mpi::communicator& world, size_t num_vertices) {
   oneapi::tbb::concurrent_priority_queue<std::pair<int, int>, std::greater<>> pq;
   oneapi::tbb::spin_mutex mutex;
   std::vector<int> local_distances(num_vertices, INT_MAX);
@@ -100,7 +102,7 @@ void RunDijkstraAlgorithm(const std::vector<std::vector<std::pair<size_t, int>>>
       continue;
     }
 
-    ProcessNeighbors(u, adj_list, local_distances, pq, mutex);
+    ProcessNeighbors(u, graph, local_distances, pq, mutex);
     SynchronizeDistances(world, local_distances, global_distances, num_vertices);
   }
 
@@ -108,30 +110,30 @@ void RunDijkstraAlgorithm(const std::vector<std::vector<std::pair<size_t, int>>>
 }
 }  // namespace
 
-const int muhina_m_dijkstra_all::TestTaskALL::kEndOfVertexList = -1;
-
 bool muhina_m_dijkstra_all::TestTaskALL::PreProcessingImpl() {
-  graph_data_.clear();
   distances_.clear();
 
   if (!task_data) {
     return false;
   }
 
+  // Rank 0 reads the graph (in place for CSR inputs) and broadcasts the CSR arrays
   if (world_.rank() == 0) {
-    const unsigned int input_size = task_data->inputs_count[0];
-    const auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-    if (in_ptr == nullptr) {
+    if (task_data->inputs[0] == nullptr || task_data->outputs_count.empty()) {
       return false;
     }
-    graph_data_.reserve(input_size);
-    std::ranges::copy(in_ptr, in_ptr + input_size, std::back_inserter(graph_data_));
-    for (int proc = 1; proc < world_.size(); proc++) {
-      world_.send(proc, 0, graph_data_);
-    }
-  } else {
-    world_.recv(0, 0, graph_data_);
+    ppc::core::graph::TaskGraph input;
+    valid_graph_ = input.Load(*task_data, task_data->outputs_count[0]);
+    const auto view = input.View();
+    graph_.offsets.assign(view.offsets.begin(), view.offsets.end());
+    graph_.targets.assign(view.targets.begin(), view.targets.end());
+    graph_.weights.assign(view.weights.begin(), view.weights.end());
+    start_input_ = input.NextInput();
   }
+  boost::mpi::broadcast(world_, valid_graph_, 0);
+  boost::mpi::broadcast(world_, graph_.offsets, 0);
+  boost::mpi::broadcast(world_, graph_.targets, 0);
+  boost::mpi::broadcast(world_, graph_.weights, 0);
 
   if (task_data->outputs_count.empty()) {
     return false;
@@ -147,9 +149,10 @@ bool muhina_m_dijkstra_all::TestTaskALL::PreProcessingImpl() {
   distances_.resize(num_vertices_);
   std::ranges::fill(distances_.begin(), distances_.end(), INT_MAX);
 
-  if (task_data->inputs.size() > 1 && task_data->inputs[1] != nullptr) {
+  boost::mpi::broadcast(world_, start_input_, 0);
+  if (task_data->inputs.size() > start_input_ && task_data->inputs[start_input_] != nullptr) {
     if (world_.rank() == 0) {
-      start_vertex_ = *reinterpret_cast<int*>(task_data->inputs[1]);
+      start_vertex_ = *reinterpret_cast<int*>(task_data->inputs[start_input_]);
     }
     boost::mpi::broadcast(world_, start_vertex_, 0);
   } else {
@@ -168,36 +171,10 @@ bool muhina_m_dijkstra_all::TestTaskALL::ValidationImpl() {
 }
 
 bool muhina_m_dijkstra_all::TestTaskALL::RunImpl() {
-  std::vector<std::vector<std::pair<size_t, int>>> adj_list(num_vertices_);
-  size_t current_vertex = 0;
-  size_t i = 0;
-
-  while (i < graph_data_.size() && current_vertex < num_vertices_) {
-    if (i >= graph_data_.size()) {
-      return false;
-    }
-    if (graph_data_[i] == kEndOfVertexList) {
-      current_vertex++;
-      i++;
-      continue;
-    }
-    if (i + 1 >= graph_data_.size()) {
-      break;
-    }
-
-    const auto dest = static_cast<size_t>(graph_data_[i]);
-    const int weight = graph_data_[i + 1];
-    if (weight < 0) {
-      return false;
-    }
-
-    if (dest < num_vertices_) {
-      adj_list[current_vertex].emplace_back(dest, weight);
-    }
-    i += 2;
+  if (!valid_graph_) {
+    return false;
   }
-
-  RunDijkstraAlgorithm(adj_list, distances_, start_vertex_, world_, num_vertices_);
+  RunDijkstraAlgorithm(graph_, distances_, start_vertex_, world_, num_vertices_);
   return true;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include <boost/mpi/communicator.hpp>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -20,6 +21,9 @@ class MultiDimMonteCarloTask : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
+  // Sum of the function over samples [first, last) of the sequence fixed by the default seed
+  [[nodiscard]] double SampleSum(size_t first, size_t last) const;
+
   std::vector<double> boundaries_;
   boost::mpi::communicator world_;
   int number_of_iterations_ = 0;
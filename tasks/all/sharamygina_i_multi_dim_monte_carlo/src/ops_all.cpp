@@ -1,18 +1,17 @@
 #include "all/sharamygina_i_multi_dim_monte_carlo/include/ops_all.h"
 
-#include <omp.h>
-
 #include <algorithm>
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/collectives/broadcast.hpp>
 #include <boost/mpi/collectives/reduce.hpp>
 #include <boost/serialization/vector.hpp>  // NOLINT(*-include-cleaner)
+#include <cstdint>
 #include <cstdlib>
-#include <ctime>
 #include <functional>
-#include <random>
 #include <vector>
 
+#include "core/random/include/philox.hpp"
+
 bool sharamygina_i_multi_dim_monte_carlo_all::MultiDimMonteCarloTask::PreProcessingImpl() {
   int rank = world_.rank();
 
@@ -47,28 +46,19 @@ bool sharamygina_i_multi_dim_monte_carlo_all::MultiDimMonteCarloTask::RunImpl()
 
   size_t dimension = boundaries_.size() / 2;
 
-  std::mt19937 engine(static_cast<unsigned long>(std::time(nullptr)) + rank + size);
-  std::uniform_real_distribution<double> distribution(0.0, 1.0);
-
   int iterations_per_process = number_of_iterations_ / size;
   int remainder = number_of_iterations_ % size;
 
-  int start_iter = (rank * iterations_per_process) + std::min(rank, remainder);
-  int end_iter = start_iter + iterations_per_process + (rank < remainder ? 1 : 0);
+  // the processes take consecutive ranges of one sample sequence
+  const std::int64_t start_iter = (rank * iterations_per_process) + std::min(rank, remainder);
+  const std::int64_t end_iter = start_iter + iterations_per_process + (rank < remainder ? 1 : 0);
+  constexpr std::int64_t kChunk = 1024;
 
   double accumulator = 0.0;
 
-  std::vector<double> random_point(dimension);
-
-#pragma omp parallel for reduction(+ : accumulator)
-  for (int n = start_iter; n < end_iter; ++n) {
-    for (size_t i = 0; i < dimension; ++i) {
-      double low = boundaries_[2 * i];
-      double high = boundaries_[(2 * i) + 1];
-      double t = distribution(engine);
-      random_point[i] = low + (high - low) * t;
-    }
-    accumulator += integrating_function_(random_point);
+#pragma omp parallel for schedule(dynamic) reduction(+ : accumulator)
+  for (std::int64_t first = start_iter; first < end_iter; first += kChunk) {
+    accumulator += SampleSum(first, std::min(first + kChunk, end_iter));
   }
 
   double global_accumulator = 0.0;
@@ -86,6 +76,22 @@ bool sharamygina_i_multi_dim_monte_carlo_all::MultiDimMonteCarloTask::RunImpl()
   return true;
 }
 
+double sharamygina_i_multi_dim_monte_carlo_all::MultiDimMonteCarloTask::SampleSum(size_t first, size_t last) const {
+  size_t dimension = boundaries_.size() / 2;
+
+  auto engine = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, dimension);
+  std::vector<double> random_point(dimension);
+  double accumulator = 0.0;
+
+  for (size_t n = first; n < last; ++n) {
+    for (size_t i = 0; i < dimension; ++i) {
+      random_point[i] = engine.Uniform(boundaries_[2 * i], boundaries_[(2 * i) + 1]);
+    }
+    accumulator += integrating_function_(random_point);
+  }
+  return accumulator;
+}
+
 bool sharamygina_i_multi_dim_monte_carlo_all::MultiDimMonteCarloTask::PostProcessingImpl() {
   if (world_.rank() == 0) {
     auto* output_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
@@ -55,8 +55,6 @@ class JarvisALLParallel : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
-  void MakeJarvisPassageALL(std::vector<shulpin_i_jarvis_all::Point>& input,
-                            std::vector<shulpin_i_jarvis_all::Point>& output);
 
  private:
   int rank_;
@@ -12,6 +12,10 @@ using Point = std::array<double, 2>;
 
 namespace shvedova_v_graham_convex_hull_all {
 
+struct Point {
+  double x, y;
+};
+
 class GrahamConvexHullALL : public ppc::core::Task {
  public:
   explicit GrahamConvexHullALL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {
@@ -27,10 +31,7 @@ class GrahamConvexHullALL : public ppc::core::Task {
   int rank_;
   int points_count_{0};
   std::vector<Point> input_;
-  std::vector<Point> procinput_;
   std::vector<Point> res_;
-
-  void PerformSort(const Point &pivot);
 };
 
 }  // namespace shvedova_v_graham_convex_hull_all
@@ -5,15 +5,13 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <cstdint>
-#include <iterator>
 #include <numeric>
 #include <span>
-#include <thread>
 #include <utility>
 #include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/hull/include/hull.hpp"
+#include "core/sparse/include/sparse.hpp"
 
 namespace {
 bool CheckCollinearity(std::span<double> raw_points) {
@@ -44,9 +42,6 @@ bool ComparePoints(const Point &p0, const Point &p1, const Point &p2) {
   }
   return cross > 0;
 }
-double CrossProduct(const Point &p0, const Point &p1, const Point &p2) {
-  return ((p1[0] - p0[0]) * (p2[1] - p0[1])) - ((p1[1] - p0[1]) * (p2[0] - p0[0]));
-}
 }  // namespace
 
 namespace shvedova_v_graham_convex_hull_all {
@@ -70,8 +65,8 @@ bool GrahamConvexHullALL::PreProcessingImpl() {
 
   auto *p_src = reinterpret_cast<double *>(task_data->inputs[0]);
   for (int i = 0; i < points_count_ * 2; i += 2) {
-    input_[i / 2][0] = p_src[i];
-    input_[i / 2][1] = p_src[i + 1];
+    input_[i / 2].x = p_src[i];
+    input_[i / 2].y = p_src[i + 1];
   }
 
   res_.clear();
@@ -80,125 +75,43 @@ bool GrahamConvexHullALL::PreProcessingImpl() {
   return true;
 }
 
-void GrahamConvexHullALL::PerformSort(const Point &pivot) {
-  const int threadsnum = std::min(static_cast<int>(procinput_.size()), ppc::util::GetPPCNumThreads());
-  const int perthread = static_cast<int>(procinput_.size()) / threadsnum;
-  const int unfit = static_cast<int>(procinput_.size()) % threadsnum;
-
-  std::vector<std::span<Point>> fragments(threadsnum);
-  auto it = procinput_.begin();
-  for (int i = 0; i < threadsnum; i++) {
-    auto nit = std::next(it, perthread + ((i < unfit) ? 1 : 0));
-    fragments[i] = std::span{it, nit};
-    it = nit;
-  }
-
-  const auto comp = [&](const Point &p1, const Point &p2) { return ComparePoints(pivot, p1, p2); };
-  const auto merge = [&](int i, int k) {
-    auto &primary = fragments[k];
-    auto &secondary = fragments[k + i];
-
-    std::inplace_merge(primary.begin(), primary.end(), secondary.end(), comp);
-    primary = std::span{primary.begin(), secondary.end()};
-  };
-
-  std::vector<std::thread> ts(threadsnum);
-  for (std::size_t i = 0; i < ts.size(); i++) {
-    ts[i] = std::thread([&, i] { std::ranges::sort(fragments[i], comp); });
-  }
-  std::ranges::for_each(ts, [](auto &t) { t.join(); });
-
-  for (int i = 1; i < threadsnum; i *= 2) {
-    const auto factor = threadsnum - i;
-    if (fragments.front().size() < 32) {
-      for (int j = 0; j < factor; j += 2 * i) {
-        merge(i, j);
-      }
-    } else {
-      ts.clear();
-      for (int j = 0; j < factor; j += 2 * i) {
-        ts.emplace_back([&](int k) { merge(i, k); }, j);
-      }
-      std::ranges::for_each(ts, [](auto &t) { t.join(); });
-    }
-  }
-}
-
 bool GrahamConvexHullALL::RunImpl() {
   auto size = input_.size();
   MPI_Bcast(&size, 1, MPI_UINT64_T, 0, MPI_COMM_WORLD);
 
   int worldsize{};
   MPI_Comm_size(MPI_COMM_WORLD, &worldsize);
-  int processes = std::min(static_cast<int>(size), worldsize);
 
-  MPI_Comm group{};
-  if (rank_ >= processes) {
-    MPI_Comm_split(MPI_COMM_WORLD, 0, rank_, &group);
-    MPI_Comm_free(&group);
-    return true;
+  std::vector<int> sendcnts(worldsize);
+  std::vector<int> displacements(worldsize);
+  for (int i = 0; i < worldsize; ++i) {
+    displacements[i] = static_cast<int>(size * i / worldsize) * 2;
+    sendcnts[i] = (static_cast<int>(size * (i + 1) / worldsize) * 2) - displacements[i];
   }
-  MPI_Comm_split(MPI_COMM_WORLD, 0, rank_, &group);
 
-  Point pivot{};
-  if (rank_ == 0) {
-    pivot = *std::ranges::min_element(input_, [](auto &a, auto &b) { return a[1] < b[1]; });
-  }
-  MPI_Bcast(pivot.data(), int(pivot.size()), MPI_DOUBLE, 0, group);
+  std::vector<Point> procinput(sendcnts[rank_] / 2);
+  MPI_Scatterv(input_.data(), sendcnts.data(), displacements.data(), MPI_DOUBLE, procinput.data(), sendcnts[rank_],
+               MPI_DOUBLE, 0, MPI_COMM_WORLD);
 
-  std::vector<int> sendcnts(processes);
-  std::vector<int> displacements(processes);
-  const int perprocess = static_cast<int>(size) / processes;
-  const int unfit = static_cast<int>(size) % processes;
+  // Every vertex of the hull is a vertex of the hull of its own block, so the root merges only those
+  const ppc::core::sparse::StlBackend backend;
+  const auto local_hull = ppc::core::hull::ConvexHull<Point>(procinput, backend);
+  int local_count = static_cast<int>(local_hull.size()) * 2;
+  std::vector<int> recvcnts(worldsize);
+  MPI_Gather(&local_count, 1, MPI_INT, recvcnts.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
 
-  for (int i = 0; i < processes; ++i) {
-    sendcnts[i] = (perprocess + (i < unfit ? 1 : 0)) * int(Point{}.size());
-  }
-  std::partial_sum(sendcnts.begin(), sendcnts.end() - 1, displacements.begin() + 1);
-  displacements[0] = 0;
-
-  int local_count = sendcnts[rank_] / int(Point{}.size());
-  procinput_.reserve(size);
-  procinput_.resize(local_count);
-
-  MPI_Scatterv(input_.data(), sendcnts.data(), displacements.data(), MPI_DOUBLE, procinput_.data(), sendcnts[rank_],
-               MPI_DOUBLE, 0, group);
-
-  PerformSort(pivot);
-
-  const auto comp = [&](const Point &p1, const Point &p2) { return ComparePoints(pivot, p1, p2); };
-  for (int i = 1; i < processes; i *= 2) {
-    if (rank_ % (2 * i) == 0) {
-      const int secondary = rank_ + i;
-      if (secondary < processes) {
-        int32_t sizecomp{};
-        MPI_Recv(&sizecomp, 1, MPI_INT32_T, secondary, 0, group, MPI_STATUS_IGNORE);
-
-        const auto div = procinput_.size();
-        procinput_.resize(div + sizecomp);
-        MPI_Recv(procinput_.data() + div, sizecomp * int(Point{}.size()), MPI_DOUBLE, secondary, 0, group,
-                 MPI_STATUS_IGNORE);
-        std::ranges::inplace_merge(procinput_, procinput_.begin() + static_cast<std::int64_t>(div), comp);
-      }
-    } else if ((rank_ % i) == 0) {
-      const auto sizeproc = std::int32_t(procinput_.size());
-      MPI_Send(&sizeproc, 1, MPI_INT32_T, rank_ - i, 0, group);
-      MPI_Send(procinput_.data(), sizeproc * int(Point{}.size()), MPI_DOUBLE, rank_ - i, 0, group);
-      break;
-    }
-  }
-
-  MPI_Comm_free(&group);
+  std::vector<int> recvdispls(worldsize);
+  std::exclusive_scan(recvcnts.begin(), recvcnts.end(), recvdispls.begin(), 0);
+  std::vector<Point> candidates(rank_ == 0 ? (recvdispls.back() + recvcnts.back()) / 2 : 0);
+  MPI_Gatherv(local_hull.data(), local_count, MPI_DOUBLE, candidates.data(), recvcnts.data(), recvdispls.data(),
+              MPI_DOUBLE, 0, MPI_COMM_WORLD);
 
   if (rank_ == 0) {
-    res_.push_back(procinput_[0]);
-    res_.push_back(procinput_[1]);
-    for (int i = 2; i < points_count_; ++i) {
-      while (res_.size() > 1 && CrossProduct(res_[res_.size() - 2], res_.back(), procinput_[i]) <= 0) {
-        res_.pop_back();
-      }
-      res_.push_back(procinput_[i]);
-    }
+    res_ = ppc::core::hull::ConvexHull<Point>(candidates, backend);
+    // The scan starts from the first of the lowest input points
+    const auto pivot = *std::ranges::min_element(input_, {}, &Point::y);
+    const auto first = std::ranges::find_if(res_, [&](const Point &p) { return ppc::core::hull::SamePoint(p, pivot); });
+    std::ranges::rotate(res_, first);
   }
   return true;
 }
@@ -209,8 +122,8 @@ bool GrahamConvexHullALL::PostProcessingImpl() {
     *reinterpret_cast<int *>(task_data->outputs[0]) = res_points_count;
     auto *p_out = reinterpret_cast<double *>(task_data->outputs[1]);
     for (int i = 0; i < res_points_count; i++) {
-      p_out[2 * i] = res_[i][0];
-      p_out[(2 * i) + 1] = res_[i][1];
+      p_out[2 * i] = res_[i].x;
+      p_out[(2 * i) + 1] = res_[i].y;
     }
   }
   return true;
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "all/sidorina_p_gradient_method/include/ops_all.hpp"
+#include "core/solver/include/cg.hpp"
 #include "core/task/include/task.hpp"
 
 using Params =
@@ -98,4 +99,38 @@ INSTANTIATE_TEST_SUITE_P(SidorinaPGradientMethodAllTestVal, SidorinaPGradientMet
                                            Params(2, {2, 3, 4, 5}, {4, 2, 4}, {0, 0}, {2, 0}, 1e-6)));
 //clang-format on
 
-}  // namespace
\ No newline at end of file
+}  // namespace
+
+TEST(sidorina_p_gradient_method_all, csr_input_with_initial_solution) {
+  const int size = 3;
+  const double tolerance = 1e-10;
+  // {4, -1, 2}, {-1, 6, -2}, {2, -2, 5}
+  std::vector<uint32_t> row_ptr = {0, 3, 6, 9};
+  std::vector<uint32_t> col_idx = {0, 1, 2, 0, 1, 2, 0, 1, 2};
+  std::vector<double> values = {4, -1, 2, -1, 6, -2, 2, -2, 5};
+  std::vector<double> b = {-1, 9, -10};
+  std::vector<double> solution = {-3, 5, 0};
+  std::vector<double> result(size);
+  std::shared_ptr<ppc::core::TaskData> task = std::make_shared<ppc::core::TaskData>();
+  task->inputs.emplace_back(const_cast<uint8_t *>(reinterpret_cast<const uint8_t *>(&size)));
+  task->inputs_count.emplace_back(1);
+  task->inputs.emplace_back(const_cast<uint8_t *>(reinterpret_cast<const uint8_t *>(&tolerance)));
+  task->inputs_count.emplace_back(1);
+  task->AddInput(row_ptr.data(), row_ptr.size());
+  task->AddInput(col_idx.data(), col_idx.size());
+  task->AddInput(values.data(), values.size());
+  task->AddInput(b.data(), b.size());
+  task->AddInput(solution.data(), solution.size());
+  task->AddOutput(result.data(), result.size());
+
+  sidorina_p_gradient_method_all::GradientMethod gradient_method(task);
+  gradient_method.SetSolverOptions({.preconditioner = ppc::core::solver::Preconditioner::kIncompleteCholesky});
+  ASSERT_TRUE(gradient_method.Validation());
+  gradient_method.PreProcessing();
+  gradient_method.Run();
+  gradient_method.PostProcessing();
+  const std::vector<double> expected = {1, 1, -2};
+  for (size_t i = 0; i < expected.size(); i++) {
+    ASSERT_NEAR(result[i], expected[i], 1e-9);
+  }
+}
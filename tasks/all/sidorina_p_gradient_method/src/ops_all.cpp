@@ -1,6 +1,28 @@
 #include "all/sidorina_p_gradient_method/include/ops_all.hpp"
 
+#include <boost/mpi/collectives/broadcast.hpp>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "core/solver/include/cg.hpp"
+#include "core/solver/include/cg_mpi.hpp"
+#include "core/sparse/include/sparse_tbb.hpp"
+
 bool sidorina_p_gradient_method_all::GradientMethod::PreProcessingImpl() {
+  // CSR inputs: row_ptr, col_idx and values at 2..4, b at 5 and the initial solution at 6
+  if (ppc::core::solver::HasCsrInputs(*task_data, 2)) {
+    const size_t csr_end = 2 + ppc::core::solver::kCsrInputsCount;
+    sparse_ = true;
+    size_ = *reinterpret_cast<int*>(task_data->inputs[0]);
+    tolerance_ = *reinterpret_cast<double*>(task_data->inputs[1]);
+    b_.assign(matrix_.Rhs().begin(), matrix_.Rhs().end());
+    const auto solution = task_data->Input<const double>(csr_end + 1);
+    solution_.assign(solution.begin(), solution.end());
+    result_.resize(size_);
+    return true;
+  }
   size_ = *reinterpret_cast<int*>(task_data->inputs[0]);
   tolerance_ = *reinterpret_cast<double*>(task_data->inputs[1]);
   auto* a_ptr = reinterpret_cast<double*>(task_data->inputs[2]);
@@ -13,10 +35,23 @@ bool sidorina_p_gradient_method_all::GradientMethod::PreProcessingImpl() {
   unsigned int solution_size = task_data->inputs_count[4];
   solution_.assign(solution_ptr, solution_ptr + solution_size);
   result_.resize(size_);
+  sparse_ = !ppc::core::solver::IsPlainCg(solver_options_);
+  if (sparse_) {
+    // SolveCg stops on a direction along which A is not positive definite, the O(n^3) Cholesky check is not needed
+    matrix_.LoadDense(a_, size_);
+    return true;
+  }
   return Cholesky(a_, size_, size_);
 }
 
 bool sidorina_p_gradient_method_all::GradientMethod::ValidationImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data, 2)) {
+    const size_t csr_end = 2 + ppc::core::solver::kCsrInputsCount;
+    const int size = *reinterpret_cast<int*>(task_data->inputs[0]);
+    return size > 0 && !task_data->outputs.empty() && task_data->inputs_count.size() > csr_end + 1 &&
+           matrix_.LoadCsrSystem(*task_data, 2) && matrix_.View().rows == static_cast<size_t>(size) &&
+           static_cast<int>(task_data->inputs_count[csr_end + 1]) == size;
+  }
   if (*reinterpret_cast<int*>(task_data->inputs[0]) <= 0 || static_cast<int>(task_data->inputs_count[2]) <= 0 ||
       static_cast<int>(task_data->inputs_count[3]) <= 0 || static_cast<int>(task_data->inputs_count[4]) <= 0) {
     return false;
@@ -46,6 +81,21 @@ bool sidorina_p_gradient_method_all::GradientMethod::ValidationImpl() {
 }
 
 bool sidorina_p_gradient_method_all::GradientMethod::RunImpl() {
+  boost::mpi::broadcast(world_, sparse_, 0);
+  if (sparse_) {
+    ppc::core::solver::CgOptions options = solver_options_;
+    options.tolerance = tolerance_;
+    // The preconditioners are block Jacobi across processes, the blocks being the local rows
+    auto block = ppc::core::solver::ScatterRows(world_, matrix_.View());
+    const ppc::core::solver::MpiRowComm comm(world_, std::move(block.row_counts));
+    const auto local_b = ppc::core::solver::ScatterRows(world_, b_, comm);
+    auto local_x = ppc::core::solver::ScatterRows(world_, solution_, comm);
+    const auto result = ppc::core::solver::SolveCg(ppc::core::solver::View(block.matrix), local_b, local_x, options,
+                                                   ppc::core::sparse::TbbBackend{}, comm);
+    ppc::core::solver::GatherRows(world_, local_x, result_, comm);
+    boost::mpi::broadcast(world_, result_.data(), size_, 0);
+    return result.converged;
+  }
   result_ = ConjugateGradientMethod(world_, a_, b_, solution_, tolerance_, size_);
   return true;
 }
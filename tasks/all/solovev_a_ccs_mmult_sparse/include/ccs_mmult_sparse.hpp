@@ -2,7 +2,6 @@
 
 #include <boost/serialization/access.hpp>
 #include <complex>
-#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -49,37 +48,11 @@ class SeqMatMultCcs : public ppc::core::Task {
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
-  static void ProcessPhase1(SeqMatMultCcs* self, int col, std::vector<int>& available);
-  static void ProcessPhase2(SeqMatMultCcs* self, int col, std::vector<int>& available,
-                            std::vector<std::complex<double>>& cask);
-  static void NotifyCompletion(SeqMatMultCcs* self);
-  static void WorkerLoop(SeqMatMultCcs* self);
 
  private:
   MatrixInCcsSparse *M1_, *M2_;
   MatrixInCcsSparse M3_;
   boost::mpi::communicator world_;
-
-  static void ComputeColumnRange(int rank, int size, int total_cols, int& start_col, int& end_col);
-
-  static void ComputeSequential(
-      const std::vector<int>& col_indices,
-      std::vector<std::vector<std::pair<std::complex<double>, int>>>& column_results, int start_col, int end_col,
-      const std::function<void(int, std::vector<std::pair<std::complex<double>, int>>&)>& func);
-
-  static void ComputeParallel(const std::vector<int>& col_indices,
-                              std::vector<std::vector<std::pair<std::complex<double>, int>>>& column_results,
-                              int start_col, int end_col, int num_threads,
-                              const std::function<void(int, std::vector<std::pair<std::complex<double>, int>>&)>& func);
-
-  void ComputeColumn(int col_idx, std::vector<std::pair<std::complex<double>, int>>& column_data);
-
-  static void FillLocalData(const std::vector<std::vector<std::pair<std::complex<double>, int>>>& column_results,
-                            std::vector<std::complex<double>>& local_val, std::vector<int>& local_row,
-                            std::vector<int>& local_col_p, int& local_n_z);
-
-  static void CountColumns(const std::vector<std::vector<std::pair<std::complex<double>, int>>>& column_results,
-                           std::vector<int>& local_col_counts, int start_col);
 };
 
 }  // namespace solovev_a_matrix_all
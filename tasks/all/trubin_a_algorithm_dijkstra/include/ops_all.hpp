@@ -8,17 +8,11 @@
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/graph.hpp"
 #include "core/task/include/task.hpp"
 
 namespace trubin_a_algorithm_dijkstra_all {
 
-struct Edge {
-  size_t to;
-  int weight;
-
-  Edge(size_t to, int weight) : to(to), weight(weight) {}
-};
-
 class TestTaskALL : public ppc::core::Task {
  public:
   explicit TestTaskALL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -29,7 +23,6 @@ class TestTaskALL : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  bool BuildAdjacencyList(const std::vector<int>& graph_data);
   void RunAlgorithm(boost::mpi::communicator& world, int rank, int size);
 
   void InitializeAtomicDistances(std::vector<std::atomic<int>>& distances_atomic) const;
@@ -38,14 +31,12 @@ class TestTaskALL : public ppc::core::Task {
   void SyncGlobalDistances(boost::mpi::communicator& world, std::vector<std::atomic<int>>& distances_atomic) const;
   void FinalizeDistances(const std::vector<std::atomic<int>>& distances_atomic);
 
-  std::vector<std::vector<Edge>> adjacency_list_;
+  ppc::core::graph::TaskGraph graph_;
   std::vector<int> distances_;
   size_t start_vertex_ = 0;
   size_t num_vertices_ = 0;
 
   bool validation_passed_ = false;
-
-  static constexpr int kEndOfVertexList = -1;
 };
 
 }  // namespace trubin_a_algorithm_dijkstra_all
@@ -10,6 +10,7 @@
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/operations.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <stdexcept>
@@ -22,25 +23,21 @@ bool trubin_a_algorithm_dijkstra_all::TestTaskALL::PreProcessingImpl() {
     return false;
   }
 
-  unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-  std::vector<int> graph_data(in_ptr, in_ptr + input_size);
-
   num_vertices_ = task_data->outputs_count[0];
 
-  if (num_vertices_ == 0 || input_size == 0) {
+  if (num_vertices_ == 0 || task_data->inputs_count[0] == 0) {
     return true;
   }
 
-  adjacency_list_.assign(num_vertices_, {});
   distances_.assign(num_vertices_, std::numeric_limits<int>::max());
 
-  if (!BuildAdjacencyList(graph_data)) {
+  if (!graph_.Load(*task_data, num_vertices_, ppc::core::graph::ParseMode::kStrict)) {
     return false;
   }
 
-  if (task_data->inputs.size() > 1 && task_data->inputs[1] != nullptr) {
-    int* ptr = reinterpret_cast<int*>(task_data->inputs[1]);
+  const size_t start_input = graph_.NextInput();
+  if (task_data->inputs.size() > start_input && task_data->inputs[start_input] != nullptr) {
+    int* ptr = reinterpret_cast<int*>(task_data->inputs[start_input]);
     if (*ptr < 0 || static_cast<size_t>(*ptr) >= num_vertices_) {
       return false;
     }
@@ -131,17 +128,18 @@ void trubin_a_algorithm_dijkstra_all::TestTaskALL::InitializeAtomicDistances(
 void trubin_a_algorithm_dijkstra_all::TestTaskALL::ProcessBlock(const tbb::blocked_range<size_t>& r,
                                                                 std::atomic<bool>& local_changed,
                                                                 std::vector<std::atomic<int>>& distances_atomic) const {
+  const auto graph = graph_.View();
   for (size_t u = r.begin(); u < r.end(); ++u) {
     const int u_dist = distances_atomic[u];
     if (u_dist == std::numeric_limits<int>::max()) {
       continue;
     }
 
-    for (const auto& edge : adjacency_list_[u]) {
-      const int new_dist = u_dist + edge.weight;
-      int old_dist = distances_atomic[edge.to].load();
+    for (std::uint32_t e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+      const int new_dist = u_dist + graph.weights[e];
+      int old_dist = distances_atomic[graph.targets[e]].load();
       while (new_dist < old_dist) {
-        if (distances_atomic[edge.to].compare_exchange_strong(old_dist, new_dist)) {
+        if (distances_atomic[graph.targets[e]].compare_exchange_strong(old_dist, new_dist)) {
           local_changed.store(true, std::memory_order_relaxed);
           break;
         }
@@ -195,35 +193,3 @@ bool trubin_a_algorithm_dijkstra_all::TestTaskALL::PostProcessingImpl() {
   }
   return true;
 }
-
-bool trubin_a_algorithm_dijkstra_all::TestTaskALL::BuildAdjacencyList(const std::vector<int>& graph_data) {
-  size_t current_vertex = 0;
-  size_t i = 0;
-
-  while (i < graph_data.size()) {
-    if (graph_data[i] == kEndOfVertexList) {
-      if (current_vertex >= num_vertices_) {
-        return false;
-      }
-      current_vertex++;
-      i++;
-      continue;
-    }
-
-    if (i + 1 >= graph_data.size()) {
-      return false;
-    }
-
-    auto to = static_cast<size_t>(graph_data[i]);
-    int weight = graph_data[i + 1];
-
-    if (to >= num_vertices_ || weight < 0) {
-      return false;
-    }
-
-    adjacency_list_[current_vertex].emplace_back(to, weight);
-    i += 2;
-  }
-
-  return true;
-}
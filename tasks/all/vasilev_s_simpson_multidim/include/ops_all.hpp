@@ -6,12 +6,15 @@
 #include <utility>
 #include <vector>
 
+#include "core/integrate/include/integrate.hpp"
 #include "core/task/include/task.hpp"
 
 namespace vasilev_s_simpson_multidim {
 
 using Coordinate = std::span<double>;
 using IntegrandFunction = double (*)(const Coordinate&);
+// Optional fourth input: evaluates blocks of points in SoA layout, used instead of the IntegrandFunction
+using BatchIntegrandFunction = ppc::core::integrate::BatchIntegrand;
 
 struct Bound {
   double lo, hi;
@@ -37,12 +40,15 @@ class SimpsonTaskAll : public ppc::core::Task {
   boost::mpi::communicator world_;
 
   IntegrandFunction func_;
+  BatchIntegrandFunction batch_func_ = nullptr;
   std::size_t arity_;
   std::size_t approxs_;
   std::vector<Bound> bounds_;
 
   std::size_t gridcap_;
   std::vector<double> steps_;
+  // Simpson nodes and weights of every axis
+  std::vector<ppc::core::integrate::GridAxis> axes_;
   double scale_;
 
   double result_;
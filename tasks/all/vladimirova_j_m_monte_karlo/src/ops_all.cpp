@@ -6,19 +6,29 @@
 #include <cmath>
 #include <cstddef>
 #include <functional>
-#include <random>
 #include <thread>
 #include <vector>
 
+#include "core/random/include/philox.hpp"
 #include "core/util/include/util.hpp"
 
 namespace {
 
-thread_local std::mt19937 gen(std::random_device{}());
-
-double CreateRandomVal(double min_v, double max_v) {
-  std::uniform_real_distribution<double> dis(min_v, max_v);
-  return dis(gen);
+// Number of samples [first, last) of the sequence fixed by the default seed at which func holds;
+// sample i takes the uniforms [i * bounds.size(), (i + 1) * bounds.size()) of the sequence
+size_t CountHits(bool (*func)(std::vector<double>, size_t),
+                 const std::vector<vladimirova_j_m_monte_karlo_all::BoundariesIntegral> &bounds, size_t first,
+                 size_t last) {
+  auto gen = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, bounds.size());
+  std::vector<double> random_val(bounds.size());
+  size_t hits = 0;
+  for (size_t i = first; i < last; i++) {
+    for (size_t j = 0; j < bounds.size(); j++) {
+      random_val[j] = gen.Uniform(bounds[j].min, bounds[j].max);
+    }
+    hits += static_cast<size_t>(func(random_val, bounds.size()));
+  }
+  return hits;
 }
 
 }  // namespace
@@ -63,36 +73,27 @@ bool vladimirova_j_m_monte_karlo_all::TestTaskALL::RunImpl() {
 
   size_t successful_point = 0;
   size_t local_accuracy = accuracy_ / world_.size();
+  // processes and threads take consecutive ranges of one sample sequence, rank 0 and thread 0 the remainders
+  size_t local_first = 0;
   if (world_.rank() == 0) {
     local_accuracy += accuracy_ % world_.size();
+  } else {
+    local_first = (world_.rank() * local_accuracy) + (accuracy_ % world_.size());
   }
   size_t chank = var_size_ / world_.size();
   size_t global_successful_point = 0;
   double global_s = 1;
 
-  std::vector<double> random_val = std::vector<double>(var_size_);
-
   std::vector<std::thread> threads(count_t);
   std::vector<size_t> local_res(count_t, 0);
 
   size_t dl = local_accuracy / count_t;
 
-  for (size_t i = 1; i < count_t; i++) {
-    local_res[i] = dl;
-  }
-  local_res[0] = dl + (local_accuracy % count_t);
-
   for (size_t t = 0; t < count_t; t++) {
     threads[t] = std::thread([&, t]() {
-      std::vector<double> random_val = std::vector<double>(var_size_);
-      size_t n = local_res[t];
-      local_res[t] = 0;
-      for (size_t i = 0; i < n; i++) {
-        for (size_t j = 0; j < var_size_; j++) {
-          random_val[j] = CreateRandomVal(var_integr_[j].min, var_integr_[j].max);
-        }
-        local_res[t] += (int)(func_(random_val, var_size_));
-      }
+      const size_t first = local_first + (t == 0 ? 0 : (t * dl) + (local_accuracy % count_t));
+      const size_t n = dl + (t == 0 ? local_accuracy % count_t : 0);
+      local_res[t] = CountHits(func_, var_integr_, first, first + n);
     });
   }
 
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "all/zolotareva_a_SLE_gradient_method/include/ops_seq.hpp"
+#include "core/solver/include/cg.hpp"
 #include "core/task/include/task.hpp"
 
 void zolotareva_a_sle_gradient_method_all::GenerateSle(std::vector<double> &a, std::vector<double> &b, int n) {
@@ -29,7 +30,7 @@ void zolotareva_a_sle_gradient_method_all::GenerateSle(std::vector<double> &a, s
 }
 
 namespace {
-void Form(int n) {
+void Form(int n, const ppc::core::solver::CgOptions &options = {}) {
   boost::mpi::communicator world;
   std::vector<double> a(n * n);
   std::vector<double> b(n);
@@ -45,6 +46,7 @@ void Form(int n) {
     task_data_seq->outputs_count.push_back(x.size());
   }
   zolotareva_a_sle_gradient_method_all::TestTaskALL task(task_data_seq);
+  task.SetSolverOptions(options);
   ASSERT_EQ(task.ValidationImpl(), true);
   task.PreProcessingImpl();
   task.RunImpl();
@@ -290,3 +292,10 @@ TEST(zolotareva_a_sle_gradient_method_all, Test_Image_random_n_3) { Form(3); };
 TEST(zolotareva_a_sle_gradient_method_all, Test_Image_random_n_10) { Form(5); };
 TEST(zolotareva_a_sle_gradient_method_all, Test_Image_random_n_200) { Form(200); };
 TEST(zolotareva_a_sle_gradient_method_all, Test_Image_random_n_591) { Form(591); };
+TEST(zolotareva_a_sle_gradient_method_all, Test_Image_random_n_200_jacobi_mixed) {
+  Form(200, {.preconditioner = ppc::core::solver::Preconditioner::kJacobi,
+             .precision = ppc::core::solver::Precision::kMixed});
+}
+TEST(zolotareva_a_sle_gradient_method_all, Test_Image_random_n_200_incomplete_cholesky) {
+  Form(200, {.preconditioner = ppc::core::solver::Preconditioner::kIncompleteCholesky});
+}
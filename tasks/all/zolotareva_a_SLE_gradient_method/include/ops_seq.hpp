@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
 #include "core/task/include/task.hpp"
 
 namespace zolotareva_a_sle_gradient_method_all {
@@ -16,6 +17,9 @@ class TestTaskALL : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  // Options other than the defaults (see IsPlainCg) solve a dense A with the sparse solver too; set on
+  // every process
+  void SetSolverOptions(const ppc::core::solver::CgOptions& options) { solver_options_ = options; }
   inline static bool IsPositiveAndSimm(const double* a, int n);
   inline void DistributeData(int world_size, int base_rows);
   inline void CalculateIterations(double threshold, std::vector<double>& p, std::vector<double>& global_p,
@@ -23,6 +27,10 @@ class TestTaskALL : public ppc::core::Task {
                                   std::vector<int>& displs, std::vector<double>& ap);
 
  private:
+  // Scatters blocks of rows with about equal numbers of nonzeros and solves with SolveCg over MPI, false if it
+  // did not converge
+  bool RunSparse();
+
   std::vector<double> a_;
   std::vector<double> b_;
   std::vector<double> x_;
@@ -32,6 +40,10 @@ class TestTaskALL : public ppc::core::Task {
   int n_{0};
   int local_rows_{0};
   boost::mpi::communicator world_;
+  // CSR inputs (row_ptr, col_idx, values, b) or solver options other than plain CG
+  bool sparse_ = false;
+  ppc::core::solver::TaskMatrix matrix_;  // Whole matrix, on rank 0
+  ppc::core::solver::CgOptions solver_options_;
 };
 
 }  // namespace zolotareva_a_sle_gradient_method_all
\ No newline at end of file
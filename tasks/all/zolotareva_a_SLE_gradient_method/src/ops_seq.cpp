@@ -7,11 +7,23 @@
 #include <boost/mpi/collectives/all_reduce.hpp>
 #include <boost/mpi/collectives/broadcast.hpp>
 #include <cmath>
+#include <cstddef>
 #include <functional>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
+#include "core/solver/include/cg_mpi.hpp"
+#include "core/sparse/include/sparse_omp.hpp"
+
 bool zolotareva_a_sle_gradient_method_all::TestTaskALL::PreProcessingImpl() {
+  if (world_.rank() == 0 && ppc::core::solver::HasCsrInputs(*task_data)) {
+    sparse_ = true;
+    n_ = static_cast<int>(matrix_.View().rows);
+    b_.assign(matrix_.Rhs().begin(), matrix_.Rhs().end());
+    return true;
+  }
   if (world_.rank() == 0) {
     n_ = static_cast<int>(task_data->inputs_count[1]);
     const auto* input_matrix = reinterpret_cast<const double*>(task_data->inputs[0]);
@@ -25,11 +37,20 @@ bool zolotareva_a_sle_gradient_method_all::TestTaskALL::PreProcessingImpl() {
         a_[(i * n_) + j] = input_matrix[(i * n_) + j];
       }
     }
+
+    sparse_ = !ppc::core::solver::IsPlainCg(solver_options_);
+    if (sparse_) {
+      matrix_.LoadDense(a_, n_);
+    }
   }
   return true;
 }
 
 bool zolotareva_a_sle_gradient_method_all::TestTaskALL::ValidationImpl() {
+  // CSR inputs skip the dense symmetry and Cholesky checks, which cost O(n^3)
+  if (world_.rank() == 0 && ppc::core::solver::HasCsrInputs(*task_data)) {
+    return !task_data->outputs.empty() && matrix_.LoadCsrSystem(*task_data);
+  }
   if (world_.rank() == 0) {
     if (static_cast<int>(task_data->inputs_count[0]) < 0 || static_cast<int>(task_data->inputs_count[1]) < 0 ||
         static_cast<int>(task_data->outputs_count[0]) < 0) {
@@ -56,6 +77,11 @@ bool zolotareva_a_sle_gradient_method_all::TestTaskALL::ValidationImpl() {
 }
 
 bool zolotareva_a_sle_gradient_method_all::TestTaskALL::RunImpl() {
+  boost::mpi::broadcast(world_, sparse_, 0);
+  if (sparse_) {
+    return RunSparse();
+  }
+
   int world_size = world_.size();
   int rank = world_.rank();
 
@@ -132,6 +158,21 @@ bool zolotareva_a_sle_gradient_method_all::TestTaskALL::PostProcessingImpl() {
   return true;
 }
 
+bool zolotareva_a_sle_gradient_method_all::TestTaskALL::RunSparse() {
+  auto block = ppc::core::solver::ScatterRows(world_, matrix_.View());
+  const ppc::core::solver::MpiRowComm comm(world_, std::move(block.row_counts));
+  local_b_ = ppc::core::solver::ScatterRows(world_, b_, comm);
+  local_x_.assign(block.matrix.rows, 0.0);
+  // The preconditioners are block Jacobi across processes, the blocks being the local rows
+  const auto result = ppc::core::solver::SolveCg(ppc::core::solver::View(block.matrix), local_b_, local_x_,
+                                                 solver_options_, ppc::core::sparse::OmpBackend{}, comm);
+  if (world_.rank() == 0) {
+    x_.resize(block.matrix.cols);
+  }
+  ppc::core::solver::GatherRows(world_, local_x_, x_, comm);
+  return result.converged;
+}
+
 void zolotareva_a_sle_gradient_method_all::TestTaskALL::DistributeData(int world_size, int base_rows) {
   int start_row = local_rows_;
   for (int proc = 1; proc < world_size; ++proc) {
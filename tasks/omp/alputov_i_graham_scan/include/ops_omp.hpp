@@ -1,7 +1,5 @@
 #pragma once
 
-#include <omp.h>
-
 #include <utility>
 #include <vector>
 
@@ -30,12 +28,6 @@ class TestTaskOMP : public ppc::core::Task {
  private:
   std::vector<Point> input_points_;
   std::vector<Point> convex_hull_;
-
-  [[nodiscard]] Point FindPivot() const;
-  [[nodiscard]] std::vector<Point> SortPoints(const Point& pivot) const;
-  [[nodiscard]] std::vector<Point> BuildHull(const std::vector<Point>& sorted_points) const;
-
-  static double Cross(const Point& o, const Point& a, const Point& b);
 };
 
 }  // namespace alputov_i_graham_scan_omp
\ No newline at end of file
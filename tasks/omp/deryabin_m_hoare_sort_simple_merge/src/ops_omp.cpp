@@ -1,11 +1,15 @@
 #include "omp/deryabin_m_hoare_sort_simple_merge/include/ops_omp.hpp"
 
+#include <omp.h>
+
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <numbers>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+
 void deryabin_m_hoare_sort_simple_merge_omp::HoaraSort(std::vector<double>& a, size_t first, size_t last) {
   size_t i = first;
   size_t j = last;
@@ -114,24 +118,26 @@ bool deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskOpenMP::ValidationImpl
 }
 
 bool deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskOpenMP::RunImpl() {
-  auto chunk_count = (short)chunk_count_;
-#pragma omp parallel for
-  for (short count = 0; count < chunk_count; count++) {
-    HoaraSort(input_array_A_, count * (short)min_chunk_size_, ((count + 1) * (short)min_chunk_size_) - 1);
+  const auto chunk_count = static_cast<int>(chunk_count_);
+  std::vector<size_t> bounds(chunk_count_ + 1);
+  for (size_t count = 0; count <= chunk_count_; count++) {
+    bounds[count] = count * dimension_ / chunk_count_;
   }
-#pragma omp barrier
-#pragma omp parallel for ordered
-  for (short i = 0; i < (short)(log((double)chunk_count_) / std::numbers::ln2); i++) {
-#pragma omp ordered
-    {
-      for (short j = 0; j < chunk_count; j++) {
-        MergeTwoParts(input_array_A_, j * (short)min_chunk_size_ << (i + 1),
-                      ((j + 1) * (short)min_chunk_size_ << (i + 1)) - 1, dimension_);
-        chunk_count--;
-      }
+#pragma omp parallel for
+  for (int count = 0; count < chunk_count; count++) {
+    if (bounds[count] < bounds[count + 1]) {
+      HoaraSort(input_array_A_, bounds[count], bounds[count + 1] - 1);
     }
   }
-#pragma omp barrier
+
+  const auto runs = ppc::core::MakeRuns<double>(input_array_A_, bounds);
+  std::vector<double> merged(dimension_);
+  const int parts = std::max(1, std::min(omp_get_max_threads(), static_cast<int>(dimension_)));
+#pragma omp parallel for
+  for (int part = 0; part < parts; part++) {
+    ppc::core::MultiwayMergePart<double>(runs, merged, part, parts);
+  }
+  input_array_A_.swap(merged);
   return true;
 }
 
@@ -5,6 +5,8 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 bool filatev_v_foks_omp::Focks::PreProcessingImpl() {
   size_block_ = task_data->inputs_count[4];
   size_a_.n = task_data->inputs_count[0];
@@ -49,32 +51,17 @@ bool filatev_v_foks_omp::Focks::RunImpl() {
 
   int grid_size = (int)(size_ / size_block_);
 
+  // Every thread owns whole blocks of C and accumulates all Fox steps for them, so no synchronization is needed
 #pragma omp parallel for
-  for (int step_i_j = 0; step_i_j < grid_size * grid_size * grid_size; ++step_i_j) {
-    int step = step_i_j / (grid_size * grid_size);
-    int i = (step_i_j % (grid_size * grid_size)) / grid_size;
-    int j = step_i_j % grid_size;
-
-    size_t root = (i + step) % grid_size;
-    std::vector<double> local_block(size_block_ * size_block_, 0);
-
-    for (size_t bi = 0; bi < size_block_; ++bi) {
-      for (size_t bj = 0; bj < size_block_; ++bj) {
-        for (size_t bk = 0; bk < size_block_; ++bk) {
-          local_block[(bi * size_block_) + bj] +=
-              matrix_a_[((i * size_block_ + bi) * size_) + (root * size_block_) + bk] *
-              matrix_b_[((root * size_block_ + bk) * size_) + (j * size_block_) + bj];
-        }
-      }
-    }
-
-#pragma omp critical
-    {
-      for (size_t bi = 0; bi < size_block_; ++bi) {
-        for (size_t bj = 0; bj < size_block_; ++bj) {
-          matrix_c_[((i * size_block_ + bi) * size_) + (j * size_block_) + bj] += local_block[(bi * size_block_) + bj];
-        }
-      }
+  for (int i_j = 0; i_j < grid_size * grid_size; ++i_j) {
+    size_t i = i_j / grid_size;
+    size_t j = i_j % grid_size;
+    for (int step = 0; step < grid_size; ++step) {
+      size_t root = (i + step) % grid_size;
+      const double *block_a = &matrix_a_[(i * size_block_ * size_) + (root * size_block_)];
+      const double *block_b = &matrix_b_[(root * size_block_ * size_) + (j * size_block_)];
+      double *block_c = &matrix_c_[(i * size_block_ * size_) + (j * size_block_)];
+      ppc::core::Gemm(size_block_, size_block_, size_block_, block_a, size_, block_b, size_, block_c, size_);
     }
   }
 
@@ -3,8 +3,13 @@
 #include <omp.h>
 
 #include <cmath>
+#include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
+#include "core/sparse/include/sparse_omp.hpp"
+
 double fomin_v_conjugate_gradient::FominVConjugateGradientOmp::DotProduct(const std::vector<double>& a,
                                                                           const std::vector<double>& b) {
   double result = 0.0;
@@ -60,6 +65,13 @@ std::vector<double> fomin_v_conjugate_gradient::FominVConjugateGradientOmp::Vect
 }
 
 bool fomin_v_conjugate_gradient::FominVConjugateGradientOmp::PreProcessingImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    sparse_ = true;
+    n = static_cast<int>(matrix_.View().rows);
+    b_.assign(matrix_.Rhs().begin(), matrix_.Rhs().end());
+    output_.resize(n, 0.0);
+    return true;
+  }
   unsigned int input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
   std::vector<double> input(in_ptr, in_ptr + input_size);
@@ -69,10 +81,17 @@ bool fomin_v_conjugate_gradient::FominVConjugateGradientOmp::PreProcessingImpl()
   b_ = std::vector<double>(input.begin() + (n * n), input.end());
   output_.resize(n, 0.0);
 
+  sparse_ = !ppc::core::solver::IsPlainCg(solver_options_);
+  if (sparse_) {
+    matrix_.LoadDense(a_, n);
+  }
   return true;
 }
 
 bool fomin_v_conjugate_gradient::FominVConjugateGradientOmp::ValidationImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    return matrix_.LoadCsrSystem(*task_data);
+  }
   unsigned int input_size = task_data->inputs_count[0];
   const int calculated_n = static_cast<int>((-1.0 + std::sqrt(1 + (4 * input_size))) / 2);
   return (static_cast<unsigned int>(calculated_n * (calculated_n + 1)) == input_size) &&
@@ -80,6 +99,12 @@ bool fomin_v_conjugate_gradient::FominVConjugateGradientOmp::ValidationImpl() {
 }
 
 bool fomin_v_conjugate_gradient::FominVConjugateGradientOmp::RunImpl() {
+  if (sparse_) {
+    output_.assign(n, 0.0);
+    const auto result =
+        ppc::core::solver::SolveCg(matrix_.View(), b_, output_, solver_options_, ppc::core::sparse::OmpBackend{});
+    return result.converged;
+  }
   const double epsilon = 1e-6;
   const int max_iter = 1000;
   std::vector<double> x(n, 0.0);
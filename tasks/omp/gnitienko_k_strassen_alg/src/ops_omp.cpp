@@ -2,11 +2,19 @@
 
 #include <omp.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
+namespace {
+// Rows of a leaf product computed by one GEMM call
+constexpr int kLeafRowsPerThread = 32;
+}  // namespace
+
 bool gnitienko_k_strassen_algorithm_omp::StrassenAlgOpenMP::PreProcessingImpl() {
   size_t input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
@@ -65,14 +73,13 @@ void gnitienko_k_strassen_algorithm_omp::StrassenAlgOpenMP::SubMatrix(const std:
 void gnitienko_k_strassen_algorithm_omp::StrassenAlgOpenMP::TrivialMultiply(const std::vector<double>& a,
                                                                             const std::vector<double>& b,
                                                                             std::vector<double>& c, int size) {
+  const auto n = static_cast<size_t>(size);
+  std::fill_n(c.begin(), n * n, 0.0);
 #pragma omp parallel for schedule(static)
-  for (int i = 0; i < size; ++i) {
-    for (int j = 0; j < size; ++j) {
-      c[(i * size) + j] = 0;
-      for (int k = 0; k < size; ++k) {
-        c[(i * size) + j] += a[(i * size) + k] * b[(k * size) + j];
-      }
-    }
+  for (int i = 0; i < size; i += kLeafRowsPerThread) {
+    const auto row = static_cast<size_t>(i);
+    const size_t rows = std::min<size_t>(kLeafRowsPerThread, n - row);
+    ppc::core::Gemm(rows, n, n, &a[row * n], n, b.data(), n, &c[row * n], n);
   }
 }
 
@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 bool gromov_a_fox_algorithm_omp::TestTaskOpenMP::PreProcessingImpl() {
   unsigned int input_size = task_data->inputs_count[0];
   if (input_size % 2 != 0) {
@@ -24,8 +27,10 @@ bool gromov_a_fox_algorithm_omp::TestTaskOpenMP::PreProcessingImpl() {
     return false;
   }
 
-  block_size_ = n_ / 2;
-  for (int i = 1; i <= n_; ++i) {
+  // Largest divisor of n_ which fits one packed GEMM panel, so every stage is a single panel update
+  constexpr int kMaxBlockSize = 256;
+  block_size_ = 0;
+  for (int i = std::min(n_, kMaxBlockSize); i >= 1; --i) {
     if (n_ % i == 0) {
       block_size_ = i;
       break;
@@ -45,27 +50,19 @@ bool gromov_a_fox_algorithm_omp::TestTaskOpenMP::ValidationImpl() {
 }
 
 bool gromov_a_fox_algorithm_omp::TestTaskOpenMP::RunImpl() {
-  int num_blocks = (n_ + block_size_ - 1) / block_size_;
-
-  std::vector<double>& a_ref = A_;
-  std::vector<double>& b_ref = B_;
-  std::vector<double>& output_ref = output_;
-  int n_ref = n_;
-  int block_size_ref = block_size_;
+  const int num_blocks = (n_ + block_size_ - 1) / block_size_;
+  const auto n = static_cast<size_t>(n_);
+  const auto bs = static_cast<size_t>(block_size_);
 
+  // Stage s multiplies the s-th block column of A by the s-th block row of B, every thread owns a block row of C
   for (int stage = 0; stage < num_blocks; ++stage) {
-#pragma omp parallel for default(none) shared(a_ref, b_ref, output_ref, n_ref, block_size_ref, stage)
-    for (int i = 0; i < n_ref; i += block_size_ref) {
-      for (int j = 0; j < n_ref; j += block_size_ref) {
-        for (int bi = i; bi < i + block_size_ref && bi < n_ref; ++bi) {
-          for (int bj = j; bj < j + block_size_ref && bj < n_ref; ++bj) {
-            int start_k = stage * block_size_ref;
-            for (int bk = start_k; bk < std::min((stage + 1) * block_size_ref, n_ref); ++bk) {
-              output_ref[(bi * n_ref) + bj] += a_ref[(bi * n_ref) + bk] * b_ref[(bk * n_ref) + bj];
-            }
-          }
-        }
-      }
+    const size_t k_begin = stage * bs;
+    const size_t k_size = std::min(bs, n - k_begin);
+#pragma omp parallel for
+    for (int i = 0; i < num_blocks; ++i) {
+      const size_t row = i * bs;
+      ppc::core::Gemm(std::min(bs, n - row), n, k_size, &A_[(row * n) + k_begin], n, &B_[k_begin * n], n,
+                      &output_[row * n], n);
     }
   }
   return true;
@@ -4,9 +4,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+
 std::vector<unsigned int> kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP::CalculationOfGapLengths(
     unsigned int size) {
   std::vector<unsigned int> result;
@@ -39,28 +42,6 @@ void kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP::ShellSort(unsigne
   }
 }
 
-void kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP::SimpleMergeSort(unsigned int left, unsigned int middle,
-                                                                               unsigned int right) {
-  std::vector<int> first_part(middle - left);
-  std::copy(output_.begin() + left, output_.begin() + middle, first_part.begin());
-  unsigned int l = 0;
-  unsigned int r = middle;
-  unsigned int j = left;
-  for (; (l < first_part.size()) && (r < right); j++) {
-    if (first_part[l] < output_[r]) {
-      output_[j] = first_part[l++];
-    } else {
-      output_[j] = output_[r++];
-    }
-  }
-  while (l < first_part.size()) {
-    output_[j++] = first_part[l++];
-  }
-  while (r < right) {
-    output_[j++] = output_[r++];
-  }
-}
-
 bool kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP::PreProcessingImpl() {
   input_ = std::vector<int>(task_data->inputs_count[0]);
   auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
@@ -95,21 +76,20 @@ bool kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP::RunImpl() {
   for (int i = 0; i < static_cast<int>(num); i++) {
     ShellSort(bounds[i].first, bounds[i].second);
   }
-  num = std::ceil(static_cast<double>(num) / 2);
-  unsigned int step = 1;
-  while (step < bounds.size()) {
-    step *= 2;
+
+  std::vector<size_t> run_bounds;
+  for (const auto &bound : bounds) {
+    run_bounds.push_back(bound.first);
+  }
+  run_bounds.push_back(output_.size());
+  const auto runs = ppc::core::MakeRuns<int>(output_, run_bounds);
+  std::vector<int> merged(output_.size());
+  const int parts = static_cast<int>(bounds.size());
 #pragma omp parallel for schedule(static)
-    for (int i = 0; i < static_cast<int>(num); i++) {
-      unsigned int middle = (step / 2) + (step * i);
-      if (middle < bounds.size()) {
-        SimpleMergeSort(
-            bounds[i * step].first, bounds[middle].first,
-            bounds[(bounds.size() - 1 < (i + 1) * step - 1) ? bounds.size() - 1 : ((i + 1) * step) - 1].second);
-      }
-    }
-    num = std::ceil(static_cast<double>(num) / 2);
+  for (int i = 0; i < parts; i++) {
+    ppc::core::MultiwayMergePart<int>(runs, merged, i, parts);
   }
+  output_.swap(merged);
   return true;
 }
 
@@ -2,9 +2,20 @@
 
 #include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
+#include "core/sparse/include/sparse_omp.hpp"
+
 bool karaseva_e_congrad_omp::TestTaskOpenMP::PreProcessingImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    sparse_ = true;
+    size_ = matrix_.View().rows;
+    b_.assign(matrix_.Rhs().begin(), matrix_.Rhs().end());
+    x_ = std::vector<double>(size_, 0.0);
+    return true;
+  }
   // Read input dimensions and copy data from task_data to internal buffers
   size_ = task_data->inputs_count[1];
   auto* a_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
@@ -15,10 +26,17 @@ bool karaseva_e_congrad_omp::TestTaskOpenMP::PreProcessingImpl() {
   b_ = std::vector<double>(b_ptr, b_ptr + size_);
   x_ = std::vector<double>(size_, 0.0);  // Initial solution guess
 
+  sparse_ = !ppc::core::solver::IsPlainCg(solver_options_);
+  if (sparse_) {
+    matrix_.LoadDense(A_, size_);
+  }
   return true;
 }
 
 bool karaseva_e_congrad_omp::TestTaskOpenMP::ValidationImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    return matrix_.LoadCsrSystem(*task_data);
+  }
   // Verify that input matrix is square (N x N) and output has correct size (N)
   const bool valid_input = task_data->inputs_count[0] == task_data->inputs_count[1] * task_data->inputs_count[1];
   const bool valid_output = task_data->outputs_count[0] == task_data->inputs_count[1];
@@ -26,6 +44,11 @@ bool karaseva_e_congrad_omp::TestTaskOpenMP::ValidationImpl() {
 }
 
 bool karaseva_e_congrad_omp::TestTaskOpenMP::RunImpl() {
+  if (sparse_) {
+    const auto result =
+        ppc::core::solver::SolveCg(matrix_.View(), b_, x_, solver_options_, ppc::core::sparse::OmpBackend{});
+    return result.converged;
+  }
   // Conjugate gradient working vectors
   std::vector<double> r(size_);   // Residual
   std::vector<double> p(size_);   // Search direction
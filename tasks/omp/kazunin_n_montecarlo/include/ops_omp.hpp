@@ -4,11 +4,10 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <numeric>
-#include <random>
 #include <utility>
 
+#include "core/random/include/philox.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kazunin_n_montecarlo_omp {
@@ -26,24 +25,19 @@ class MonteCarloOmp : public ppc::core::Task {
   bool PreProcessingImpl() override {
     precision_ = *reinterpret_cast<std::size_t*>(task_data->inputs[0]);
     limits_ = *reinterpret_cast<decltype(limits_)*>(task_data->inputs[1]);
-    std::ranges::generate(generators_, [&, i = 0]() mutable { return MakeGenerator(limits_[i++]); });
     total_space_ = std::accumulate(
         limits_.begin(), limits_.end(), 1.0,
         [](const double acc, const std::pair<double, double>& limit) { return acc * (limit.second - limit.first); });
     return true;
   }
   bool RunImpl() override {
-    double sum = 0.0;
+    const auto precision = static_cast<int64_t>(precision_);
+    constexpr int64_t kChunk = 1024;
 
-#pragma omp parallel
-    {
-      std::array<double, N> random_args;
-      const auto generators = generators_;
-#pragma omp for reduction(+ : sum)
-      for (int64_t iter = 0; iter < static_cast<int64_t>(precision_); ++iter) {
-        std::ranges::generate(random_args, [&generators, j = 0]() mutable { return generators[j++](); });
-        sum += f_(random_args);
-      }
+    double sum = 0.0;
+#pragma omp parallel for schedule(dynamic) reduction(+ : sum)
+    for (int64_t first = 0; first < precision; first += kChunk) {
+      sum += SampleSum(first, std::min(first + kChunk, precision));
     }
 
     result_ = (total_space_ * sum) / precision_;
@@ -55,18 +49,24 @@ class MonteCarloOmp : public ppc::core::Task {
   }
 
  private:
-  std::function<double()> MakeGenerator(const std::pair<double, double>& interval) {
-    std::uniform_real_distribution<double> distrib(interval.first, interval.second);
-    std::mt19937 engine(seedgen_());
-    return [distrib, engine]() mutable { return distrib(engine); };
+  // Sum of f_ over samples [first, last) of one fixed sequence: every chunk jumps to its own samples
+  double SampleSum(std::size_t first, std::size_t last) const {
+    auto gen = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, N);
+    std::array<double, N> random_args;
+    double sum = 0.0;
+    for (std::size_t iter = first; iter < last; ++iter) {
+      for (std::size_t j = 0; j < N; ++j) {
+        random_args[j] = gen.Uniform(limits_[j].first, limits_[j].second);
+      }
+      sum += f_(random_args);
+    }
+    return sum;
   }
 
   F f_;
   std::size_t precision_;
   double total_space_;
   std::array<std::pair<double, double>, N> limits_;
-  std::array<std::function<double()>, N> generators_;
-  std::random_device seedgen_;
   double result_;
 };
 
@@ -87,22 +87,13 @@ class MonteCarloSeq : public ppc::core::Task {
   bool PreProcessingImpl() override {
     precision_ = *reinterpret_cast<std::size_t*>(task_data->inputs[0]);
     limits_ = *reinterpret_cast<decltype(limits_)*>(task_data->inputs[1]);
-    std::ranges::generate(generators_, [&, i = 0]() mutable { return MakeGenerator(limits_[i++]); });
     total_space_ = std::accumulate(
         limits_.begin(), limits_.end(), 1.0,
         [](const double acc, const std::pair<double, double>& limit) { return acc * (limit.second - limit.first); });
     return true;
   }
   bool RunImpl() override {
-    double sum = 0.0;
-
-    std::array<double, N> random_args;
-    for (std::size_t iter = 0; iter < precision_; ++iter) {
-      std::ranges::generate(random_args, [this, j = 0]() mutable { return generators_[j++](); });
-      sum += f_(random_args);
-    }
-
-    result_ = (total_space_ * sum) / precision_;
+    result_ = (total_space_ * SampleSum(0, precision_)) / precision_;
     return true;
   }
   bool PostProcessingImpl() override {
@@ -111,18 +102,24 @@ class MonteCarloSeq : public ppc::core::Task {
   }
 
  private:
-  std::function<double()> MakeGenerator(const std::pair<double, double>& interval) {
-    std::uniform_real_distribution<double> distrib(interval.first, interval.second);
-    std::mt19937 engine(seedgen_());
-    return [distrib, engine]() mutable { return distrib(engine); };
+  // Sum of f_ over samples [first, last) of one fixed sequence: every chunk jumps to its own samples
+  double SampleSum(std::size_t first, std::size_t last) const {
+    auto gen = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, N);
+    std::array<double, N> random_args;
+    double sum = 0.0;
+    for (std::size_t iter = first; iter < last; ++iter) {
+      for (std::size_t j = 0; j < N; ++j) {
+        random_args[j] = gen.Uniform(limits_[j].first, limits_[j].second);
+      }
+      sum += f_(random_args);
+    }
+    return sum;
   }
 
   F f_;
   std::size_t precision_;
   double total_space_;
   std::array<std::pair<double, double>, N> limits_;
-  std::array<std::function<double()>, N> generators_;
-  std::random_device seedgen_;
   double result_;
 };
 
@@ -9,6 +9,8 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse_omp.hpp"
+
 void kolodkin_g_multiplication_matrix_omp::SparseMatrixCRS::AddValue(int row, Complex value, int col) {
   bool found = false;
   for (int j = rowPtr[row]; j < rowPtr[row + 1]; j++) {
@@ -144,33 +146,17 @@ bool kolodkin_g_multiplication_matrix_omp::TestTaskOpenMP::ValidationImpl() {
 }
 
 bool kolodkin_g_multiplication_matrix_omp::TestTaskOpenMP::RunImpl() {
-  SparseMatrixCRS c(A_.numRows, B_.numCols);
-  std::vector<std::vector<std::pair<unsigned int, Complex>>> local_results(A_.numRows);
-
-#pragma omp parallel for
-  for (int i = 0; i < A_.numRows; i++) {
-    std::vector<std::pair<unsigned int, Complex>> temp_results;
-
-    for (int j = A_.rowPtr[i]; j < A_.rowPtr[i + 1]; j++) {
-      unsigned int col_a = A_.colIndices[j];
-      Complex value_a = A_.values[j];
-
-      for (int k = B_.rowPtr[col_a]; k < B_.rowPtr[col_a + 1]; k++) {
-        unsigned int col_b = B_.colIndices[k];
-        Complex value_b = B_.values[k];
-
-        temp_results.emplace_back(col_b, value_a * value_b);
-      }
-    }
-    local_results[i] = std::move(temp_results);
-  }
-
-  for (int i = 0; i < A_.numRows; i++) {
-    for (const auto& result : local_results[i]) {
-      c.AddValue(i, result.second, (int)result.first);
-    }
-  }
+  using View = ppc::core::sparse::CsrView<Complex, int>;
+  const auto view = [](const SparseMatrixCRS& m) {
+    return View{.rows = static_cast<size_t>(m.numRows), .cols = static_cast<size_t>(m.numCols), .row_ptr = m.rowPtr,
+                .col_idx = m.colIndices, .values = m.values};
+  };
+  auto product = ppc::core::sparse::SpGemm(view(A_), view(B_), ppc::core::sparse::OmpBackend{});
 
+  SparseMatrixCRS c(A_.numRows, B_.numCols);
+  c.rowPtr = std::move(product.row_ptr);
+  c.colIndices = std::move(product.col_idx);
+  c.values = std::move(product.values);
   output_ = ParseMatrixIntoVec(c);
   return true;
 }
@@ -13,6 +13,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
 #include "core/util/include/util.hpp"
 
 namespace {
@@ -107,33 +108,15 @@ bool koshkin_m_radix_int_simple_merge::OmpT::RunImpl() {
     blocks[i] = RadixIntegerSort(blocks[i]);
   }
 
-  for (std::size_t blcnt = blocks.size(), dx = 1; blcnt > 1; blcnt /= 2, dx *= 2) {
-    const auto bsize = blocks[0].size();
-    const auto after = blcnt / 2;
+  const std::vector<std::span<const int>> runs(blocks.begin(), blocks.end());
+  const int parts = static_cast<int>(blocks.size());
+  out_.resize(task_data->inputs_count[0]);
 
-    const auto merge_and_subst = [&](std::vector<int> &a, std::vector<int> &b) {
-      std::vector<int> c(a.size() + b.size());
-      std::ranges::merge(a, b, c.begin());
-      a = std::move(c);
-      b.clear();
-    };
-
-#pragma omp parallel for if (bsize > 64)
-    for (int g = 0; g < static_cast<int>(after); ++g) {
-      merge_and_subst(blocks[2 * dx * g], blocks[(2 * dx * g) + dx]);
-    }
-
-    if (after % 2 != 0) {
-      if (after == 1) {
-        merge_and_subst(blocks.front(), blocks.back());
-      } else {
-        merge_and_subst(blocks[2 * dx * (after - 2)], blocks[2 * dx * (after - 1)]);
-      }
-    }
+#pragma omp parallel for
+  for (int part = 0; part < parts; part++) {
+    ppc::core::MultiwayMergePart<int>(runs, out_, part, parts);
   }
 
-  out_ = std::move(blocks.front());
-
   return true;
 }
 
@@ -1,11 +1,10 @@
 #include "../include/mci_omp.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
-#include <random>
-#include <vector>
 
 #include "../include/mci_common.hpp"
 
@@ -16,27 +15,17 @@ bool krylov_m_monte_carlo::TaskOpenMP::ValidationImpl() {
 }
 
 bool krylov_m_monte_carlo::TaskOpenMP::RunImpl() {
-  const auto dimensions = params->Dimensions();
   const auto iterations = static_cast<std::int64_t>(params->iterations);
-  const auto func = params->func;
-
-  std::random_device dev;
-  std::mt19937 gen(dev());
+  constexpr std::int64_t kChunk = 1024;
 
+  // Every chunk jumps to its own samples of the shared sequence instead of sharing a copied generator
   double sum = 0.;
-#pragma omp parallel firstprivate(gen)
-  {
-    std::vector<double> x(dimensions);
-#pragma omp for reduction(+ : sum)
-    for (std::int64_t _ = 0; _ < iterations; ++_) {
-      for (std::size_t p = 0; p < dimensions; ++p) {
-        x[p] = dists[p](gen);
-      }
-      sum += func(x);
-    }
+#pragma omp parallel for schedule(dynamic) reduction(+ : sum)
+  for (std::int64_t first = 0; first < iterations; first += kChunk) {
+    sum += SampleSum(first, std::min(first + kChunk, iterations));
   }
 
   res = (vol * sum) / static_cast<double>(iterations);
 
   return true;
-}
\ No newline at end of file
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <utility>
 #include <vector>
@@ -21,6 +22,9 @@ class TestTaskOMP : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
+  // sum of the integrand over samples [first, last) of a sequence fixed by the default seed
+  [[nodiscard]] double SampleSum(std::size_t first, std::size_t last) const;
+
   std::vector<double> integrationBounds_;
   std::function<IntegrandFunction> integrand_;
   double result_{};
@@ -1,14 +1,13 @@
 #include "omp/lopatin_i_monte_carlo/include/lopatinMonteCarloOMP.hpp"
 
-#include <omp.h>
-
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <ctime>
-#include <random>
+#include <cstdint>
 #include <vector>
 
+#include "core/random/include/philox.hpp"
+
 namespace lopatin_i_monte_carlo_omp {
 
 bool TestTaskOMP::ValidationImpl() {
@@ -38,36 +37,19 @@ bool TestTaskOMP::PreProcessingImpl() {
 bool TestTaskOMP::RunImpl() {
   const size_t d = integrationBounds_.size() / 2;  // dimensions
 
-  // init random numbers generator
-  std::random_device rd;
-  std::seed_seq seed{rd(), static_cast<unsigned int>(std::time(nullptr))};
-  std::vector<std::mt19937::result_type> seeds(omp_get_max_threads());
-  seed.generate(seeds.begin(), seeds.end());
-
   // volume of integration region
   double volume = 1.0;
   for (size_t j = 0; j < d; ++j) {
     volume *= (integrationBounds_[(2 * j) + 1] - integrationBounds_[2 * j]);
   }
 
+  // chunks jump to their own samples of one sequence, so the result does not depend on the number of threads
+  const auto iterations = static_cast<std::int64_t>(iterations_);
+  constexpr std::int64_t kChunk = 1024;
   double total_sum = 0.0;
-#pragma omp parallel reduction(+ : total_sum)
-  {
-    // init generator for each thread with unique seed
-    const int tid = omp_get_thread_num();
-    std::mt19937 local_rnd(seeds[tid]);
-    std::uniform_real_distribution<> dis(0.0, 1.0);
-
-#pragma omp for
-    for (int i = 0; i < iterations_; ++i) {
-      std::vector<double> point(d);
-      for (size_t j = 0; j < d; ++j) {
-        const double min = integrationBounds_[2 * j];
-        const double max = integrationBounds_[(2 * j) + 1];
-        point[j] = min + (max - min) * dis(local_rnd);
-      }
-      total_sum += integrand_(point);
-    }
+#pragma omp parallel for schedule(dynamic) reduction(+ : total_sum)
+  for (std::int64_t first = 0; first < iterations; first += kChunk) {
+    total_sum += SampleSum(first, std::min(first + kChunk, iterations));
   }
 
   result_ = (total_sum / iterations_) * volume;
@@ -75,6 +57,22 @@ bool TestTaskOMP::RunImpl() {
   return true;
 }
 
+double TestTaskOMP::SampleSum(std::size_t first, std::size_t last) const {
+  const size_t d = integrationBounds_.size() / 2;  // dimensions
+
+  // sample i takes the uniforms [i * d, (i + 1) * d) of the fixed sequence
+  auto rnd = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, d);
+  std::vector<double> point(d);
+  double sum = 0.0;
+  for (size_t i = first; i < last; ++i) {
+    for (size_t j = 0; j < d; ++j) {
+      point[j] = rnd.Uniform(integrationBounds_[2 * j], integrationBounds_[(2 * j) + 1]);
+    }
+    sum += integrand_(point);
+  }
+  return sum;
+}
+
 bool TestTaskOMP::PostProcessingImpl() {
   auto* output_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
   *output_ptr = result_;
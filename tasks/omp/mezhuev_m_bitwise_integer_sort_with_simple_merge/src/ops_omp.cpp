@@ -1,11 +1,63 @@
 #include "omp/mezhuev_m_bitwise_integer_sort_with_simple_merge/include/ops_omp.hpp"
 
+#include <omp.h>
+
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+
 namespace mezhuev_m_bitwise_integer_sort_omp {
 
+namespace {
+
+// LSD radix sort by decimal digits of non-negative numbers
+void RadixSort(std::vector<int>& arr) {
+  if (arr.empty()) {
+    return;
+  }
+
+  int max_num = *std::ranges::max_element(arr);
+  std::vector<int> output(arr.size());
+  for (int exp = 1; max_num / exp > 0; exp *= 10) {
+    std::vector<int> count(10, 0);
+    for (int num : arr) {
+      count[(num / exp) % 10]++;
+    }
+    for (int j = 1; j < 10; ++j) {
+      count[j] += count[j - 1];
+    }
+    for (int i = static_cast<int>(arr.size()) - 1; i >= 0; --i) {
+      int digit = (arr[i] / exp) % 10;
+      output[--count[digit]] = arr[i];
+    }
+    arr.swap(output);
+  }
+}
+
+// Sorts one block: magnitudes of negative and positive numbers are sorted separately
+void SortBlock(std::span<const int> block, std::span<int> out) {
+  std::vector<int> negative;
+  std::vector<int> positive;
+  for (int num : block) {
+    if (num < 0) {
+      negative.push_back(-num);
+    } else {
+      positive.push_back(num);
+    }
+  }
+  RadixSort(positive);
+  RadixSort(negative);
+
+  auto it = std::ranges::transform(negative.rbegin(), negative.rend(), out.begin(), [](int num) { return -num; }).out;
+  std::ranges::copy(positive, it);
+}
+
+}  // namespace
+
 bool SortOpenMP::PreProcessingImpl() {
   unsigned int input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
@@ -33,70 +85,24 @@ bool SortOpenMP::RunImpl() {
     return true;
   }
 
-  std::vector<int> negative;
-  std::vector<int> positive;
-  for (int num : input_) {
-    if (num < 0) {
-      negative.push_back(-num);
-    } else {
-      positive.push_back(num);
-    }
+  const int blocks = std::max(1, std::min(omp_get_max_threads(), static_cast<int>(input_.size())));
+  std::vector<size_t> bounds(blocks + 1);
+  for (int i = 0; i <= blocks; ++i) {
+    bounds[i] = i * input_.size() / blocks;
   }
-
-  auto radix_sort = [](std::vector<int>& arr) {
-    if (arr.empty()) {
-      return;
-    }
-
-    int max_num = *std::ranges::max_element(arr);
-
-    for (int exp = 1; max_num / exp > 0; exp *= 10) {
-      std::vector<int> output(arr.size());
-      std::vector<int> count(10, 0);
-#pragma omp parallel
-      {
-        std::vector<int> local_count(10, 0);
-
-#pragma omp for nowait
-        for (int i = 0; i < static_cast<int>(arr.size()); ++i) {
-          int digit = (arr[i] / exp) % 10;
-          local_count[digit]++;
-        }
-
-#pragma omp critical
-        {
-          for (int j = 0; j < 10; ++j) {
-            count[j] += local_count[j];
-          }
-        }
-      }
-      for (int j = 1; j < 10; ++j) {
-        count[j] += count[j - 1];
-      }
-
-      for (int i = static_cast<int>(arr.size()) - 1; i >= 0; --i) {
-        int digit = (arr[i] / exp) % 10;
-        output[--count[digit]] = arr[i];
-      }
-
+  std::vector<int> sorted_blocks(input_.size());
 #pragma omp parallel for
-      for (int i = 0; i < static_cast<int>(arr.size()); ++i) {
-        arr[i] = output[i];
-      }
-    }
-  };
-
-  radix_sort(positive);
-  radix_sort(negative);
-
-  std::ranges::reverse(negative);
-  for (int& num : negative) {
-    num = -num;
+  for (int i = 0; i < blocks; ++i) {
+    const size_t size = bounds[i + 1] - bounds[i];
+    SortBlock(std::span(input_).subspan(bounds[i], size), std::span(sorted_blocks).subspan(bounds[i], size));
   }
 
-  output_.clear();
-  output_.insert(output_.end(), negative.begin(), negative.end());
-  output_.insert(output_.end(), positive.begin(), positive.end());
+  const auto runs = ppc::core::MakeRuns<int>(sorted_blocks, bounds);
+  output_.resize(input_.size());
+#pragma omp parallel for
+  for (int part = 0; part < blocks; ++part) {
+    ppc::core::MultiwayMergePart<int>(runs, output_, part, blocks);
+  }
 
   return true;
 }
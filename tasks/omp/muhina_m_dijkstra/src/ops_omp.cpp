@@ -7,65 +7,41 @@
 #include <utility>
 #include <vector>
 
-const int muhina_m_dijkstra_omp::TestTaskOpenMP::kEndOfVertexList = -1;
+#include "core/graph/include/graph.hpp"
+#include "core/graph/include/sssp.hpp"
+#include "core/sparse/include/sparse_omp.hpp"
 
 bool muhina_m_dijkstra_omp::TestTaskOpenMP::PreProcessingImpl() {
-  unsigned int input_size = task_data->inputs_count[0];
-  auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
-  graph_data_.assign(in_ptr, in_ptr + input_size);
-
-  num_vertices_ = task_data->outputs_count[0];
-  distances_.resize(num_vertices_);
-  for (size_t i = 0; i < num_vertices_; ++i) {
-    distances_[i] = INT_MAX;
-  }
-  if (task_data->inputs.size() > 1 && task_data->inputs[1] != nullptr) {
-    start_vertex_ = *reinterpret_cast<int *>(task_data->inputs[1]);
-  } else {
-    start_vertex_ = 0;
+  // A batch of sources fills outputs[0] with one row of distances per source
+  sources_ = ppc::core::graph::TaskSources(*task_data, ppc::core::graph::GraphInputsCount(*task_data));
+  num_vertices_ = task_data->outputs_count[0] / sources_.size();
+  valid_graph_ = graph_.Load(*task_data, num_vertices_);
+
+  distances_.assign(sources_.size() * num_vertices_, INT_MAX);
+  if (valid_graph_) {
+    distances_[sources_.front()] = 0;
   }
-  distances_[start_vertex_] = 0;
-
   return true;
 }
 
 bool muhina_m_dijkstra_omp::TestTaskOpenMP::ValidationImpl() {
-  return !task_data->inputs_count.empty() && task_data->inputs_count[0] > 0;
-  return !task_data->outputs_count.empty() && task_data->outputs_count[0] > 0;
+  return !task_data->inputs_count.empty() && task_data->inputs_count[0] > 0 &&
+         ppc::core::graph::ValidTaskSources(*task_data, ppc::core::graph::GraphInputsCount(*task_data));
 }
 
 bool muhina_m_dijkstra_omp::TestTaskOpenMP::RunImpl() {
-  std::vector<std::vector<std::pair<size_t, int>>> adj_list(num_vertices_);
-  size_t current_vertex = 0;
-  size_t i = 0;
-
-  while (i < graph_data_.size() && current_vertex < num_vertices_) {
-    if (graph_data_[i] == kEndOfVertexList) {
-      current_vertex++;
-      i++;
-      continue;
-    }
-
-    if (i + 1 >= graph_data_.size()) {
-      break;
-    }
-
-    size_t dest = graph_data_[i];
-    int weight = graph_data_[i + 1];
-    if (weight < 0) {
-      return false;
-    }
-
-    if (dest < num_vertices_) {
-      adj_list[current_vertex].emplace_back(dest, weight);
-    }
-
-    i += 2;
+  if (!valid_graph_) {
+    return false;
+  }
+  if (sources_.size() > 1) {
+    ppc::core::graph::BatchedShortestPaths(graph_.View(), sources_, distances_, ppc::core::sparse::OmpBackend{});
+    return true;
   }
+  const auto graph = graph_.View();
 
   std::priority_queue<std::pair<int, size_t>, std::vector<std::pair<int, size_t>>, std::greater<>> pq;
 
-  pq.emplace(0, start_vertex_);
+  pq.emplace(0, sources_.front());
 
   while (!pq.empty()) {
     size_t u = pq.top().second;
@@ -77,9 +53,9 @@ bool muhina_m_dijkstra_omp::TestTaskOpenMP::RunImpl() {
     }
 
 #pragma omp parallel for
-    for (int idx = 0; idx < static_cast<int>(adj_list[u].size()); ++idx) {
-      size_t v = adj_list[u][idx].first;
-      int weight = adj_list[u][idx].second;
+    for (int idx = static_cast<int>(graph.offsets[u]); idx < static_cast<int>(graph.offsets[u + 1]); ++idx) {
+      size_t v = graph.targets[idx];
+      int weight = graph.weights[idx];
 
       if (distances_[u] != INT_MAX && distances_[u] + weight < distances_[v]) {
 #pragma omp critical
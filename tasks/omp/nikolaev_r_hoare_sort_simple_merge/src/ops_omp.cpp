@@ -8,6 +8,8 @@
 #include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+
 bool nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP::PreProcessingImpl() {
   vect_size_ = task_data->inputs_count[0];
   auto *vect_ptr = reinterpret_cast<double *>(task_data->inputs[0]);
@@ -22,70 +24,24 @@ bool nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP::Validat
 }
 
 bool nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP::RunImpl() {
-  int num_threads = omp_get_max_threads();
-  if (vect_size_ < static_cast<size_t>(num_threads)) {
-    num_threads = static_cast<int>(vect_size_);
-  }
-
-  std::vector<std::pair<size_t, size_t>> segments;
-  segments.reserve(num_threads);
-
-  size_t seg_size = vect_size_ / num_threads;
-  size_t remainder = vect_size_ % num_threads;
-  size_t start = 0;
-  for (int i = 0; i < num_threads; ++i) {
-    size_t extra = (i < static_cast<int>(remainder) ? 1 : 0);
-    size_t end = start + seg_size + extra - 1;
-    segments.emplace_back(start, end);
-    start = end + 1;
+  const int blocks = std::max(1, std::min(omp_get_max_threads(), static_cast<int>(vect_size_)));
+  std::vector<size_t> bounds(blocks + 1);
+  for (int i = 0; i <= blocks; i++) {
+    bounds[i] = static_cast<size_t>(i) * vect_size_ / blocks;
   }
 
 #pragma omp parallel for schedule(static)
-  for (int i = 0; i < static_cast<int>(segments.size()); i++) {
-    QuickSort(segments[i].first, segments[i].second);
+  for (int i = 0; i < blocks; i++) {
+    QuickSort(bounds[i], bounds[i + 1] - 1);
   }
 
-  while (segments.size() > 1) {
-    size_t num_pairs = segments.size() / 2;
-    std::vector<std::pair<size_t, size_t>> new_segments;
-    new_segments.resize(num_pairs);
-
+  const auto runs = ppc::core::MakeRuns<double>(vect_, bounds);
+  std::vector<double> merged(vect_size_);
 #pragma omp parallel for schedule(static)
-    for (int i = 0; i < static_cast<int>(num_pairs); i++) {
-      size_t left_start = segments[2 * i].first;
-      size_t left_end = segments[2 * i].second;
-
-      size_t right_start = segments[(2 * i) + 1].first;
-      size_t right_end = segments[(2 * i) + 1].second;
-
-      size_t merged_size = right_end - left_start + 1;
-      std::vector<double> merged(merged_size);
-
-      size_t i1 = left_start;
-      size_t i2 = right_start;
-      size_t k = 0;
-      while (i1 <= left_end && i2 <= right_end) {
-        if (vect_[i1] < vect_[i2]) {
-          merged[k++] = vect_[i1++];
-        } else {
-          merged[k++] = vect_[i2++];
-        }
-      }
-      while (i1 <= left_end) {
-        merged[k++] = vect_[i1++];
-      }
-      while (i2 <= right_end) {
-        merged[k++] = vect_[i2++];
-      }
-
-      std::ranges::copy(merged, vect_.begin() + static_cast<std::ptrdiff_t>(left_start));
-      new_segments[i] = {left_start, right_end};
-    }
-    if (segments.size() % 2 == 1) {
-      new_segments.push_back(segments.back());
-    }
-    segments.swap(new_segments);
+  for (int part = 0; part < blocks; part++) {
+    ppc::core::MultiwayMergePart<double>(runs, merged, part, blocks);
   }
+  vect_.swap(merged);
   return true;
 }
 
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
 #include "core/task/include/task.hpp"
 #include "core/util/include/util.hpp"
 
@@ -12,11 +13,6 @@ namespace pikarychev_i_hoare_sort_simple_merge {
 
 template <class T>
 class HoareOpenMP : public ppc::core::Task {
-  struct Block {
-    T* e;
-    std::size_t sz;
-  };
-
  public:
   explicit HoareOpenMP(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
 
@@ -36,41 +32,27 @@ class HoareOpenMP : public ppc::core::Task {
 
   bool RunImpl() override {
     const auto size = input_.size();
-    std::ranges::copy_n(input_.begin(), size, res_.begin());
-
-    const auto parallelism = std::min<std::size_t>(size, ppc::util::GetPPCNumThreads());
     if (size < 1) {
       return true;
     }
 
-    const auto fair = size / parallelism;
-    const auto extra = size % parallelism;
-
-    std::vector<Block> blocks(parallelism);
-    T* pointer = res_.data();
-    for (std::size_t i = 0; i < parallelism; i++) {
-      blocks[i] = {.e = pointer, .sz = fair + ((i < extra) ? 1 : 0)};
-      pointer += blocks[i].sz;
+    const auto parallelism = std::min<std::size_t>(size, ppc::util::GetPPCNumThreads());
+    const auto comp = reverse_ ? ReverseComp : StandardComp;
+    std::vector<std::size_t> bounds(parallelism + 1);
+    for (std::size_t i = 0; i <= parallelism; i++) {
+      bounds[i] = i * size / parallelism;
     }
 
+    std::vector<T> sorted(input_);
 #pragma omp parallel for
-    for (int i = 0; i < int(parallelism); i++) {
-      DoSort(blocks[i].e, 0, blocks[i].sz - 1, reverse_ ? ReverseComp : StandardComp);
+    for (int i = 0; i < static_cast<int>(parallelism); i++) {
+      DoSort(sorted.data() + bounds[i], 0, static_cast<int>(bounds[i + 1] - bounds[i]) - 1, comp);
     }
 
-    auto partind = parallelism;
-    for (auto wide = decltype(parallelism){1}; partind > 1; wide *= 2, partind /= 2) {
-#pragma omp parallel for if (blocks[wide].sz >= 40)
-      for (int k = 0; k < static_cast<int>(partind / 2); ++k) {
-        const auto idx = 2 * wide * k;
-        DoInplaceMerge(blocks.data() + idx, blocks.data() + idx + wide, reverse_ ? ReverseComp : StandardComp);
-      }
-      if ((partind / 2) == 1) {
-        DoInplaceMerge(&blocks.front(), &blocks.back(), reverse_ ? ReverseComp : StandardComp);
-      } else if ((partind / 2) % 2 != 0) {
-        DoInplaceMerge(blocks.data() + (2 * wide * ((partind / 2) - 2)),
-                       blocks.data() + (2 * wide * ((partind / 2) - 1)), reverse_ ? ReverseComp : StandardComp);
-      }
+    const auto runs = ppc::core::MakeRuns<T>(sorted, bounds);
+#pragma omp parallel for
+    for (int part = 0; part < static_cast<int>(parallelism); part++) {
+      ppc::core::MultiwayMergePart<T>(runs, res_, part, parallelism, comp);
     }
 
     return true;
@@ -85,11 +67,6 @@ class HoareOpenMP : public ppc::core::Task {
   }
 
  private:
-  static void DoInplaceMerge(Block* b1, Block* b2, bool (*comp)(const T&, const T&)) {
-    std::inplace_merge(b1->e, b2->e, b2->e + b2->sz, comp);
-    b1->sz += b2->sz;
-  }
-
   static int Partition(T* block, int low, int high, bool (*comp)(const T&, const T&)) {
     int e = low - 1;
     for (int j = low; j <= high - 1; j++) {
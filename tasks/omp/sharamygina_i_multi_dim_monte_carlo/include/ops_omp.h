@@ -1,4 +1,5 @@
 #pragma once
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -16,6 +17,9 @@ class MultiDimMonteCarloTask : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
+  // Sum of the function over samples [first, last) of the sequence fixed by the default seed
+  [[nodiscard]] double SampleSum(size_t first, size_t last) const;
+
   std::vector<double> boundaries_;
   int number_of_iterations_ = 0;
   double final_result_ = 0.0;
@@ -1,14 +1,13 @@
 #include "omp/sharamygina_i_multi_dim_monte_carlo/include/ops_omp.h"
 
-#include <omp.h>
-
 #include <algorithm>
+#include <cstdint>
 #include <cstdlib>
-#include <ctime>
 #include <functional>
-#include <random>
 #include <vector>
 
+#include "core/random/include/philox.hpp"
+
 bool sharamygina_i_multi_dim_monte_carlo_omp::MultiDimMonteCarloTask::PreProcessingImpl() {
   auto* raw_bounds = reinterpret_cast<double*>(task_data->inputs[0]);
   size_t total_bounds_count = task_data->inputs_count[0];
@@ -32,30 +31,14 @@ bool sharamygina_i_multi_dim_monte_carlo_omp::MultiDimMonteCarloTask::Validation
 bool sharamygina_i_multi_dim_monte_carlo_omp::MultiDimMonteCarloTask::RunImpl() {
   size_t dimension = boundaries_.size() / 2;
 
-  std::mt19937 engine(static_cast<unsigned long>(std::time(nullptr)));
-  std::uniform_real_distribution<double> distribution(0.0, 1.0);
-
+  // chunks jump to their own samples of one sequence, so the result does not depend on the number of threads
+  const auto iterations = static_cast<std::int64_t>(number_of_iterations_);
+  constexpr std::int64_t kChunk = 1024;
   double accumulator = 0.0;
 
-#pragma omp parallel
-  {
-    std::mt19937 local_engine(static_cast<unsigned long>(std::time(nullptr) + omp_get_thread_num()));
-    double local_accumulator = 0.0;
-
-#pragma omp for
-    for (int n = 0; n < number_of_iterations_; ++n) {
-      std::vector<double> random_point(dimension);
-      for (size_t i = 0; i < dimension; ++i) {
-        double low = boundaries_[2 * i];
-        double high = boundaries_[(2 * i) + 1];
-        double t = distribution(local_engine);
-        random_point[i] = low + (high - low) * t;
-      }
-      local_accumulator += integrating_function_(random_point);
-    }
-
-#pragma omp atomic
-    accumulator += local_accumulator;
+#pragma omp parallel for schedule(dynamic) reduction(+ : accumulator)
+  for (std::int64_t first = 0; first < iterations; first += kChunk) {
+    accumulator += SampleSum(first, std::min(first + kChunk, iterations));
   }
 
   double volume = 1.0;
@@ -69,6 +52,22 @@ bool sharamygina_i_multi_dim_monte_carlo_omp::MultiDimMonteCarloTask::RunImpl()
   return true;
 }
 
+double sharamygina_i_multi_dim_monte_carlo_omp::MultiDimMonteCarloTask::SampleSum(size_t first, size_t last) const {
+  size_t dimension = boundaries_.size() / 2;
+
+  auto engine = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, dimension);
+  std::vector<double> random_point(dimension);
+  double accumulator = 0.0;
+
+  for (size_t n = first; n < last; ++n) {
+    for (size_t i = 0; i < dimension; ++i) {
+      random_point[i] = engine.Uniform(boundaries_[2 * i], boundaries_[(2 * i) + 1]);
+    }
+    accumulator += integrating_function_(random_point);
+  }
+  return accumulator;
+}
+
 bool sharamygina_i_multi_dim_monte_carlo_omp::MultiDimMonteCarloTask::PostProcessingImpl() {
   auto* output_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
   output_ptr[0] = final_result_;
@@ -8,7 +8,6 @@
 #include "core/task/include/task.hpp"
 
 namespace shlyakov_m_shell_sort_omp {
-void Merge(int left, int mid, int right, std::vector<int>& arr, std::vector<int>& buffer);
 void ShellSort(int left, int right, std::vector<int>& arr);
 
 class TestTaskOpenMP : public ppc::core::Task {
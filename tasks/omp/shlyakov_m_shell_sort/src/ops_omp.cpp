@@ -2,10 +2,12 @@
 
 #include <omp.h>
 
-#include <cmath>
+#include <algorithm>
 #include <cstddef>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+
 bool shlyakov_m_shell_sort_omp::TestTaskOpenMP::PreProcessingImpl() {
   std::size_t input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
@@ -25,35 +27,28 @@ bool shlyakov_m_shell_sort_omp::TestTaskOpenMP::RunImpl() {
   int num_threads = omp_get_max_threads();
   int sub_arr_size = (array_size + num_threads - 1) / num_threads;
 
-#pragma omp parallel
-  {
-    std::vector<int> buffer;
+  std::vector<std::size_t> bounds(num_threads + 1);
+  for (int i = 0; i <= num_threads; ++i) {
+    bounds[i] = static_cast<std::size_t>(std::min(i * sub_arr_size, array_size));
+  }
 
-#pragma omp for schedule(dynamic)
-    for (int i = 0; i < num_threads; ++i) {
-      int left = i * sub_arr_size;
-      int right = (left + sub_arr_size - 1 < array_size - 1) ? (left + sub_arr_size - 1) : (array_size - 1);
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < num_threads; ++i) {
+    int left = static_cast<int>(bounds[i]);
+    int right = static_cast<int>(bounds[i + 1]) - 1;
 
-      if (left < right) {
-        ShellSort(left, right, input_);
-      }
+    if (left < right) {
+      ShellSort(left, right, input_);
     }
+  }
 
-    for (int size = sub_arr_size; size < array_size; size *= 2) {
-#pragma omp for schedule(dynamic)
-      for (int left = 0; left < array_size; left += 2 * size) {
-        int mid = (left + size - 1 < array_size - 1) ? (left + size - 1) : (array_size - 1);
-        int right_bound = left + (2 * size) - 1;
-        int right = (right_bound < array_size - 1) ? right_bound : (array_size - 1);
-
-        if (mid < right) {
-          Merge(left, mid, right, input_, buffer);
-        }
-      }
-    }
+  const auto runs = ppc::core::MakeRuns<int>(input_, bounds);
+  output_.resize(input_.size());
+#pragma omp parallel for
+  for (int part = 0; part < num_threads; ++part) {
+    ppc::core::MultiwayMergePart<int>(runs, output_, part, num_threads);
   }
 
-  output_ = input_;
   return true;
 }
 
@@ -79,31 +74,6 @@ void ShellSort(int left, int right, std::vector<int>& arr) {
     }
   }
 }
-
-void Merge(int left, int mid, int right, std::vector<int>& arr, std::vector<int>& buffer) {
-  int i = left;
-  int j = mid + 1;
-  int k = 0;
-  const int merge_size = right - left + 1;
-
-  if (buffer.size() < static_cast<std::size_t>(merge_size)) {
-    buffer.resize(static_cast<std::size_t>(merge_size));
-  }
-
-  for (; i <= mid || j <= right;) {
-    if (i > mid) {
-      buffer[k++] = arr[j++];
-    } else if (j > right) {
-      buffer[k++] = arr[i++];
-    } else {
-      buffer[k++] = (arr[i] <= arr[j]) ? arr[i++] : arr[j++];
-    }
-  }
-
-  for (size_t idx = 0; idx < static_cast<size_t>(k); ++idx) {
-    arr[left + idx] = buffer[idx];
-  }
-}
 }  // namespace shlyakov_m_shell_sort_omp
 
 bool shlyakov_m_shell_sort_omp::TestTaskOpenMP::PostProcessingImpl() {
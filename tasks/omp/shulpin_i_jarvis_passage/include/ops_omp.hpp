@@ -49,8 +49,6 @@ class JarvisOMPParallel : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
-  static void MakeJarvisPassageOMP(std::vector<shulpin_i_jarvis_omp::Point>& input,
-                                   std::vector<shulpin_i_jarvis_omp::Point>& output);
 
  private:
   std::vector<shulpin_i_jarvis_omp::Point> input_omp_, output_omp_;
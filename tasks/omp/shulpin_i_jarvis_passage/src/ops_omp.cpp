@@ -3,13 +3,12 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <cstdint>
-#include <cstring>
-#include <string>
 #include <unordered_set>
-#include <utility>
 #include <vector>
 
+#include "core/hull/include/hull.hpp"
+#include "core/sparse/include/sparse_omp.hpp"
+
 namespace {
 int Orientation(const shulpin_i_jarvis_omp::Point& p, const shulpin_i_jarvis_omp::Point& q,
                 const shulpin_i_jarvis_omp::Point& r) {
@@ -79,70 +78,6 @@ bool shulpin_i_jarvis_omp::JarvisSequential::PostProcessingImpl() {
   return true;
 }
 
-void shulpin_i_jarvis_omp::JarvisOMPParallel::MakeJarvisPassageOMP(
-    std::vector<shulpin_i_jarvis_omp::Point>& input_jar, std::vector<shulpin_i_jarvis_omp::Point>& output_jar) {
-  int total = static_cast<int>(input_jar.size());
-  output_jar.clear();
-
-  std::unordered_set<shulpin_i_jarvis_omp::Point, shulpin_i_jarvis_omp::PointHash, shulpin_i_jarvis_omp::PointEqual>
-      unique_points;
-  std::vector<shulpin_i_jarvis_omp::Point> hull;
-  hull.reserve(total);
-
-  int start = 0;
-  for (int i = 1; i < total; ++i) {
-    const auto& a = input_jar[i];
-    const auto& b = input_jar[start];
-    if (a.x < b.x || (a.x == b.x && a.y < b.y)) {
-      start = i;
-    }
-  }
-  int active = start;
-
-  do {
-    const Point& current = input_jar[active];
-    if (unique_points.find(current) == unique_points.end()) {
-      hull.push_back(current);
-      unique_points.insert(current);
-    }
-
-    int candidate = (active + 1) % total;
-    std::vector<int> thread_candidates(omp_get_max_threads(), candidate);
-
-#pragma omp parallel
-    {
-      int tid = omp_get_thread_num();
-      int local_candidate = candidate;
-
-#pragma omp for nowait
-      for (int i = 0; i < total; ++i) {
-        if (i == active) continue;
-        if (Orientation(current, input_jar[i], input_jar[local_candidate]) == 2) {
-          local_candidate = i;
-        }
-      }
-
-      thread_candidates[tid] = local_candidate;
-    }
-
-    for (int tid = 0; tid < static_cast<int>(thread_candidates.size()); ++tid) {
-      int cand = thread_candidates[tid];
-      if (Orientation(current, input_jar[cand], input_jar[candidate]) == 2) {
-        candidate = cand;
-      }
-    }
-
-    if (candidate == active) {
-      break;
-    }
-
-    active = candidate;
-
-  } while (active != start);
-
-  output_jar = std::move(hull);
-}
-
 bool shulpin_i_jarvis_omp::JarvisOMPParallel::PreProcessingImpl() {
   std::vector<shulpin_i_jarvis_omp::Point> tmp_input;
 
@@ -162,7 +97,11 @@ bool shulpin_i_jarvis_omp::JarvisOMPParallel::ValidationImpl() {
 }
 
 bool shulpin_i_jarvis_omp::JarvisOMPParallel::RunImpl() {
-  MakeJarvisPassageOMP(input_omp_, output_omp_);
+  // Counterclockwise from the leftmost point with every point on the boundary, the way the passage walks it
+  const ppc::core::sparse::OmpBackend backend;
+  const auto hull = ppc::core::hull::ConvexHull<Point>(input_omp_, backend, ppc::core::hull::HullPoints::kBoundary);
+  output_omp_ =
+      ppc::core::hull::OrientHull(hull, ppc::core::hull::LeftBottomLess{}, ppc::core::hull::Winding::kCounterclockwise);
   return true;
 }
 
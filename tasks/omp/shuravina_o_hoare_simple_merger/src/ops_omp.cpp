@@ -6,6 +6,8 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+
 namespace shuravina_o_hoare_simple_merger {
 
 void TestTaskOMP::QuickSort(std::vector<int>& arr, int low, int high) {
@@ -34,40 +36,8 @@ void TestTaskOMP::QuickSort(std::vector<int>& arr, int low, int high) {
 
     int pi = i + 1;
 
-#pragma omp parallel sections
-    {
-#pragma omp section
-      QuickSort(arr, low, pi - 1);
-#pragma omp section
-      QuickSort(arr, pi + 1, high);
-    }
-  }
-}
-
-void TestTaskOMP::Merge(std::vector<int>& arr, int low, int mid, int high) {
-  std::vector<int> temp(high - low + 1);
-  int i = low;
-  int j = mid + 1;
-  int k = 0;
-
-  while (i <= mid && j <= high) {
-    if (arr[i] <= arr[j]) {
-      temp[k++] = arr[i++];
-    } else {
-      temp[k++] = arr[j++];
-    }
-  }
-
-  while (i <= mid) {
-    temp[k++] = arr[i++];
-  }
-
-  while (j <= high) {
-    temp[k++] = arr[j++];
-  }
-
-  for (i = low, k = 0; i <= high; ++i, ++k) {
-    arr[i] = temp[k];
+    QuickSort(arr, low, pi - 1);
+    QuickSort(arr, pi + 1, high);
   }
 }
 
@@ -115,10 +85,24 @@ bool TestTaskOMP::RunImpl() {
     return true;
   }
 
-  auto size = input_.size();
-  QuickSort(input_, 0, static_cast<int>(size) - 1);
-  Merge(input_, 0, static_cast<int>(size / 2) - 1, static_cast<int>(size) - 1);
-  output_ = input_;
+  const auto size = input_.size();
+  const int blocks = std::max(1, std::min(omp_get_max_threads(), static_cast<int>(size)));
+  std::vector<size_t> bounds(blocks + 1);
+  for (int i = 0; i <= blocks; ++i) {
+    bounds[i] = static_cast<size_t>(i) * size / blocks;
+  }
+
+#pragma omp parallel for
+  for (int i = 0; i < blocks; ++i) {
+    QuickSort(input_, static_cast<int>(bounds[i]), static_cast<int>(bounds[i + 1]) - 1);
+  }
+
+  const auto runs = ppc::core::MakeRuns<int>(input_, bounds);
+  output_.resize(size);
+#pragma omp parallel for
+  for (int part = 0; part < blocks; ++part) {
+    ppc::core::MultiwayMergePart<int>(runs, output_, part, blocks);
+  }
   return true;
 }
 
@@ -19,7 +19,6 @@ class TestTaskOpenMP : public ppc::core::Task {
  private:
   std::vector<int> mas_, output_;
   static void RadixSort(std::vector<int> &mas);
-  static std::vector<int> Merge(std::vector<int> mas1, std::vector<int> mas2);
 };
 
 }  // namespace smirnov_i_radix_sort_simple_merge_omp
\ No newline at end of file
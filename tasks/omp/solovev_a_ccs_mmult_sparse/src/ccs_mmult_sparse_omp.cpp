@@ -1,7 +1,10 @@
 #include "omp/solovev_a_ccs_mmult_sparse/include/ccs_mmult_sparse_omp.hpp"
 
 #include <complex>
-#include <vector>
+#include <cstddef>
+#include <span>
+
+#include "core/sparse/include/sparse_omp.hpp"
 
 bool solovev_a_matrix_omp::OMPMatMultCcs::PreProcessingImpl() {
   M1_ = reinterpret_cast<MatrixInCcsSparse*>(task_data->inputs[0]);
@@ -17,57 +20,24 @@ bool solovev_a_matrix_omp::OMPMatMultCcs::ValidationImpl() {
 }
 
 bool solovev_a_matrix_omp::OMPMatMultCcs::RunImpl() {
+  // col_p, row and val may be longer than the stored matrix, only their used prefix is multiplied
+  using View = ppc::core::sparse::CcsView<std::complex<double>, int>;
+  const auto view = [](const MatrixInCcsSparse* m) {
+    const auto nnz = static_cast<size_t>(m->col_p[m->c_n]);
+    return View{.rows = static_cast<size_t>(m->r_n),
+                .cols = static_cast<size_t>(m->c_n),
+                .col_ptr = std::span<const int>(m->col_p).first(m->c_n + 1),
+                .row_idx = std::span<const int>(m->row).first(nnz),
+                .values = std::span<const std::complex<double>>(m->val).first(nnz)};
+  };
+  const auto product = ppc::core::sparse::SpGemm(view(M1_), view(M2_), ppc::core::sparse::OmpBackend{});
+
   M3_->r_n = M1_->r_n;
   M3_->c_n = M2_->c_n;
-  M3_->col_p.resize(M3_->c_n + 1);
-  M3_->col_p[0] = 0;
-
-  for (int m2_c = 0; m2_c < M3_->c_n; ++m2_c) {
-    std::vector<int> available_el(M3_->r_n, 0);
-    for (int m2_i = M2_->col_p[m2_c]; m2_i < M2_->col_p[m2_c + 1]; ++m2_i) {
-      int m2_r = M2_->row[m2_i];
-      for (int m1_i = M1_->col_p[m2_r]; m1_i < M1_->col_p[m2_r + 1]; ++m1_i) {
-        available_el[M1_->row[m1_i]] = 1;
-      }
-    }
-    int n_z_c_cnt = 0;
-    for (int m3_r = 0; m3_r < M3_->r_n; ++m3_r) {
-      n_z_c_cnt += available_el[m3_r];
-    }
-    M3_->col_p[m2_c + 1] = n_z_c_cnt + M3_->col_p[m2_c];
-  }
-
-  int n_z_full = M3_->col_p[M3_->c_n];
-  M3_->n_z = n_z_full;
-  M3_->row.resize(n_z_full);
-  M3_->val.resize(n_z_full);
-
-  std::complex<double> nought = {0.0, 0.0};
-  std::complex<double> m2_val = {0.0, 0.0};
-
-#pragma omp parallel for
-  for (int m2_c = 0; m2_c < M3_->c_n; ++m2_c) {
-    std::vector<std::complex<double>> cask(M3_->r_n, nought);
-    std::vector<int> available_el_local(M3_->r_n, 0);
-
-    for (int m2_i = M2_->col_p[m2_c]; m2_i < M2_->col_p[m2_c + 1]; ++m2_i) {
-      int m2_r = M2_->row[m2_i];
-      m2_val = M2_->val[m2_i];
-      for (int m1_i = M1_->col_p[m2_r]; m1_i < M1_->col_p[m2_r + 1]; ++m1_i) {
-        int m1_row = M1_->row[m1_i];
-        cask[m1_row] += M1_->val[m1_i] * m2_val;
-        available_el_local[m1_row] = 1;
-      }
-    }
-
-    int c_pos = M3_->col_p[m2_c];
-    for (int m3_r = 0; m3_r < M3_->r_n; ++m3_r) {
-      if (available_el_local[m3_r] != 0) {
-        M3_->row[c_pos] = m3_r;
-        M3_->val[c_pos++] = cask[m3_r];
-      }
-    }
-  }
+  M3_->n_z = static_cast<int>(product.values.size());
+  M3_->col_p.assign(product.col_ptr.begin(), product.col_ptr.end());
+  M3_->row.assign(product.row_idx.begin(), product.row_idx.end());
+  M3_->val.assign(product.values.begin(), product.values.end());
   return true;
 }
 
@@ -1,9 +1,33 @@
 #include "omp/solovyev_d_shell_sort_simple/include/ops_omp.hpp"
 
+#include <omp.h>
+
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+
+namespace {
+// Shell sort with gaps n/2, n/4, ..., 1 of one block
+void ShellSort(std::span<int> block) {
+  const int size = static_cast<int>(block.size());
+  for (int gap = size / 2; gap > 0; gap /= 2) {
+    for (int f = gap; f < size; f++) {
+      int val = block[f];
+      int j = f;
+      while (j >= gap && block[j - gap] > val) {
+        block[j] = block[j - gap];
+        j -= gap;
+      }
+      block[j] = val;
+    }
+  }
+}
+}  // namespace
+
 bool solovyev_d_shell_sort_simple_omp::TaskOMP::PreProcessingImpl() {
   unsigned int input_size = task_data->inputs_count[0];
   auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
@@ -17,20 +41,23 @@ bool solovyev_d_shell_sort_simple_omp::TaskOMP::ValidationImpl() {
 }
 
 bool solovyev_d_shell_sort_simple_omp::TaskOMP::RunImpl() {
-  for (int gap = (int)input_.size() / 2; gap > 0; gap /= 2) {
+  const int blocks = std::max(1, std::min(omp_get_max_threads(), static_cast<int>(input_.size())));
+  std::vector<size_t> bounds(blocks + 1);
+  for (int i = 0; i <= blocks; i++) {
+    bounds[i] = i * input_.size() / blocks;
+  }
 #pragma omp parallel for
-    for (int i = 0; i < gap; i++) {
-      for (int f = gap + i; f < (int)input_.size(); f = f + gap) {
-        int val = input_[f];
-        int j = f;
-        while (j >= gap && input_[j - gap] > val) {
-          input_[j] = input_[j - gap];
-          j -= gap;
-        }
-        input_[j] = val;
-      }
-    }
+  for (int i = 0; i < blocks; i++) {
+    ShellSort(std::span(input_).subspan(bounds[i], bounds[i + 1] - bounds[i]));
+  }
+
+  const auto runs = ppc::core::MakeRuns<int>(input_, bounds);
+  std::vector<int> merged(input_.size());
+#pragma omp parallel for
+  for (int part = 0; part < blocks; part++) {
+    ppc::core::MultiwayMergePart<int>(runs, merged, part, blocks);
   }
+  input_.swap(merged);
   return true;
 }
 bool solovyev_d_shell_sort_simple_omp::TaskOMP::PostProcessingImpl() {
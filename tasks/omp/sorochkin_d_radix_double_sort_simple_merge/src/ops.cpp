@@ -12,6 +12,7 @@
 #include <span>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
 #include "core/util/include/util.hpp"
 
 namespace {
@@ -75,7 +76,7 @@ bool sorochkin_d_radix_double_sort_simple_merge_omp::SortTask::PreProcessingImpl
 }
 
 bool sorochkin_d_radix_double_sort_simple_merge_omp::SortTask::RunImpl() {
-  output_ = input_;
+  std::vector<double> sorted = input_;
 
   const auto size = input_.size();
   if (size == 0) {
@@ -93,7 +94,7 @@ bool sorochkin_d_radix_double_sort_simple_merge_omp::SortTask::RunImpl() {
   std::vector<std::span<double>> chunks(numthreads);
   std::ranges::generate(chunks, [&, i = 0]() mutable {
     const auto j = i++;
-    return std::span{output_}.subspan(offsets[j], distrib[j]);
+    return std::span{sorted}.subspan(offsets[j], distrib[j]);
   });
 
 #pragma omp parallel for
@@ -101,23 +102,12 @@ bool sorochkin_d_radix_double_sort_simple_merge_omp::SortTask::RunImpl() {
     RadixSort(chunks[i]);
   }
 
-  for (std::size_t i = 1, j = numthreads; j > 1; i *= 2, j /= 2) {
-    const auto multithreaded = chunks.front().size() > 48;
-    const auto jh = j / 2;
-    const auto merge = [&](std::span<double> &master, std::span<double> &slave) {
-      std::inplace_merge(master.begin(), slave.begin(), slave.end());
-      master = std::span{master.begin(), slave.end()};
-    };
-#pragma omp parallel for if (multithreaded)
-    for (int k = 0; k < static_cast<int>(jh); ++k) {
-      const auto idx = 2 * i * k;
-      merge(chunks[idx], chunks[idx + i]);
-    }
-    if (jh == 1) {
-      merge(chunks.front(), chunks.back());
-    } else if (jh % 2 != 0) {
-      merge(chunks[2 * i * (jh - 2)], chunks[2 * i * (jh - 1)]);
-    }
+  const std::vector<std::span<const double>> runs(chunks.begin(), chunks.end());
+  output_.resize(size);
+
+#pragma omp parallel for
+  for (int part = 0; part < static_cast<int>(numthreads); part++) {
+    ppc::core::MultiwayMergePart<double>(runs, output_, part, numthreads);
   }
 
   return true;
@@ -6,6 +6,8 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+
 void sotskov_a_shell_sorting_with_simple_merging_omp::ShellSort(std::vector<int>& arr, int left, int right) {
   int array_size = right - left + 1;
 
@@ -29,63 +31,33 @@ void sotskov_a_shell_sorting_with_simple_merging_omp::ShellSort(std::vector<int>
   }
 }
 
-void sotskov_a_shell_sorting_with_simple_merging_omp::ParallelMerge(std::vector<int>& arr, int left, int mid, int right,
-                                                                    std::vector<int>& temp_buffer) {
-  int i = left;
-  int j = mid + 1;
-  int k = 0;
-  const int merge_size = right - left + 1;
-
-  if (temp_buffer.size() < static_cast<std::size_t>(merge_size)) {
-    temp_buffer.resize(static_cast<std::size_t>(merge_size));
-  }
-
-  while (i <= mid && j <= right) {
-    temp_buffer[k++] = (arr[i] < arr[j]) ? arr[i++] : arr[j++];
-  }
-
-  while (i <= mid) {
-    temp_buffer[k++] = arr[i++];
-  }
-
-  while (j <= right) {
-    temp_buffer[k++] = arr[j++];
-  }
-
-  std::ranges::copy(temp_buffer.begin(), temp_buffer.begin() + k, arr.begin() + left);
-}
-
 void sotskov_a_shell_sorting_with_simple_merging_omp::ShellSortWithSimpleMerging(std::vector<int>& arr) {
   int array_size = static_cast<int>(arr.size());
   int num_threads = omp_get_max_threads();
-  int chunk_size = (array_size + num_threads - 1) / num_threads;
+  int chunk_size = std::max(1, (array_size + num_threads - 1) / num_threads);
 
-#pragma omp parallel
-  {
-    std::vector<int> temp_buffer(chunk_size * 2);
+  std::vector<std::size_t> bounds(num_threads + 1);
+  for (int i = 0; i <= num_threads; ++i) {
+    bounds[i] = std::min(i * chunk_size, array_size);
+  }
 
-#pragma omp for schedule(dynamic)
-    for (int i = 0; i < num_threads; ++i) {
-      int left = i * chunk_size;
-      int right = std::min(left + chunk_size - 1, array_size - 1);
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < num_threads; ++i) {
+    int left = i * chunk_size;
+    int right = std::min(left + chunk_size - 1, array_size - 1);
 
-      if (left < right) {
-        ShellSort(arr, left, right);
-      }
+    if (left < right) {
+      ShellSort(arr, left, right);
     }
+  }
 
-    for (int size = chunk_size; size < array_size; size *= 2) {
-#pragma omp for schedule(dynamic)
-      for (int left = 0; left < array_size; left += 2 * size) {
-        int mid = std::min(left + size - 1, array_size - 1);
-        int right = std::min(left + (2 * size) - 1, array_size - 1);
-
-        if (mid < right) {
-          ParallelMerge(arr, left, mid, right, temp_buffer);
-        }
-      }
-    }
+  const auto runs = ppc::core::MakeRuns<int>(arr, bounds);
+  std::vector<int> merged(arr.size());
+#pragma omp parallel for
+  for (int part = 0; part < num_threads; ++part) {
+    ppc::core::MultiwayMergePart<int>(runs, merged, part, num_threads);
   }
+  arr.swap(merged);
 }
 
 bool sotskov_a_shell_sorting_with_simple_merging_omp::TestTaskOpenMP::PreProcessingImpl() {
@@ -6,6 +6,7 @@
 #include <atomic>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <limits>
 #include <unordered_map>
@@ -19,25 +20,21 @@ bool trubin_a_algorithm_dijkstra_omp::TestTaskOpenMP::PreProcessingImpl() {
     return false;
   }
 
-  unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-  std::vector<int> graph_data(in_ptr, in_ptr + input_size);
-
   num_vertices_ = task_data->outputs_count[0];
 
-  if (num_vertices_ == 0 || input_size == 0) {
+  if (num_vertices_ == 0 || task_data->inputs_count[0] == 0) {
     return true;
   }
 
-  adjacency_list_.assign(num_vertices_, {});
   distances_.assign(num_vertices_, std::numeric_limits<int>::max());
 
-  if (!BuildAdjacencyList(graph_data)) {
+  if (!graph_.Load(*task_data, num_vertices_, ppc::core::graph::ParseMode::kStrict)) {
     return false;
   }
 
-  if (task_data->inputs.size() > 1 && task_data->inputs[1] != nullptr) {
-    int* ptr = reinterpret_cast<int*>(task_data->inputs[1]);
+  const size_t start_input = graph_.NextInput();
+  if (task_data->inputs.size() > start_input && task_data->inputs[start_input] != nullptr) {
+    int* ptr = reinterpret_cast<int*>(task_data->inputs[start_input]);
     if (*ptr < 0 || static_cast<size_t>(*ptr) >= num_vertices_) {
       return false;
     }
@@ -127,38 +124,6 @@ bool trubin_a_algorithm_dijkstra_omp::TestTaskOpenMP::PostProcessingImpl() {
 
   return true;
 }
-
-bool trubin_a_algorithm_dijkstra_omp::TestTaskOpenMP::BuildAdjacencyList(const std::vector<int>& graph_data) {
-  size_t current_vertex = 0;
-  size_t i = 0;
-
-  while (i < graph_data.size()) {
-    if (graph_data[i] == kEndOfVertexList) {
-      if (current_vertex >= num_vertices_) {
-        return false;
-      }
-      current_vertex++;
-      i++;
-      continue;
-    }
-
-    if (i + 1 >= graph_data.size()) {
-      return false;
-    }
-
-    auto to = static_cast<size_t>(graph_data[i]);
-    int weight = graph_data[i + 1];
-
-    if (to >= num_vertices_ || weight < 0) {
-      return false;
-    }
-
-    adjacency_list_[current_vertex].emplace_back(to, weight);
-    i += 2;
-  }
-
-  return true;
-}
 void trubin_a_algorithm_dijkstra_omp::TestTaskOpenMP::ProcessCurrentBucket(
     std::vector<int>& current, std::vector<std::vector<int>>& buckets, const int delta,
     std::vector<std::atomic<int>>& distances_atomic) {
@@ -202,10 +167,11 @@ void trubin_a_algorithm_dijkstra_omp::TestTaskOpenMP::ProcessSingleVertex(
     int u, int delta, std::vector<int>& next_bucket, std::unordered_map<size_t, std::vector<int>>& heavy_buckets,
     std::vector<std::atomic<int>>& distances_atomic) {
   int dist_u = distances_atomic[u].load(std::memory_order_relaxed);
+  const auto graph = graph_.View();
 
-  for (const auto& edge : adjacency_list_[u]) {
-    int v = static_cast<int>(edge.to);
-    int weight = edge.weight;
+  for (std::uint32_t e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+    int v = static_cast<int>(graph.targets[e]);
+    int weight = graph.weights[e];
     int new_dist = dist_u + weight;
 
     int old_dist = distances_atomic[v].load(std::memory_order_relaxed);
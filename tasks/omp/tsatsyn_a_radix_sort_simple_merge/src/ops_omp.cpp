@@ -1,25 +1,51 @@
 #include "omp/tsatsyn_a_radix_sort_simple_merge/include/ops_omp.hpp"
 
+#include <omp.h>
+
 #include <algorithm>
 #include <bit>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <utility>
 #include <vector>
 
-namespace constants {
-constexpr int kChunk = 100;
-}  // namespace constants
+#include "core/merge/include/multiway_merge.hpp"
+
+namespace {
+// Radix sort of one block: values are split by sign and sorted by their bits, negative ones in reverse order
+void SortBlock(std::span<const double> block, std::span<double> out) {
+  std::vector<uint64_t> pozitive_copy;
+  std::vector<uint64_t> negative_copy;
+  for (const double value : block) {
+    (value > 0.0 ? pozitive_copy : negative_copy).push_back(std::bit_cast<uint64_t>(value));
+  }
+  const int pozitive_bits = tsatsyn_a_radix_sort_simple_merge_omp::CalculateBits(pozitive_copy, true);
+  const int negative_bits = tsatsyn_a_radix_sort_simple_merge_omp::CalculateBits(negative_copy, false);
+  for (int bit = 0; bit < pozitive_bits; bit++) {
+    pozitive_copy = tsatsyn_a_radix_sort_simple_merge_omp::MainSort(pozitive_copy, bit);
+  }
+  for (int bit = 0; bit < negative_bits; bit++) {
+    negative_copy = tsatsyn_a_radix_sort_simple_merge_omp::MainSort(negative_copy, bit);
+  }
+  for (size_t i = 0; i < negative_copy.size(); i++) {
+    out[negative_copy.size() - 1 - i] = std::bit_cast<double>(negative_copy[i]);
+  }
+  for (size_t i = 0; i < pozitive_copy.size(); i++) {
+    out[negative_copy.size() + i] = std::bit_cast<double>(pozitive_copy[i]);
+  }
+}
+}  // namespace
+
 inline std::vector<uint64_t> tsatsyn_a_radix_sort_simple_merge_omp::MainSort(std::vector<uint64_t> &data, int bit) {
   std::vector<uint64_t> group0;
   std::vector<uint64_t> group1;
 
   group0.reserve(data.size());
   group1.reserve(data.size());
-#pragma omp for schedule(guided, constants::kChunk) nowait
-  for (int i = 0; i < static_cast<int>(data.size()); i++) {
-    (((data[i] >> bit) & 1) != 0U) ? group1.push_back(data[i]) : group0.push_back(data[i]);
+  for (const uint64_t value : data) {
+    (((value >> bit) & 1) != 0U) ? group1.push_back(value) : group0.push_back(value);
   }
   data = std::move(group0);
   data.insert(data.end(), group1.begin(), group1.end());
@@ -53,50 +79,23 @@ bool tsatsyn_a_radix_sort_simple_merge_omp::TestTaskOpenMP::PreProcessingImpl()
 bool tsatsyn_a_radix_sort_simple_merge_omp::TestTaskOpenMP::ValidationImpl() { return task_data->inputs_count[0] != 0; }
 
 bool tsatsyn_a_radix_sort_simple_merge_omp::TestTaskOpenMP::RunImpl() {
-  std::vector<uint64_t> pozitive_copy;
-  std::vector<uint64_t> negative_copy;
-  int i = 0;
-#pragma omp parallel private(i)
-  {
-    std::vector<uint64_t> local_positive;
-    std::vector<uint64_t> local_negative;
-
-#pragma omp for nowait
-    for (i = 0; i < static_cast<int>(input_data_.size()); ++i) {
-      if (input_data_[i] > 0.0) {
-        local_positive.push_back(*reinterpret_cast<const uint64_t *>(&input_data_[i]));
-      } else {
-        local_negative.push_back(*reinterpret_cast<const uint64_t *>(&input_data_[i]));
-      }
-    }
-#pragma omp critical
-    {
-      pozitive_copy.insert(pozitive_copy.end(), local_positive.begin(), local_positive.end());
-      negative_copy.insert(negative_copy.end(), local_negative.begin(), local_negative.end());
-    }
+  const int blocks = std::max(1, std::min(omp_get_max_threads(), static_cast<int>(input_data_.size())));
+  std::vector<size_t> bounds(blocks + 1);
+  for (int i = 0; i <= blocks; i++) {
+    bounds[i] = i * input_data_.size() / blocks;
   }
-  int pozitive_bits = CalculateBits(pozitive_copy, true);
-  int negative_bits = CalculateBits(negative_copy, false);
-
-  for (int bit = 0; bit < pozitive_bits; bit++) {
-    pozitive_copy = MainSort(pozitive_copy, bit);
+  std::vector<double> sorted_blocks(input_data_.size());
+#pragma omp parallel for
+  for (int i = 0; i < blocks; i++) {
+    const size_t size = bounds[i + 1] - bounds[i];
+    SortBlock(std::span(input_data_).subspan(bounds[i], size), std::span(sorted_blocks).subspan(bounds[i], size));
   }
 
-  if (!negative_copy.empty()) {
-    for (int bit = 0; bit < negative_bits; bit++) {
-      negative_copy = MainSort(negative_copy, bit);
-    }
-
-#pragma omp parallel for schedule(guided, constants::kChunk)
-    for (i = 0; i < static_cast<int>(negative_copy.size()); i++) {
-      output_[static_cast<int>(negative_copy.size()) - 1 - i] = *reinterpret_cast<const double *>(&negative_copy[i]);
-    }
+  const auto runs = ppc::core::MakeRuns<double>(sorted_blocks, bounds);
+#pragma omp parallel for
+  for (int part = 0; part < blocks; part++) {
+    ppc::core::MultiwayMergePart<double>(runs, output_, part, blocks);
   }
-#pragma omp parallel for schedule(guided, constants::kChunk)
-  for (i = 0; i < static_cast<int>(pozitive_copy.size()); ++i) {
-    output_[negative_copy.size() + i] = *reinterpret_cast<const double *>(&pozitive_copy[i]);
-  }
-
   return true;
 }
 bool tsatsyn_a_radix_sort_simple_merge_omp::TestTaskOpenMP::PostProcessingImpl() {
@@ -1,17 +1,16 @@
 #include "../include/ops_omp.hpp"
 
 #include <algorithm>
-#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <numeric>
-#include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/integrate/include/integrate.hpp"
 
 bool vasilev_s_simpson_multidim::SimpsonTaskOmp::ValidationImpl() {
   const auto arity = task_data->inputs_count[0];
 
-  const bool inputs_are_present = task_data->inputs.size() == 3 && arity > 0;
+  const bool inputs_are_present = (task_data->inputs.size() == 3 || task_data->inputs.size() == 4) && arity > 0;
   const bool outputs_are_present = task_data->outputs.size() == 1 && task_data->outputs_count[0] == 1;
   if (!inputs_are_present || !outputs_are_present) {
     return false;
@@ -27,45 +26,32 @@ bool vasilev_s_simpson_multidim::SimpsonTaskOmp::PreProcessingImpl() {
   bounds_.assign(bsrc, bsrc + arity_);
 
   func_ = reinterpret_cast<IntegrandFunction>(task_data->inputs[1]);
+  batch_func_ = task_data->inputs.size() > 3 ? reinterpret_cast<BatchIntegrandFunction>(task_data->inputs[3]) : nullptr;
   approxs_ = *reinterpret_cast<std::size_t*>(task_data->inputs[2]);
 
   steps_.resize(arity_);
   std::ranges::transform(bounds_, steps_.begin(), [n = approxs_](const auto& b) { return (b.hi - b.lo) / n; });
 
-  gridcap_ = static_cast<std::size_t>(std::pow(approxs_, arity_));
+  axes_.clear();
+  for (std::size_t i = 0; i < arity_; i++) {
+    axes_.push_back(ppc::core::integrate::SimpsonAxis(bounds_[i].lo, steps_[i], approxs_));
+  }
+  gridcap_ = ppc::core::integrate::GridSize(axes_);
   scale_ = std::accumulate(steps_.begin(), steps_.end(), 1., [](double cur, double step) { return cur * step / 3.; });
 
   return true;
 }
 
 bool vasilev_s_simpson_multidim::SimpsonTaskOmp::RunImpl() {
-#ifdef _WIN32
-  int igridcap = int(gridcap_);
-#else
-  auto igridcap{gridcap_};
-#endif
+  // Blocks of grid points are walked incrementally and evaluated with one integrand call per block
+  const auto integrand = ppc::core::integrate::BatchOrPointwise(batch_func_, func_);
+  const auto gridcap = static_cast<std::int64_t>(gridcap_);
+  constexpr std::int64_t kChunk = 16 * ppc::core::integrate::kBlockSize;
 
   double isum = 0.;
-  std::vector<double> coordbuf(arity_);
-#pragma omp parallel for reduction(+ : isum) firstprivate(coordbuf) \
-    schedule(static, gridcap_ / ppc::util::GetPPCNumThreads())
-  for (auto ip = decltype(igridcap){0}; ip < igridcap; ip++) {
-    auto p = ip;
-    double coefficient = 1.;
-    for (size_t k = 0; k < coordbuf.size(); k++) {
-      const auto pos{p % approxs_};
-      coordbuf[k] = bounds_[k].lo + (double(pos) * (bounds_[k].hi - bounds_[k].lo) / double(approxs_));
-      p /= static_cast<decltype(p)>(approxs_);
-      if (pos == 0 || pos == (approxs_ - 1)) {
-        continue;
-      }
-      if (pos % 2 != 0) {
-        coefficient *= 4.;
-      } else {
-        coefficient *= 2.;
-      }
-    }
-    isum += coefficient * func_(coordbuf);
+#pragma omp parallel for schedule(dynamic) reduction(+ : isum)
+  for (std::int64_t first = 0; first < gridcap; first += kChunk) {
+    isum += ppc::core::integrate::WeightedGridSum(axes_, first, std::min(first + kChunk, gridcap), integrand);
   }
 
   result_ = isum * scale_;
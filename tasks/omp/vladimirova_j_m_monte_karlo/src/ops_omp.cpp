@@ -1,18 +1,31 @@
 
 #include "omp/vladimirova_j_m_monte_karlo/include/ops_omp.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <random>
+#include <cstdint>
 #include <vector>
 
-namespace {
+#include "core/random/include/philox.hpp"
 
-thread_local std::mt19937 gen(std::random_device{}());
+namespace {
 
-double CreateRandomVal(double min_v, double max_v) {
-  std::uniform_real_distribution<double> dis(min_v, max_v);
-  return dis(gen);
+// Number of samples [first, last) of the sequence fixed by the default seed at which func holds;
+// sample i takes the uniforms [i * bounds.size(), (i + 1) * bounds.size()) of the sequence
+size_t CountHits(bool (*func)(std::vector<double>, size_t),
+                 const std::vector<vladimirova_j_m_monte_karlo_omp::BoundariesIntegral> &bounds, size_t first,
+                 size_t last) {
+  auto gen = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, bounds.size());
+  std::vector<double> random_val(bounds.size());
+  size_t hits = 0;
+  for (size_t i = first; i < last; i++) {
+    for (size_t j = 0; j < bounds.size(); j++) {
+      random_val[j] = gen.Uniform(bounds[j].min, bounds[j].max);
+    }
+    hits += static_cast<size_t>(func(random_val, bounds.size()));
+  }
+  return hits;
 }
 
 }  // namespace
@@ -51,21 +64,13 @@ bool vladimirova_j_m_monte_karlo_omp::TestTaskOpenMP::ValidationImpl() {
 
 bool vladimirova_j_m_monte_karlo_omp::TestTaskOpenMP::RunImpl() {
   // Multiply matrices
+  // chunks jump to their own samples of one sequence, so the result does not depend on the number of threads
+  const auto accuracy = static_cast<std::int64_t>(accuracy_);
+  constexpr std::int64_t kChunk = 1024;
   size_t successful_point = 0;
-#pragma omp parallel
-  {
-    std::vector<double> random_val = std::vector<double>(var_size_);
-    size_t local_successful_point = 0;
-
-#pragma omp for
-    for (int i = 0; i < (int)accuracy_; i++) {
-      for (size_t j = 0; j < var_size_; j++) {
-        random_val[j] = CreateRandomVal(var_integr_[j].min, var_integr_[j].max);
-      }
-      local_successful_point += (int)(func_(random_val, var_size_));
-    }
-#pragma omp atomic
-    successful_point += local_successful_point;
+#pragma omp parallel for schedule(dynamic) reduction(+ : successful_point)
+  for (std::int64_t first = 0; first < accuracy; first += kChunk) {
+    successful_point += CountHits(func_, var_integr_, first, std::min(first + kChunk, accuracy));
   }
   double s = 1;
   for (size_t i = 0; i < var_size_; i++) {
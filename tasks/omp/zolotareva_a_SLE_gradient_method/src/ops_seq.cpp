@@ -4,9 +4,21 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
+#include "core/sparse/include/sparse_omp.hpp"
+
 bool zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP::PreProcessingImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    sparse_ = true;
+    n_ = static_cast<int>(matrix_.View().rows);
+    b_.assign(matrix_.Rhs().begin(), matrix_.Rhs().end());
+    x_.assign(n_, 0.0);
+    return true;
+  }
   n_ = static_cast<int>(task_data->inputs_count[1]);
   a_.resize(n_ * n_);
   b_.resize(n_);
@@ -21,10 +33,18 @@ bool zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP::PreProcessingImpl() {
     }
   }
 
+  sparse_ = !ppc::core::solver::IsPlainCg(solver_options_);
+  if (sparse_) {
+    matrix_.LoadDense(a_, n_);
+  }
   return true;
 }
 
 bool zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP::ValidationImpl() {
+  // CSR inputs skip the dense symmetry and Cholesky checks, which cost O(n^3)
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    return !task_data->outputs.empty() && matrix_.LoadCsrSystem(*task_data);
+  }
   if (static_cast<int>(task_data->inputs_count[0]) < 0 || static_cast<int>(task_data->inputs_count[1]) < 0 ||
       static_cast<int>(task_data->outputs_count[0]) < 0) {
     return false;
@@ -48,6 +68,11 @@ bool zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP::ValidationImpl() {
 }
 
 bool zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP::RunImpl() {
+  if (sparse_) {
+    const auto result =
+        ppc::core::solver::SolveCg(matrix_.View(), b_, x_, solver_options_, ppc::core::sparse::OmpBackend{});
+    return result.converged;
+  }
   ConjugateGradient(a_, b_, x_, n_);
   return true;
 }
@@ -10,7 +10,6 @@
 namespace ermolaev_v_graham_scan_seq {
 
 constexpr size_t kMinInputPoints = 3;
-constexpr size_t kMinStackPoints = 2;
 
 class Point {
  public:
@@ -39,8 +38,6 @@ class TestTaskSequential : public ppc::core::Task {
 
  private:
   std::vector<Point> input_, output_;
-
-  static int CrossProduct(const Point& p1, const Point& p2, const Point& p3);
 };
 
 }  // namespace ermolaev_v_graham_scan_seq
\ No newline at end of file
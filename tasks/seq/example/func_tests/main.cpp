@@ -71,3 +71,46 @@ TEST(nesterov_a_test_task_seq, test_matmul_100_from_file) {
   test_task_sequential.PostProcessing();
   EXPECT_EQ(in, out);
 }
+
+TEST(nesterov_a_test_task_seq, test_matmul_prepared) {
+  constexpr size_t kCount = 20;
+
+  // Create data
+  std::vector<int> in(kCount * kCount, 0);
+  std::vector<int> out(kCount * kCount, 0);
+
+  for (size_t i = 0; i < kCount; i++) {
+    in[(i * kCount) + i] = 1;
+  }
+
+  // Create task_data
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_seq->inputs_count.emplace_back(in.size());
+  task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_seq->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  nesterov_a_test_task_seq::TestTaskSequential test_task_sequential(task_data_seq);
+  ASSERT_EQ(test_task_sequential.Validation(), true);
+  test_task_sequential.PreProcessing();
+
+  // Run prepared task over stream of new inputs of the same size
+  for (int scale = 1; scale <= 3; scale++) {
+    std::vector<int> new_in(kCount * kCount, 0);
+    std::vector<int> new_out(kCount * kCount, 0);
+    std::vector<int> expected(kCount * kCount, 0);
+    for (size_t i = 0; i < kCount; i++) {
+      new_in[(i * kCount) + i] = scale;
+      expected[(i * kCount) + i] = scale * scale;
+    }
+
+    auto new_task_data = std::make_shared<ppc::core::TaskData>();
+    new_task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(new_in.data()));
+    new_task_data->inputs_count.emplace_back(new_in.size());
+    new_task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(new_out.data()));
+    new_task_data->outputs_count.emplace_back(new_out.size());
+    ASSERT_TRUE(test_task_sequential.RunPrepared(new_task_data));
+    EXPECT_EQ(expected, new_out);
+  }
+}
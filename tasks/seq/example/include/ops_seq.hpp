@@ -14,6 +14,7 @@ class TestTaskSequential : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  bool RebindImpl() override;
 
  private:
   std::vector<int> input_, output_;
@@ -1,5 +1,6 @@
 #include "seq/example/include/ops_seq.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <vector>
@@ -17,6 +18,13 @@ bool nesterov_a_test_task_seq::TestTaskSequential::PreProcessingImpl() {
   return true;
 }
 
+bool nesterov_a_test_task_seq::TestTaskSequential::RebindImpl() {
+  // Reuse buffers allocated by PreProcessingImpl for the same sizes
+  std::ranges::copy(task_data->Input<const int>(0), input_.begin());
+  std::ranges::fill(output_, 0);
+  return true;
+}
+
 bool nesterov_a_test_task_seq::TestTaskSequential::ValidationImpl() {
   // Check equality of counts elements
   return task_data->inputs_count[0] == task_data->outputs_count[0];
@@ -2,8 +2,11 @@
 
 #include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
+
 double fomin_v_conjugate_gradient::FominVConjugateGradientSeq::DotProduct(const std::vector<double>& a,
                                                                           const std::vector<double>& b) {
   double result = 0.0;
@@ -52,6 +55,13 @@ std::vector<double> fomin_v_conjugate_gradient::FominVConjugateGradientSeq::Vect
 }
 
 bool fomin_v_conjugate_gradient::FominVConjugateGradientSeq::PreProcessingImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    sparse_ = true;
+    n = static_cast<int>(matrix_.View().rows);
+    b_.assign(matrix_.Rhs().begin(), matrix_.Rhs().end());
+    output_.resize(n, 0.0);
+    return true;
+  }
   unsigned int input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
   std::vector<double> input(in_ptr, in_ptr + input_size);
@@ -61,10 +71,17 @@ bool fomin_v_conjugate_gradient::FominVConjugateGradientSeq::PreProcessingImpl()
   b_ = std::vector<double>(input.begin() + (n * n), input.end());
   output_.resize(n, 0.0);
 
+  sparse_ = !ppc::core::solver::IsPlainCg(solver_options_);
+  if (sparse_) {
+    matrix_.LoadDense(a_, n);
+  }
   return true;
 }
 
 bool fomin_v_conjugate_gradient::FominVConjugateGradientSeq::ValidationImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    return matrix_.LoadCsrSystem(*task_data);
+  }
   unsigned int input_size = task_data->inputs_count[0];
   const int calculated_n = static_cast<int>((-1.0 + std::sqrt(1 + (4 * input_size))) / 2);
   return (static_cast<unsigned int>(calculated_n * (calculated_n + 1)) == input_size) &&
@@ -72,6 +89,10 @@ bool fomin_v_conjugate_gradient::FominVConjugateGradientSeq::ValidationImpl() {
 }
 
 bool fomin_v_conjugate_gradient::FominVConjugateGradientSeq::RunImpl() {
+  if (sparse_) {
+    output_.assign(n, 0.0);
+    return ppc::core::solver::SolveCg(matrix_.View(), b_, output_, solver_options_).converged;
+  }
   const double epsilon = 1e-6;
   const int max_iter = 1000;
   std::vector<double> x(n, 0.0);
@@ -33,6 +33,4 @@ class TestTaskSequential : public ppc::core::Task {
   std::vector<Point> convexHullPoints_;
 };
 
-std::vector<Point> Jarvis(const std::vector<Point>& points);
-
 }  // namespace kalinin_d_jarvis_convex_hull_seq
@@ -2,56 +2,10 @@
 #include "seq/kalinin_d_jarvis_convex_hull/include/ops_seq.hpp"
 
 #include <algorithm>
-#include <cmath>
 #include <vector>
-using namespace std::chrono_literals;
 
-std::vector<kalinin_d_jarvis_convex_hull_seq::Point> kalinin_d_jarvis_convex_hull_seq::Jarvis(
-    const std::vector<kalinin_d_jarvis_convex_hull_seq::Point>& points) {
-  if (points.size() < 3) {
-    return points;
-  }
-
-  kalinin_d_jarvis_convex_hull_seq::Point p0 = points[0];
-  for (const auto& p : points) {
-    if (p.x < p0.x || (p.x == p0.x && p.y < p0.y)) {
-      p0 = p;
-    }
-  }
-  std::vector<kalinin_d_jarvis_convex_hull_seq::Point> convex_hull = {p0};
-  kalinin_d_jarvis_convex_hull_seq::Point prev_point = p0;
-
-  while (true) {
-    kalinin_d_jarvis_convex_hull_seq::Point next_point = prev_point;  // Инициализация
-    bool found = false;
-    for (const auto& point : points) {
-      if (point == prev_point) {
-        continue;
-      }
-      if (!found) {
-        next_point = point;
-        found = true;
-        continue;
-      }
-      double cross_product = ((point.y - prev_point.y) * (next_point.x - prev_point.x)) -
-                             ((point.x - prev_point.x) * (next_point.y - prev_point.y));
-      if (cross_product > 0 ||
-          (cross_product == 0 &&
-           ((point.x - prev_point.x) * (point.x - prev_point.x) + (point.y - prev_point.y) * (point.y - prev_point.y)) >
-               ((next_point.x - prev_point.x) * (next_point.x - prev_point.x) +
-                (next_point.y - prev_point.y) * (next_point.y - prev_point.y)))) {
-        next_point = point;
-      }
-    }
-    if (!found || next_point == p0) {
-      break;
-    }
-    convex_hull.push_back(next_point);
-    prev_point = next_point;
-  }
-
-  return convex_hull;
-}
+#include "core/hull/include/hull.hpp"
+#include "core/sparse/include/sparse.hpp"
 
 bool kalinin_d_jarvis_convex_hull_seq::TestTaskSequential::PreProcessingImpl() {
   // Init value for input and output
@@ -71,7 +25,10 @@ bool kalinin_d_jarvis_convex_hull_seq::TestTaskSequential::ValidationImpl() {
 }
 
 bool kalinin_d_jarvis_convex_hull_seq::TestTaskSequential::RunImpl() {
-  convexHullPoints_ = kalinin_d_jarvis_convex_hull_seq::Jarvis(points_);
+  // Clockwise from the leftmost point, the order gift wrapping from it gives
+  const auto hull = ppc::core::hull::ConvexHull<Point>(points_, ppc::core::sparse::SeqBackend{});
+  convexHullPoints_ =
+      ppc::core::hull::OrientHull(hull, ppc::core::hull::LeftBottomLess{}, ppc::core::hull::Winding::kClockwise);
   return true;
 }
 
@@ -6,6 +6,7 @@
 #include <random>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/karaseva_e_congrad/include/ops_seq.hpp"
 
@@ -48,6 +49,36 @@ std::vector<double> MultiplyMatrixVector(const std::vector<double>& a_matrix, co
   return result;
 }
 
+// 5-point Laplacian on a side x side grid in CSR form
+ppc::core::solver::CsrMatrix GenerateLaplacian2D(size_t side) {
+  ppc::core::solver::CsrMatrix a;
+  a.rows = side * side;
+  a.cols = a.rows;
+  for (size_t i = 0; i < a.rows; ++i) {
+    const size_t row = i / side;
+    const size_t col = i % side;
+    const auto add = [&](size_t j, double value) {
+      a.col_idx.push_back(static_cast<uint32_t>(j));
+      a.values.push_back(value);
+    };
+    if (row > 0) {
+      add(i - side, -1.0);
+    }
+    if (col > 0) {
+      add(i - 1, -1.0);
+    }
+    add(i, 4.0);
+    if (col + 1 < side) {
+      add(i + 1, -1.0);
+    }
+    if (row + 1 < side) {
+      add(i + side, -1.0);
+    }
+    a.row_ptr.push_back(static_cast<uint32_t>(a.values.size()));
+  }
+  return a;
+}
+
 }  // namespace
 
 TEST(karaseva_e_congrad_seq, test_identity_50) {
@@ -222,4 +253,88 @@ TEST(karaseva_e_congrad_seq, test_diagonal_matrix_100) {
   for (size_t i = 0; i < kN; ++i) {
     EXPECT_NEAR(x[i], 1.0, 1e-9);
   }
-}
\ No newline at end of file
+}
+TEST(karaseva_e_congrad_seq, test_csr_laplacian_incomplete_cholesky) {
+  constexpr size_t kSide = 30;
+  auto a = GenerateLaplacian2D(kSide);
+  const size_t n = a.rows;
+  // b = A * 1
+  std::vector<double> b(n, 0.0);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t e = a.row_ptr[i]; e < a.row_ptr[i + 1]; ++e) {
+      b[i] += a.values[e];
+    }
+  }
+  std::vector<double> x(n, 0.0);
+
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->AddInput(a.row_ptr.data(), a.row_ptr.size());
+  task_data_seq->AddInput(a.col_idx.data(), a.col_idx.size());
+  task_data_seq->AddInput(a.values.data(), a.values.size());
+  task_data_seq->AddInput(b.data(), b.size());
+  task_data_seq->AddOutput(x.data(), x.size());
+
+  karaseva_e_congrad_seq::TestTaskSequential test_task(task_data_seq);
+  test_task.SetSolverOptions({.preconditioner = ppc::core::solver::Preconditioner::kIncompleteCholesky});
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+
+  for (size_t i = 0; i < n; ++i) {
+    EXPECT_NEAR(x[i], 1.0, 1e-8);
+  }
+}
+
+TEST(karaseva_e_congrad_seq, test_random_spd_mixed_precision) {
+  constexpr size_t kN = 40;
+  auto a_matrix = GenerateRandomSPDMatrix(kN, 7);
+  std::vector<double> x_true(kN);
+  for (size_t i = 0; i < kN; ++i) {
+    x_true[i] = static_cast<double>(i % 5) - 2.0;
+  }
+  auto b = MultiplyMatrixVector(a_matrix, x_true, kN);
+  std::vector<double> x(kN, 0.0);
+
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->inputs.push_back(reinterpret_cast<uint8_t*>(a_matrix.data()));
+  task_data_seq->inputs_count.push_back(kN * kN);
+  task_data_seq->inputs.push_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_seq->inputs_count.push_back(kN);
+  task_data_seq->outputs.push_back(reinterpret_cast<uint8_t*>(x.data()));
+  task_data_seq->outputs_count.push_back(kN);
+
+  karaseva_e_congrad_seq::TestTaskSequential test_task(task_data_seq);
+  test_task.SetSolverOptions({.preconditioner = ppc::core::solver::Preconditioner::kJacobi,
+                              .precision = ppc::core::solver::Precision::kMixed});
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+
+  for (size_t i = 0; i < kN; ++i) {
+    EXPECT_NEAR(x[i], x_true[i], 1e-8);
+  }
+}
+
+TEST(karaseva_e_congrad_seq, test_dense_iteration_limit) {
+  constexpr size_t kN = 40;
+  auto a_matrix = GenerateRandomSPDMatrix(kN, 11);
+  std::vector<double> b(kN, 1.0);
+  std::vector<double> x(kN, 0.0);
+
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->inputs.push_back(reinterpret_cast<uint8_t*>(a_matrix.data()));
+  task_data_seq->inputs_count.push_back(kN * kN);
+  task_data_seq->inputs.push_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_seq->inputs_count.push_back(kN);
+  task_data_seq->outputs.push_back(reinterpret_cast<uint8_t*>(x.data()));
+  task_data_seq->outputs_count.push_back(kN);
+
+  // The dense kernel has its own stopping rule, so an iteration limit runs SolveCg, which stops short of it
+  karaseva_e_congrad_seq::TestTaskSequential test_task(task_data_seq);
+  test_task.SetSolverOptions({.max_iterations = 2});
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  EXPECT_FALSE(test_task.Run());
+}
@@ -2,9 +2,19 @@
 
 #include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
+
 bool karaseva_e_congrad_seq::TestTaskSequential::PreProcessingImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    sparse_ = true;
+    size_ = matrix_.View().rows;
+    b_.assign(matrix_.Rhs().begin(), matrix_.Rhs().end());
+    x_ = std::vector<double>(size_, 0.0);
+    return true;
+  }
   // Set the system size based on the length of vector b
   size_ = task_data->inputs_count[1];
   auto* a_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
@@ -15,10 +25,17 @@ bool karaseva_e_congrad_seq::TestTaskSequential::PreProcessingImpl() {
   b_ = std::vector<double>(b_ptr, b_ptr + size_);
   x_ = std::vector<double>(size_, 0.0);  // Initial guess
 
+  sparse_ = !ppc::core::solver::IsPlainCg(solver_options_);
+  if (sparse_) {
+    matrix_.LoadDense(A_, size_);
+  }
   return true;
 }
 
 bool karaseva_e_congrad_seq::TestTaskSequential::ValidationImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    return matrix_.LoadCsrSystem(*task_data);
+  }
   // Check that A is a square matrix (n*n), and b and x have n elements
   const bool valid_input = task_data->inputs_count[0] == task_data->inputs_count[1] * task_data->inputs_count[1];
   const bool valid_output = task_data->outputs_count[0] == task_data->inputs_count[1];
@@ -26,6 +43,9 @@ bool karaseva_e_congrad_seq::TestTaskSequential::ValidationImpl() {
 }
 
 bool karaseva_e_congrad_seq::TestTaskSequential::RunImpl() {
+  if (sparse_) {
+    return ppc::core::solver::SolveCg(matrix_.View(), b_, x_, solver_options_).converged;
+  }
   std::vector<double> r(size_);
   std::vector<double> p(size_);
   std::vector<double> ap(size_);
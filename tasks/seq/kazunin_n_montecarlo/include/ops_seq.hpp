@@ -1,13 +1,11 @@
 #pragma once
 
-#include <algorithm>
 #include <array>
 #include <cstddef>
-#include <functional>
 #include <numeric>
-#include <random>
 #include <utility>
 
+#include "core/random/include/philox.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kazunin_n_montecarlo_seq {
@@ -25,22 +23,13 @@ class MonteCarloSeq : public ppc::core::Task {
   bool PreProcessingImpl() override {
     precision_ = *reinterpret_cast<std::size_t*>(task_data->inputs[0]);
     limits_ = *reinterpret_cast<decltype(limits_)*>(task_data->inputs[1]);
-    std::ranges::generate(generators_, [&, i = 0]() mutable { return MakeGenerator(limits_[i++]); });
     total_space_ = std::accumulate(
         limits_.begin(), limits_.end(), 1.0,
         [](const double acc, const std::pair<double, double>& limit) { return acc * (limit.second - limit.first); });
     return true;
   }
   bool RunImpl() override {
-    double sum = 0.0;
-
-    std::array<double, N> random_args;
-    for (std::size_t iter = 0; iter < precision_; ++iter) {
-      std::ranges::generate(random_args, [this, j = 0]() mutable { return generators_[j++](); });
-      sum += f_(random_args);
-    }
-
-    result_ = (total_space_ * sum) / precision_;
+    result_ = (total_space_ * SampleSum(0, precision_)) / precision_;
     return true;
   }
   bool PostProcessingImpl() override {
@@ -49,18 +38,24 @@ class MonteCarloSeq : public ppc::core::Task {
   }
 
  private:
-  std::function<double()> MakeGenerator(const std::pair<double, double>& interval) {
-    std::uniform_real_distribution<double> distrib(interval.first, interval.second);
-    std::mt19937 engine(seedgen_());
-    return [distrib, engine]() mutable { return distrib(engine); };
+  // Sum of f_ over samples [first, last) of one fixed sequence: every chunk jumps to its own samples
+  double SampleSum(std::size_t first, std::size_t last) const {
+    auto gen = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, N);
+    std::array<double, N> random_args;
+    double sum = 0.0;
+    for (std::size_t iter = first; iter < last; ++iter) {
+      for (std::size_t j = 0; j < N; ++j) {
+        random_args[j] = gen.Uniform(limits_[j].first, limits_[j].second);
+      }
+      sum += f_(random_args);
+    }
+    return sum;
   }
 
   F f_;
   std::size_t precision_;
   double total_space_;
   std::array<std::pair<double, double>, N> limits_;
-  std::array<std::function<double()>, N> generators_;
-  std::random_device seedgen_;
   double result_;
 };
 
@@ -4,8 +4,11 @@
 #include <complex>
 #include <cstddef>
 #include <iostream>
+#include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
+
 void kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS::AddValue(int row, Complex value, int col) {
   for (int j = rowPtr[row]; j < rowPtr[row + 1]; ++j) {
     if (colIndices[j] == col) {
@@ -133,19 +136,17 @@ bool kolodkin_g_multiplication_matrix_seq::TestTaskSequential::ValidationImpl()
 }
 
 bool kolodkin_g_multiplication_matrix_seq::TestTaskSequential::RunImpl() {
-  SparseMatrixCRS c(A_.numRows, B_.numCols);
-  for (unsigned int i = 0; i < (unsigned int)A_.numRows; ++i) {
-    for (unsigned int j = A_.rowPtr[i]; j < (unsigned int)A_.rowPtr[i + 1]; ++j) {
-      unsigned int col_a = A_.colIndices[j];
-      Complex value_a = A_.values[j];
-      for (unsigned int k = B_.rowPtr[col_a]; k < (unsigned int)B_.rowPtr[col_a + 1]; ++k) {
-        unsigned int col_b = B_.colIndices[k];
-        Complex value_b = B_.values[k];
+  using View = ppc::core::sparse::CsrView<Complex, int>;
+  const auto view = [](const SparseMatrixCRS& m) {
+    return View{.rows = static_cast<size_t>(m.numRows), .cols = static_cast<size_t>(m.numCols), .row_ptr = m.rowPtr,
+                .col_idx = m.colIndices, .values = m.values};
+  };
+  auto product = ppc::core::sparse::SpGemm(view(A_), view(B_), ppc::core::sparse::SeqBackend{});
 
-        c.AddValue((int)i, value_a * value_b, (int)col_b);
-      }
-    }
-  }
+  SparseMatrixCRS c(A_.numRows, B_.numCols);
+  c.rowPtr = std::move(product.row_ptr);
+  c.colIndices = std::move(product.col_idx);
+  c.values = std::move(product.values);
   output_ = ParseMatrixIntoVec(c);
   return true;
 }
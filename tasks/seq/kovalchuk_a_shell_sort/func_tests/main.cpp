@@ -249,4 +249,25 @@ TEST(kovalchuk_a_shell_sort, test_double_reverse_size8) {
 
   std::vector<int> expected = {1, 1, 2, 2, 3, 3, 4, 4};
   ASSERT_EQ(expected, output);
-}
\ No newline at end of file
+}
+
+TEST(kovalchuk_a_shell_sort, test_in_place) {
+  std::vector<int> data = {5, -3, 8, 0, 2, 2, -7};
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(data.data()));
+  task_data->inputs_count.emplace_back(data.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(data.data()));
+  task_data->outputs_count.emplace_back(data.size());
+
+  auto task = std::make_shared<kovalchuk_a_shell_sort::ShellSortSequential>(task_data);
+  ASSERT_TRUE(task->IsInPlaceSupported());
+
+  ASSERT_TRUE(task->Validation());
+  task->PreProcessing();
+  task->Run();
+  task->PostProcessing();
+
+  std::vector<int> expected = {-7, -3, 0, 2, 2, 5, 8};
+  ASSERT_EQ(expected, data);
+}
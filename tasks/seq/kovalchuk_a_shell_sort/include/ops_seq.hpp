@@ -1,5 +1,5 @@
 #pragma once
-#include <vector>
+#include <span>
 
 #include "core/task/include/task.hpp"
 
@@ -12,9 +12,11 @@ class ShellSortSequential : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  [[nodiscard]] bool IsInPlaceSupported() const override { return true; }
 
  private:
-  std::vector<int> input_;
+  // sorting is done directly in output buffer
+  std::span<int> data_;
   void ShellSort();
 };
 
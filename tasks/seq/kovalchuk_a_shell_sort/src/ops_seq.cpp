@@ -2,7 +2,6 @@
 
 #include <algorithm>
 #include <utility>
-#include <vector>
 
 #include "core/task/include/task.hpp"
 
@@ -11,8 +10,10 @@ namespace kovalchuk_a_shell_sort {
 ShellSortSequential::ShellSortSequential(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
 
 bool ShellSortSequential::PreProcessingImpl() {
-  auto* input_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-  input_.assign(input_ptr, input_ptr + task_data->inputs_count[0]);
+  data_ = task_data->Output<int>(0);
+  if (!task_data->IsInPlace(0, 0)) {
+    std::ranges::copy(task_data->Input<const int>(0), data_.begin());
+  }
   return true;
 }
 
@@ -27,26 +28,24 @@ bool ShellSortSequential::RunImpl() {
 }
 
 void ShellSortSequential::ShellSort() {
-  if (input_.empty()) {
+  if (data_.empty()) {
     return;
   }
 
-  int n = static_cast<int>(input_.size());
+  int n = static_cast<int>(data_.size());
   for (int gap = n / 2; gap > 0; gap /= 2) {
     for (int i = gap; i < n; ++i) {
-      int temp = input_[i];
+      int temp = data_[i];
       int j = i;
-      for (; j >= gap && input_[j - gap] > temp; j -= gap) {
-        input_[j] = input_[j - gap];
+      for (; j >= gap && data_[j - gap] > temp; j -= gap) {
+        data_[j] = data_[j - gap];
       }
-      input_[j] = temp;
+      data_[j] = temp;
     }
   }
 }
 
 bool ShellSortSequential::PostProcessingImpl() {
-  auto* output_ptr = reinterpret_cast<int*>(task_data->outputs[0]);
-  std::ranges::copy(input_, output_ptr);
   return true;
 }
 
@@ -1,14 +1,30 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <cstddef>
 #include <numbers>
+#include <span>
 #include <utility>
 
 #include "../include/mci_common.hpp"
 #include "../include/mci_seq.hpp"
+#include "core/integrate/include/integrate.hpp"
 
 using namespace krylov_m_monte_carlo;
 
+namespace {
+
+void BatchIntegrand(const ppc::core::integrate::PointBlock& points, std::span<double> values) {
+  const auto x = points.Axis(0);
+  const auto y = points.Axis(1);
+  const auto z = points.Axis(2);
+  for (std::size_t i = 0; i < points.count; ++i) {
+    values[i] = (x[i] * y[i]) + (z[i] * z[i]);
+  }
+}
+
+}  // namespace
+
 using DeterminedTestCase = std::pair<IntegrationParams, double>;
 
 class krylov_m_monte_carlo_test_seq  // NOLINT(readability-identifier-naming)
@@ -40,6 +56,30 @@ TEST_F(krylov_m_monte_carlo_test_seq, validation_failure) {
   EXPECT_FALSE(task.Validation());
 }
 
+TEST_F(krylov_m_monte_carlo_test_seq, batch_integrand_matches_pointwise) {
+  IntegrationParams params{.func = [](const Point& x) { return (x[0] * x[1]) + (x[2] * x[2]); },
+                           .bounds = {{0, 1}, {-1, 2}, {0.5, 1.5}},
+                           .iterations = 100'003};
+  double pointwise{};
+  double batch{};
+
+  TaskSequential pointwise_task(params.CreateTaskData(pointwise));
+  ASSERT_TRUE(pointwise_task.Validation());
+  pointwise_task.PreProcessing();
+  pointwise_task.Run();
+  pointwise_task.PostProcessing();
+
+  params.batch_func = BatchIntegrand;
+  TaskSequential batch_task(params.CreateTaskData(batch));
+  ASSERT_TRUE(batch_task.Validation());
+  batch_task.PreProcessing();
+  batch_task.Run();
+  batch_task.PostProcessing();
+
+  // Same samples summed in the same order
+  EXPECT_DOUBLE_EQ(batch, pointwise);
+}
+
 TEST_P(krylov_m_monte_carlo_test_seq, determined) {
   auto [params, ref] = GetParam();
   RunTest(params, ref);
@@ -3,10 +3,10 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <ctime>
-#include <random>
 #include <vector>
 
+#include "core/random/include/philox.hpp"
+
 namespace lopatin_i_monte_carlo_seq {
 
 bool TestTaskSequential::ValidationImpl() {
@@ -31,32 +31,33 @@ bool TestTaskSequential::PreProcessingImpl() {
 bool TestTaskSequential::RunImpl() {
   const size_t d = integrationBounds_.size() / 2;  // dimensions
 
-  std::random_device rd;
-  std::seed_seq seed{rd(), static_cast<unsigned int>(std::time(nullptr))};
-  std::mt19937 rnd(seed);
-  std::uniform_real_distribution<> dis(0.0, 1.0);
-
-  result_ = 0.0;
-  for (int i = 0; i < iterations_; ++i) {
-    std::vector<double> point(d);
-    for (size_t j = 0; j < d; ++j) {
-      const double min = integrationBounds_[2 * j];
-      const double max = integrationBounds_[(2 * j) + 1];
-      point[j] = min + (max - min) * dis(rnd);
-    }
-    result_ += integrand_(point);
-  }
-
   // volume of integration region
   double volume = 1.0;
   for (size_t j = 0; j < d; ++j) {
     volume *= (integrationBounds_[(2 * j) + 1] - integrationBounds_[2 * j]);
   }
-  result_ = (result_ / iterations_) * volume;
+
+  result_ = (SampleSum(0, iterations_) / iterations_) * volume;
 
   return true;
 }
 
+double TestTaskSequential::SampleSum(std::size_t first, std::size_t last) const {
+  const size_t d = integrationBounds_.size() / 2;  // dimensions
+
+  // sample i takes the uniforms [i * d, (i + 1) * d) of the fixed sequence
+  auto rnd = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, d);
+  std::vector<double> point(d);
+  double sum = 0.0;
+  for (size_t i = first; i < last; ++i) {
+    for (size_t j = 0; j < d; ++j) {
+      point[j] = rnd.Uniform(integrationBounds_[2 * j], integrationBounds_[(2 * j) + 1]);
+    }
+    sum += integrand_(point);
+  }
+  return sum;
+}
+
 bool TestTaskSequential::PostProcessingImpl() {
   auto* output_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
   *output_ptr = result_;
@@ -13,14 +13,6 @@ struct Coord {
   bool operator!=(const Coord o) const { return x != o.x || y != o.y; }
 };
 
-double Distance(Coord a, Coord b);
-
-// Angle Between Three Points
-double ABTP(Coord a, Coord b, Coord c);
-
-// Angle Between Three Points for leftmost point
-double ABTP(Coord a, Coord c);
-
 class TestTaskSequential : public ppc::core::Task {
  public:
   explicit TestTaskSequential(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -31,10 +23,6 @@ class TestTaskSequential : public ppc::core::Task {
 
  private:
   std::vector<Coord> input_, output_;
-  int n_;
-
-  int FindMostLeft();
-  void PointSearch(double t, double &line_angle, int &search_index, int i);
 };
 
 }  // namespace oturin_a_gift_wrapping_seq
\ No newline at end of file
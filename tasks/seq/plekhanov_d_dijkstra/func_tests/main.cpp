@@ -226,3 +226,40 @@ TEST(plekhanov_d_dijkstra_seq, test_dijkstra_EqualOptimalPaths) {
   std::vector<int> expected = {0, 5, 5, 10};
   plekhanov_d_dijkstra_seq::RunTest(adj_list, 0, expected);
 }
+
+TEST(plekhanov_d_dijkstra_seq, test_dijkstra_batched_sources) {
+  // 0 -> 1 (4), 0 -> 2 (1), 1 -> 3 (1), 2 -> 1 (2), 3 -> 0 (7); one row of distances per source
+  std::vector<int> graph_data = {1, 4, 2, 1, -1, 3, 1, -1, 1, 2, -1, 0, 7, -1};
+  std::vector<std::uint32_t> sources = {0, 3, 2};
+  std::vector<int> distances(sources.size() * 4, INT_MAX);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(graph_data.data()));
+  task_data->inputs_count.emplace_back(graph_data.size());
+  task_data->AddInput(sources.data(), sources.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(distances.data()));
+  task_data->outputs_count.emplace_back(distances.size());
+
+  plekhanov_d_dijkstra_seq::TestTaskSequential task(task_data);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  ASSERT_TRUE(task.Run());
+  task.PostProcessing();
+  EXPECT_EQ(distances, (std::vector<int>{0, 3, 1, 4, 7, 10, 8, 0, 10, 2, 0, 3}));
+}
+
+TEST(plekhanov_d_dijkstra_seq, test_dijkstra_batch_rejected) {
+  // 0 -> 1 (4), 1 -> 0 (2); an empty batch and a source past the last vertex both fail validation
+  std::vector<int> graph_data = {1, 4, -1, 0, 2, -1};
+  for (const auto &sources : {std::vector<std::uint32_t>{}, std::vector<std::uint32_t>{1, 2}}) {
+    std::vector<int> distances(4, INT_MAX);
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(graph_data.data()));
+    task_data->inputs_count.emplace_back(graph_data.size());
+    task_data->AddInput(sources.data(), sources.size());
+    task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(distances.data()));
+    task_data->outputs_count.emplace_back(distances.size());
+
+    plekhanov_d_dijkstra_seq::TestTaskSequential task(task_data);
+    EXPECT_FALSE(task.Validation());
+  }
+}
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/graph.hpp"
 #include "core/task/include/task.hpp"
 
 namespace plekhanov_d_dijkstra_seq {
@@ -17,11 +19,11 @@ class TestTaskSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<int> graph_data_;
+  ppc::core::graph::TaskGraph graph_;
+  bool valid_graph_ = false;
+  std::vector<std::uint32_t> sources_;
   std::vector<int> distances_;
-  size_t start_vertex_;
   size_t num_vertices_;
-  static const int kEndOfVertexList;
 };
 
 }  // namespace plekhanov_d_dijkstra_seq
\ No newline at end of file
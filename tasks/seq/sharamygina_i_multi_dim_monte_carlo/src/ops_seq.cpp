@@ -2,11 +2,11 @@
 
 #include <algorithm>
 #include <cstdlib>
-#include <ctime>
 #include <functional>
-#include <random>
 #include <vector>
 
+#include "core/random/include/philox.hpp"
+
 bool sharamygina_i_multi_dim_monte_carlo_seq::MultiDimMonteCarloTask::PreProcessingImpl() {
   auto* raw_bounds = reinterpret_cast<double*>(task_data->inputs[0]);
   size_t total_bounds_count = task_data->inputs_count[0];
@@ -30,21 +30,7 @@ bool sharamygina_i_multi_dim_monte_carlo_seq::MultiDimMonteCarloTask::Validation
 bool sharamygina_i_multi_dim_monte_carlo_seq::MultiDimMonteCarloTask::RunImpl() {
   size_t dimension = boundaries_.size() / 2;
 
-  std::mt19937 engine(static_cast<unsigned long>(std::time(nullptr)));
-  std::uniform_real_distribution<double> distribution(0.0, 1.0);
-
-  double accumulator = 0.0;
-
-  for (int n = 0; n < number_of_iterations_; ++n) {
-    std::vector<double> random_point(dimension);
-    for (size_t i = 0; i < dimension; ++i) {
-      double low = boundaries_[2 * i];
-      double high = boundaries_[(2 * i) + 1];
-      double t = distribution(engine);
-      random_point[i] = low + (high - low) * t;
-    }
-    accumulator += integrating_function_(random_point);
-  }
+  double accumulator = SampleSum(0, number_of_iterations_);
 
   double volume = 1.0;
   for (size_t i = 0; i < dimension; ++i) {
@@ -57,6 +43,22 @@ bool sharamygina_i_multi_dim_monte_carlo_seq::MultiDimMonteCarloTask::RunImpl()
   return true;
 }
 
+double sharamygina_i_multi_dim_monte_carlo_seq::MultiDimMonteCarloTask::SampleSum(size_t first, size_t last) const {
+  size_t dimension = boundaries_.size() / 2;
+
+  auto engine = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, dimension);
+  std::vector<double> random_point(dimension);
+  double accumulator = 0.0;
+
+  for (size_t n = first; n < last; ++n) {
+    for (size_t i = 0; i < dimension; ++i) {
+      random_point[i] = engine.Uniform(boundaries_[2 * i], boundaries_[(2 * i) + 1]);
+    }
+    accumulator += integrating_function_(random_point);
+  }
+  return accumulator;
+}
+
 bool sharamygina_i_multi_dim_monte_carlo_seq::MultiDimMonteCarloTask::PostProcessingImpl() {
   auto* output_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
   output_ptr[0] = final_result_;
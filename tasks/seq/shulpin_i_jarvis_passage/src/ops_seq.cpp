@@ -1,58 +1,11 @@
 #include "seq/shulpin_i_jarvis_passage/include/ops_seq.hpp"
 
 #include <algorithm>
-#include <cmath>
 #include <cstddef>
-#include <unordered_set>
 #include <vector>
 
-int shulpin_i_jarvis_seq::JarvisSequential::Orientation(const Point& p, const Point& q, const Point& r) {
-  double val = ((q.y - p.y) * (r.x - q.x)) - ((q.x - p.x) * (r.y - q.y));
-  if (std::fabs(val) < 1e-9) {
-    return 0;
-  }
-  return (val > 0) ? 1 : 2;
-}
-
-void shulpin_i_jarvis_seq::JarvisSequential::MakeJarvisPassage(std::vector<shulpin_i_jarvis_seq::Point>& input_jar,
-                                                               std::vector<shulpin_i_jarvis_seq::Point>& output_jar) {
-  size_t total = input_jar.size();
-  output_jar.clear();
-  // clang-format off
-  std::unordered_set<shulpin_i_jarvis_seq::Point, 
-                     shulpin_i_jarvis_seq::PointHash, 
-                     shulpin_i_jarvis_seq::PointEqual> unique_points;
-  // clang-format on
-  size_t start = 0;
-  for (size_t i = 1; i < total; ++i) {
-    if (input_jar[i].x < input_jar[start].x ||
-        (input_jar[i].x == input_jar[start].x && input_jar[i].y < input_jar[start].y)) {
-      start = i;
-    }
-  }
-
-  size_t active = start;
-  do {
-    const auto& current = input_jar[active];
-    if (unique_points.find(current) == unique_points.end()) {
-      output_jar.emplace_back(current);
-      unique_points.insert(current);
-    }
-
-    size_t candidate = (active + 1) % total;
-    for (size_t index = 0; index < total; ++index) {
-      if (index == active) {
-        continue;
-      }
-
-      if (Orientation(input_jar[active], input_jar[index], input_jar[candidate]) == 2) {
-        candidate = index;
-      }
-    }
-
-    active = candidate;
-  } while (active != start);
-}
+#include "core/hull/include/hull.hpp"
+#include "core/sparse/include/sparse.hpp"
 
 bool shulpin_i_jarvis_seq::JarvisSequential::PreProcessingImpl() {
   std::vector<shulpin_i_jarvis_seq::Point> tmp_input;
@@ -74,7 +27,11 @@ bool shulpin_i_jarvis_seq::JarvisSequential::ValidationImpl() {
 }
 
 bool shulpin_i_jarvis_seq::JarvisSequential::RunImpl() {
-  MakeJarvisPassage(input_, output_);
+  // Counterclockwise from the leftmost point with every point on the boundary, the way the passage walks it
+  const auto hull =
+      ppc::core::hull::ConvexHull<Point>(input_, ppc::core::sparse::SeqBackend{}, ppc::core::hull::HullPoints::kBoundary);
+  output_ =
+      ppc::core::hull::OrientHull(hull, ppc::core::hull::LeftBottomLess{}, ppc::core::hull::Winding::kCounterclockwise);
   return true;
 }
 
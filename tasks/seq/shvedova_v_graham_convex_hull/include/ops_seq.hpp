@@ -1,15 +1,16 @@
 #pragma once
 
-#include <array>
 #include <utility>
 #include <vector>
 
 #include "core/task/include/task.hpp"
 
-using Point = std::array<double, 2>;
-
 namespace shvedova_v_graham_convex_hull_seq {
 
+struct Point {
+  double x, y;
+};
+
 class GrahamConvexHullSequential : public ppc::core::Task {
  public:
   explicit GrahamConvexHullSequential(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -23,8 +24,6 @@ class GrahamConvexHullSequential : public ppc::core::Task {
   int points_count_{0};
   std::vector<Point> input_;
   std::vector<Point> res_;
-
-  void PerformSort();
 };
 
 }  // namespace shvedova_v_graham_convex_hull_seq
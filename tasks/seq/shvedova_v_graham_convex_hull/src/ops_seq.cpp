@@ -6,6 +6,9 @@
 #include <span>
 #include <vector>
 
+#include "core/hull/include/hull.hpp"
+#include "core/sparse/include/sparse.hpp"
+
 namespace {
 bool CheckCollinearity(std::span<double> raw_points) {
   const auto points_count = raw_points.size() / 2;
@@ -23,20 +26,6 @@ bool CheckCollinearity(std::span<double> raw_points) {
   }
   return true;
 }
-bool ComparePoints(const Point &p0, const Point &p1, const Point &p2) {
-  const auto dx1 = p1[0] - p0[0];
-  const auto dy1 = p1[1] - p0[1];
-  const auto dx2 = p2[0] - p0[0];
-  const auto dy2 = p2[1] - p0[1];
-  const auto cross = (dx1 * dy2) - (dy1 * dx2);
-  if (std::abs(cross) < 1e-9) {
-    return (dx1 * dx1 + dy1 * dy1) < (dx2 * dx2 + dy2 * dy2);
-  }
-  return cross > 0;
-}
-double CrossProduct(const Point &p0, const Point &p1, const Point &p2) {
-  return ((p1[0] - p0[0]) * (p2[1] - p0[1])) - ((p1[1] - p0[1]) * (p2[0] - p0[0]));
-}
 }  // namespace
 
 namespace shvedova_v_graham_convex_hull_seq {
@@ -55,8 +44,8 @@ bool GrahamConvexHullSequential::PreProcessingImpl() {
 
   auto *p_src = reinterpret_cast<double *>(task_data->inputs[0]);
   for (int i = 0; i < points_count_ * 2; i += 2) {
-    input_[i / 2][0] = p_src[i];
-    input_[i / 2][1] = p_src[i + 1];
+    input_[i / 2].x = p_src[i];
+    input_[i / 2].y = p_src[i + 1];
   }
 
   res_.clear();
@@ -65,22 +54,12 @@ bool GrahamConvexHullSequential::PreProcessingImpl() {
   return true;
 }
 
-void GrahamConvexHullSequential::PerformSort() {
-  const auto pivot = *std::ranges::min_element(input_, [](auto &a, auto &b) { return a[1] < b[1]; });
-  std::ranges::sort(input_.begin(), input_.end(),
-                    [&](const Point &p1, const Point &p2) { return ComparePoints(pivot, p1, p2); });
-}
-
 bool GrahamConvexHullSequential::RunImpl() {
-  PerformSort();
-  res_.push_back(input_[0]);
-  res_.push_back(input_[1]);
-  for (int i = 2; i < points_count_; ++i) {
-    while (res_.size() > 1 && CrossProduct(res_[res_.size() - 2], res_.back(), input_[i]) <= 0) {
-      res_.pop_back();
-    }
-    res_.push_back(input_[i]);
-  }
+  res_ = ppc::core::hull::ConvexHull<Point>(input_, ppc::core::sparse::SeqBackend{});
+  // The scan starts from the first of the lowest input points
+  const auto pivot = *std::ranges::min_element(input_, {}, &Point::y);
+  const auto first = std::ranges::find_if(res_, [&](const Point &p) { return ppc::core::hull::SamePoint(p, pivot); });
+  std::ranges::rotate(res_, first);
   return true;
 }
 
@@ -89,8 +68,8 @@ bool GrahamConvexHullSequential::PostProcessingImpl() {
   *reinterpret_cast<int *>(task_data->outputs[0]) = res_points_count;
   auto *p_out = reinterpret_cast<double *>(task_data->outputs[1]);
   for (int i = 0; i < res_points_count; i++) {
-    p_out[2 * i] = res_[i][0];
-    p_out[(2 * i) + 1] = res_[i][1];
+    p_out[2 * i] = res_[i].x;
+    p_out[(2 * i) + 1] = res_[i].y;
   }
   return true;
 }
@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
 #include "core/task/include/task.hpp"
 
 namespace sidorina_p_gradient_method_seq {
@@ -128,6 +129,10 @@ class GradientMethod : public ppc::core::Task {
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
+  // Options other than the defaults (see IsPlainCg) solve a dense A with the sparse solver too; the
+  // tolerance input overrides options.tolerance
+  void SetSolverOptions(const ppc::core::solver::CgOptions& options) { solver_options_ = options; }
+
  private:
   int size_;
   double tolerance_;
@@ -135,6 +140,10 @@ class GradientMethod : public ppc::core::Task {
   std::vector<double> b_;
   std::vector<double> solution_;
   std::vector<double> result_;
+  // CSR inputs or solver options other than plain CG
+  bool sparse_ = false;
+  ppc::core::solver::TaskMatrix matrix_;
+  ppc::core::solver::CgOptions solver_options_;
 };
 
 }  // namespace sidorina_p_gradient_method_seq
\ No newline at end of file
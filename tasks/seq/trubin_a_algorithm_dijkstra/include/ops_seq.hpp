@@ -4,16 +4,10 @@
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/graph.hpp"
 #include "core/task/include/task.hpp"
 
 namespace trubin_a_algorithm_dijkstra_seq {
-struct Edge {
-  size_t to;
-  int weight;
-
-  Edge(size_t to, int weight) : to(to), weight(weight) {}
-};
-
 class TestTaskSequential : public ppc::core::Task {
  public:
   explicit TestTaskSequential(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -24,16 +18,13 @@ class TestTaskSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  bool BuildAdjacencyList(const std::vector<int>& graph_data);
 
-  std::vector<std::vector<Edge>> adjacency_list_;
+  ppc::core::graph::TaskGraph graph_;
   std::vector<int> distances_;
   size_t start_vertex_ = 0;
   size_t num_vertices_ = 0;
 
   bool validation_passed_ = false;
-
-  static constexpr int kEndOfVertexList = -1;
 };
 
 }  // namespace trubin_a_algorithm_dijkstra_seq
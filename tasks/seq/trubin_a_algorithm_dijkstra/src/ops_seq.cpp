@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <queue>
@@ -13,25 +14,21 @@ bool trubin_a_algorithm_dijkstra_seq::TestTaskSequential::PreProcessingImpl() {
     return false;
   }
 
-  unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-  std::vector<int> graph_data(in_ptr, in_ptr + input_size);
-
   num_vertices_ = task_data->outputs_count[0];
 
-  if (num_vertices_ == 0 || input_size == 0) {
+  if (num_vertices_ == 0 || task_data->inputs_count[0] == 0) {
     return true;
   }
 
-  adjacency_list_.assign(num_vertices_, {});
   distances_.assign(num_vertices_, std::numeric_limits<int>::max());
 
-  if (!BuildAdjacencyList(graph_data)) {
+  if (!graph_.Load(*task_data, num_vertices_, ppc::core::graph::ParseMode::kStrict)) {
     return false;
   }
 
-  if (task_data->inputs.size() > 1 && task_data->inputs[1] != nullptr) {
-    int* ptr = reinterpret_cast<int*>(task_data->inputs[1]);
+  const size_t start_input = graph_.NextInput();
+  if (task_data->inputs.size() > start_input && task_data->inputs[start_input] != nullptr) {
+    int* ptr = reinterpret_cast<int*>(task_data->inputs[start_input]);
     if (*ptr < 0 || static_cast<size_t>(*ptr) >= num_vertices_) {
       return false;
     }
@@ -80,6 +77,7 @@ bool trubin_a_algorithm_dijkstra_seq::TestTaskSequential::RunImpl() {
 
   using QueueElement = std::pair<int, size_t>;
   std::priority_queue<QueueElement, std::vector<QueueElement>, std::greater<>> min_heap;
+  const auto graph = graph_.View();
   min_heap.emplace(0, start_vertex_);
 
   while (!min_heap.empty()) {
@@ -90,11 +88,11 @@ bool trubin_a_algorithm_dijkstra_seq::TestTaskSequential::RunImpl() {
       continue;
     }
 
-    for (const auto& edge : adjacency_list_[u]) {
-      int new_dist = distances_[u] + edge.weight;
-      if (new_dist < distances_[edge.to]) {
-        distances_[edge.to] = new_dist;
-        min_heap.emplace(new_dist, edge.to);
+    for (std::uint32_t e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+      int new_dist = distances_[u] + graph.weights[e];
+      if (new_dist < distances_[graph.targets[e]]) {
+        distances_[graph.targets[e]] = new_dist;
+        min_heap.emplace(new_dist, graph.targets[e]);
       }
     }
   }
@@ -116,35 +114,3 @@ bool trubin_a_algorithm_dijkstra_seq::TestTaskSequential::PostProcessingImpl() {
   }
   return true;
 }
-
-bool trubin_a_algorithm_dijkstra_seq::TestTaskSequential::BuildAdjacencyList(const std::vector<int>& graph_data) {
-  size_t current_vertex = 0;
-  size_t i = 0;
-
-  while (i < graph_data.size()) {
-    if (graph_data[i] == kEndOfVertexList) {
-      if (current_vertex >= num_vertices_) {
-        return false;
-      }
-      current_vertex++;
-      i++;
-      continue;
-    }
-
-    if (i + 1 >= graph_data.size()) {
-      return false;
-    }
-
-    auto to = static_cast<size_t>(graph_data[i]);
-    int weight = graph_data[i + 1];
-
-    if (to >= num_vertices_ || weight < 0) {
-      return false;
-    }
-
-    adjacency_list_[current_vertex].emplace_back(to, weight);
-    i += 2;
-  }
-
-  return true;
-}
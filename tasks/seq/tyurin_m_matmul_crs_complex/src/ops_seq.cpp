@@ -1,39 +1,9 @@
 #include "seq/tyurin_m_matmul_crs_complex/include/ops_seq.hpp"
 
-#include <cmath>
 #include <complex>
-#include <cstdint>
-#include <cstdio>
-#include <vector>
+#include <utility>
 
-namespace {
-MatrixCRS TransposeMatrixCRS(const MatrixCRS &crs) {
-  const auto new_cols = crs.GetRows();
-
-  MatrixCRS res;
-  res.cols_count = new_cols;
-  res.rowptr.resize(crs.GetCols() + 2);
-  res.colind.resize(crs.colind.size(), 0);
-  res.data.resize(crs.data.size(), 0);
-
-  for (uint32_t i = 0; i < crs.data.size(); ++i) {
-    ++res.rowptr[crs.colind[i] + 2];
-  }
-  for (uint32_t i = 2; i < res.rowptr.size(); ++i) {
-    res.rowptr[i] += res.rowptr[i - 1];
-  }
-  for (uint32_t i = 0; i < new_cols; ++i) {
-    for (uint32_t j = crs.rowptr[i]; j < crs.rowptr[i + 1]; ++j) {
-      const auto new_index = res.rowptr[crs.colind[j] + 1]++;
-      res.data[new_index] = crs.data[j];
-      res.colind[new_index] = i;
-    }
-  }
-  res.rowptr.pop_back();
-
-  return res;
-}
-}  // namespace
+#include "core/sparse/include/sparse.hpp"
 
 bool tyurin_m_matmul_crs_complex_seq::TestTaskSequential::ValidationImpl() {
   const bool left_cols_equal_right_rows = task_data->inputs_count[1] == task_data->inputs_count[2];
@@ -44,39 +14,21 @@ bool tyurin_m_matmul_crs_complex_seq::TestTaskSequential::ValidationImpl() {
 
 bool tyurin_m_matmul_crs_complex_seq::TestTaskSequential::PreProcessingImpl() {
   lhs_ = *reinterpret_cast<MatrixCRS *>(task_data->inputs[0]);
-  rhs_ = TransposeMatrixCRS(*reinterpret_cast<MatrixCRS *>(task_data->inputs[1]));
-  res_ = {};
-  res_.rowptr.resize(lhs_.GetRows() + 1);
-  res_.cols_count = rhs_.GetRows();
+  rhs_ = *reinterpret_cast<MatrixCRS *>(task_data->inputs[1]);
   return true;
 }
 
 bool tyurin_m_matmul_crs_complex_seq::TestTaskSequential::RunImpl() {
-  const auto rows = lhs_.GetRows();
-  const auto cols = rhs_.GetRows();
-
-  for (uint32_t i = 0; i < rows; ++i) {
-    for (uint32_t j = 0; j < cols; ++j) {
-      auto ii = lhs_.rowptr[i];
-      auto ij = rhs_.rowptr[j];
-      std::complex<double> summul = 0.0;
-      while (ii < lhs_.rowptr[i + 1] && ij < rhs_.rowptr[j + 1]) {
-        if (lhs_.colind[ii] < rhs_.colind[ij]) {
-          ++ii;
-        } else if (lhs_.colind[ii] > rhs_.colind[ij]) {
-          ++ij;
-        } else {
-          summul += lhs_.data[ii++] * rhs_.data[ij++];
-        }
-      }
-      if (summul != 0.0) {
-        res_.data.push_back(summul);
-        res_.colind.push_back(j);
-      }
-    }
-    res_.rowptr[i + 1] = res_.data.size();
-  }
-
+  using View = ppc::core::sparse::CsrView<std::complex<double>>;
+  const auto view = [](const MatrixCRS &m) {
+    return View{.rows = m.GetRows(), .cols = m.GetCols(), .row_ptr = m.rowptr, .col_idx = m.colind, .values = m.data};
+  };
+  auto product =
+      ppc::core::sparse::SpGemm(view(lhs_), view(rhs_), ppc::core::sparse::SeqBackend{}, {.drop_zeros = true});
+  res_.cols_count = rhs_.GetCols();
+  res_.rowptr = std::move(product.row_ptr);
+  res_.colind = std::move(product.col_idx);
+  res_.data = std::move(product.values);
   return true;
 }
 
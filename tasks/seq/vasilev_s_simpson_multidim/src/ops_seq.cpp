@@ -1,15 +1,15 @@
 #include "../include/ops_seq.hpp"
 
 #include <algorithm>
-#include <cmath>
 #include <cstddef>
 #include <numeric>
-#include <vector>
+
+#include "core/integrate/include/integrate.hpp"
 
 bool vasilev_s_simpson_multidim::SimpsonTaskOmp::ValidationImpl() {
   const auto arity = task_data->inputs_count[0];
 
-  const bool inputs_are_present = task_data->inputs.size() == 3 && arity > 0;
+  const bool inputs_are_present = (task_data->inputs.size() == 3 || task_data->inputs.size() == 4) && arity > 0;
   const bool outputs_are_present = task_data->outputs.size() == 1 && task_data->outputs_count[0] == 1;
   if (!inputs_are_present || !outputs_are_present) {
     return false;
@@ -25,50 +25,26 @@ bool vasilev_s_simpson_multidim::SimpsonTaskOmp::PreProcessingImpl() {
   bounds_.assign(bsrc, bsrc + arity_);
 
   func_ = reinterpret_cast<IntegrandFunction>(task_data->inputs[1]);
+  batch_func_ = task_data->inputs.size() > 3 ? reinterpret_cast<BatchIntegrandFunction>(task_data->inputs[3]) : nullptr;
   approxs_ = *reinterpret_cast<std::size_t*>(task_data->inputs[2]);
 
   steps_.resize(arity_);
   std::ranges::transform(bounds_, steps_.begin(), [n = approxs_](const auto& b) { return (b.hi - b.lo) / n; });
 
-  gridcap_ = static_cast<std::size_t>(std::pow(approxs_, arity_));
+  axes_.clear();
+  for (std::size_t i = 0; i < arity_; i++) {
+    axes_.push_back(ppc::core::integrate::SimpsonAxis(bounds_[i].lo, steps_[i], approxs_));
+  }
+  gridcap_ = ppc::core::integrate::GridSize(axes_);
   scale_ = std::accumulate(steps_.begin(), steps_.end(), 1., [](double cur, double step) { return cur * step / 3.; });
 
   return true;
 }
 
 bool vasilev_s_simpson_multidim::SimpsonTaskOmp::RunImpl() {
-  double isum = 0.;
-
-  std::vector<std::size_t> gridpos(arity_);
-  std::vector<double> coordbuf(arity_);
-  for (std::size_t ip = 0; ip < gridcap_; ip++) {
-    {
-      auto p = ip;
-      for (size_t i = 0; i < arity_; i++) {
-        gridpos[i] = p % approxs_;
-        p /= approxs_;
-      }
-    }
-
-    for (size_t i = 0; i < arity_; i++) {
-      coordbuf[i] = bounds_[i].lo + (static_cast<double>(gridpos[i]) * steps_[i]);
-    }
-
-    double coefficient = 1.;
-    for (auto pos : gridpos) {
-      if (pos == 0 || pos == (approxs_ - 1)) {
-        coefficient *= 1.;
-      } else if (pos % 2 != 0) {
-        coefficient *= 4.;
-      } else {
-        coefficient *= 2.;
-      }
-    }
-
-    isum += coefficient * func_(coordbuf);
-  }
-
-  result_ = isum * scale_;
+  // Grid points are walked incrementally and evaluated with one integrand call per block
+  const auto integrand = ppc::core::integrate::BatchOrPointwise(batch_func_, func_);
+  result_ = ppc::core::integrate::WeightedGridSum(axes_, 0, gridcap_, integrand) * scale_;
 
   return true;
 }
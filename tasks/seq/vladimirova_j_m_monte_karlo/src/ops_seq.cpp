@@ -3,16 +3,27 @@
 
 #include <cmath>
 #include <cstddef>
-#include <random>
 #include <vector>
 
+#include "core/random/include/philox.hpp"
+
 namespace {
 
-std::random_device rd;
-std::mt19937 gen(rd());
-double CreateRandomVal(double min_v, double max_v) {
-  std::uniform_real_distribution<double> dis(min_v, max_v);
-  return dis(gen);
+// Number of samples [first, last) of the sequence fixed by the default seed at which func holds;
+// sample i takes the uniforms [i * bounds.size(), (i + 1) * bounds.size()) of the sequence
+size_t CountHits(bool (*func)(std::vector<double>, size_t),
+                 const std::vector<vladimirova_j_m_monte_karlo_seq::BoundariesIntegral> &bounds, size_t first,
+                 size_t last) {
+  auto gen = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, bounds.size());
+  std::vector<double> random_val(bounds.size());
+  size_t hits = 0;
+  for (size_t i = first; i < last; i++) {
+    for (size_t j = 0; j < bounds.size(); j++) {
+      random_val[j] = gen.Uniform(bounds[j].min, bounds[j].max);
+    }
+    hits += static_cast<size_t>(func(random_val, bounds.size()));
+  }
+  return hits;
 }
 
 }  // namespace
@@ -53,14 +64,7 @@ bool vladimirova_j_m_monte_karlo_seq::TestTaskSequential::ValidationImpl() {
 
 bool vladimirova_j_m_monte_karlo_seq::TestTaskSequential::RunImpl() {
   // Multiply matrices
-  size_t successful_point = 0;
-  std::vector<double> random_val = std::vector<double>(var_size_);
-  for (size_t i = 0; i < accuracy_; i++) {
-    for (size_t j = 0; j < var_size_; j++) {
-      random_val[j] = CreateRandomVal(var_integr_[j].min, var_integr_[j].max);
-    }
-    successful_point += (int)(func_(random_val, var_size_));
-  }
+  size_t successful_point = CountHits(func_, var_integr_, 0, accuracy_);
   double s = 1;
   for (size_t i = 0; i < var_size_; i++) {
     s *= (var_integr_[i].max - var_integr_[i].min);
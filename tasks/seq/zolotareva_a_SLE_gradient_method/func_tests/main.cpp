@@ -5,6 +5,7 @@
 #include <random>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/zolotareva_a_SLE_gradient_method/include/ops_seq.hpp"
 
@@ -239,3 +240,44 @@ TEST(zolotareva_a_sle_gradient_method_seq, Test_Image_random_n_3) { Form(3); };
 TEST(zolotareva_a_sle_gradient_method_seq, Test_Image_random_n_5) { Form(5); };
 TEST(zolotareva_a_sle_gradient_method_seq, Test_Image_random_n_7) { Form(7); };
 TEST(zolotareva_a_sle_gradient_method_seq, Test_Image_random_n_20) { Form(591); };
+
+TEST(zolotareva_a_sle_gradient_method_seq, csr_input_incomplete_cholesky) {
+  // Pentadiagonal SPD matrix: 4 on the diagonal, -1 at distances 1 and 10
+  const int n = 200;
+  std::vector<uint32_t> row_ptr = {0};
+  std::vector<uint32_t> col_idx;
+  std::vector<double> values;
+  for (int i = 0; i < n; ++i) {
+    for (const int j : {i - 10, i - 1, i, i + 1, i + 10}) {
+      if (j >= 0 && j < n) {
+        col_idx.push_back(static_cast<uint32_t>(j));
+        values.push_back(j == i ? 4.0 : -1.0);
+      }
+    }
+    row_ptr.push_back(static_cast<uint32_t>(values.size()));
+  }
+  std::vector<double> b(n, 1.0);
+  std::vector<double> x(n);
+
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->AddInput(row_ptr.data(), row_ptr.size());
+  task_data_seq->AddInput(col_idx.data(), col_idx.size());
+  task_data_seq->AddInput(values.data(), values.size());
+  task_data_seq->AddInput(b.data(), b.size());
+  task_data_seq->AddOutput(x.data(), x.size());
+
+  zolotareva_a_sle_gradient_method_seq::TestTaskSequential task(task_data_seq);
+  task.SetSolverOptions({.preconditioner = ppc::core::solver::Preconditioner::kIncompleteCholesky});
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  for (int i = 0; i < n; ++i) {
+    double sum = 0.0;
+    for (uint32_t e = row_ptr[i]; e < row_ptr[i + 1]; ++e) {
+      sum += values[e] * x[col_idx[e]];
+    }
+    EXPECT_NEAR(sum, b[i], 1e-9);
+  }
+}
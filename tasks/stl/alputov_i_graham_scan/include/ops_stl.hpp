@@ -29,17 +29,6 @@ class TestTaskSTL : public ppc::core::Task {
  private:
   std::vector<Point> input_points_;
   std::vector<Point> convex_hull_;
-
-  [[nodiscard]] Point FindPivot() const;
-  [[nodiscard]] std::vector<Point> SortPoints(const Point& pivot);
-  static std::vector<Point> BuildHull(const std::vector<Point>& sorted_points, const Point& pivot);
-  static void RemoveDuplicates(std::vector<Point>& points);
-  [[nodiscard]] static bool CompareAngles(const Point& first_point, const Point& second_point,
-                                          const Point& pivot_point);
-
-  static double Cross(const Point& o, const Point& a, const Point& b);
-
-  void ParallelSort(std::vector<Point>& points, auto comp);
 };
 
 }  // namespace alputov_i_graham_scan_stl
\ No newline at end of file
@@ -17,11 +17,6 @@ class IntegralsSimpsonSTL : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  struct IterationRange {
-    int start;
-    int end;
-  };
-
   int dimension_{};
   std::vector<double> a_, b_;
   std::vector<int> n_;
@@ -31,9 +26,6 @@ class IntegralsSimpsonSTL : public ppc::core::Task {
   [[nodiscard]] double FunctionN(const std::vector<double>& coords) const;
   double RecursiveSimpsonSum(int dim_index, std::vector<int>& idx, const std::vector<double>& steps) const;
   void ThreadTaskRunner(int start_idx, int end_idx, const std::vector<double>& steps, double* partial_sum_output);
-
-  [[nodiscard]] static unsigned int DetermineNumThreads(int total_iterations);
-  [[nodiscard]] static std::vector<IterationRange> DistributeIterations(int total_iterations, unsigned int num_threads);
 };
 
 }  // namespace anufriev_d_integrals_simpson_stl
\ No newline at end of file
@@ -1,13 +1,11 @@
 #include "stl/anufriev_d_integrals_simpson/include/ops_stl.hpp"
 
-#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <functional>
-#include <thread>
 #include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/pool/include/thread_pool.hpp"
 
 namespace {
 
@@ -130,58 +128,6 @@ void IntegralsSimpsonSTL::ThreadTaskRunner(int start_idx, int end_idx, const std
   *partial_sum_output = local_partial_sum;
 }
 
-unsigned int IntegralsSimpsonSTL::DetermineNumThreads(int total_iterations) {
-  unsigned int num_threads = ppc::util::GetPPCNumThreads();
-  if (num_threads == 0) {
-    num_threads = 2;
-  }
-  if (total_iterations <= 0) {
-    return 0;
-  }
-  num_threads = std::min(num_threads, static_cast<unsigned int>(total_iterations));
-
-  if (num_threads == 0) {
-    num_threads = 1;
-  }
-  return num_threads;
-}
-
-std::vector<IntegralsSimpsonSTL::IterationRange> IntegralsSimpsonSTL::DistributeIterations(int total_iterations,
-                                                                                           unsigned int num_threads) {
-  std::vector<IterationRange> ranges;
-  if (num_threads == 0 || total_iterations == 0) {
-    return ranges;
-  }
-  auto total_iter_unsigned = static_cast<unsigned int>(total_iterations);
-  unsigned int iterations_per_thread_unsigned = total_iter_unsigned / num_threads;
-  unsigned int remaining_iterations_unsigned = total_iter_unsigned % num_threads;
-
-  int current_start_idx = 0;
-  for (unsigned int i = 0; i < num_threads; ++i) {
-    unsigned int current_chunk_size = iterations_per_thread_unsigned;
-    if (remaining_iterations_unsigned > 0) {
-      current_chunk_size++;
-      remaining_iterations_unsigned--;
-    }
-
-    if (current_chunk_size == 0) {
-      break;
-    }
-
-    int current_end_idx = current_start_idx + static_cast<int>(current_chunk_size);
-    current_end_idx = std::min(current_end_idx, total_iterations);
-
-    if (current_start_idx < current_end_idx) {
-      ranges.push_back({current_start_idx, current_end_idx});
-    }
-    current_start_idx = current_end_idx;
-    if (current_start_idx >= total_iterations) {
-      break;
-    }
-  }
-  return ranges;
-}
-
 bool IntegralsSimpsonSTL::RunImpl() {
   if (dimension_ < 1) {
     return false;
@@ -200,45 +146,14 @@ bool IntegralsSimpsonSTL::RunImpl() {
 
   const int total_iterations_dim0 = n_[0] + 1;
 
-  unsigned int num_actual_threads = DetermineNumThreads(total_iterations_dim0);
-
-  if (num_actual_threads == 0 && total_iterations_dim0 > 0) {
-    num_actual_threads = 1;
-  }
-
-  std::vector<double> partial_sums(num_actual_threads, 0.0);
-  std::vector<std::thread> threads;
-
-  if (num_actual_threads == 1) {
-    if (!partial_sums.empty()) {
-      ThreadTaskRunner(0, total_iterations_dim0, steps, partial_sums.data());
-    }
-  } else if (num_actual_threads != 0) {
-    std::vector<IterationRange> ranges = DistributeIterations(total_iterations_dim0, num_actual_threads);
-
-    if (ranges.size() < num_actual_threads && !ranges.empty()) {
-      partial_sums.resize(ranges.size());
-    } else if (ranges.empty() && num_actual_threads > 0) {
-      partial_sums.clear();
-    }
-
-    for (size_t i = 0; i < ranges.size(); ++i) {
-      const auto& range = ranges[i];
-      threads.emplace_back(&IntegralsSimpsonSTL::ThreadTaskRunner, this, range.start, range.end, std::cref(steps),
-                           &partial_sums[i]);
-    }
-  }
-
-  for (auto& th : threads) {
-    if (th.joinable()) {
-      th.join();
-    }
-  }
-
-  double total_sum = 0.0;
-  for (double p_sum : partial_sums) {
-    total_sum += p_sum;
-  }
+  const double total_sum = ppc::core::ParallelReduce<double>(
+      0, total_iterations_dim0, 0.0,
+      [&](size_t start, size_t end) {
+        double partial_sum = 0.0;
+        ThreadTaskRunner(static_cast<int>(start), static_cast<int>(end), steps, &partial_sum);
+        return partial_sum;
+      },
+      std::plus<>());
 
   double coeff = 1.0;
   for (int i = 0; i < dimension_; i++) {
@@ -5,11 +5,10 @@
 #include <cmath>
 #include <cstdint>
 #include <cstring>
-#include <functional>
 #include <limits>
-#include <thread>
 #include <vector>
 
+#include "core/pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 namespace bessonov_e_radix_sort_simple_merging_stl {
@@ -110,40 +109,26 @@ bool bessonov_e_radix_sort_simple_merging_stl::TestTaskSTL::RunImpl() {
   size_t num_threads = ppc::util::GetPPCNumThreads();
   num_threads = std::max<size_t>(1, num_threads);
   const size_t block_size = (n + num_threads - 1) / num_threads;
-  {
-    std::vector<std::thread> threads;
-    for (size_t i = 0; i < num_threads; ++i) {
-      size_t start = i * block_size;
-      size_t end = std::min(start + block_size, n);
-      if (start >= n) {
-        break;
-      }
-      threads.emplace_back(ConvertDoubleToBits, std::cref(input_), std::ref(bits), start, end);
+  ppc::core::ParallelFor(0, num_threads, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; ++i) {
+      const size_t start = std::min(i * block_size, n);
+      const size_t end = std::min(start + block_size, n);
+      ConvertDoubleToBits(input_, bits, start, end);
     }
-    for (auto& t : threads) {
-      t.join();
-    }
-  }
+  });
 
   constexpr int kPasses = sizeof(uint64_t);
   for (int pass = 0; pass < kPasses; ++pass) {
     RadixSortPass(bits, temp, pass * 8);
   }
 
-  {
-    std::vector<std::thread> threads;
-    for (size_t i = 0; i < num_threads; ++i) {
-      size_t start = i * block_size;
-      size_t end = std::min(start + block_size, n);
-      if (start >= n) {
-        break;
-      }
-      threads.emplace_back(ConvertBitsToDouble, std::cref(bits), std::ref(output_), start, end);
+  ppc::core::ParallelFor(0, num_threads, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; ++i) {
+      const size_t start = std::min(i * block_size, n);
+      const size_t end = std::min(start + block_size, n);
+      ConvertBitsToDouble(bits, output_, start, end);
     }
-    for (auto& t : threads) {
-      t.join();
-    }
-  }
+  });
 
   return true;
 }
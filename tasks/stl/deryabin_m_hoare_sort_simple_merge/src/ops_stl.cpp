@@ -4,9 +4,10 @@
 #include <bit>
 #include <cmath>
 #include <cstddef>
-#include <thread>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+#include "core/pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 void deryabin_m_hoare_sort_simple_merge_stl::HoareSort(std::vector<double>& a, size_t first, size_t last) {
@@ -85,55 +86,27 @@ bool deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSTL::ValidationImpl()
 }
 
 bool deryabin_m_hoare_sort_simple_merge_stl::HoareSortTaskSTL::RunImpl() {
-  const size_t num_threads =
-      std::min(static_cast<unsigned int>(ppc::util::GetPPCNumThreads()), std::thread::hardware_concurrency());
-  if (chunk_count_ < num_threads) {
-    // Увеличиваем число кусочков до ближайшей степени двойки >= num_threads,
-    // чтобы эффективно загрузить все доступные потоки
-    chunk_count_ = 1ULL << std::bit_width(num_threads - 1);
-    min_chunk_size_ = dimension_ / chunk_count_;
+  std::vector<size_t> bounds(chunk_count_ + 1);
+  for (size_t count = 0; count <= chunk_count_; count++) {
+    bounds[count] = count * dimension_ / chunk_count_;
   }
-  std::vector<std::thread> workers;
-  workers.reserve(num_threads);
-  auto parallel_for = [&num_threads, &workers](size_t start, size_t end, auto&& func) {
-    const size_t num_chunk_per_thread = (end - start) / num_threads;
-    for (size_t i = 0; i < num_threads - 1; ++i) {
-      workers.emplace_back([&func, start, i, num_chunk_per_thread] {
-        const size_t chunk_start = start + (i * num_chunk_per_thread);
-        const size_t chunk_end = start + (i + 1) * num_chunk_per_thread;
-        for (size_t j = chunk_start; j < chunk_end; ++j) {
-          func(j);
-        }
-      });
-    }
-    workers.emplace_back([&func, start, num_chunk_per_thread, end, num_threads] {
-      const size_t chunk_start = start + ((num_threads - 1) * num_chunk_per_thread);
-      for (size_t j = chunk_start; j < end; ++j) {
-        func(j);
+  ppc::core::ParallelFor(0, chunk_count_, [&](size_t first, size_t last) {
+    for (size_t count = first; count < last; count++) {
+      if (bounds[count] < bounds[count + 1]) {
+        HoareSort(input_array_A_, bounds[count], bounds[count + 1] - 1);
       }
-    });
-    for (auto& worker : workers) {
-      worker.join();
     }
-    workers.resize(0);
-  };
-  parallel_for(0, chunk_count_, [this](size_t count) {
-    HoareSort(input_array_A_, count * min_chunk_size_, ((count + 1) * min_chunk_size_) - 1);
   });
-  for (size_t i = 0; i < static_cast<size_t>(std::bit_width(chunk_count_) -
-                                             1);  // Вычисялем сколько уровней слияния потребуется как логарифм по
-                                                  // основанию 2 от числа частей chunk_count_
-       ++i) {  // На каждом уровне сливаются пары соседних блоков размером min_chunk_size_ × 2^i
-    parallel_for(
-        0, chunk_count_ >> (i + 1), [this, i](size_t j) {  // Распределение слияний между потоками на каждом уровне
-          std::inplace_merge(
-              input_array_A_.begin() +
-                  static_cast<long>(j * min_chunk_size_ << (i + 1)),  // Вызов std::inplace_merge для слияния двух
-                                                                      // подмассивов, отсортированных функцией HoareSort
-              input_array_A_.begin() + static_cast<long>(((j << 1 | 1) * (min_chunk_size_ << i))),
-              input_array_A_.begin() + static_cast<long>((j + 1) * min_chunk_size_ << (i + 1)));
-        });
-  }
+
+  const auto runs = ppc::core::MakeRuns<double>(input_array_A_, bounds);
+  std::vector<double> merged(dimension_);
+  const size_t parts = std::max<size_t>(1, std::min<size_t>(ppc::util::GetPPCNumThreads(), dimension_));
+  ppc::core::ParallelFor(0, parts, [&](size_t first, size_t last) {
+    for (size_t part = first; part < last; part++) {
+      ppc::core::MultiwayMergePart<double>(runs, merged, part, parts);
+    }
+  });
+  input_array_A_.swap(merged);
   return true;
 }
 
@@ -1,10 +1,9 @@
 #include "stl/durynichev_d_integrals_simpson_method/include/ops_stl.hpp"
 
 #include <cmath>
-#include <functional>
-#include <thread>
 #include <vector>
 
+#include "core/pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 namespace durynichev_d_integrals_simpson_method_stl {
@@ -27,7 +26,7 @@ bool SimpsonIntegralSTL::ValidationImpl() {
 
 bool SimpsonIntegralSTL::RunImpl() {
   const int num_threads = ppc::util::GetPPCNumThreads();
-  std::vector<std::thread> threads(num_threads);
+  ppc::core::TaskGroup group;
 
   if (dim_ == 1) {
     double a = boundaries_[0];
@@ -37,7 +36,7 @@ bool SimpsonIntegralSTL::RunImpl() {
     for (int i = 0; i < num_threads; ++i) {
       double sub_a = a + (i * interval_size);
       double sub_b = (i == num_threads - 1) ? b : sub_a + interval_size;
-      threads[i] = std::thread(&SimpsonIntegralSTL::Simpson1D, this, sub_a, sub_b, std::ref(results_[i]));
+      group.Run([this, sub_a, sub_b, i] { Simpson1D(sub_a, sub_b, results_[i]); });
     }
   } else if (dim_ == 2) {
     double x0 = boundaries_[0];
@@ -49,13 +48,11 @@ bool SimpsonIntegralSTL::RunImpl() {
     for (int i = 0; i < num_threads; ++i) {
       double sub_x0 = x0 + (i * interval_size_x);
       double sub_x1 = (i == num_threads - 1) ? x1 : sub_x0 + interval_size_x;
-      threads[i] = std::thread(&SimpsonIntegralSTL::Simpson2D, this, sub_x0, sub_x1, y0, y1, std::ref(results_[i]));
+      group.Run([this, sub_x0, sub_x1, y0, y1, i] { Simpson2D(sub_x0, sub_x1, y0, y1, results_[i]); });
     }
   }
 
-  for (auto& thread : threads) {
-    thread.join();
-  }
+  group.Wait();
 
   return true;
 }
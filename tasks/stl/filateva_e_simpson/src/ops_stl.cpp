@@ -2,10 +2,10 @@
 
 #include <cmath>
 #include <cstddef>
-#include <thread>
+#include <functional>
 #include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/pool/include/thread_pool.hpp"
 
 bool filateva_e_simpson_stl::Simpson::PreProcessingImpl() {
   mer_ = task_data->inputs_count[0];
@@ -67,21 +67,9 @@ bool filateva_e_simpson_stl::Simpson::RunImpl() {
     h_[i] = static_cast<double>(b_[i] - a_[i]) / static_cast<double>(steps_);
   }
 
-  const int num_threads = ppc::util::GetPPCNumThreads();
-  std::vector<std::thread> threads(num_threads);
-  std::vector<double> local_res(num_threads, 0.0);
-  res_ = 0.0;
-
-  unsigned long del = (unsigned long)std::pow(steps_ + 1, mer_) / num_threads;
-  unsigned long ost = (unsigned long)std::pow(steps_ + 1, mer_) % num_threads;
-  for (int i = 0; i < num_threads; i++) {
-    threads[i] = std::thread([&, i]() { local_res[i] = IntegralFunc(ost + (del * i), ost + (del * (i + 1))); });
-  }
-  res_ += IntegralFunc(0, ost);
-  for (int i = 0; i < num_threads; i++) {
-    threads[i].join();
-    res_ += local_res[i];
-  }
+  const auto num_points = (unsigned long)std::pow(steps_ + 1, mer_);
+  res_ = ppc::core::ParallelReduce<double>(
+      0, num_points, 0.0, [&](size_t start, size_t end) { return IntegralFunc(start, end); }, std::plus<>());
 
   for (size_t i = 0; i < mer_; i++) {
     res_ *= (h_[i] / 3.0);
@@ -2,9 +2,11 @@
 
 #include <cmath>
 #include <cstddef>
+#include <span>
 #include <thread>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
 #include "core/util/include/util.hpp"
 
 double fomin_v_conjugate_gradient::FominVConjugateGradientStl::DotProduct(const std::vector<double>& a,
@@ -140,6 +142,13 @@ std::vector<double> fomin_v_conjugate_gradient::FominVConjugateGradientStl::Vect
 }
 
 bool fomin_v_conjugate_gradient::FominVConjugateGradientStl::PreProcessingImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    sparse_ = true;
+    n = static_cast<int>(matrix_.View().rows);
+    b_.assign(matrix_.Rhs().begin(), matrix_.Rhs().end());
+    output_.resize(n, 0.0);
+    return true;
+  }
   unsigned int input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
   std::vector<double> input(in_ptr, in_ptr + input_size);
@@ -149,10 +158,17 @@ bool fomin_v_conjugate_gradient::FominVConjugateGradientStl::PreProcessingImpl()
   b_ = std::vector<double>(input.begin() + (n * n), input.end());
   output_.resize(n, 0.0);
 
+  sparse_ = !ppc::core::solver::IsPlainCg(solver_options_);
+  if (sparse_) {
+    matrix_.LoadDense(a_, n);
+  }
   return true;
 }
 
 bool fomin_v_conjugate_gradient::FominVConjugateGradientStl::ValidationImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    return matrix_.LoadCsrSystem(*task_data);
+  }
   unsigned int input_size = task_data->inputs_count[0];
   const int calculated_n = static_cast<int>((-1.0 + std::sqrt(1 + (4 * input_size))) / 2);
   return (static_cast<unsigned int>(calculated_n * (calculated_n + 1)) == input_size) &&
@@ -160,6 +176,12 @@ bool fomin_v_conjugate_gradient::FominVConjugateGradientStl::ValidationImpl() {
 }
 
 bool fomin_v_conjugate_gradient::FominVConjugateGradientStl::RunImpl() {
+  if (sparse_) {
+    output_.assign(n, 0.0);
+    const auto result =
+        ppc::core::solver::SolveCg(matrix_.View(), b_, output_, solver_options_, ppc::core::solver::StlBackend{});
+    return result.converged;
+  }
   const double epsilon = (n < 100) ? 1e-4 : 1e-6;
   const int max_iter = (n < 100) ? 200 : 1000;
   std::vector<double> x(n, 0.0);
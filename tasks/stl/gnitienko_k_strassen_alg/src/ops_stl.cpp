@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <core/gemm/include/gemm.hpp>
 #include <core/util/include/util.hpp>
 #include <cstddef>
 #include <functional>
@@ -67,14 +68,9 @@ void gnitienko_k_strassen_algorithm_stl::StrassenAlgSTL::SubMatrix(const std::ve
 void gnitienko_k_strassen_algorithm_stl::StrassenAlgSTL::TrivialMultiply(const std::vector<double>& a,
                                                                          const std::vector<double>& b,
                                                                          std::vector<double>& c, int size) {
-  for (int i = 0; i < size; ++i) {
-    for (int j = 0; j < size; ++j) {
-      c[(i * size) + j] = 0;
-      for (int k = 0; k < size; ++k) {
-        c[(i * size) + j] += a[(i * size) + k] * b[(k * size) + j];
-      }
-    }
-  }
+  const auto n = static_cast<size_t>(size);
+  std::fill_n(c.begin(), n * n, 0.0);
+  ppc::core::Gemm(n, n, n, a.data(), n, b.data(), n, c.data(), n);
 }
 
 void gnitienko_k_strassen_algorithm_stl::ParallelizeTasks(const std::vector<std::function<void(int)>>& tasks,
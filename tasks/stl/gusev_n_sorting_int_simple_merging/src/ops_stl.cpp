@@ -4,10 +4,10 @@
 #include <cmath>
 #include <cstddef>
 #include <numeric>
-#include <thread>
 #include <utility>
 #include <vector>
 
+#include "core/pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 namespace gusev_n_sorting_int_simple_merging_stl {
@@ -30,22 +30,16 @@ void TestTaskSTL::SplitAndSort(std::vector<int>& arr, std::vector<int>& negative
   const size_t data_size = arr.size();
   const int num_threads = (data_size < 1000) ? 1 : ppc::util::GetPPCNumThreads();
 
-  std::vector<std::thread> threads(num_threads);
-
   std::vector<std::vector<int>> local_negatives(num_threads);
   std::vector<std::vector<int>> local_positives(num_threads);
 
   size_t total_size = arr.size();
   size_t chunk_size = (total_size + num_threads - 1) / num_threads;
 
-  for (int i = 0; i < num_threads; ++i) {
-    size_t start = i * chunk_size;
-    size_t end = std::min((i + 1) * chunk_size, total_size);
-    if (start >= total_size) {
-      break;
-    }
-
-    threads[i] = std::thread([&arr, start, end, &local_negatives, &local_positives, i]() {
+  ppc::core::ParallelFor(0, num_threads, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; ++i) {
+      const size_t start = std::min(i * chunk_size, total_size);
+      const size_t end = std::min(start + chunk_size, total_size);
       for (size_t j = start; j < end; ++j) {
         if (arr[j] < 0) {
           local_negatives[i].push_back(-arr[j]);
@@ -53,21 +47,16 @@ void TestTaskSTL::SplitAndSort(std::vector<int>& arr, std::vector<int>& negative
           local_positives[i].push_back(arr[j]);
         }
       }
-    });
-  }
-
-  for (auto& t : threads) {
-    if (t.joinable()) {
-      t.join();
     }
-  }
+  });
 
   for (int i = 0; i < num_threads; ++i) {
     negatives.insert(negatives.end(), local_negatives[i].begin(), local_negatives[i].end());
     positives.insert(positives.end(), local_positives[i].begin(), local_positives[i].end());
   }
 
-  std::thread t_neg([&negatives]() {
+  ppc::core::TaskGroup group;
+  group.Run([&negatives] {
     if (!negatives.empty()) {
       RadixSortForNonNegative(negatives);
       std::ranges::reverse(negatives);
@@ -76,15 +65,12 @@ void TestTaskSTL::SplitAndSort(std::vector<int>& arr, std::vector<int>& negative
       }
     }
   });
-
-  std::thread t_pos([&positives]() {
+  group.Run([&positives] {
     if (!positives.empty()) {
       RadixSortForNonNegative(positives);
     }
   });
-
-  t_neg.join();
-  t_pos.join();
+  group.Wait();
 }
 
 void TestTaskSTL::RadixSortForNonNegative(std::vector<int>& arr) {
@@ -102,30 +88,21 @@ void TestTaskSTL::CountingSort(std::vector<int>& arr, int exp) {
   const size_t data_size = arr.size();
   const int num_threads = (data_size < 1000) ? 1 : ppc::util::GetPPCNumThreads();
 
-  std::vector<std::thread> threads;
   std::vector<std::vector<int>> local_counts(num_threads, std::vector<int>(kDigitCount, 0));
 
   size_t total_size = arr.size();
   size_t chunk_size = (total_size + num_threads - 1) / num_threads;
 
-  for (int i = 0; i < num_threads; ++i) {
-    size_t start = i * chunk_size;
-    size_t end = std::min((i + 1) * chunk_size, total_size);
-    if (start >= total_size) {
-      break;
-    }
-
-    threads.emplace_back([&arr, exp, start, end, &local_counts, i]() {
+  ppc::core::ParallelFor(0, num_threads, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; ++i) {
+      const size_t start = std::min(i * chunk_size, total_size);
+      const size_t end = std::min(start + chunk_size, total_size);
       for (size_t j = start; j < end; ++j) {
         int digit = (arr[j] / exp) % kDigitCount;
         local_counts[i][digit]++;
       }
-    });
-  }
-
-  for (auto& t : threads) {
-    t.join();
-  }
+    }
+  });
 
   std::vector<int> global_count(kDigitCount, 0);
   for (int d = 0; d < kDigitCount; ++d) {
@@ -2,10 +2,12 @@
 
 #include <algorithm>
 #include <cmath>
-#include <thread>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+#include "core/pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 std::vector<unsigned int> kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL::CalculationOfGapLengths(
@@ -40,28 +42,6 @@ void kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL::ShellSort(unsigned i
   }
 }
 
-void kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL::SimpleMergeSort(unsigned int left, unsigned int middle,
-                                                                            unsigned int right) {
-  std::vector<int> first_part(middle - left);
-  std::ranges::copy(output_.begin() + left, output_.begin() + middle, first_part.begin());
-  unsigned int l = 0;
-  unsigned int r = middle;
-  unsigned int j = left;
-  for (; (l < first_part.size()) && (r < right); j++) {
-    if (first_part[l] < output_[r]) {
-      output_[j] = first_part[l++];
-    } else {
-      output_[j] = output_[r++];
-    }
-  }
-  while (l < first_part.size()) {
-    output_[j++] = first_part[l++];
-  }
-  while (r < right) {
-    output_[j++] = output_[r++];
-  }
-}
-
 bool kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL::PreProcessingImpl() {
   // Init value for input and output
   input_ = std::vector<int>(task_data->inputs_count[0]);
@@ -97,27 +77,25 @@ bool kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL::RunImpl() {
     left = right;
   }
 
-  auto sort = [&](unsigned int start_index, unsigned int end_index) { ShellSort(start_index, end_index); };
-  std::vector<std::thread> threads(num);
-  for (int i = 0; i < static_cast<int>(num); i++) {
-    threads[i] = std::thread(sort, bounds[i].first, bounds[i].second);
-  }
-  std::ranges::for_each(threads, [&](auto &thread) { thread.join(); });
-
-  num = std::ceil(static_cast<double>(num) / 2);
-  unsigned int step = 1;
-  while (step < bounds.size()) {
-    step *= 2;
-    for (int i = 0; i < static_cast<int>(num); i++) {
-      unsigned int middle = (step / 2) + (step * i);
-      if (middle < bounds.size()) {
-        SimpleMergeSort(
-            bounds[i * step].first, bounds[middle].first,
-            bounds[(bounds.size() - 1 < (i + 1) * step - 1) ? bounds.size() - 1 : ((i + 1) * step) - 1].second);
-      }
+  ppc::core::ParallelFor(0, num, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; i++) {
+      ShellSort(bounds[i].first, bounds[i].second);
     }
-    num = std::ceil(static_cast<double>(num) / 2);
+  });
+
+  std::vector<size_t> run_bounds;
+  for (const auto &bound : bounds) {
+    run_bounds.push_back(bound.first);
   }
+  run_bounds.push_back(output_.size());
+  const auto runs = ppc::core::MakeRuns<int>(output_, run_bounds);
+  std::vector<int> merged(output_.size());
+  ppc::core::ParallelFor(0, num, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; i++) {
+      ppc::core::MultiwayMergePart<int>(runs, merged, i, num);
+    }
+  });
+  output_.swap(merged);
 
   return true;
 }
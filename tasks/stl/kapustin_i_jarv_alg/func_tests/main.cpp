@@ -1,14 +1,58 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <random>
 #include <utility>
 #include <vector>
 
 #include "core/task/include/task.hpp"
 #include "stl/kapustin_i_jarv_alg/include/ops_stl.hpp"
 
+namespace {
+
+std::vector<std::pair<int, int>> RunHull(std::vector<std::pair<int, int>> &input_points) {
+  std::vector<std::pair<int, int>> output_result(input_points.size());
+  auto task_data_stl = std::make_shared<ppc::core::TaskData>();
+  task_data_stl->inputs.emplace_back(reinterpret_cast<uint8_t *>(input_points.data()));
+  task_data_stl->inputs_count.emplace_back(input_points.size());
+  task_data_stl->outputs.emplace_back(reinterpret_cast<uint8_t *>(output_result.data()));
+  task_data_stl->outputs_count.emplace_back(output_result.size());
+
+  kapustin_i_jarv_alg_stl::TestTaskSTL test_task_stl(task_data_stl);
+  EXPECT_TRUE(test_task_stl.Validation());
+  test_task_stl.PreProcessing();
+  test_task_stl.Run();
+  test_task_stl.PostProcessing();
+  return output_result;
+}
+
+// Counterclockwise hull from the lowest of the leftmost points by Andrew's monotone chain, collinear points dropped
+std::vector<std::pair<int, int>> ReferenceHull(std::vector<std::pair<int, int>> points) {
+  std::ranges::sort(points);
+  const auto cross = [](const auto &o, const auto &a, const auto &b) {
+    return (static_cast<int64_t>(a.first - o.first) * (b.second - o.second)) -
+           (static_cast<int64_t>(a.second - o.second) * (b.first - o.first));
+  };
+  std::vector<std::pair<int, int>> hull;
+  for (int pass = 0; pass < 2; pass++) {
+    const size_t lower = hull.size();
+    for (const auto &p : points) {
+      while (hull.size() >= lower + 2 && cross(hull[hull.size() - 2], hull.back(), p) <= 0) {
+        hull.pop_back();
+      }
+      hull.push_back(p);
+    }
+    hull.pop_back();
+    std::ranges::reverse(points);
+  }
+  return hull;
+}
+
+}  // namespace
+
 TEST(KapustinJarvAlgSTLTest, SimpleTriangle) {
   std::vector<std::pair<int, int>> input_points = {{0, 0}, {5, 5}, {10, 0}};
   std::vector<std::pair<int, int>> expected_result = {{0, 0}, {10, 0}, {5, 5}};
@@ -162,3 +206,40 @@ TEST(KapustinJarvAlgSTLTest, Circle) {
     EXPECT_EQ(expected_result[i], output_result[i]);
   }
 }
+
+TEST(KapustinJarvAlgSTLTest, ParabolaWithInnerPoints) {
+  // Every point of the parabola is a hull vertex, so the march switches to the chunk hulls
+  std::vector<std::pair<int, int>> input_points;
+  std::vector<std::pair<int, int>> expected_result;
+  for (int x = -1000; x <= 1000; x++) {
+    expected_result.emplace_back(x, x * x);
+    input_points.emplace_back(x, x * x);
+    input_points.emplace_back(x, (x * x) + 1 + ((x + 1000) % 7));
+  }
+  std::mt19937 gen(7);
+  std::ranges::shuffle(input_points, gen);
+
+  const auto output_result = RunHull(input_points);
+  for (size_t i = 0; i < expected_result.size(); ++i) {
+    ASSERT_EQ(expected_result[i], output_result[i]);
+  }
+}
+
+TEST(KapustinJarvAlgSTLTest, RandomPointsMatchReference) {
+  std::mt19937 gen(42);
+  for (const int range : {10, 1000, 100000}) {
+    std::uniform_int_distribution<int> coordinate(0, range);
+    std::vector<std::pair<int, int>> input_points(20000);
+    for (auto &p : input_points) {
+      p = {coordinate(gen), coordinate(gen)};
+    }
+    // A single leftmost point, the march starts from it
+    input_points[123] = {-1, range / 2};
+
+    const auto expected_result = ReferenceHull(input_points);
+    const auto output_result = RunHull(input_points);
+    for (size_t i = 0; i < expected_result.size(); ++i) {
+      ASSERT_EQ(expected_result[i], output_result[i]) << "range " << range << ", vertex " << i;
+    }
+  }
+}
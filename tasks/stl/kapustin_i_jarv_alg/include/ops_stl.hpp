@@ -8,6 +8,9 @@
 
 namespace kapustin_i_jarv_alg_stl {
 
+// Jarvis march from the leftmost point. Threads are created once per run and meet at a barrier after every
+// wrapping step; once the hull outgrows log2 of the chunk size, every thread builds the hull of its chunk and
+// the march continues over the chunk hulls (Chan's algorithm with one group per thread).
 class TestTaskSTL : public ppc::core::Task {
  public:
   explicit TestTaskSTL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -18,16 +21,11 @@ class TestTaskSTL : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<std::pair<int, int>> input_;
+  // Input points in structure-of-arrays layout
+  std::vector<int> xs_;
+  std::vector<int> ys_;
   std::vector<std::pair<int, int>> output_;
-  std::pair<int, int> current_point_;
-  std::pair<int, int> next_point_;
-  size_t leftmost_index_;
-  void FindBestPointMultithreaded(size_t current_index, std::vector<size_t>& local_best);
-
-  [[nodiscard]] static int Orientation(const std::pair<int, int>& p, const std::pair<int, int>& q,
-                                       const std::pair<int, int>& r);
-  [[nodiscard]] static int CalculateDistance(const std::pair<int, int>& p1, const std::pair<int, int>& p2);
+  size_t leftmost_index_ = 0;
 };
 
 }  // namespace kapustin_i_jarv_alg_stl
\ No newline at end of file
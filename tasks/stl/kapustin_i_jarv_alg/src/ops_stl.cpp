@@ -1,133 +1,231 @@
 #include "stl/kapustin_i_jarv_alg/include/ops_stl.hpp"
 
 #include <algorithm>
-#include <cmath>
+#include <barrier>
+#include <bit>
 #include <cstddef>
+#include <cstdint>
+#include <numeric>
 #include <thread>
-#include <unordered_set>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 #include "core/util/include/util.hpp"
 
-namespace kapustin_i_jarv_alg_stl {
-struct PairHash {
-  size_t operator()(const std::pair<int, int>& p) const {
-    return std::hash<int>()(p.first) ^ std::hash<int>()(p.second);
-  }
-};
+namespace {
 
-struct PairEqual {
-  bool operator()(const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) const {
-    return lhs.first == rhs.first && lhs.second == rhs.second;
-  }
-};
-}  // namespace kapustin_i_jarv_alg_stl
+// Candidates tested against the current best at once before the scalar scan of a block
+constexpr size_t kBlockSize = 256;
 
-bool kapustin_i_jarv_alg_stl::TestTaskSTL::ValidationImpl() {
-  return !task_data->inputs.empty() && task_data->inputs[0] != nullptr;
+// True if r is a better next hull vertex than q seen from (fx, fy): r lies clockwise of the ray to q, or on it
+// and farther. Exact while the coordinates stay within +-2^30.
+bool Beats(int64_t fx, int64_t fy, int64_t qx, int64_t qy, int64_t rx, int64_t ry) {
+  const int64_t cross = ((qx - fx) * (ry - fy)) - ((qy - fy) * (rx - fx));
+  if (cross != 0) {
+    return cross < 0;
+  }
+  return ((rx - fx) * (rx - fx)) + ((ry - fy) * (ry - fy)) > ((qx - fx) * (qx - fx)) + ((qy - fy) * (qy - fy));
 }
 
-void kapustin_i_jarv_alg_stl::TestTaskSTL::FindBestPointMultithreaded(size_t current_index,
-                                                                      std::vector<size_t>& local_best) {
-  const size_t total_points = input_.size();
-  const size_t num_threads = local_best.size();
-  const size_t chunk_size = (total_points + num_threads - 1) / num_threads;
-
-  std::vector<std::thread> threads;
-  threads.reserve(num_threads);
-
-  for (size_t thread_id = 0; thread_id < num_threads; ++thread_id) {
-    const size_t start = thread_id * chunk_size;
-    const size_t end = std::min(start + chunk_size, total_points);
-
-    threads.emplace_back([this, current_index, &local_best, thread_id, start, end]() {
-      const auto& current_point = input_[current_index];
-      size_t best = (current_index + 1) % input_.size();
-      for (size_t j = start; j < end; ++j) {
-        if (j == current_index) {
-          continue;
-        }
-        const auto& candidate = input_[j];
-        const auto& best_point = input_[best];
+class HullTeam {
+ public:
+  HullTeam(const std::vector<int>& xs, const std::vector<int>& ys, size_t num_threads)
+      : xs_(xs), ys_(ys), num_threads_(num_threads), local_best_(num_threads), hulls_(num_threads),
+        tangents_(num_threads, 0), chan_threshold_(std::bit_width(xs.size() / num_threads)) {}
+
+  // Hull vertices counterclockwise from `start`, collinear points dropped
+  std::vector<std::pair<int, int>> Run(size_t start) {
+    start_ = start;
+    current_ = start;
+    hull_.clear();
+    hull_.reserve(xs_.size());
+    hull_.emplace_back(xs_[start], ys_[start]);
+
+    std::barrier sync_point(static_cast<std::ptrdiff_t>(num_threads_), [this]() noexcept { Merge(); });
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads_ - 1);
+    for (size_t t = 1; t < num_threads_; t++) {
+      threads.emplace_back([this, &sync_point, t] { Work(t, sync_point); });
+    }
+    Work(0, sync_point);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    return std::move(hull_);
+  }
 
-        const int orient = ((best_point.second - current_point.second) * (candidate.first - best_point.first)) -
-                           ((best_point.first - current_point.first) * (candidate.second - best_point.second));
+ private:
+  const std::vector<int>& xs_;
+  const std::vector<int>& ys_;
+  size_t num_threads_;
+  // Best candidate of every thread in the current step
+  std::vector<size_t> local_best_;
+  // Counterclockwise hull of the chunk of every thread and the vertex last found tangent on it
+  std::vector<std::vector<size_t>> hulls_;
+  std::vector<size_t> tangents_;
+  size_t chan_threshold_;
+  std::vector<std::pair<int, int>> hull_;
+  size_t start_ = 0;
+  size_t current_ = 0;
+  bool chan_ = false;
+  bool done_ = false;
+
+  [[nodiscard]] bool IsBetter(size_t from, size_t q, size_t r) const {
+    return Beats(xs_[from], ys_[from], xs_[q], ys_[q], xs_[r], ys_[r]);
+  }
 
-        if (orient > 0) {
+  template <class Barrier>
+  void Work(size_t t, Barrier& sync_point) {
+    const size_t first = xs_.size() * t / num_threads_;
+    const size_t last = xs_.size() * (t + 1) / num_threads_;
+    while (true) {
+      if (chan_ && hulls_[t].empty()) {
+        hulls_[t] = ChunkHull(first, last);
+      }
+      local_best_[t] = chan_ ? Tangent(t) : Scan(first, last);
+      sync_point.arrive_and_wait();
+      if (done_) {
+        return;
+      }
+    }
+  }
+
+  // Best candidate in [first, last). Every block is first tested as a whole against the current best: the test
+  // has no data-dependent branches and runs on SIMD lanes, the scalar scan only visits blocks that improve it.
+  [[nodiscard]] size_t Scan(size_t first, size_t last) const {
+    const int64_t fx = xs_[current_];
+    const int64_t fy = ys_[current_];
+    const int* xs = xs_.data();
+    const int* ys = ys_.data();
+    size_t best = first;
+    for (size_t block = first; block < last; block += kBlockSize) {
+      const size_t end = std::min(block + kBlockSize, last);
+      const int64_t qx = xs[best] - fx;
+      const int64_t qy = ys[best] - fy;
+      const int64_t q_dist = (qx * qx) + (qy * qy);
+      int improves = 0;
+      for (size_t j = block; j < end; j++) {
+        const int64_t rx = xs[j] - fx;
+        const int64_t ry = ys[j] - fy;
+        const int64_t cross = (qx * ry) - (qy * rx);
+        improves |= static_cast<int>(cross < 0 || (cross == 0 && (rx * rx) + (ry * ry) > q_dist));
+      }
+      if (improves == 0) {
+        continue;
+      }
+      for (size_t j = block; j < end; j++) {
+        if (IsBetter(current_, best, j)) {
           best = j;
-        } else if (orient == 0) {
-          const int dx1 = candidate.first - current_point.first;
-          const int dy1 = candidate.second - current_point.second;
-          const int dx2 = best_point.first - current_point.first;
-          const int dy2 = best_point.second - current_point.second;
-          const int dist1 = (dx1 * dx1) + (dy1 * dy1);
-          const int dist2 = (dx2 * dx2) + (dy2 * dy2);
-          if (dist1 > dist2) {
-            best = j;
-          }
         }
       }
-      local_best[thread_id] = best;
-    });
+    }
+    return best;
+  }
+
+  // Counterclockwise hull of the points [first, last) by Andrew's monotone chain, collinear points dropped
+  [[nodiscard]] std::vector<size_t> ChunkHull(size_t first, size_t last) const {
+    std::vector<size_t> order(last - first);
+    std::iota(order.begin(), order.end(), first);
+    std::ranges::sort(order,
+                      [this](size_t a, size_t b) { return std::tie(xs_[a], ys_[a]) < std::tie(xs_[b], ys_[b]); });
+    if (order.size() < 3) {
+      return order;
+    }
+    const auto turns_left = [this](size_t o, size_t a, size_t b) {
+      const int64_t cross = ((static_cast<int64_t>(xs_[a]) - xs_[o]) * (static_cast<int64_t>(ys_[b]) - ys_[o])) -
+                            ((static_cast<int64_t>(ys_[a]) - ys_[o]) * (static_cast<int64_t>(xs_[b]) - xs_[o]));
+      return cross > 0;
+    };
+    std::vector<size_t> hull(2 * order.size());
+    size_t k = 0;
+    for (const size_t i : order) {
+      while (k >= 2 && !turns_left(hull[k - 2], hull[k - 1], i)) {
+        k--;
+      }
+      hull[k++] = i;
+    }
+    const size_t lower = k + 1;
+    for (size_t i = order.size() - 1; i-- > 0;) {
+      while (k >= lower && !turns_left(hull[k - 2], hull[k - 1], order[i])) {
+        k--;
+      }
+      hull[k++] = order[i];
+    }
+    hull.resize(k - 1);
+    return hull;
   }
 
-  for (auto& t : threads) {
-    t.join();
+  // Best candidate on the chunk hull of thread t. Seen from a point outside a convex polygon or on its boundary the
+  // candidates rise and fall once around it, so climbing from the last tangent reaches the best vertex, and the
+  // tangent moves forward as the march does.
+  [[nodiscard]] size_t Tangent(size_t t) {
+    const auto& hull = hulls_[t];
+    const size_t k = hull.size();
+    size_t& pos = tangents_[t];
+    for (size_t steps = 0; steps < k && IsBetter(current_, hull[pos], hull[(pos + 1) % k]); steps++) {
+      pos = (pos + 1) % k;
+    }
+    for (size_t steps = 0; steps < k && IsBetter(current_, hull[pos], hull[(pos + k - 1) % k]); steps++) {
+      pos = (pos + k - 1) % k;
+    }
+    return hull[pos];
   }
+
+  // Runs on one thread between the steps: picks the next vertex among the thread candidates
+  void Merge() {
+    size_t best = local_best_[0];
+    for (size_t t = 1; t < num_threads_; t++) {
+      if (IsBetter(current_, best, local_best_[t])) {
+        best = local_best_[t];
+      }
+    }
+    // A hull has at most as many vertices as there are points, which also stops degenerate inputs
+    if ((xs_[best] == xs_[start_] && ys_[best] == ys_[start_]) || hull_.size() == xs_.size()) {
+      done_ = true;
+      return;
+    }
+    hull_.emplace_back(xs_[best], ys_[best]);
+    current_ = best;
+    chan_ = chan_ || hull_.size() > chan_threshold_;
+  }
+};
+
+}  // namespace
+
+bool kapustin_i_jarv_alg_stl::TestTaskSTL::ValidationImpl() {
+  return !task_data->inputs.empty() && task_data->inputs[0] != nullptr && task_data->inputs_count[0] > 0;
 }
 
 bool kapustin_i_jarv_alg_stl::TestTaskSTL::PreProcessingImpl() {
-  std::vector<std::pair<int, int>> points;
+  size_t total = 0;
   for (size_t i = 0; i < task_data->inputs.size(); ++i) {
-    auto* data = reinterpret_cast<std::pair<int, int>*>(task_data->inputs[i]);
-    points.insert(points.end(), data, data + task_data->inputs_count[i]);
+    total += task_data->inputs_count[i];
+  }
+  xs_.clear();
+  ys_.clear();
+  xs_.reserve(total);
+  ys_.reserve(total);
+  for (size_t i = 0; i < task_data->inputs.size(); ++i) {
+    const auto* data = reinterpret_cast<std::pair<int, int>*>(task_data->inputs[i]);
+    for (size_t j = 0; j < task_data->inputs_count[i]; ++j) {
+      xs_.push_back(data[j].first);
+      ys_.push_back(data[j].second);
+    }
   }
-  input_ = std::move(points);
 
   leftmost_index_ = 0;
-  for (size_t i = 1; i < input_.size(); ++i) {
-    if (input_[i].first < input_[leftmost_index_].first) {
+  for (size_t i = 1; i < xs_.size(); ++i) {
+    if (xs_[i] < xs_[leftmost_index_]) {
       leftmost_index_ = i;
     }
   }
-  current_point_ = input_[leftmost_index_];
   return true;
 }
 
 bool kapustin_i_jarv_alg_stl::TestTaskSTL::RunImpl() {
-  std::unordered_set<std::pair<int, int>, PairHash, PairEqual> unique_points;
-  const auto start_point = current_point_;
-  size_t current_index = leftmost_index_;
-  output_.clear();
-  output_.reserve(input_.size());
-
-  output_.push_back(start_point);
-  unique_points.insert(start_point);
-  const auto num_threads = std::min(static_cast<size_t>(ppc::util::GetPPCNumThreads()), input_.size());
-
-  do {
-    std::vector<size_t> local_best(num_threads, (current_index + 1) % input_.size());
-    FindBestPointMultithreaded(current_index, local_best);
-
-    size_t best_index = local_best[0];
-    for (size_t i = 1; i < local_best.size(); ++i) {
-      const int orient = Orientation(input_[current_index], input_[best_index], input_[local_best[i]]);
-      if (orient > 0 || (orient == 0 && CalculateDistance(input_[local_best[i]], input_[current_index]) >
-                                            CalculateDistance(input_[best_index], input_[current_index]))) {
-        best_index = local_best[i];
-      }
-    }
-
-    if (input_[best_index] == start_point) {
-      break;
-    }
-    current_point_ = input_[best_index];
-    output_.push_back(current_point_);
-    unique_points.insert(current_point_);
-    current_index = best_index;
-  } while (current_point_ != start_point);
-
+  const auto num_threads = std::clamp<size_t>(ppc::util::GetPPCNumThreads(), 1, xs_.size());
+  output_ = HullTeam(xs_, ys_, num_threads).Run(leftmost_index_);
   return true;
 }
 
@@ -136,19 +234,3 @@ bool kapustin_i_jarv_alg_stl::TestTaskSTL::PostProcessingImpl() {
   std::ranges::copy(output_, result_ptr);
   return true;
 }
-
-int kapustin_i_jarv_alg_stl::TestTaskSTL::CalculateDistance(const std::pair<int, int>& p1,
-                                                            const std::pair<int, int>& p2) {
-  const int dx = p1.first - p2.first;
-  const int dy = p1.second - p2.second;
-  return (dx * dx) + (dy * dy);
-}
-
-int kapustin_i_jarv_alg_stl::TestTaskSTL::Orientation(const std::pair<int, int>& p, const std::pair<int, int>& q,
-                                                      const std::pair<int, int>& r) {
-  const int val = ((q.second - p.second) * (r.first - q.first)) - ((q.first - p.first) * (r.second - q.second));
-  if (val == 0) {
-    return 0;
-  }
-  return val > 0 ? 1 : -1;
-}
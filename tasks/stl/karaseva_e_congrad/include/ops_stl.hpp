@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
 #include "core/task/include/task.hpp"
 
 namespace karaseva_a_test_task_stl {
@@ -16,11 +17,18 @@ class TestTaskSTL : public ppc::core::Task {
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
+  // Options other than the defaults (see IsPlainCg) solve a dense A with the sparse solver too
+  void SetSolverOptions(const ppc::core::solver::CgOptions& options) { solver_options_ = options; }
+
  private:
   std::vector<double> A_;  // Coefficient matrix
   std::vector<double> b_;  // Right-hand side vector
   std::vector<double> x_;  // Solution vector
   size_t size_{};          // System size (N x N)
+  // CSR inputs (row_ptr, col_idx, values, b) or solver options other than plain CG
+  bool sparse_ = false;
+  ppc::core::solver::TaskMatrix matrix_;
+  ppc::core::solver::CgOptions solver_options_;
 };
 
 }  // namespace karaseva_a_test_task_stl
\ No newline at end of file
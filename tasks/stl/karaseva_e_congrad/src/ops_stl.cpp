@@ -4,14 +4,23 @@
 #include <cmath>
 #include <cstddef>
 #include <numeric>
+#include <span>
 #include <thread>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
 #include "core/util/include/util.hpp"
 
 using namespace karaseva_a_test_task_stl;
 
 bool TestTaskSTL::PreProcessingImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    sparse_ = true;
+    size_ = matrix_.View().rows;
+    b_.assign(matrix_.Rhs().begin(), matrix_.Rhs().end());
+    x_ = std::vector<double>(size_, 0.0);
+    return true;
+  }
   // Set system size from input data
   size_ = task_data->inputs_count[1];
   auto* a_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
@@ -22,10 +31,17 @@ bool TestTaskSTL::PreProcessingImpl() {
   b_ = std::vector<double>(b_ptr, b_ptr + size_);
   x_ = std::vector<double>(size_, 0.0);  // Initial guess
 
+  sparse_ = !ppc::core::solver::IsPlainCg(solver_options_);
+  if (sparse_) {
+    matrix_.LoadDense(A_, size_);
+  }
   return true;
 }
 
 bool TestTaskSTL::ValidationImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    return matrix_.LoadCsrSystem(*task_data);
+  }
   // Validate matrix and vector dimensions
   const bool valid_input = task_data->inputs_count[0] == task_data->inputs_count[1] * task_data->inputs_count[1];
   const bool valid_output = task_data->outputs_count[0] == task_data->inputs_count[1];
@@ -178,6 +194,11 @@ void UpdateSearchDirection(std::vector<double>& p, const std::vector<double>& r,
 }  // namespace
 
 bool TestTaskSTL::RunImpl() {
+  if (sparse_) {
+    const auto result =
+        ppc::core::solver::SolveCg(matrix_.View(), b_, x_, solver_options_, ppc::core::solver::StlBackend{});
+    return result.converged;
+  }
   std::vector<double> r(size_);
   std::vector<double> p(size_);
   std::vector<double> ap(size_);
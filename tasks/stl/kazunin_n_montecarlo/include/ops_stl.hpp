@@ -1,18 +1,15 @@
 #pragma once
 
-#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <functional>
-#include <future>
 #include <numeric>
-#include <random>
-#include <thread>
 #include <utility>
 #include <vector>
 
+#include "core/pool/include/thread_pool.hpp"
+#include "core/random/include/philox.hpp"
 #include "core/task/include/task.hpp"
-#include "core/util/include/util.hpp"
 
 namespace kazunin_n_montecarlo_stl {
 
@@ -29,42 +26,15 @@ class MonteCarloStl : public ppc::core::Task {
   bool PreProcessingImpl() override {
     precision_ = *reinterpret_cast<std::size_t*>(task_data->inputs[0]);
     limits_ = *reinterpret_cast<decltype(limits_)*>(task_data->inputs[1]);
-    std::ranges::generate(generators_, [&, i = 0]() mutable { return MakeGenerator(limits_[i++]); });
     total_space_ = std::accumulate(
         limits_.begin(), limits_.end(), 1.0,
         [](const double acc, const std::pair<double, double>& limit) { return acc * (limit.second - limit.first); });
     return true;
   }
   bool RunImpl() override {
-    const auto numthreads = static_cast<std::size_t>(ppc::util::GetPPCNumThreads());
-    std::vector<std::future<double>> futures(numthreads);
-    std::vector<std::thread> threads(numthreads);
-
-    const auto delta = precision_ / numthreads;
-    const auto offset = precision_ % numthreads;
-
-    for (std::size_t i = 0; i < numthreads; i++) {
-      std::promise<double> promise;
-      futures[i] = promise.get_future();
-      threads[i] = std::thread(
-          [&](std::size_t iters, std::promise<double>&& promise) {
-            double sum = 0.0;
-            std::array<double, N> random_args;
-            const auto generators = generators_;
-            for (std::size_t iter = 0; iter < iters; ++iter) {
-              std::ranges::generate(random_args, [&generators, j = 0]() mutable { return generators[j++](); });
-              sum += f_(random_args);
-            }
-            promise.set_value(sum);
-          },
-          delta + static_cast<std::size_t>(i < offset), std::move(promise));
-    }
-
-    double total_sum = 0.0;
-    for (std::size_t i = 0; i < numthreads; i++) {
-      threads[i].join();
-      total_sum += futures[i].get();
-    }
+    const double total_sum = ppc::core::ParallelReduce<double>(
+        0, precision_, 0.0, [&](std::size_t begin, std::size_t end) { return SampleSum(begin, end); }, std::plus<>(),
+        1024);
 
     result_ = (total_space_ * total_sum) / precision_;
 
@@ -76,18 +46,24 @@ class MonteCarloStl : public ppc::core::Task {
   }
 
  private:
-  std::function<double()> MakeGenerator(const std::pair<double, double>& interval) {
-    std::uniform_real_distribution<double> distrib(interval.first, interval.second);
-    std::mt19937 engine(seedgen_());
-    return [distrib, engine]() mutable { return distrib(engine); };
+  // Sum of f_ over samples [first, last) of one fixed sequence: every chunk jumps to its own samples
+  double SampleSum(std::size_t first, std::size_t last) const {
+    auto gen = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, N);
+    std::array<double, N> random_args;
+    double sum = 0.0;
+    for (std::size_t iter = first; iter < last; ++iter) {
+      for (std::size_t j = 0; j < N; ++j) {
+        random_args[j] = gen.Uniform(limits_[j].first, limits_[j].second);
+      }
+      sum += f_(random_args);
+    }
+    return sum;
   }
 
   F f_;
   std::size_t precision_;
   double total_space_;
   std::array<std::pair<double, double>, N> limits_;
-  std::array<std::function<double()>, N> generators_;
-  std::random_device seedgen_;
   double result_;
 };
 
@@ -108,22 +84,13 @@ class MonteCarloSeq : public ppc::core::Task {
   bool PreProcessingImpl() override {
     precision_ = *reinterpret_cast<std::size_t*>(task_data->inputs[0]);
     limits_ = *reinterpret_cast<decltype(limits_)*>(task_data->inputs[1]);
-    std::ranges::generate(generators_, [&, i = 0]() mutable { return MakeGenerator(limits_[i++]); });
     total_space_ = std::accumulate(
         limits_.begin(), limits_.end(), 1.0,
         [](const double acc, const std::pair<double, double>& limit) { return acc * (limit.second - limit.first); });
     return true;
   }
   bool RunImpl() override {
-    double sum = 0.0;
-
-    std::array<double, N> random_args;
-    for (std::size_t iter = 0; iter < precision_; ++iter) {
-      std::ranges::generate(random_args, [this, j = 0]() mutable { return generators_[j++](); });
-      sum += f_(random_args);
-    }
-
-    result_ = (total_space_ * sum) / precision_;
+    result_ = (total_space_ * SampleSum(0, precision_)) / precision_;
     return true;
   }
   bool PostProcessingImpl() override {
@@ -132,18 +99,24 @@ class MonteCarloSeq : public ppc::core::Task {
   }
 
  private:
-  std::function<double()> MakeGenerator(const std::pair<double, double>& interval) {
-    std::uniform_real_distribution<double> distrib(interval.first, interval.second);
-    std::mt19937 engine(seedgen_());
-    return [distrib, engine]() mutable { return distrib(engine); };
+  // Sum of f_ over samples [first, last) of one fixed sequence: every chunk jumps to its own samples
+  double SampleSum(std::size_t first, std::size_t last) const {
+    auto gen = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, N);
+    std::array<double, N> random_args;
+    double sum = 0.0;
+    for (std::size_t iter = first; iter < last; ++iter) {
+      for (std::size_t j = 0; j < N; ++j) {
+        random_args[j] = gen.Uniform(limits_[j].first, limits_[j].second);
+      }
+      sum += f_(random_args);
+    }
+    return sum;
   }
 
   F f_;
   std::size_t precision_;
   double total_space_;
   std::array<std::pair<double, double>, N> limits_;
-  std::array<std::function<double()>, N> generators_;
-  std::random_device seedgen_;
   double result_;
 };
 
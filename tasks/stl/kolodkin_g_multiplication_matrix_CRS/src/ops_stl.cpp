@@ -2,12 +2,13 @@
 
 #include <cmath>
 #include <complex>
-#include <core/util/include/util.hpp>
 #include <cstddef>
 #include <iostream>
-#include <thread>
+#include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
+
 void kolodkin_g_multiplication_matrix_stl::SparseMatrixCRS::AddValue(int row, Complex value, int col) {
   for (int j = rowPtr[row]; j < rowPtr[row + 1]; ++j) {
     if (colIndices[j] == col) {
@@ -136,47 +137,17 @@ bool kolodkin_g_multiplication_matrix_stl::TestTaskSTL::ValidationImpl() {
 }
 
 bool kolodkin_g_multiplication_matrix_stl::TestTaskSTL::RunImpl() {
-  SparseMatrixCRS c(A_.numRows, B_.numCols);
-  const int num_threads = ppc::util::GetPPCNumThreads();
-  std::vector<std::thread> threads(num_threads);
-  std::vector<SparseMatrixCRS> local_results(num_threads, SparseMatrixCRS(A_.numRows, B_.numCols));
-
-  auto worker = [&](unsigned int start_row, unsigned int end_row, int thread_index) {
-    SparseMatrixCRS local_c(A_.numRows, B_.numCols);
-    for (unsigned int i = start_row; i < end_row; ++i) {
-      for (unsigned int j = A_.rowPtr[i]; j < (unsigned int)A_.rowPtr[i + 1]; ++j) {
-        unsigned int col_a = A_.colIndices[j];
-        Complex value_a = A_.values[j];
-        for (unsigned int k = B_.rowPtr[col_a]; k < (unsigned int)B_.rowPtr[col_a + 1]; ++k) {
-          unsigned int col_b = B_.colIndices[k];
-          Complex value_b = B_.values[k];
-
-          local_c.AddValue((int)i, value_a * value_b, (int)col_b);
-        }
-      }
-    }
-    local_results[thread_index] = local_c;
+  using View = ppc::core::sparse::CsrView<Complex, int>;
+  const auto view = [](const SparseMatrixCRS& m) {
+    return View{.rows = static_cast<size_t>(m.numRows), .cols = static_cast<size_t>(m.numCols), .row_ptr = m.rowPtr,
+                .col_idx = m.colIndices, .values = m.values};
   };
+  auto product = ppc::core::sparse::SpGemm(view(A_), view(B_), ppc::core::sparse::StlBackend{});
 
-  unsigned int rows_per_thread = A_.numRows / num_threads;
-  for (int t = 0; t < num_threads; ++t) {
-    unsigned int start_row = t * rows_per_thread;
-    unsigned int end_row = (t == num_threads - 1) ? A_.numRows : start_row + rows_per_thread;
-    threads[t] = std::thread(worker, start_row, end_row, t);
-  }
-
-  for (auto& thread : threads) {
-    thread.join();
-  }
-
-  for (const auto& local_c : local_results) {
-    for (unsigned int i = 0; i < (unsigned int)local_c.numRows; ++i) {
-      for (unsigned int j = local_c.rowPtr[i]; j < (unsigned int)local_c.rowPtr[i + 1]; ++j) {
-        c.AddValue((int)i, local_c.values[j], local_c.colIndices[j]);
-      }
-    }
-  }
-
+  SparseMatrixCRS c(A_.numRows, B_.numCols);
+  c.rowPtr = std::move(product.row_ptr);
+  c.colIndices = std::move(product.col_idx);
+  c.values = std::move(product.values);
   output_ = ParseMatrixIntoVec(c);
   return true;
 }
@@ -3,10 +3,9 @@
 #include <cmath>
 #include <cstddef>
 #include <functional>
-#include <thread>
 #include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/pool/include/thread_pool.hpp"
 
 bool kolokolova_d_integral_simpson_method_stl::TestTaskSTL::PreProcessingImpl() {
   nums_variables_ = int(task_data->inputs_count[0]);
@@ -42,39 +41,14 @@ bool kolokolova_d_integral_simpson_method_stl::TestTaskSTL::ValidationImpl() {
 }
 
 bool kolokolova_d_integral_simpson_method_stl::TestTaskSTL::RunImpl() {
+  // Per-variable setup is too small to be worth parallel jobs
   std::vector<double> size_step(nums_variables_);
-
-  auto calculate_size_step = [&](int i) {
-    double a = double(borders_[(2 * i) + 1] - borders_[2 * i]) / double(steps_[i]);
-    size_step[i] = a;
-  };
-
-  std::vector<std::thread> threads;
-  threads.reserve(nums_variables_);
-  for (int i = 0; i < nums_variables_; ++i) {
-    threads.emplace_back(calculate_size_step, i);
-  }
-
-  for (auto& t : threads) {
-    t.join();
-  }
-
   std::vector<std::vector<double>> points(nums_variables_);
-  threads.clear();
-
   for (int i = 0; i < nums_variables_; ++i) {
-    threads.emplace_back([&, i]() {
-      std::vector<double> vec;
-      for (int j = 0; j <= steps_[i]; ++j) {
-        double num = borders_[2 * i] + (double(j) * size_step[i]);
-        vec.push_back(num);
-      }
-      points[i] = vec;
-    });
-  }
-
-  for (auto& t : threads) {
-    t.join();
+    size_step[i] = double(borders_[(2 * i) + 1] - borders_[2 * i]) / double(steps_[i]);
+    for (int j = 0; j <= steps_[i]; ++j) {
+      points[i].push_back(borders_[2 * i] + (double(j) * size_step[i]));
+    }
   }
 
   std::vector<double> results_func = FindFunctionValue(points, func_);
@@ -134,93 +108,37 @@ void kolokolova_d_integral_simpson_method_stl::TestTaskSTL::MultiplyCoeffandFunc
   int coeff_vec_size = int(coeff_vec.size());
   int function_vec_size = int(function_val.size());
 
-  // Determine the number of threads for parallel processing using GetPPCNumThreads
-  int thread_count = ppc::util::GetPPCNumThreads();
-  if (thread_count <= 0 || thread_count > int(std::thread::hardware_concurrency())) {
-    // Use maximum available threads if GetPPCNumThreads gives a non-viable count
-    thread_count = int(std::thread::hardware_concurrency());
-  }
-
-  // vector for storing threads
-  std::vector<std::thread> threads;
-  threads.reserve(thread_count);
-
-  // calculate the section size for each thread
-  int section_size = function_vec_size / thread_count;
-
-  // loop of multiplying function values ??by coefficients
-  for (int t = 0; t < thread_count; ++t) {
-    threads.emplace_back([&, t, section_size, function_vec_size, coeff_vec_size]() {
-      int start = t * section_size;
-
-      // determine the start and end indices for the current thread
-      int end = (t == thread_count - 1) ? function_vec_size : start + section_size;
-      for (int i = start; i < end; ++i) {
-        function_val[i] *= coeff_vec[i % coeff_vec_size];
-      }
-    });
-  }
-
-  // wait for all threads to complete
-  for (auto& t : threads) {
-    t.join();
-  }
+  // loop of multiplying function values by coefficients
+  ppc::core::ParallelFor(0, function_vec_size, [&](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+      function_val[i] *= coeff_vec[i % coeff_vec_size];
+    }
+  });
 
   // additional iterations of multiplication by coefficients
   for (int iteration = 1; iteration < a; ++iteration) {
-    threads.clear();
-    for (int t = 0; t < thread_count; ++t) {
-      threads.emplace_back([&, t, section_size, function_vec_size, coeff_vec_size, iteration]() {
-        int start = t * section_size;
-
-        // determine the start and end indices for the current thread
-        int end = (t == thread_count - 1) ? function_vec_size : start + section_size;
-        for (int i = start; i < end; ++i) {
-          int block_size = iteration * coeff_vec_size;
-          int current_n_index = (i / block_size) % coeff_vec_size;
-          function_val[i] *= coeff_vec[current_n_index];
-        }
-      });
-    }
-
-    for (auto& t : threads) {
-      t.join();
-    }
+    ppc::core::ParallelFor(0, function_vec_size, [&](size_t start, size_t end) {
+      int block_size = iteration * coeff_vec_size;
+      for (size_t i = start; i < end; ++i) {
+        int current_n_index = (int(i) / block_size) % coeff_vec_size;
+        function_val[i] *= coeff_vec[current_n_index];
+      }
+    });
   }
 }
 
 double kolokolova_d_integral_simpson_method_stl::TestTaskSTL::CreateOutputResult(std::vector<double> const& vec,
                                                                                  std::vector<double> size_steps) const {
-  double sum = 0;
-
-  std::vector<std::thread> threads;
-  int thread_count = int(std::thread::hardware_concurrency());
-  if (thread_count == 0) {
-    thread_count = 1;
-  }
-  threads.reserve(thread_count);
-  int section_size = int(vec.size()) / thread_count;
-  std::vector<double> local_sums(thread_count, 0.0);
-
-  for (int t = 0; t < thread_count; ++t) {
-    threads.emplace_back([&, t, section_size, vec]() {
-      int start = t * section_size;
-      int end = (t == thread_count - 1) ? int(vec.size()) : start + section_size;
-      double local_sum = 0;
-      for (int i = start; i < end; i++) {
-        local_sum += vec[i];
-      }
-      local_sums[t] = local_sum;
-    });
-  }
-
-  for (auto& t : threads) {
-    t.join();
-  }
-
-  for (const auto& local_sum : local_sums) {
-    sum += local_sum;
-  }
+  double sum = ppc::core::ParallelReduce<double>(
+      0, vec.size(), 0.0,
+      [&](size_t start, size_t end) {
+        double local_sum = 0;
+        for (size_t i = start; i < end; i++) {
+          local_sum += vec[i];
+        }
+        return local_sum;
+      },
+      std::plus<>());
 
   for (size_t i = 0; i < size_steps.size(); i++) {
     sum *= size_steps[i];
@@ -9,11 +9,12 @@
 #include <ranges>
 #include <span>
 #include <string>
-#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+#include "core/pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 namespace {
@@ -105,49 +106,20 @@ bool koshkin_m_radix_int_simple_merge::StlT::RunImpl() {
 
   const auto parlevel = blocks.size();
 
-  {
-    std::vector<std::thread> threads(parlevel);
-    for (std::size_t j = 0; j < parlevel; j++) {
-      threads[j] = std::thread([&](std::size_t i) { blocks[i] = RadixIntegerSort(intermediate_blocks[i]); }, j);
+  ppc::core::ParallelFor(0, parlevel, [&](std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; i++) {
+      blocks[i] = RadixIntegerSort(intermediate_blocks[i]);
     }
-    for (auto &t : threads) {
-      t.join();
-    }
-  }
+  });
 
-  std::vector<std::thread> threads(parlevel);
-  for (std::size_t blcnt = blocks.size(), dx = 1; blcnt > 1; blcnt /= 2, dx *= 2) {
-    const auto bsize = blocks[0].size();
-    const auto after = blcnt / 2;
-
-    const auto merge_and_subst = [&](std::vector<int> &a, std::vector<int> &b) {
-      std::vector<int> c(a.size() + b.size());
-      std::ranges::merge(a, b, c.begin());
-      a = std::move(c);
-      b.clear();
-    };
-    if (bsize > 64) {
-      threads.resize(after);
-      for (std::size_t i = 0; i < after; i++) {
-        threads[i] = std::thread([&](int g) { merge_and_subst(blocks[2 * dx * g], blocks[(2 * dx * g) + dx]); }, i);
-      }
-      std::ranges::for_each(threads, [](auto &thread) { thread.join(); });
-    } else {
-      for (std::size_t g = 0; g < after; ++g) {
-        merge_and_subst(blocks[2 * dx * g], blocks[(2 * dx * g) + dx]);
-      }
-    }
+  const std::vector<std::span<const int>> runs(blocks.begin(), blocks.end());
+  out_.resize(in_.size());
 
-    if (after % 2 != 0) {
-      if (after == 1) {
-        merge_and_subst(blocks.front(), blocks.back());
-      } else {
-        merge_and_subst(blocks[2 * dx * (after - 2)], blocks[2 * dx * (after - 1)]);
-      }
+  ppc::core::ParallelFor(0, parlevel, [&](std::size_t first, std::size_t last) {
+    for (std::size_t part = first; part < last; part++) {
+      ppc::core::MultiwayMergePart<int>(runs, out_, part, parlevel);
     }
-  }
-
-  out_ = std::move(blocks.front());
+  });
 
   return true;
 }
@@ -1,12 +1,14 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <random>
 #include <span>
 #include <utility>
 #include <vector>
 
+#include "core/integrate/include/integrate.hpp"
+#include "core/random/include/philox.hpp"
 #include "core/task/include/task.hpp"
 
 namespace krylov_m_monte_carlo {
@@ -14,11 +16,17 @@ namespace krylov_m_monte_carlo {
 using Point = std::span<double>;
 using MathFunction = double (*)(const Point&);  // <-- avoid extra indirection [std::function<double(const Point&)>]
 using Bound = std::pair<double, double>;
+// Evaluates the integrand at a block of points in SoA layout (see ppc::core::integrate::PointBlock)
+using BatchMathFunction = ppc::core::integrate::BatchIntegrand;
 
 struct IntegrationParams {
   MathFunction func;
   std::vector<Bound> bounds;
   std::size_t iterations;
+  // Samples depend only on the seed, not on the number of threads or processes
+  std::uint64_t seed = ppc::core::random::kDefaultSeed;
+  // When set, the samples are evaluated by batch_func a block at a time instead of one by one by func
+  BatchMathFunction batch_func = nullptr;
 
   [[nodiscard]] std::size_t Dimensions() const noexcept { return bounds.size(); }
 
@@ -62,7 +70,10 @@ class TaskCommon : public ppc::core::Task {
   double res;
 
   double vol;
-  std::vector<std::uniform_real_distribution<double>> dists;
+
+  // Sum of func over samples [first, last) of the sequence fixed by params->seed, so any split of the
+  // samples into chunks gives the serial result up to the summation order
+  [[nodiscard]] double SampleSum(std::size_t first, std::size_t last) const;
 };
 
 }  // namespace krylov_m_monte_carlo
\ No newline at end of file
@@ -1,9 +1,17 @@
 #include "../include/mci_common.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
-#include <random>
+#include <span>
+#include <vector>
+
+#include "core/random/include/philox.hpp"
+
+namespace {
+constexpr std::size_t kBatchSamples = 256;
+}  // namespace
 
 bool krylov_m_monte_carlo::TaskCommon::ValidationImpl() {
   return std::ranges::all_of(IntegrationParams::FromTaskData(*task_data).bounds,
@@ -14,14 +22,7 @@ bool krylov_m_monte_carlo::TaskCommon::PreProcessingImpl() {
   params = &IntegrationParams::FromTaskData(*task_data);
   res = {};
   vol = 1.;
-  //
-  const std::size_t dimensions = params->Dimensions();
-  dists.resize(dimensions);
-  //
-
-  auto dist_it = dists.begin();
   for (const auto& bound : params->bounds) {
-    *(dist_it++) = std::uniform_real_distribution<double>{bound.first, bound.second};
     vol *= bound.second - bound.first;
   }
 
@@ -31,4 +32,46 @@ bool krylov_m_monte_carlo::TaskCommon::PreProcessingImpl() {
 bool krylov_m_monte_carlo::TaskCommon::PostProcessingImpl() {
   IntegrationParams::OutputOf(*task_data) = res;
   return true;
-}
\ No newline at end of file
+}
+
+double krylov_m_monte_carlo::TaskCommon::SampleSum(std::size_t first, std::size_t last) const {
+  const auto dimensions = params->Dimensions();
+  const auto func = params->func;
+  const auto batch_func = params->batch_func;
+  const auto& bounds = params->bounds;
+
+  // Points are drawn kBatchSamples at a time by the batched generator, then scaled to the bounds;
+  // a batch integrand gets them transposed to SoA and evaluates the whole batch in one call
+  auto gen = ppc::core::random::SampleStream(params->seed, first, dimensions);
+  std::vector<double> batch(kBatchSamples * dimensions);
+  std::vector<double> soa(batch_func != nullptr ? kBatchSamples * dimensions : 0);
+  std::array<double, kBatchSamples> values{};
+  double sum = 0.;
+  for (std::size_t begin = first; begin < last; begin += kBatchSamples) {
+    const std::size_t count = std::min(kBatchSamples, last - begin);
+    const Point points(batch.data(), count * dimensions);
+    gen.FillUniform(points);
+    if (batch_func != nullptr) {
+      for (std::size_t p = 0; p < dimensions; ++p) {
+        for (std::size_t i = 0; i < count; ++i) {
+          soa[(p * kBatchSamples) + i] =
+              bounds[p].first + ((bounds[p].second - bounds[p].first) * points[(i * dimensions) + p]);
+        }
+      }
+      batch_func({.data = soa.data(), .dims = dimensions, .count = count, .stride = kBatchSamples},
+                 std::span(values).first(count));
+      for (std::size_t i = 0; i < count; ++i) {
+        sum += values[i];
+      }
+      continue;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+      const Point x = points.subspan(i * dimensions, dimensions);
+      for (std::size_t p = 0; p < dimensions; ++p) {
+        x[p] = bounds[p].first + ((bounds[p].second - bounds[p].first) * x[p]);
+      }
+      sum += func(x);
+    }
+  }
+  return sum;
+}
@@ -9,7 +9,6 @@
 namespace kudryashova_i_radix_batcher_stl {
 std::vector<double> GetRandomDoubleVector(int size);
 void RadixDoubleSort(std::vector<double>& data, size_t first, size_t last);
-void BatcherMerge(std::vector<double>& target_array, size_t merge_start, size_t mid_point, size_t merge_end);
 
 class TestTaskSTL : public ppc::core::Task {
  public:
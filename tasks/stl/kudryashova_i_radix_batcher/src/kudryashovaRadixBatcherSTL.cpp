@@ -5,9 +5,10 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
-#include <thread>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+#include "core/pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 void kudryashova_i_radix_batcher_stl::RadixDoubleSort(std::vector<double> &data, size_t first, size_t last) {
@@ -54,35 +55,6 @@ void kudryashova_i_radix_batcher_stl::RadixDoubleSort(std::vector<double> &data,
     std::memcpy(&data[first + i], &bits, sizeof(double));
   }
 }
-void kudryashova_i_radix_batcher_stl::BatcherMerge(std::vector<double> &target_array, size_t merge_start,
-                                                   size_t mid_point, size_t merge_end) {
-  const size_t total_elements = merge_end - merge_start;
-  const size_t left_size = mid_point - merge_start;
-  const size_t right_size = merge_end - mid_point;
-  std::vector<double> left_array(target_array.begin() + static_cast<std::ptrdiff_t>(merge_start),
-                                 target_array.begin() + static_cast<std::ptrdiff_t>(mid_point));
-  std::vector<double> right_array(target_array.begin() + static_cast<std::ptrdiff_t>(mid_point),
-                                  target_array.begin() + static_cast<std::ptrdiff_t>(merge_end));
-  size_t left_ptr = 0;
-  size_t right_ptr = 0;
-  size_t merge_ptr = merge_start;
-
-  for (size_t i = 0; i < total_elements; ++i) {
-    if (i % 2 == 0) {
-      if (left_ptr < left_size && (right_ptr >= right_size || left_array[left_ptr] <= right_array[right_ptr])) {
-        target_array[merge_ptr++] = left_array[left_ptr++];
-      } else {
-        target_array[merge_ptr++] = right_array[right_ptr++];
-      }
-    } else {
-      if (right_ptr < right_size && (left_ptr >= left_size || right_array[right_ptr] <= left_array[left_ptr])) {
-        target_array[merge_ptr++] = right_array[right_ptr++];
-      } else {
-        target_array[merge_ptr++] = left_array[left_ptr++];
-      }
-    }
-  }
-}
 
 bool kudryashova_i_radix_batcher_stl::TestTaskSTL::RunImpl() {
   const size_t input_size = input_data_.size();
@@ -93,50 +65,27 @@ bool kudryashova_i_radix_batcher_stl::TestTaskSTL::RunImpl() {
   const size_t num_threads = ppc::util::GetPPCNumThreads();
   const size_t sort_block_size = (input_size + num_threads - 1) / num_threads;
 
-  std::vector<std::thread> sort_threads;
-  for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-    const size_t block_start = thread_idx * sort_block_size;
-    const size_t block_end = std::min(block_start + sort_block_size, input_size);
-
-    if (block_start >= input_size) {
-      break;
-    }
-
-    sort_threads.emplace_back([this, block_start, block_end] { RadixDoubleSort(input_data_, block_start, block_end); });
+  std::vector<size_t> bounds;
+  for (size_t block_start = 0; block_start < input_size; block_start += sort_block_size) {
+    bounds.push_back(block_start);
   }
-  for (auto &thread : sort_threads) {
-    thread.join();
-  }
-
-  for (size_t current_merge_size = sort_block_size; current_merge_size < input_size; current_merge_size *= 2) {
-    const size_t merge_group_size = 2 * current_merge_size;
-    const size_t total_merge_groups = (input_size + merge_group_size - 1) / merge_group_size;
-
-    std::vector<std::thread> merge_threads;
-    const size_t merge_groups_per_thread = (total_merge_groups + num_threads - 1) / num_threads;
+  bounds.push_back(input_size);
+  const size_t blocks_count = bounds.size() - 1;
 
-    for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-      const size_t group_range_start = thread_idx * merge_groups_per_thread;
-      const size_t group_range_end = std::min(group_range_start + merge_groups_per_thread, total_merge_groups);
-
-      if (group_range_start >= group_range_end) {
-        break;
-      }
-      merge_threads.emplace_back([&, group_range_start, group_range_end, current_merge_size, merge_group_size] {
-        for (size_t group_index = group_range_start; group_index < group_range_end; ++group_index) {
-          const size_t merge_start = group_index * merge_group_size;
-          const size_t merge_mid = std::min(merge_start + current_merge_size, input_size);
-          const size_t merge_end = std::min(merge_start + merge_group_size, input_size);
-          if (merge_mid < merge_end) {
-            BatcherMerge(input_data_, merge_start, merge_mid, merge_end);
-          }
-        }
-      });
+  ppc::core::ParallelFor(0, blocks_count, [&](size_t first, size_t last) {
+    for (size_t block = first; block < last; ++block) {
+      RadixDoubleSort(input_data_, bounds[block], bounds[block + 1]);
     }
-    for (auto &thread : merge_threads) {
-      thread.join();
+  });
+
+  std::vector<double> merged(input_size);
+  const auto runs = ppc::core::MakeRuns<double>(input_data_, bounds);
+  ppc::core::ParallelFor(0, num_threads, [&](size_t first, size_t last) {
+    for (size_t part = first; part < last; ++part) {
+      ppc::core::MultiwayMergePart<double>(runs, merged, part, num_threads);
     }
-  }
+  });
+  input_data_.swap(merged);
   return true;
 }
 
@@ -19,8 +19,6 @@ class FoxSTL : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  [[nodiscard]] double AtA(size_t i, size_t j) const;
-  [[nodiscard]] double AtB(size_t i, size_t j) const;
   void MatMulBlocks(size_t a_pos_x, size_t a_pos_y, size_t b_pos_x, size_t b_pos_y, size_t c_pos_x, size_t c_pos_y,
                     size_t size);
   std::vector<double> input_a_;
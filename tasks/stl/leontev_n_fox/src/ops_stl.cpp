@@ -6,24 +6,11 @@
 #include <thread>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
 #include "core/util/include/util.hpp"
 
 namespace leontev_n_fox_stl {
 
-double FoxSTL::AtA(size_t i, size_t j) const {
-  if (i >= n_ || j >= n_) {
-    return 0.0;
-  }
-  return input_a_[(i * n_) + j];
-}
-
-double FoxSTL::AtB(size_t i, size_t j) const {
-  if (i >= n_ || j >= n_) {
-    return 0.0;
-  }
-  return input_b_[(i * n_) + j];
-}
-
 std::vector<double> MatMul(std::vector<double>& a, std::vector<double>& b, size_t n) {
   std::vector<double> res(n * n, 0.0);
   for (size_t j = 0; j < n; j++) {
@@ -36,17 +23,17 @@ std::vector<double> MatMul(std::vector<double>& a, std::vector<double>& b, size_
   return res;
 }
 
+// Blocks on the bottom and right edges of the grid may stick out of the matrix and are clipped to it
 void FoxSTL::MatMulBlocks(size_t a_pos_x, size_t a_pos_y, size_t b_pos_x, size_t b_pos_y, size_t c_pos_x,
                           size_t c_pos_y, size_t size) {
-  size_t row_max = (n_ >= c_pos_y) ? (n_ - c_pos_y) : 0;
-  size_t col_max = (n_ >= c_pos_x) ? (n_ - c_pos_x) : 0;
-  for (size_t j = 0; j < std::min(size, col_max); j++) {
-    for (size_t i = 0; i < std::min(size, row_max); i++) {
-      for (size_t l = 0; l < size; l++) {
-        output_[((i + c_pos_y) * n_) + (j + c_pos_x)] += AtA(i + a_pos_y, l + a_pos_x) * AtB(l + b_pos_y, j + b_pos_x);
-      }
-    }
+  size_t rows = (n_ >= c_pos_y) ? std::min(size, n_ - c_pos_y) : 0;
+  size_t cols = (n_ >= c_pos_x) ? std::min(size, n_ - c_pos_x) : 0;
+  size_t depth = (n_ >= a_pos_x) ? std::min(size, n_ - a_pos_x) : 0;
+  if (rows == 0 || cols == 0 || depth == 0) {
+    return;
   }
+  ppc::core::Gemm(rows, cols, depth, &input_a_[(a_pos_y * n_) + a_pos_x], n_, &input_b_[(b_pos_y * n_) + b_pos_x], n_,
+                  &output_[(c_pos_y * n_) + c_pos_x], n_);
 }
 
 bool FoxSTL::PreProcessingImpl() {
@@ -3,13 +3,11 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <ctime>
-#include <numeric>
-#include <random>
-#include <thread>
+#include <functional>
 #include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/pool/include/thread_pool.hpp"
+#include "core/random/include/philox.hpp"
 
 namespace lopatin_i_monte_carlo_stl {
 
@@ -46,67 +44,38 @@ bool TestTaskSTL::PreProcessingImpl() {
 bool TestTaskSTL::RunImpl() {
   const size_t d = integrationBounds_.size() / 2;  // dimensions
 
-  const int num_threads = ppc::util::GetPPCNumThreads();
-  std::vector<std::thread> threads(num_threads);
-  std::vector<double> partial_sums(num_threads, 0.0);
-  const int chunk_size = iterations_ / num_threads;
-  const int remainder = iterations_ % num_threads;
-
-  // init random numbers generator
-  std::vector<std::mt19937> generators;
-  std::random_device rd;
-  std::seed_seq seed{rd(), static_cast<unsigned int>(std::time(nullptr))};
-  std::vector<std::mt19937::result_type> seeds(num_threads);
-  seed.generate(seeds.begin(), seeds.end());
-  generators.reserve(seeds.size());
-  for (auto& s : seeds) {
-    generators.emplace_back(s);
-  }
-
   // volume of integration region
   double volume = 1.0;
   for (size_t j = 0; j < d; ++j) {
     volume *= (integrationBounds_[(2 * j) + 1] - integrationBounds_[2 * j]);
   }
 
-  auto thread_task = [&](int thread_id, int start, int end) {
-    std::uniform_real_distribution<> dis(0.0, 1.0);
-    auto& gen = generators[thread_id];
-    double local_sum = 0.0;
-
-    for (int i = start; i < end; ++i) {
-      std::vector<double> point(d);
-      for (size_t j = 0; j < d; ++j) {
-        const double min = integrationBounds_[2 * j];
-        const double max = integrationBounds_[(2 * j) + 1];
-        point[j] = min + (max - min) * dis(gen);
-      }
-      local_sum += integrand_(point);
-    }
-
-    partial_sums[thread_id] = local_sum;
-  };
-
-  // create and run threads
-  int start = 0;
-  for (int tid = 0; tid < num_threads; ++tid) {
-    const int end = start + chunk_size + (tid < remainder ? 1 : 0);
-    threads[tid] = std::thread(thread_task, tid, start, end);
-    start = end;
-  }
-
-  // waiting for all threads to end their work
-  for (auto& t : threads) {
-    t.join();
-  }
-
-  double total_sum = std::accumulate(partial_sums.begin(), partial_sums.end(), 0.0);
+  // chunks jump to their own samples of one sequence, so the result does not depend on the number of threads
+  const double total_sum = ppc::core::ParallelReduce<double>(
+      0, iterations_, 0.0, [&](std::size_t begin, std::size_t end) { return SampleSum(begin, end); }, std::plus<>(),
+      1024);
 
   result_ = (total_sum / iterations_) * volume;
 
   return true;
 }
 
+double TestTaskSTL::SampleSum(std::size_t first, std::size_t last) const {
+  const size_t d = integrationBounds_.size() / 2;  // dimensions
+
+  // sample i takes the uniforms [i * d, (i + 1) * d) of the fixed sequence
+  auto rnd = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, d);
+  std::vector<double> point(d);
+  double sum = 0.0;
+  for (size_t i = first; i < last; ++i) {
+    for (size_t j = 0; j < d; ++j) {
+      point[j] = rnd.Uniform(integrationBounds_[2 * j], integrationBounds_[(2 * j) + 1]);
+    }
+    sum += integrand_(point);
+  }
+  return sum;
+}
+
 bool TestTaskSTL::PostProcessingImpl() {
   auto* output_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
   *output_ptr = result_;
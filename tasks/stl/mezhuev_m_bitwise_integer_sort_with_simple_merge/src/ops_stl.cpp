@@ -3,17 +3,19 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <thread>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+#include "core/pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 namespace mezhuev_m_bitwise_integer_sort_stl {
 
 namespace {
 
-void SeparateNumbers(const std::vector<int>& input, std::vector<int>& negative, std::vector<int>& positive) {
+void SeparateNumbers(std::span<const int> input, std::vector<int>& negative, std::vector<int>& positive) {
   for (int num : input) {
     if (num < 0) {
       negative.push_back(-num);
@@ -51,6 +53,18 @@ void ProcessNumbers(std::vector<int>& numbers, int max_value) {
     exp *= 10;
   }
 }
+
+// Sorts one block: magnitudes of negative and positive numbers are sorted separately
+void SortBlock(std::span<const int> block, std::span<int> out, int max_value) {
+  std::vector<int> negative;
+  std::vector<int> positive;
+  SeparateNumbers(block, negative, positive);
+  ProcessNumbers(positive, max_value);
+  ProcessNumbers(negative, max_value);
+
+  auto it = std::ranges::transform(negative.rbegin(), negative.rend(), out.begin(), [](int num) { return -num; }).out;
+  std::ranges::copy(positive, it);
+}
 }  // namespace
 
 bool SortSTL::PreProcessingImpl() {
@@ -78,50 +92,27 @@ bool SortSTL::RunImpl() {
     return true;
   }
 
-  std::vector<int> negative;
-  std::vector<int> positive;
-  SeparateNumbers(input_, negative, positive);
-
-  auto sort_in_threads = [&](std::vector<int>& numbers) {
-    size_t num_threads = ppc::util::GetPPCNumThreads();
-    if (num_threads == 0) {
-      num_threads = 4;
-    }
-
-    size_t chunk_size = numbers.size() / num_threads;
-    std::vector<std::thread> threads;
-
-    for (size_t i = 0; i < num_threads; ++i) {
-      size_t start = i * chunk_size;
-      size_t end = (i == num_threads - 1) ? numbers.size() : start + chunk_size;
-      threads.emplace_back([&, start, end]() {
-        auto start_iter = numbers.begin() + static_cast<std::vector<int>::difference_type>(start);
-        auto end_iter = numbers.begin() + static_cast<std::vector<int>::difference_type>(end);
-        std::vector<int> chunk(start_iter, end_iter);
-        ProcessNumbers(chunk, max_value_);
-        std::ranges::copy(chunk.begin(), chunk.end(),
-                          numbers.begin() + static_cast<std::vector<int>::difference_type>(start));
-      });
+  const size_t blocks = std::max<size_t>(1, std::min<size_t>(ppc::util::GetPPCNumThreads(), input_.size()));
+  std::vector<size_t> bounds(blocks + 1);
+  for (size_t i = 0; i <= blocks; ++i) {
+    bounds[i] = i * input_.size() / blocks;
+  }
+  std::vector<int> sorted_blocks(input_.size());
+  ppc::core::ParallelFor(0, blocks, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; ++i) {
+      const size_t size = bounds[i + 1] - bounds[i];
+      SortBlock(std::span(input_).subspan(bounds[i], size), std::span(sorted_blocks).subspan(bounds[i], size),
+                max_value_);
     }
+  });
 
-    for (auto& thread : threads) {
-      thread.join();
+  const auto runs = ppc::core::MakeRuns<int>(sorted_blocks, bounds);
+  output_.resize(input_.size());
+  ppc::core::ParallelFor(0, blocks, [&](size_t first, size_t last) {
+    for (size_t part = first; part < last; ++part) {
+      ppc::core::MultiwayMergePart<int>(runs, output_, part, blocks);
     }
-
-    std::ranges::sort(numbers);
-  };
-
-  sort_in_threads(positive);
-  sort_in_threads(negative);
-
-  std::ranges::reverse(negative);
-  for (int& num : negative) {
-    num = -num;
-  }
-
-  output_.clear();
-  output_.insert(output_.end(), negative.begin(), negative.end());
-  output_.insert(output_.end(), positive.begin(), positive.end());
+  });
 
   return true;
 }
@@ -418,4 +418,24 @@ TEST(muhina_m_dijkstra_stl, test_graph_with_self_loops) {
   for (size_t i = 0; i < kNumVertices; ++i) {
     EXPECT_EQ(distances[i], expected_distances[i]);
   }
-}
\ No newline at end of file
+}
+
+TEST(muhina_m_dijkstra_stl, test_dijkstra_batched_sources) {
+  // 0 -> 1 (4), 0 -> 2 (1), 1 -> 3 (1), 2 -> 1 (2), 3 -> 0 (7); one row of distances per source
+  std::vector<int> graph_data = {1, 4, 2, 1, -1, 3, 1, -1, 1, 2, -1, 0, 7, -1};
+  std::vector<std::uint32_t> sources = {0, 3, 2};
+  std::vector<int> distances(sources.size() * 4, INT_MAX);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(graph_data.data()));
+  task_data->inputs_count.emplace_back(graph_data.size());
+  task_data->AddInput(sources.data(), sources.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(distances.data()));
+  task_data->outputs_count.emplace_back(distances.size());
+
+  muhina_m_dijkstra_stl::TestTaskSTL task(task_data);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  ASSERT_TRUE(task.Run());
+  task.PostProcessing();
+  EXPECT_EQ(distances, (std::vector<int>{0, 3, 1, 4, 7, 10, 8, 0, 10, 2, 0, 3}));
+}
@@ -4,6 +4,7 @@
 #include <climits>
 #include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <mutex>
@@ -12,13 +13,12 @@
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/graph.hpp"
+#include "core/graph/include/sssp.hpp"
 #include "core/util/include/util.hpp"
 
-const int muhina_m_dijkstra_stl::TestTaskSTL::kEndOfVertexList = -1;
-
 namespace {
-void ProcessVertex(const std::pair<int, size_t>& current,
-                   const std::vector<std::vector<std::pair<size_t, int>>>& adj_list,
+void ProcessVertex(const std::pair<int, size_t>& current, ppc::core::graph::CsrGraphView graph,
                    std::vector<std::atomic<int>>& atomic_distances,
                    std::priority_queue<std::pair<int, size_t>, std::vector<std::pair<int, size_t>>, std::greater<>>& pq,
                    std::mutex& pq_mtx, std::condition_variable& cv, std::atomic<int>& active_threads) {
@@ -31,9 +31,9 @@ void ProcessVertex(const std::pair<int, size_t>& current,
     return;
   }
 
-  for (const auto& neighbor : adj_list[u]) {
-    size_t v = neighbor.first;
-    int weight = neighbor.second;
+  for (std::uint32_t e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+    size_t v = graph.targets[e];
+    int weight = graph.weights[e];
     int new_dist = dist_u + weight;
 
     int old_dist = atomic_distances[v].load(std::memory_order_relaxed);
@@ -53,8 +53,8 @@ void ProcessVertex(const std::pair<int, size_t>& current,
   cv.notify_all();
 }
 
-void RunDijkstraAlgorithm(const std::vector<std::vector<std::pair<size_t, int>>>& adj_list, std::vector<int>& distances,
-                          size_t start_vertex, int num_threads) {
+void RunDijkstraAlgorithm(ppc::core::graph::CsrGraphView graph, std::vector<int>& distances, size_t start_vertex,
+                          int num_threads) {
   using P = std::pair<int, size_t>;
   std::priority_queue<P, std::vector<P>, std::greater<>> pq;
   std::mutex pq_mtx;
@@ -103,7 +103,7 @@ void RunDijkstraAlgorithm(const std::vector<std::vector<std::pair<size_t, int>>>
         continue;
       }
 
-      ProcessVertex(current, adj_list, atomic_distances, pq, pq_mtx, cv, active_threads);
+      ProcessVertex(current, graph, atomic_distances, pq, pq_mtx, cv, active_threads);
     }
   };
 
@@ -124,61 +124,33 @@ void RunDijkstraAlgorithm(const std::vector<std::vector<std::pair<size_t, int>>>
 }  // namespace
 
 bool muhina_m_dijkstra_stl::TestTaskSTL::PreProcessingImpl() {
-  unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-  graph_data_.assign(in_ptr, in_ptr + input_size);
-
-  num_vertices_ = task_data->outputs_count[0];
-  distances_.resize(num_vertices_);
-  for (size_t i = 0; i < num_vertices_; ++i) {
-    distances_[i] = INT_MAX;
-  }
-  if (task_data->inputs.size() > 1 && task_data->inputs[1] != nullptr) {
-    start_vertex_ = *reinterpret_cast<int*>(task_data->inputs[1]);
-  } else {
-    start_vertex_ = 0;
+  // A batch of sources fills outputs[0] with one row of distances per source
+  sources_ = ppc::core::graph::TaskSources(*task_data, ppc::core::graph::GraphInputsCount(*task_data));
+  num_vertices_ = task_data->outputs_count[0] / sources_.size();
+  valid_graph_ = graph_.Load(*task_data, num_vertices_);
+
+  distances_.assign(sources_.size() * num_vertices_, INT_MAX);
+  if (valid_graph_) {
+    distances_[sources_.front()] = 0;
   }
-  distances_[start_vertex_] = 0;
-
   return true;
 }
 
 bool muhina_m_dijkstra_stl::TestTaskSTL::ValidationImpl() {
-  return !task_data->inputs_count.empty() && task_data->inputs_count[0] > 0 && !task_data->outputs_count.empty() &&
-         task_data->outputs_count[0] > 0;
+  return !task_data->inputs_count.empty() && task_data->inputs_count[0] > 0 &&
+         ppc::core::graph::ValidTaskSources(*task_data, ppc::core::graph::GraphInputsCount(*task_data));
 }
 
 bool muhina_m_dijkstra_stl::TestTaskSTL::RunImpl() {
-  std::vector<std::vector<std::pair<size_t, int>>> adj_list(num_vertices_);
-  size_t current_vertex = 0;
-  size_t i = 0;
-
-  while (i < graph_data_.size() && current_vertex < num_vertices_) {
-    if (graph_data_[i] == kEndOfVertexList) {
-      current_vertex++;
-      i++;
-      continue;
-    }
-
-    if (i + 1 >= graph_data_.size()) {
-      break;
-    }
-
-    size_t dest = graph_data_[i];
-    int weight = graph_data_[i + 1];
-
-    if (weight < 0) {
-      return false;
-    }
-
-    if (dest < num_vertices_) {
-      adj_list[current_vertex].emplace_back(dest, weight);
-    }
-
-    i += 2;
+  if (!valid_graph_) {
+    return false;
+  }
+  if (sources_.size() > 1) {
+    ppc::core::graph::BatchedShortestPaths(graph_.View(), sources_, distances_, ppc::core::graph::StlBackend{});
+    return true;
   }
   const int num_threads = ppc::util::GetPPCNumThreads();
-  RunDijkstraAlgorithm(adj_list, distances_, start_vertex_, num_threads);
+  RunDijkstraAlgorithm(graph_.View(), distances_, sources_.front(), num_threads);
   return true;
 }
 
@@ -3,9 +3,10 @@
 #include <algorithm>
 #include <cstddef>
 #include <random>
-#include <thread>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+#include "core/pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 bool nikolaev_r_hoare_sort_simple_merge_stl::HoareSortSimpleMergeSTL::PreProcessingImpl() {
@@ -22,39 +23,26 @@ bool nikolaev_r_hoare_sort_simple_merge_stl::HoareSortSimpleMergeSTL::Validation
 }
 
 bool nikolaev_r_hoare_sort_simple_merge_stl::HoareSortSimpleMergeSTL::RunImpl() {
-  unsigned int num_threads = ppc::util::GetPPCNumThreads();
-  if (num_threads == 1 || vect_size_ < num_threads) {
-    QuickSort(0, vect_size_ - 1);
-    return true;
+  const size_t blocks = std::max<size_t>(1, std::min<size_t>(ppc::util::GetPPCNumThreads(), vect_size_));
+  std::vector<size_t> bounds(blocks + 1);
+  for (size_t i = 0; i <= blocks; i++) {
+    bounds[i] = i * vect_size_ / blocks;
   }
 
-  size_t total = vect_.size();
-  std::vector<size_t> boundaries;
-  boundaries.push_back(0);
-  size_t chunk_size = total / num_threads;
-  for (unsigned int i = 1; i < num_threads; i++) {
-    boundaries.push_back(i * chunk_size);
-  }
-  boundaries.push_back(total);
-
-  std::vector<std::thread> threads;
-  for (unsigned int i = 0; i < num_threads; ++i) {
-    size_t start_index = boundaries[i];
-    size_t end_index = boundaries[i + 1];
-    threads.emplace_back([this, start_index, end_index]() { QuickSort(start_index, end_index - 1); });
-  }
-
-  for (auto &t : threads) {
-    t.join();
-  }
+  ppc::core::ParallelFor(0, blocks, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; i++) {
+      QuickSort(bounds[i], bounds[i + 1] - 1);
+    }
+  });
 
-  size_t merged_end = boundaries[1];
-  for (unsigned int i = 1; i < num_threads; i++) {
-    size_t next_end = boundaries[i + 1];
-    std::inplace_merge(vect_.begin(), vect_.begin() + static_cast<std::vector<double>::difference_type>(merged_end),
-                       vect_.begin() + static_cast<std::vector<double>::difference_type>(next_end));
-    merged_end = next_end;
-  }
+  const auto runs = ppc::core::MakeRuns<double>(vect_, bounds);
+  std::vector<double> merged(vect_size_);
+  ppc::core::ParallelFor(0, blocks, [&](size_t first, size_t last) {
+    for (size_t part = first; part < last; part++) {
+      ppc::core::MultiwayMergePart<double>(runs, merged, part, blocks);
+    }
+  });
+  vect_.swap(merged);
   return true;
 }
 
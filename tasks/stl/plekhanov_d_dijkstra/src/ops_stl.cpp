@@ -3,6 +3,7 @@
 #include <atomic>
 #include <climits>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <mutex>
 #include <queue>
@@ -10,72 +11,35 @@
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/graph.hpp"
+#include "core/graph/include/sssp.hpp"
 #include "core/util/include/util.hpp"
 
-namespace plekhanov_d_dijkstra_stl {
-
-namespace {
-
-bool ConvertGraphToAdjacencyList(const std::vector<int>& graph_data, size_t num_vertices,
-                                 std::vector<std::vector<std::pair<int, int>>>& graph) {
-  graph.assign(num_vertices, {});
-  size_t current_vertex = 0;
-  size_t i = 0;
-  while (i < graph_data.size() && current_vertex < num_vertices) {
-    if (graph_data[i] == -1) {
-      current_vertex++;
-      i++;
-      continue;
-    }
-    if (i + 1 >= graph_data.size()) {
-      break;
-    }
-    size_t dest = graph_data[i];
-    int weight = graph_data[i + 1];
-    if (weight < 0) {
-      return false;
-    }
-    if (dest < num_vertices) {
-      graph[current_vertex].emplace_back(static_cast<int>(dest), weight);
-    }
-    i += 2;
-  }
-  return true;
-}
-
-}  // namespace
-
-}  // namespace plekhanov_d_dijkstra_stl
-
-const int plekhanov_d_dijkstra_stl::TestTaskSTL::kEndOfVertexList = -1;
-
 bool plekhanov_d_dijkstra_stl::TestTaskSTL::PreProcessingImpl() {
-  unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-  graph_data_.assign(in_ptr, in_ptr + input_size);
-  num_vertices_ = task_data->outputs_count[0];
-  distances_.assign(num_vertices_, INT_MAX);
-
-  if (task_data->inputs.size() > 1 && task_data->inputs[1] != nullptr) {
-    start_vertex_ = *reinterpret_cast<int*>(task_data->inputs[1]);
-  } else {
-    start_vertex_ = 0;
-  }
-  distances_[start_vertex_] = 0;
+  // A batch of sources fills outputs[0] with one row of distances per source
+  sources_ = ppc::core::graph::TaskSources(*task_data, ppc::core::graph::GraphInputsCount(*task_data));
+  num_vertices_ = task_data->outputs_count[0] / sources_.size();
+  valid_graph_ = graph_.Load(*task_data, num_vertices_);
+
+  distances_.resize(sources_.size() * num_vertices_);
   return true;
 }
 
 bool plekhanov_d_dijkstra_stl::TestTaskSTL::ValidationImpl() {
-  return !task_data->inputs_count.empty() && task_data->inputs_count[0] > 0 && !task_data->outputs_count.empty() &&
-         task_data->outputs_count[0] > 0;
+  return !task_data->inputs_count.empty() && task_data->inputs_count[0] > 0 &&
+         ppc::core::graph::ValidTaskSources(*task_data, ppc::core::graph::GraphInputsCount(*task_data));
 }
 
 bool plekhanov_d_dijkstra_stl::TestTaskSTL::RunImpl() {
-  std::vector<std::vector<std::pair<int, int>>> graph(num_vertices_);
-
-  if (!ConvertGraphToAdjacencyList(graph_data_, num_vertices_, graph)) {
+  if (!valid_graph_) {
     return false;
   }
+  if (sources_.size() > 1) {
+    ppc::core::graph::BatchedShortestPaths(graph_.View(), sources_, distances_, ppc::core::graph::StlBackend{});
+    return true;
+  }
+  const auto graph = graph_.View();
+  const size_t source = sources_.front();
 
   struct Compare {
     bool operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first > b.first; }
@@ -85,10 +49,10 @@ bool plekhanov_d_dijkstra_stl::TestTaskSTL::RunImpl() {
   for (auto& d : distance) {
     d.store(INT_MAX);
   }
-  distance[start_vertex_] = 0;
+  distance[source] = 0;
 
   std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, Compare> pq;
-  pq.emplace(0, start_vertex_);
+  pq.emplace(0, source);
 
   std::mutex pq_mutex;
 
@@ -113,8 +77,9 @@ bool plekhanov_d_dijkstra_stl::TestTaskSTL::RunImpl() {
         }
       }
 
-      for (const auto& [v, weight] : graph[u]) {
-        int new_dist = cur_dist + weight;
+      for (std::uint32_t e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+        const auto v = static_cast<int>(graph.targets[e]);
+        int new_dist = cur_dist + graph.weights[e];
         int old_val = distance[v].load();
 
         while (new_dist < old_val && !distance[v].compare_exchange_weak(old_val, new_dist)) {
@@ -1,90 +1,70 @@
-#include "stl/sharamygina_i_multi_dim_monte_carlo/include/ops_stl.h"
-
-#include <algorithm>
-#include <core/util/include/util.hpp>
-#include <cstdlib>
-#include <ctime>
-#include <functional>
-#include <future>
-#include <numeric>
-#include <random>
-#include <vector>
-
-bool sharamygina_i_multi_dim_monte_carlo_stl::MultiDimMonteCarloTask::PreProcessingImpl() {
-  auto* raw_bounds = reinterpret_cast<double*>(task_data->inputs[0]);
-  size_t total_bounds_count = task_data->inputs_count[0];
-  boundaries_.resize(total_bounds_count);
-  std::copy(raw_bounds, raw_bounds + total_bounds_count, boundaries_.begin());
-  auto* function_ptr = reinterpret_cast<std::function<double(const std::vector<double>&)>*>(task_data->inputs[2]);
-  integrating_function_ = *function_ptr;
-  int* iter_ptr = reinterpret_cast<int*>(task_data->inputs[1]);
-  number_of_iterations_ = *iter_ptr;
-
-  return true;
-}
-
-bool sharamygina_i_multi_dim_monte_carlo_stl::MultiDimMonteCarloTask::ValidationImpl() {
-  return task_data && !task_data->outputs_count.empty() && !task_data->outputs.empty() && !task_data->inputs.empty() &&
-         task_data->outputs_count[0] == 1 && (task_data->inputs_count.size() == 3) &&
-         (task_data->inputs_count[0] % 2 == 0) && (task_data->inputs_count[1] == 1) &&
-         (task_data->inputs_count[2] == 1);
-}
-
-bool sharamygina_i_multi_dim_monte_carlo_stl::MultiDimMonteCarloTask::RunImpl() {
-  size_t dimension = boundaries_.size() / 2;
-
-  const int num_threads = ppc::util::GetPPCNumThreads();
-  std::vector<std::future<double>> futures;
-
-  int iterations_per_thread = number_of_iterations_ / num_threads;
-  int remainder = number_of_iterations_ % num_threads;
-
-  for (int t = 0; t < num_threads; ++t) {
-    int start = t * iterations_per_thread;
-    int end = (t == num_threads - 1) ? (start + iterations_per_thread + remainder) : (start + iterations_per_thread);
-
-    futures.push_back(std::async(std::launch::async, [this, start, end, dimension, t]() -> double {
-      std::random_device rd;
-      unsigned long seed = rd() + static_cast<unsigned long>(t);
-      std::mt19937 local_engine(seed);
-      std::uniform_real_distribution<double> local_distribution(0.0, 1.0);
-
-      double local_accumulator = 0.0;
-      std::vector<double> random_point(dimension);
-
-      for (int n = start; n < end; ++n) {
-        for (size_t i = 0; i < dimension; ++i) {
-          double low = boundaries_[2 * i];
-          double high = boundaries_[(2 * i) + 1];
-          double rnd = local_distribution(local_engine);
-          random_point[i] = low + (high - low) * rnd;
-        }
-        local_accumulator += integrating_function_(random_point);
-      }
-      return local_accumulator;
-    }));
-  }
-
-  std::vector<double> results;
-  results.reserve(futures.size());
-  for (auto& future : futures) {
-    results.push_back(future.get());
-  }
-  double accumulator = std::reduce(results.begin(), results.end(), 0.0);
-
-  double volume = 1.0;
-  for (size_t i = 0; i < dimension; ++i) {
-    double edge_length = boundaries_[(2 * i) + 1] - boundaries_[2 * i];
-    volume *= edge_length;
-  }
-
-  final_result_ = (accumulator / static_cast<double>(number_of_iterations_)) * volume;
-
-  return true;
-}
-
-bool sharamygina_i_multi_dim_monte_carlo_stl::MultiDimMonteCarloTask::PostProcessingImpl() {
-  auto* output_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
-  output_ptr[0] = final_result_;
-  return true;
-}
+#include "stl/sharamygina_i_multi_dim_monte_carlo/include/ops_stl.h"
+
+#include <algorithm>
+#include <core/pool/include/thread_pool.hpp>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+#include "core/random/include/philox.hpp"
+
+bool sharamygina_i_multi_dim_monte_carlo_stl::MultiDimMonteCarloTask::PreProcessingImpl() {
+  auto* raw_bounds = reinterpret_cast<double*>(task_data->inputs[0]);
+  size_t total_bounds_count = task_data->inputs_count[0];
+  boundaries_.resize(total_bounds_count);
+  std::copy(raw_bounds, raw_bounds + total_bounds_count, boundaries_.begin());
+  auto* function_ptr = reinterpret_cast<std::function<double(const std::vector<double>&)>*>(task_data->inputs[2]);
+  integrating_function_ = *function_ptr;
+  int* iter_ptr = reinterpret_cast<int*>(task_data->inputs[1]);
+  number_of_iterations_ = *iter_ptr;
+
+  return true;
+}
+
+bool sharamygina_i_multi_dim_monte_carlo_stl::MultiDimMonteCarloTask::ValidationImpl() {
+  return task_data && !task_data->outputs_count.empty() && !task_data->outputs.empty() && !task_data->inputs.empty() &&
+         task_data->outputs_count[0] == 1 && (task_data->inputs_count.size() == 3) &&
+         (task_data->inputs_count[0] % 2 == 0) && (task_data->inputs_count[1] == 1) &&
+         (task_data->inputs_count[2] == 1);
+}
+
+bool sharamygina_i_multi_dim_monte_carlo_stl::MultiDimMonteCarloTask::RunImpl() {
+  size_t dimension = boundaries_.size() / 2;
+
+  // chunks jump to their own samples of one sequence, so the result does not depend on the number of threads
+  double accumulator = ppc::core::ParallelReduce<double>(
+      0, number_of_iterations_, 0.0, [this](size_t start, size_t end) { return SampleSum(start, end); }, std::plus<>(),
+      1024);
+
+  double volume = 1.0;
+  for (size_t i = 0; i < dimension; ++i) {
+    double edge_length = boundaries_[(2 * i) + 1] - boundaries_[2 * i];
+    volume *= edge_length;
+  }
+
+  final_result_ = (accumulator / static_cast<double>(number_of_iterations_)) * volume;
+
+  return true;
+}
+
+double sharamygina_i_multi_dim_monte_carlo_stl::MultiDimMonteCarloTask::SampleSum(size_t first, size_t last) const {
+  size_t dimension = boundaries_.size() / 2;
+
+  auto engine = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, dimension);
+  std::vector<double> random_point(dimension);
+  double accumulator = 0.0;
+
+  for (size_t n = first; n < last; ++n) {
+    for (size_t i = 0; i < dimension; ++i) {
+      random_point[i] = engine.Uniform(boundaries_[2 * i], boundaries_[(2 * i) + 1]);
+    }
+    accumulator += integrating_function_(random_point);
+  }
+  return accumulator;
+}
+
+bool sharamygina_i_multi_dim_monte_carlo_stl::MultiDimMonteCarloTask::PostProcessingImpl() {
+  auto* output_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
+  output_ptr[0] = final_result_;
+  return true;
+}
@@ -8,8 +8,6 @@
 namespace shlyakov_m_shell_sort_stl {
 
 void ShellSort(int left, int right, std::vector<int>& arr);
-void Merge(int left, int mid, int right, std::vector<int>& arr, std::vector<int>& buffer);
-void ParallelMerge(std::vector<std::pair<int, int>>& segs, std::vector<int>& arr, std::vector<int>& buffer);
 
 class TestTaskSTL : public ppc::core::Task {
  public:
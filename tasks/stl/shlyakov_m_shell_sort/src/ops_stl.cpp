@@ -2,9 +2,10 @@
 
 #include <algorithm>
 #include <cstddef>
-#include <thread>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+#include "core/pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 namespace shlyakov_m_shell_sort_stl {
@@ -21,90 +22,39 @@ bool TestTaskSTL::PreProcessingImpl() {
 bool TestTaskSTL::ValidationImpl() { return task_data->inputs_count[0] == task_data->outputs_count[0]; }
 
 bool TestTaskSTL::RunImpl() {
-  int array_size = static_cast<int>(input_.size());
+  const int array_size = static_cast<int>(input_.size());
   if (array_size < 2) {
     return true;
   }
 
-  unsigned int hardware_threads = ppc::util::GetPPCNumThreads();
-  int num_threads = (hardware_threads > 0) ? static_cast<int>(hardware_threads) : 1;
+  const int num_threads = std::max(1, std::min(ppc::util::GetPPCNumThreads(), array_size));
+  const int sub_arr_size = (array_size + num_threads - 1) / num_threads;
 
-  int sub_arr_size = (array_size + num_threads - 1) / num_threads;
-
-  std::vector<std::thread> threads;
-
-  for (int i = 0; i < num_threads; ++i) {
-    int left = i * sub_arr_size;
-    int right = std::min(left + sub_arr_size - 1, array_size - 1);
-
-    if (left < right) {
-      threads.emplace_back([this, left, right]() { ShellSort(left, right, input_); });
-    }
+  std::vector<std::size_t> bounds(num_threads + 1);
+  for (int i = 0; i <= num_threads; ++i) {
+    bounds[i] = static_cast<std::size_t>(std::min(i * sub_arr_size, array_size));
   }
 
-  for (auto& thread : threads) {
-    if (thread.joinable()) {
-      thread.join();
-    }
-  }
-
-  std::vector<int> buffer(input_.size());
-  while (num_threads > 1) {
-    int new_num_threads = (num_threads + 1) / 2;
-    threads.clear();
-
-    for (int i = 0; i < new_num_threads; ++i) {
-      int left = i * 2 * sub_arr_size;
-      int mid = std::min(left + sub_arr_size - 1, array_size - 1);
-      int right = std::min(left + (2 * sub_arr_size) - 1, array_size - 1);
-
-      if (mid < right) {
-        threads.emplace_back([this, left, mid, right]() {
-          std::vector<int> local_buffer(input_.size());
-          Merge(left, mid, right, input_, local_buffer);
-        });
+  ppc::core::ParallelFor(0, num_threads, [&](std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; ++i) {
+      const int left = static_cast<int>(bounds[i]);
+      const int right = static_cast<int>(bounds[i + 1]) - 1;
+      if (left < right) {
+        ShellSort(left, right, input_);
       }
     }
+  });
 
-    for (auto& thread : threads) {
-      if (thread.joinable()) {
-        thread.join();
-      }
+  const auto runs = ppc::core::MakeRuns<int>(input_, bounds);
+  output_.resize(input_.size());
+  ppc::core::ParallelFor(0, num_threads, [&](std::size_t first, std::size_t last) {
+    for (std::size_t part = first; part < last; ++part) {
+      ppc::core::MultiwayMergePart<int>(runs, output_, part, num_threads);
     }
-
-    sub_arr_size *= 2;
-    num_threads = new_num_threads;
-  }
-
-  output_ = input_;
+  });
   return true;
 }
 
-void Merge(int left, int mid, int right, std::vector<int>& arr, std::vector<int>& buffer) {
-  int i = left;
-  int j = mid + 1;
-  int k = 0;
-  const int merge_size = right - left + 1;
-
-  if (buffer.size() < static_cast<std::size_t>(merge_size)) {
-    buffer.resize(static_cast<std::size_t>(merge_size));
-  }
-
-  for (; i <= mid || j <= right;) {
-    if (i > mid) {
-      buffer[k++] = arr[j++];
-    } else if (j > right) {
-      buffer[k++] = arr[i++];
-    } else {
-      buffer[k++] = (arr[i] <= arr[j]) ? arr[i++] : arr[j++];
-    }
-  }
-
-  for (size_t idx = 0; idx < static_cast<size_t>(k); ++idx) {
-    arr[left + idx] = buffer[idx];
-  }
-}
-
 void ShellSort(int left, int right, std::vector<int>& arr) {
   int sub_array_size = right - left + 1;
   int gap = 1;
@@ -50,8 +50,6 @@ class JarvisSTLParallel : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
-  static void MakeJarvisPassageSTL(std::vector<shulpin_i_jarvis_stl::Point>& input,
-                                   std::vector<shulpin_i_jarvis_stl::Point>& output);
 
  private:
   std::vector<shulpin_i_jarvis_stl::Point> input_stl_, output_stl_;
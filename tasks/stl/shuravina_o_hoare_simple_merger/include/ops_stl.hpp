@@ -21,7 +21,6 @@ class TestTaskSTL : public ppc::core::Task {
   std::vector<int> output_;
 
   static void QuickSort(std::vector<int>& arr, int left, int right);
-  static void MergeHelper(std::vector<int>& arr, int left, int mid, int right);
 
   bool ValidationImpl() override;
   bool PreProcessingImpl() override;
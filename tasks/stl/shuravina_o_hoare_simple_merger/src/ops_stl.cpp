@@ -1,13 +1,14 @@
 #include "stl/shuravina_o_hoare_simple_merger/include/ops_stl.hpp"
 
 #include <algorithm>
-#include <atomic>
+#include <cstddef>
 #include <core/util/include/util.hpp>
-#include <future>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+#include "core/pool/include/thread_pool.hpp"
 #include "core/task/include/task.hpp"
 
 namespace shuravina_o_hoare_simple_merger {
@@ -61,68 +62,32 @@ void TestTaskSTL::QuickSort(std::vector<int>& arr, int left, int right) {
   QuickSort(arr, i, right);
 }
 
-void TestTaskSTL::MergeHelper(std::vector<int>& arr, int left, int mid, int right) {
-  std::vector<int> temp(right - left + 1);
-  const int parallel_threshold = 10000;
-  const int num_threads = ppc::util::GetPPCNumThreads();
-  static std::atomic<int> thread_counter(0);
-
-  auto merge_segment = [&](int start_i, int start_j, int end_i, int end_j, int start_k) {
-    int i = start_i;
-    int j = start_j;
-    int k = start_k;
-
-    while (i <= end_i && j <= end_j) {
-      temp[k++] = (arr[i] <= arr[j]) ? arr[i++] : arr[j++];
-    }
-    while (i <= end_i) {
-      temp[k++] = arr[i++];
-    }
-    while (j <= end_j) {
-      temp[k++] = arr[j++];
-    }
-  };
-
-  if ((right - left > parallel_threshold) && (thread_counter.load() < num_threads)) {
-    const int segment_size = (right - left) / num_threads;
-    std::vector<std::future<void>> futures;
-
-    for (int i = 0; i < num_threads; ++i) {
-      const int start = left + (i * segment_size);
-      const int end = (i == num_threads - 1) ? right : (start + segment_size - 1);
-      const int middle = start + ((end - start) / 2);
-
-      if (thread_counter.load() < num_threads) {
-        thread_counter++;
-        futures.push_back(std::async(std::launch::async, [&, start, middle, end]() {
-          merge_segment(start, middle + 1, middle, end, start - left);
-          thread_counter--;
-        }));
-      } else {
-        merge_segment(start, middle + 1, middle, end, start - left);
-      }
-    }
-
-    for (auto& future : futures) {
-      future.get();
-    }
-  } else {
-    merge_segment(left, mid + 1, mid, right, 0);
-  }
-
-  std::ranges::copy(temp, arr.begin() + left);
-}
-
 bool TestTaskSTL::RunImpl() {
   if (input_.empty()) {
     output_ = input_;
     return true;
   }
 
-  const int size = static_cast<int>(input_.size());
-  QuickSort(input_, 0, size - 1);
-  MergeHelper(input_, 0, (size / 2) - 1, size - 1);
-  output_ = input_;
+  const auto size = input_.size();
+  const size_t blocks = std::max<size_t>(1, std::min<size_t>(ppc::util::GetPPCNumThreads(), size));
+  std::vector<size_t> bounds(blocks + 1);
+  for (size_t i = 0; i <= blocks; ++i) {
+    bounds[i] = i * size / blocks;
+  }
+
+  ppc::core::ParallelFor(0, blocks, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; ++i) {
+      QuickSort(input_, static_cast<int>(bounds[i]), static_cast<int>(bounds[i + 1]) - 1);
+    }
+  });
+
+  const auto runs = ppc::core::MakeRuns<int>(input_, bounds);
+  output_.resize(size);
+  ppc::core::ParallelFor(0, blocks, [&](size_t first, size_t last) {
+    for (size_t part = first; part < last; ++part) {
+      ppc::core::MultiwayMergePart<int>(runs, output_, part, blocks);
+    }
+  });
   return true;
 }
 
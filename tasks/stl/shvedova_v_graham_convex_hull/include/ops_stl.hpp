@@ -10,6 +10,10 @@ using Point = std::array<double, 2>;
 
 namespace shvedova_v_graham_convex_hull_stl {
 
+struct Point {
+  double x, y;
+};
+
 class GrahamConvexHullSTL : public ppc::core::Task {
  public:
   explicit GrahamConvexHullSTL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -23,8 +27,6 @@ class GrahamConvexHullSTL : public ppc::core::Task {
   int points_count_{0};
   std::vector<Point> input_;
   std::vector<Point> res_;
-
-  void PerformSort();
 };
 
 }  // namespace shvedova_v_graham_convex_hull_stl
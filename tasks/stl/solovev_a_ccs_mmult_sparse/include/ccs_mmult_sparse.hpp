@@ -1,11 +1,7 @@
 #pragma once
 
-#include <atomic>
 #include <complex>
-#include <condition_variable>
 #include <memory>
-#include <mutex>
-#include <thread>
 #include <utility>
 #include <vector>
 
@@ -34,27 +30,8 @@ class SeqMatMultCcs : public ppc::core::Task {
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
-  static void ProcessPhase1(SeqMatMultCcs* self, int col, std::vector<int>& available);
-  static void ProcessPhase2(SeqMatMultCcs* self, int col, std::vector<int>& available,
-                            std::vector<std::complex<double>>& cask);
-  static void NotifyCompletion(SeqMatMultCcs* self);
-  static void WorkerLoop(SeqMatMultCcs* self);
-
  private:
   MatrixInCcsSparse *M1_, *M2_, *M3_;
-
-  std::vector<std::thread> workers_;
-  std::once_flag init_flag_;
-  std::mutex mtx_;
-  std::condition_variable cv_;
-  std::condition_variable cv_done_;
-  std::atomic<int> next_col_{0};
-  std::atomic<int> completed_{0};
-  int phase_ = 0;
-  int r_n_ = 0, c_n_ = 0;
-  std::atomic<bool> terminate_{false};
-
-  std::vector<int> counts_;
 };
 
 }  // namespace solovev_a_matrix_stl
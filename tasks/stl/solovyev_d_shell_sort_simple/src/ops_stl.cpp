@@ -1,14 +1,33 @@
 #include "stl/solovyev_d_shell_sort_simple/include/ops_stl.hpp"
 
 #include <algorithm>
-#include <barrier>
 #include <cmath>
 #include <cstddef>
-#include <thread>
+#include <span>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+#include "core/pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
+namespace {
+// Shell sort with gaps n/2, n/4, ..., 1 of one block
+void ShellSort(std::span<int> block) {
+  const int size = static_cast<int>(block.size());
+  for (int gap = size / 2; gap > 0; gap /= 2) {
+    for (int f = gap; f < size; f++) {
+      int val = block[f];
+      int j = f;
+      while (j >= gap && block[j - gap] > val) {
+        block[j] = block[j - gap];
+        j -= gap;
+      }
+      block[j] = val;
+    }
+  }
+}
+}  // namespace
+
 bool solovyev_d_shell_sort_simple_stl::TaskSTL::PreProcessingImpl() {
   size_t input_size = task_data->inputs_count[0];
   auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
@@ -23,32 +42,25 @@ bool solovyev_d_shell_sort_simple_stl::TaskSTL::ValidationImpl() {
 
 bool solovyev_d_shell_sort_simple_stl::TaskSTL::RunImpl() {
   num_threads_ = std::max(1, ppc::util::GetPPCNumThreads());
-  std::barrier sync_point(num_threads_);
-
-  std::vector<std::thread> threads(num_threads_);
-  for (int t = 0; t < num_threads_; ++t) {
-    threads[t] = std::thread([&, t] {
-      for (int gap = static_cast<int>(input_.size()) / 2; gap > 0; gap /= 2) {
-        sync_point.arrive_and_wait();
-        for (int i = t; i < gap; i += num_threads_) {
-          for (size_t f = i + gap; f < input_.size(); f += gap) {
-            int val = input_[f];
-            size_t j = f;
-            while (j >= static_cast<size_t>(gap) && input_[j - gap] > val) {
-              input_[j] = input_[j - gap];
-              j -= gap;
-            }
-            input_[j] = val;
-          }
-        }
-      }
-    });
+  const size_t blocks = std::max<size_t>(1, std::min<size_t>(num_threads_, input_.size()));
+  std::vector<size_t> bounds(blocks + 1);
+  for (size_t i = 0; i <= blocks; i++) {
+    bounds[i] = i * input_.size() / blocks;
   }
-  for (auto &th : threads) {
-    if (th.joinable()) {
-      th.join();
+  ppc::core::ParallelFor(0, blocks, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; i++) {
+      ShellSort(std::span(input_).subspan(bounds[i], bounds[i + 1] - bounds[i]));
     }
-  }
+  });
+
+  const auto runs = ppc::core::MakeRuns<int>(input_, bounds);
+  std::vector<int> merged(input_.size());
+  ppc::core::ParallelFor(0, blocks, [&](size_t first, size_t last) {
+    for (size_t part = first; part < last; part++) {
+      ppc::core::MultiwayMergePart<int>(runs, merged, part, blocks);
+    }
+  });
+  input_.swap(merged);
   return true;
 }
 
@@ -9,9 +9,10 @@
 #include <numeric>
 #include <ranges>
 #include <span>
-#include <thread>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+#include "core/pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 namespace {
@@ -75,7 +76,7 @@ bool sorochkin_d_radix_double_sort_simple_merge_stl::SortTask::PreProcessingImpl
 }
 
 bool sorochkin_d_radix_double_sort_simple_merge_stl::SortTask::RunImpl() {
-  output_ = input_;
+  std::vector<double> sorted = input_;
 
   const auto size = input_.size();
   if (size == 0) {
@@ -93,40 +94,23 @@ bool sorochkin_d_radix_double_sort_simple_merge_stl::SortTask::RunImpl() {
   std::vector<std::span<double>> chunks(numthreads);
   std::ranges::generate(chunks, [&, i = 0]() mutable {
     const auto j = i++;
-    return std::span{output_}.subspan(offsets[j], distrib[j]);
+    return std::span{sorted}.subspan(offsets[j], distrib[j]);
   });
 
-  std::vector<std::thread> threads(numthreads);
-  std::ranges::generate(threads,
-                        [&, i = 0]() mutable { return std::thread([chunk = chunks[i++]] { RadixSort(chunk); }); });
-  std::ranges::for_each(threads, [](auto &thread) { thread.join(); });
-
-  for (std::size_t i = 1, j = numthreads; j > 1; i *= 2, j /= 2) {
-    const auto multithreaded = chunks.front().size() > 48;
-    const auto jh = j / 2;
-    const auto merge = [&](std::span<double> &master, std::span<double> &slave) {
-      std::inplace_merge(master.begin(), slave.begin(), slave.end());
-      master = std::span{master.begin(), slave.end()};
-    };
-    const auto run = [&](std::size_t begin, std::size_t end) {
-      for (std::size_t k = begin; k < end; ++k) {
-        const auto idx = 2 * i * k;
-        merge(chunks[idx], chunks[idx + i]);
-      }
-    };
-    if (multithreaded) {
-      threads.resize(jh);
-      std::ranges::generate(threads, [&, i = 0]() mutable { return std::thread([&](int j) { run(j, j + 1); }, i); });
-      std::ranges::for_each(threads, [](auto &thread) { thread.join(); });
-    } else {
-      run(0, jh);
+  ppc::core::ParallelFor(0, numthreads, [&](std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; i++) {
+      RadixSort(chunks[i]);
     }
-    if (jh == 1) {
-      merge(chunks.front(), chunks.back());
-    } else if (jh % 2 != 0) {
-      merge(chunks[2 * i * (jh - 2)], chunks[2 * i * (jh - 1)]);
+  });
+
+  const std::vector<std::span<const double>> runs(chunks.begin(), chunks.end());
+  output_.resize(size);
+
+  ppc::core::ParallelFor(0, numthreads, [&](std::size_t first, std::size_t last) {
+    for (std::size_t part = first; part < last; part++) {
+      ppc::core::MultiwayMergePart<double>(runs, output_, part, numthreads);
     }
-  }
+  });
 
   return true;
 }
@@ -9,7 +9,6 @@ namespace sotskov_a_shell_sorting_with_simple_merging_stl {
 
 void ShellSortWithSimpleMerging(std::vector<int>& arr);
 void ShellSort(std::vector<int>& arr, int left, int right);
-void ParallelMerge(std::vector<int>& arr, int left, int mid, int right);
 
 class TestTaskSTL : public ppc::core::Task {
  public:
@@ -2,10 +2,10 @@
 
 #include <algorithm>
 #include <cstddef>
-#include <functional>
-#include <thread>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+#include "core/pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 void sotskov_a_shell_sorting_with_simple_merging_stl::ShellSort(std::vector<int>& arr, int left, int right) {
@@ -29,56 +29,33 @@ void sotskov_a_shell_sorting_with_simple_merging_stl::ShellSort(std::vector<int>
   }
 }
 
-void sotskov_a_shell_sorting_with_simple_merging_stl::ParallelMerge(std::vector<int>& arr, int left, int mid,
-                                                                    int right) {
-  std::vector<int> temp(right - left + 1);
-  int i = left;
-  int j = mid + 1;
-  int k = 0;
-
-  while (i <= mid && j <= right) {
-    temp[k++] = (arr[i] < arr[j]) ? arr[i++] : arr[j++];
-  }
-  while (i <= mid) {
-    temp[k++] = arr[i++];
-  }
-  while (j <= right) {
-    temp[k++] = arr[j++];
-  }
-  std::ranges::copy(temp, arr.begin() + left);
-}
-
 void sotskov_a_shell_sorting_with_simple_merging_stl::ShellSortWithSimpleMerging(std::vector<int>& arr) {
   int array_size = static_cast<int>(arr.size());
   int num_threads = ppc::util::GetPPCNumThreads();
   int chunk_size = std::max(1, (array_size + num_threads - 1) / num_threads);
 
-  std::vector<std::thread> threads;
-  threads.reserve(num_threads);
-
-  for (int i = 0; i < num_threads; ++i) {
-    int left = i * chunk_size;
-    int right = std::min(left + chunk_size - 1, array_size - 1);
-    if (left < right) {
-      threads.emplace_back(ShellSort, std::ref(arr), left, right);
-    }
+  const auto parts = static_cast<std::size_t>(num_threads);
+  std::vector<std::size_t> bounds(parts + 1);
+  for (std::size_t i = 0; i <= parts; ++i) {
+    bounds[i] = std::min<std::size_t>(i * chunk_size, array_size);
   }
 
-  std::ranges::for_each(threads, [](auto& thread) { thread.join(); });
-
-  for (int size = chunk_size; size < array_size; size *= 2) {
-    std::vector<std::thread> merge_threads;
-    for (int i = 0; i < array_size; i += 2 * size) {
-      int left = i;
-      int mid = std::min(i + size - 1, array_size - 1);
-      int right = std::min(i + (2 * size) - 1, array_size - 1);
-      if (mid < right) {
-        merge_threads.emplace_back(ParallelMerge, std::ref(arr), left, mid, right);
+  ppc::core::ParallelFor(0, parts, [&](std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; ++i) {
+      if (bounds[i] + 1 < bounds[i + 1]) {
+        ShellSort(arr, static_cast<int>(bounds[i]), static_cast<int>(bounds[i + 1]) - 1);
       }
     }
+  });
 
-    std::ranges::for_each(merge_threads, [](auto& thread) { thread.join(); });
-  }
+  const auto runs = ppc::core::MakeRuns<int>(arr, bounds);
+  std::vector<int> merged(arr.size());
+  ppc::core::ParallelFor(0, parts, [&](std::size_t first, std::size_t last) {
+    for (std::size_t part = first; part < last; ++part) {
+      ppc::core::MultiwayMergePart<int>(runs, merged, part, parts);
+    }
+  });
+  arr.swap(merged);
 }
 
 bool sotskov_a_shell_sorting_with_simple_merging_stl::TestTaskSTL::PreProcessingImpl() {
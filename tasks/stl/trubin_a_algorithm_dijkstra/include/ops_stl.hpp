@@ -9,17 +9,11 @@
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/graph.hpp"
 #include "core/task/include/task.hpp"
 
 namespace trubin_a_algorithm_dijkstra_stl {
 
-struct Edge {
-  size_t to;
-  int weight;
-
-  Edge(size_t to, int weight) : to(to), weight(weight) {}
-};
-
 class TestTaskSTL : public ppc::core::Task {
  public:
   explicit TestTaskSTL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -30,18 +24,15 @@ class TestTaskSTL : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  bool BuildAdjacencyList(const std::vector<int>& graph_data);
   void WorkerThread(
       std::priority_queue<std::pair<int, size_t>, std::vector<std::pair<int, size_t>>, std::greater<>>& pq,
       std::mutex& pq_mutex, std::condition_variable& cv, std::atomic<bool>& terminate_flag,
       std::atomic<int>& workers_running, std::vector<std::atomic<int>>& atomic_distances);
-  std::vector<std::vector<Edge>> adjacency_list_;
+  ppc::core::graph::TaskGraph graph_;
   std::vector<int> distances_;
   size_t start_vertex_ = 0;
   size_t num_vertices_ = 0;
   bool validation_passed_ = false;
-
-  static constexpr int kEndOfVertexList = -1;
 };
 
 }  // namespace trubin_a_algorithm_dijkstra_stl
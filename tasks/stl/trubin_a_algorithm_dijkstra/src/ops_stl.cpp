@@ -4,6 +4,7 @@
 #include <climits>
 #include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <functional>
 #include <limits>
@@ -20,25 +21,21 @@ bool trubin_a_algorithm_dijkstra_stl::TestTaskSTL::PreProcessingImpl() {
     return false;
   }
 
-  unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-  std::vector<int> graph_data(in_ptr, in_ptr + input_size);
-
   num_vertices_ = task_data->outputs_count[0];
 
-  if (num_vertices_ == 0 || input_size == 0) {
+  if (num_vertices_ == 0 || task_data->inputs_count[0] == 0) {
     return true;
   }
 
-  adjacency_list_.assign(num_vertices_, {});
   distances_.assign(num_vertices_, std::numeric_limits<int>::max());
 
-  if (!BuildAdjacencyList(graph_data)) {
+  if (!graph_.Load(*task_data, num_vertices_, ppc::core::graph::ParseMode::kStrict)) {
     return false;
   }
 
-  if (task_data->inputs.size() > 1 && task_data->inputs[1] != nullptr) {
-    int* ptr = reinterpret_cast<int*>(task_data->inputs[1]);
+  const size_t start_input = graph_.NextInput();
+  if (task_data->inputs.size() > start_input && task_data->inputs[start_input] != nullptr) {
+    int* ptr = reinterpret_cast<int*>(task_data->inputs[start_input]);
     if (*ptr < 0 || static_cast<size_t>(*ptr) >= num_vertices_) {
       return false;
     }
@@ -77,6 +74,7 @@ void trubin_a_algorithm_dijkstra_stl::TestTaskSTL::WorkerThread(
     std::priority_queue<std::pair<int, size_t>, std::vector<std::pair<int, size_t>>, std::greater<>>& pq,
     std::mutex& pq_mutex, std::condition_variable& cv, std::atomic<bool>& terminate_flag,
     std::atomic<int>& workers_running, std::vector<std::atomic<int>>& atomic_distances) {
+  const auto graph = graph_.View();
   while (!terminate_flag.load(std::memory_order_acquire)) {
     std::pair<int, size_t> current;
     {
@@ -105,9 +103,9 @@ void trubin_a_algorithm_dijkstra_stl::TestTaskSTL::WorkerThread(
       continue;
     }
 
-    for (const auto& edge : adjacency_list_[u]) {
-      size_t v = edge.to;
-      int weight = edge.weight;
+    for (std::uint32_t e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+      size_t v = graph.targets[e];
+      int weight = graph.weights[e];
 
       int candidate = dist_u + weight;
       int current_dist = atomic_distances[v].load(std::memory_order_relaxed);
@@ -187,29 +185,3 @@ bool trubin_a_algorithm_dijkstra_stl::TestTaskSTL::PostProcessingImpl() {
   }
   return true;
 }
-
-bool trubin_a_algorithm_dijkstra_stl::TestTaskSTL::BuildAdjacencyList(const std::vector<int>& graph_data) {
-  size_t current_vertex = 0;
-  size_t i = 0;
-  while (i < graph_data.size()) {
-    if (graph_data[i] == kEndOfVertexList) {
-      if (current_vertex >= num_vertices_) {
-        return false;
-      }
-      current_vertex++;
-      i++;
-      continue;
-    }
-    if (i + 1 >= graph_data.size()) {
-      return false;
-    }
-    auto to = static_cast<size_t>(graph_data[i]);
-    int weight = graph_data[i + 1];
-    if (to >= num_vertices_ || weight < 0) {
-      return false;
-    }
-    adjacency_list_[current_vertex].emplace_back(to, weight);
-    i += 2;
-  }
-  return true;
-}
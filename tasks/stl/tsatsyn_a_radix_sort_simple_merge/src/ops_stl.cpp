@@ -5,45 +5,15 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <future>
-#include <mutex>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+#include "core/pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 namespace {
-inline void ToSplitData(std::vector<uint64_t> &poz, std::vector<uint64_t> &neg, std::vector<double> input) {
-  std::mutex pos_mtx;
-  std::mutex neg_mtx;
-
-  size_t num_threads = ppc::util::GetPPCNumThreads();
-  size_t chunk_size = (input.size() + num_threads - 1) / num_threads;
-
-  auto split_worker = [&](size_t start, size_t end) {
-    for (size_t i = start; i < end; ++i) {
-      double num = input[i];
-      uint64_t bits = 0;
-      bits = std::bit_cast<uint64_t>(num);
-      if (num >= 0) {
-        std::lock_guard<std::mutex> lock(pos_mtx);
-        poz.push_back(bits);
-      } else {
-        std::lock_guard<std::mutex> lock(neg_mtx);
-        neg.push_back(bits);
-      }
-    }
-  };
-  std::vector<std::future<void>> split_futures;
-  for (size_t t = 0; t < num_threads; ++t) {
-    size_t start = t * chunk_size;
-    size_t end = std::min(start + chunk_size, input.size());
-    split_futures.emplace_back(std::async(std::launch::async, split_worker, start, end));
-  }
-  for (auto &f : split_futures) {
-    f.wait();
-  }
-}
 inline int CalculateBits(const std::vector<uint64_t> &data, bool is_pozitive) {
   if (data.empty()) {
     return 0;
@@ -81,6 +51,23 @@ inline void SortRadix(std::vector<uint64_t> &data, bool is_negative, int num_bit
     }
   }
 }
+
+// Radix sort of one block: values are split by sign and sorted by their bits, negative ones first
+void SortBlock(std::span<const double> block, std::span<double> out) {
+  std::vector<uint64_t> pozitive_copy;
+  std::vector<uint64_t> negative_copy;
+  for (const double num : block) {
+    (num >= 0 ? pozitive_copy : negative_copy).push_back(std::bit_cast<uint64_t>(num));
+  }
+  SortRadix(negative_copy, true, CalculateBits(negative_copy, false));
+  SortRadix(pozitive_copy, false, CalculateBits(pozitive_copy, true));
+  for (size_t i = 0; i < negative_copy.size(); ++i) {
+    out[i] = std::bit_cast<double>(negative_copy[i]);
+  }
+  for (size_t i = 0; i < pozitive_copy.size(); ++i) {
+    out[negative_copy.size() + i] = std::bit_cast<double>(pozitive_copy[i]);
+  }
+}
 }  // namespace
 bool tsatsyn_a_radix_sort_simple_merge_stl::TestTaskSTL::PreProcessingImpl() {
   // Init value for input and output
@@ -96,45 +83,25 @@ bool tsatsyn_a_radix_sort_simple_merge_stl::TestTaskSTL::ValidationImpl() {
 }
 
 bool tsatsyn_a_radix_sort_simple_merge_stl::TestTaskSTL::RunImpl() {
-  std::vector<uint64_t> pozitive_copy;
-  std::vector<uint64_t> negative_copy;
-  ToSplitData(pozitive_copy, negative_copy, input_data_);
-
-  size_t num_threads = ppc::util::GetPPCNumThreads();
-  int pozitive_bits = CalculateBits(pozitive_copy, true);
-  int negative_bits = CalculateBits(negative_copy, false);
-
-  if (num_threads >= 2) {
-    if (!negative_copy.empty()) {
-      auto future_neg = std::async(
-          std::launch::async, [&negative_copy, &negative_bits]() { SortRadix(negative_copy, true, negative_bits); });
-      future_neg.wait();
+  const size_t blocks = std::max<size_t>(1, std::min<size_t>(input_data_.size(), ppc::util::GetPPCNumThreads()));
+  std::vector<size_t> bounds(blocks + 1);
+  for (size_t i = 0; i <= blocks; ++i) {
+    bounds[i] = i * input_data_.size() / blocks;
+  }
+  std::vector<double> sorted_blocks(input_data_.size());
+  ppc::core::ParallelFor(0, blocks, [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; ++i) {
+      const size_t size = bounds[i + 1] - bounds[i];
+      SortBlock(std::span(input_data_).subspan(bounds[i], size), std::span(sorted_blocks).subspan(bounds[i], size));
     }
-    auto future_pos = std::async(
-        std::launch::async, [&pozitive_copy, &pozitive_bits]() { SortRadix(pozitive_copy, false, pozitive_bits); });
-    future_pos.wait();
+  });
 
-  } else {
-    if (!negative_copy.empty()) {
-      SortRadix(negative_copy, true, negative_bits);
-    }
-    SortRadix(pozitive_copy, false, pozitive_bits);
-  }
-  if (!negative_copy.empty()) {
-    auto future_neg = std::async(std::launch::async, [&]() {
-      for (size_t i = 0; i < negative_copy.size(); ++i) {
-        output_[i] = std::bit_cast<double>(negative_copy[i]);
-      }
-    });
-    future_neg.wait();
-  }
-  auto future_pos = std::async(std::launch::async, [&]() {
-    size_t offset = negative_copy.size();
-    for (size_t i = 0; i < pozitive_copy.size(); ++i) {
-      output_[offset + i] = std::bit_cast<double>(pozitive_copy[i]);
+  const auto runs = ppc::core::MakeRuns<double>(sorted_blocks, bounds);
+  ppc::core::ParallelFor(0, blocks, [&](size_t first, size_t last) {
+    for (size_t part = first; part < last; ++part) {
+      ppc::core::MultiwayMergePart<double>(runs, output_, part, blocks);
     }
   });
-  future_pos.wait();
   return true;
 }
 
@@ -4,42 +4,16 @@
 #include <cstddef>
 #include <cstdint>
 #include <span>
-#include <thread>
 #include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+#include "core/pool/include/thread_pool.hpp"
 #include "core/task/include/task.hpp"
 #include "core/util/include/util.hpp"
 
 namespace tyshkevich_a_hoare_simple_merge_stl {
 
-template <typename T>
-struct ArrayPiece {
-  T* first;
-  T* last;
-
-  [[nodiscard]] std::size_t Size() const noexcept { return last - first; }
-
-  operator std::span<T>() const noexcept { return std::span<T>(first, last); }
-
-  void Concat(const ArrayPiece& other) { last = other.last; }
-
-  static std::vector<ArrayPiece> Partition(std::span<T> arr, std::size_t pieces) {
-    const std::size_t delta = arr.size() / pieces;
-    const std::size_t extra = arr.size() % pieces;
-
-    std::vector<ArrayPiece> v(pieces);
-    auto* cur = arr.data();
-    for (std::size_t i = 0; i < pieces; i++) {
-      const std::size_t sz = delta + ((i < extra) ? 1 : 0);
-      v[i] = {.first = cur, .last = cur + sz};
-      cur += sz;
-    }
-
-    return v;
-  }
-};
-
 template <typename T, typename Comparator>
 class HoareSortTask : public ppc::core::Task {
  public:
@@ -54,68 +28,34 @@ class HoareSortTask : public ppc::core::Task {
   }
 
   bool RunImpl() override {
-    std::copy(input_.begin(), input_.end(), output_.begin());
-
     const std::size_t concurrency = std::min(output_.size(), std::size_t(ppc::util::GetPPCNumThreads()));
     if (concurrency == 0) {
       return true;
     }
-    std::vector<std::thread> threads(concurrency);
-
-    auto pieces = ArrayPiece<T>::Partition(output_, concurrency);
 
-    for (std::size_t i = 0; i < concurrency; i++) {
-      threads[i] = std::thread(
-          [&](std::size_t tnum) {
-            auto& piece = pieces[tnum];
-            HoareSort(piece, 0, piece.Size() - 1);
-          },
-          i);
-    }
-    for (std::size_t i = 0; i < concurrency; i++) {
-      threads[i].join();
+    std::vector<std::size_t> bounds(concurrency + 1);
+    for (std::size_t i = 0; i <= concurrency; i++) {
+      bounds[i] = i * output_.size() / concurrency;
     }
 
-    std::size_t leap = 1;
-    for (std::size_t reduc = concurrency; reduc > 1; reduc /= 2) {
-      const auto dl = 2 * leap;
-      const auto nextreduc = reduc / 2;
-
-      const auto wk = [&](std::size_t g) {
-        auto& head = pieces[dl * g];
-        auto& tail = pieces[(dl * g) + leap];
-        std::inplace_merge(head.first, tail.first, tail.last, cmp_);
-        head.Concat(tail);
-      };
-
-      if (pieces[0].Size() > kParallelizeThreshold) {
-        for (std::size_t g = 0; g < nextreduc; ++g) {
-          threads[g] = std::thread(wk, g);
-        }
-        for (std::size_t g = 0; g < nextreduc; ++g) {
-          threads[g].join();
-        }
-      } else {
-        for (std::size_t g = 0; g < nextreduc; ++g) {
-          wk(g);
-        }
-      }
-      if (nextreduc % 2 != 0) {
-        ArrayPiece<T>* head = nullptr;
-        ArrayPiece<T>* tail = nullptr;
-        if (nextreduc == 1) {
-          head = &pieces.front();
-          tail = &pieces.back();
-        } else {
-          head = &pieces[dl * (nextreduc - 2)];
-          tail = &pieces[dl * (nextreduc - 1)];
-        }
-        std::inplace_merge(head->first, tail->first, tail->last, cmp_);
-        head->Concat(*tail);
+    std::vector<T> sorted(input_.begin(), input_.end());
+    const auto sort_piece = [&](std::size_t tnum) {
+      HoareSort(std::span(sorted).subspan(bounds[tnum], bounds[tnum + 1] - bounds[tnum]), 0,
+                static_cast<std::int64_t>(bounds[tnum + 1] - bounds[tnum]) - 1);
+    };
+
+    ppc::core::ParallelFor(0, concurrency, [&](std::size_t first, std::size_t last) {
+      for (std::size_t tnum = first; tnum < last; tnum++) {
+        sort_piece(tnum);
       }
+    });
 
-      leap *= 2;
-    }
+    const auto runs = ppc::core::MakeRuns<T>(sorted, bounds);
+    ppc::core::ParallelFor(0, concurrency, [&](std::size_t first, std::size_t last) {
+      for (std::size_t part = first; part < last; part++) {
+        ppc::core::MultiwayMergePart<T>(runs, output_, part, concurrency, cmp_);
+      }
+    });
 
     return true;
   }
@@ -151,8 +91,6 @@ class HoareSortTask : public ppc::core::Task {
 
   std::span<const T> input_;
   std::span<T> output_;
-
-  static constexpr std::size_t kParallelizeThreshold = 32;
 };
 
 template <typename T, typename Comparator>
@@ -5,9 +5,11 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "../include/ops_stl.hpp"
+#include "core/integrate/include/integrate.hpp"
 #include "core/task/include/task.hpp"
 
 struct IntegrationTest {
@@ -107,3 +109,42 @@ INSTANTIATE_TEST_SUITE_P(vasilev_s_simpson_multidim_test_stl, PresetTests, ::tes
     }
 ));
 // clang-format on
+
+TEST(vasilev_s_simpson_multidim_stl, batch_integrand_matches_pointwise) {
+  std::vector<vasilev_s_simpson_multidim::Bound> bounds = {{0.0, 1.0}, {-1.0, 2.0}, {0.5, 1.5}};
+  std::size_t approxs = 24;
+  const vasilev_s_simpson_multidim::IntegrandFunction pointwise = [](const auto &coord) {
+    return (coord[0] * coord[1]) + (coord[2] * coord[2]);
+  };
+  const vasilev_s_simpson_multidim::BatchIntegrandFunction batch = [](const ppc::core::integrate::PointBlock &points,
+                                                                      std::span<double> values) {
+    const auto x = points.Axis(0);
+    const auto y = points.Axis(1);
+    const auto z = points.Axis(2);
+    for (std::size_t i = 0; i < points.count; i++) {
+      values[i] = (x[i] * y[i]) + (z[i] * z[i]);
+    }
+  };
+
+  const auto run = [&](bool with_batch) {
+    double out{};
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->inputs = {reinterpret_cast<uint8_t *>(bounds.data()), reinterpret_cast<uint8_t *>(pointwise),
+                         reinterpret_cast<uint8_t *>(&approxs)};
+    if (with_batch) {
+      task_data->inputs.push_back(reinterpret_cast<uint8_t *>(batch));
+    }
+    task_data->inputs_count.emplace_back(bounds.size());
+    task_data->outputs = {reinterpret_cast<uint8_t *>(&out)};
+    task_data->outputs_count.emplace_back(1);
+
+    vasilev_s_simpson_multidim::SimpsonTaskStl task(task_data);
+    EXPECT_TRUE(task.Validation());
+    task.PreProcessing();
+    task.Run();
+    task.PostProcessing();
+    return out;
+  };
+  const double expected = run(false);
+  EXPECT_NEAR(run(true), expected, 1e-9);
+}
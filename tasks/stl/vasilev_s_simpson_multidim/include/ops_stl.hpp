@@ -1,17 +1,19 @@
 #pragma once
 
 #include <cstddef>
-#include <future>
 #include <span>
 #include <utility>
 #include <vector>
 
+#include "core/integrate/include/integrate.hpp"
 #include "core/task/include/task.hpp"
 
 namespace vasilev_s_simpson_multidim {
 
 using Coordinate = std::span<double>;
 using IntegrandFunction = double (*)(const Coordinate&);
+// Optional fourth input: evaluates blocks of points in SoA layout, used instead of the IntegrandFunction
+using BatchIntegrandFunction = ppc::core::integrate::BatchIntegrand;
 
 struct Bound {
   double lo, hi;
@@ -27,15 +29,16 @@ class SimpsonTaskStl : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  void ComputeThreadSum(std::pair<std::size_t, std::size_t> range, std::promise<double>&& promise);
-
   IntegrandFunction func_;
+  BatchIntegrandFunction batch_func_ = nullptr;
   std::size_t arity_;
   std::size_t approxs_;
   std::vector<Bound> bounds_;
 
   std::size_t gridcap_;
   std::vector<double> steps_;
+  // Simpson nodes and weights of every axis
+  std::vector<ppc::core::integrate::GridAxis> axes_;
   double scale_;
 
   double result_;
@@ -3,19 +3,29 @@
 
 #include <cmath>
 #include <cstddef>
-#include <random>
-#include <thread>
+#include <functional>
 #include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/pool/include/thread_pool.hpp"
+#include "core/random/include/philox.hpp"
 
 namespace {
 
-thread_local std::mt19937 gen(std::random_device{}());
-
-double CreateRandomVal(double min_v, double max_v) {
-  std::uniform_real_distribution<double> dis(min_v, max_v);
-  return dis(gen);
+// Number of samples [first, last) of the sequence fixed by the default seed at which func holds;
+// sample i takes the uniforms [i * bounds.size(), (i + 1) * bounds.size()) of the sequence
+size_t CountHits(bool (*func)(std::vector<double>, size_t),
+                 const std::vector<vladimirova_j_m_monte_karlo_stl::BoundariesIntegral> &bounds, size_t first,
+                 size_t last) {
+  auto gen = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, bounds.size());
+  std::vector<double> random_val(bounds.size());
+  size_t hits = 0;
+  for (size_t i = first; i < last; i++) {
+    for (size_t j = 0; j < bounds.size(); j++) {
+      random_val[j] = gen.Uniform(bounds[j].min, bounds[j].max);
+    }
+    hits += static_cast<size_t>(func(random_val, bounds.size()));
+  }
+  return hits;
 }
 
 }  // namespace
@@ -55,40 +65,11 @@ bool vladimirova_j_m_monte_karlo_stl::TestTaskStl::ValidationImpl() {
 }
 
 bool vladimirova_j_m_monte_karlo_stl::TestTaskStl::RunImpl() {
-  size_t successful_point = 0;
-
-  size_t count_t = ppc::util::GetPPCNumThreads();
-  if (count_t == 0) {
-    return false;
-  }
-  std::vector<std::thread> threads(count_t);
-  std::vector<size_t> local_res(count_t, 0);
-
-  size_t dl = accuracy_ / count_t;
+  // every chunk jumps to its own samples of one sequence
+  size_t successful_point = ppc::core::ParallelReduce<size_t>(
+      0, accuracy_, 0, [&](size_t begin, size_t end) { return CountHits(func_, var_integr_, begin, end); },
+      std::plus<>(), 1024);
 
-  for (size_t i = 1; i < count_t; i++) {
-    local_res[i] = dl;
-  }
-  local_res[0] = dl + (accuracy_ % count_t);
-
-  for (size_t t = 0; t < count_t; t++) {
-    threads[t] = std::thread([&, t]() {
-      std::vector<double> random_val = std::vector<double>(var_size_);
-      size_t n = local_res[t];
-      local_res[t] = 0;
-      for (size_t i = 0; i < n; i++) {
-        for (size_t j = 0; j < var_size_; j++) {
-          random_val[j] = CreateRandomVal(var_integr_[j].min, var_integr_[j].max);
-        }
-        local_res[t] += (int)(func_(random_val, var_size_));
-      }
-    });
-  }
-
-  for (size_t i = 0; i < count_t; i++) {
-    threads[i].join();
-    successful_point += local_res[i];
-  }
   double s = 1;
   for (size_t i = 0; i < var_size_; i++) {
     s *= (var_integr_[i].max - var_integr_[i].min);
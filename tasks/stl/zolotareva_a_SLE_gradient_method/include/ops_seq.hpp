@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
 #include "core/task/include/task.hpp"
 
 namespace zolotareva_a_sle_gradient_method_stl {
@@ -16,6 +17,9 @@ class TestTaskSTL : public ppc::core::Task {
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
+  // Options other than the defaults (see IsPlainCg) solve a dense A with the sparse solver too
+  void SetSolverOptions(const ppc::core::solver::CgOptions& options) { solver_options_ = options; }
+
   inline static void ConjugateGradient(const std::vector<double>& a, const std::vector<double>& b,
                                        std::vector<double>& x, int n);
   inline static double DotProduct(const std::vector<double>& vec1, const std::vector<double>& vec2, int n);
@@ -30,6 +34,10 @@ class TestTaskSTL : public ppc::core::Task {
   std::vector<double> b_;
   std::vector<double> x_;
   int n_{0};
+  // CSR inputs (row_ptr, col_idx, values, b) or solver options other than plain CG
+  bool sparse_ = false;
+  ppc::core::solver::TaskMatrix matrix_;
+  ppc::core::solver::CgOptions solver_options_;
 };
 
 }  // namespace zolotareva_a_sle_gradient_method_stl
\ No newline at end of file
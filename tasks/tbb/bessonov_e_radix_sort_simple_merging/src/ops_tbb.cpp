@@ -11,9 +11,11 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
 #include "core/task/include/task.hpp"
 
 namespace bessonov_e_radix_sort_simple_merging_tbb {
@@ -112,7 +114,7 @@ bool TestTaskTbb::RunImpl() {
     return true;
   }
 
-  const size_t num_chunks = tbb::this_task_arena::max_concurrency();
+  const size_t num_chunks = std::min(n, static_cast<size_t>(tbb::this_task_arena::max_concurrency()));
   const size_t chunk_size = (n + num_chunks - 1) / num_chunks;
 
   std::vector<std::vector<uint64_t>> chunks(num_chunks);
@@ -131,26 +133,12 @@ bool TestTaskTbb::RunImpl() {
     chunks[chunk_idx] = std::move(sortable);
   });
 
-  while (chunks.size() > 1) {
-    size_t new_size = (chunks.size() + 1) / 2;
-    std::vector<std::vector<uint64_t>> new_chunks(new_size);
-
-    tbb::parallel_for(size_t(0), new_size, [&](size_t i) {
-      size_t left_idx = i * 2;
-      size_t right_idx = left_idx + 1;
-      if (right_idx < chunks.size()) {
-        new_chunks[i].resize(chunks[left_idx].size() + chunks[right_idx].size());
-        std::merge(chunks[left_idx].begin(), chunks[left_idx].end(), chunks[right_idx].begin(), chunks[right_idx].end(),
-                   new_chunks[i].begin());
-      } else {
-        new_chunks[i] = std::move(chunks[left_idx]);
-      }
-    });
-
-    chunks = std::move(new_chunks);
-  }
+  const std::vector<std::span<const uint64_t>> runs(chunks.begin(), chunks.end());
+  std::vector<uint64_t> merged(n);
+  tbb::parallel_for(size_t(0), num_chunks,
+                    [&](size_t part) { ppc::core::MultiwayMergePart<uint64_t>(runs, merged, part, num_chunks); });
 
-  ConvertToDoubles(chunks[0], output_);
+  ConvertToDoubles(merged, output_);
 
   return true;
 }
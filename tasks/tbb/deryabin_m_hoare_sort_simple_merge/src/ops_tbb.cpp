@@ -8,7 +8,9 @@
 #include <numbers>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
 #include "oneapi/tbb/parallel_for.h"
+#include "oneapi/tbb/task_arena.h"
 
 void deryabin_m_hoare_sort_simple_merge_tbb::HoaraSort(std::vector<double>& a, size_t first, size_t last) {
   if (first >= last) {
@@ -117,15 +119,23 @@ bool deryabin_m_hoare_sort_simple_merge_tbb::HoareSortTaskTBB::ValidationImpl()
 }
 
 bool deryabin_m_hoare_sort_simple_merge_tbb::HoareSortTaskTBB::RunImpl() {
-  oneapi::tbb::parallel_for(0, (int)chunk_count_, 1, [=, this](int count) {
-    HoaraSort(input_array_A_, count * min_chunk_size_, ((count + 1) * min_chunk_size_) - 1);
-  });
-  for (size_t i = 0; i < (size_t)(log((double)chunk_count_) / std::numbers::ln2); i++) {
-    oneapi::tbb::parallel_for(0, (int)chunk_count_ >> (i + 1), 1, [=, this](int j) {
-      MergeTwoParts(input_array_A_, (size_t)j * min_chunk_size_ << (i + 1),
-                    (((size_t)j + 1) * min_chunk_size_ << (i + 1)) - 1, dimension_);
-    });
+  std::vector<size_t> bounds(chunk_count_ + 1);
+  for (size_t count = 0; count <= chunk_count_; count++) {
+    bounds[count] = count * dimension_ / chunk_count_;
   }
+  oneapi::tbb::parallel_for(size_t{0}, chunk_count_, [&](size_t count) {
+    if (bounds[count] < bounds[count + 1]) {
+      HoaraSort(input_array_A_, bounds[count], bounds[count + 1] - 1);
+    }
+  });
+
+  const auto runs = ppc::core::MakeRuns<double>(input_array_A_, bounds);
+  std::vector<double> merged(dimension_);
+  const auto parts = std::min(dimension_, static_cast<size_t>(oneapi::tbb::this_task_arena::max_concurrency()));
+  oneapi::tbb::parallel_for(size_t{0}, parts, [&](size_t part) {
+    ppc::core::MultiwayMergePart<double>(runs, merged, part, parts);
+  });
+  input_array_A_.swap(merged);
   return true;
 }
 
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <cmath>
 #include <compare>
 #include <cstddef>
 #include <utility>
@@ -11,7 +10,6 @@
 namespace ermolaev_v_graham_scan_tbb {
 
 constexpr size_t kMinInputPoints = 3;
-constexpr size_t kMinStackPoints = 2;
 
 class Point {
  public:
@@ -40,13 +38,6 @@ class TestTaskTBB : public ppc::core::Task {
 
  private:
   std::vector<Point> input_, output_;
-
-  static int CrossProduct(const Point& p1, const Point& p2, const Point& p3);
-  size_t IndexOfMinElement();
-  bool CheckGrahamNecessaryConditions();
-  void GrahamScan();
-  bool IsAllCollinear();
-  bool IsAllSame();
 };
 
 }  // namespace ermolaev_v_graham_scan_tbb
@@ -3,6 +3,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
 #include "core/task/include/task.hpp"
 
 namespace fomin_v_conjugate_gradient {
@@ -15,6 +16,9 @@ class FominVConjugateGradientTbb : public ppc::core::Task {
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
+  // Options other than the defaults (see IsPlainCg) solve a dense A with the sparse solver too
+  void SetSolverOptions(const ppc::core::solver::CgOptions& options) { solver_options_ = options; }
+
   static double DotProduct(const std::vector<double>& a, const std::vector<double>& b);
   [[nodiscard]] std::vector<double> MatrixVectorMultiply(const std::vector<double>& a,
                                                          const std::vector<double>& x) const;
@@ -28,6 +32,10 @@ class FominVConjugateGradientTbb : public ppc::core::Task {
   std::vector<double> a_;
   std::vector<double> b_;
   std::vector<double> output_;
+  // CSR inputs (row_ptr, col_idx, values, b) or solver options other than plain CG
+  bool sparse_ = false;
+  ppc::core::solver::TaskMatrix matrix_;
+  ppc::core::solver::CgOptions solver_options_;
 };
 
 }  // namespace fomin_v_conjugate_gradient
\ No newline at end of file
@@ -7,8 +7,12 @@
 #include <cmath>
 #include <cstddef>
 #include <functional>
+#include <span>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
+#include "core/sparse/include/sparse_tbb.hpp"
+
 double fomin_v_conjugate_gradient::FominVConjugateGradientTbb::DotProduct(const std::vector<double>& a,
                                                                           const std::vector<double>& b) {
   return tbb::parallel_reduce(
@@ -71,6 +75,13 @@ std::vector<double> fomin_v_conjugate_gradient::FominVConjugateGradientTbb::Vect
 }
 
 bool fomin_v_conjugate_gradient::FominVConjugateGradientTbb::PreProcessingImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    sparse_ = true;
+    n = static_cast<int>(matrix_.View().rows);
+    b_.assign(matrix_.Rhs().begin(), matrix_.Rhs().end());
+    output_.resize(n, 0.0);
+    return true;
+  }
   unsigned int input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
   std::vector<double> input(in_ptr, in_ptr + input_size);
@@ -80,10 +91,17 @@ bool fomin_v_conjugate_gradient::FominVConjugateGradientTbb::PreProcessingImpl()
   b_ = std::vector<double>(input.begin() + (n * n), input.end());
   output_.resize(n, 0.0);
 
+  sparse_ = !ppc::core::solver::IsPlainCg(solver_options_);
+  if (sparse_) {
+    matrix_.LoadDense(a_, n);
+  }
   return true;
 }
 
 bool fomin_v_conjugate_gradient::FominVConjugateGradientTbb::ValidationImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    return matrix_.LoadCsrSystem(*task_data);
+  }
   unsigned int input_size = task_data->inputs_count[0];
   const int calculated_n = static_cast<int>((-1.0 + std::sqrt(1 + (4 * input_size))) / 2);
   return (static_cast<unsigned int>(calculated_n * (calculated_n + 1)) == input_size) &&
@@ -91,6 +109,12 @@ bool fomin_v_conjugate_gradient::FominVConjugateGradientTbb::ValidationImpl() {
 }
 
 bool fomin_v_conjugate_gradient::FominVConjugateGradientTbb::RunImpl() {
+  if (sparse_) {
+    output_.assign(n, 0.0);
+    const auto result =
+        ppc::core::solver::SolveCg(matrix_.View(), b_, output_, solver_options_, ppc::core::sparse::TbbBackend{});
+    return result.converged;
+  }
   const double epsilon = 1e-6;
   const int max_iter = 1000;
   std::vector<double> x(n, 0.0);
@@ -2,7 +2,9 @@
 
 #include <tbb/tbb.h>
 
+#include <algorithm>
 #include <cmath>
+#include <core/gemm/include/gemm.hpp>
 #include <core/util/include/util.hpp>
 #include <cstddef>
 #include <utility>
@@ -12,6 +14,11 @@
 #include "oneapi/tbb/task_arena.h"
 #include "oneapi/tbb/task_group.h"
 
+namespace {
+// Rows of a leaf product computed by one GEMM call
+constexpr size_t kLeafRowsPerThread = 32;
+}  // namespace
+
 bool gnitienko_k_strassen_algorithm_tbb::StrassenAlgTBB::PreProcessingImpl() {
   size_t input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
@@ -70,14 +77,10 @@ void gnitienko_k_strassen_algorithm_tbb::StrassenAlgTBB::SubMatrix(const std::ve
 void gnitienko_k_strassen_algorithm_tbb::StrassenAlgTBB::TrivialMultiply(const std::vector<double>& a,
                                                                          const std::vector<double>& b,
                                                                          std::vector<double>& c, int size) {
-  tbb::parallel_for(0, size, [&](int i) {
-    for (int j = 0; j < size; ++j) {
-      double sum = 0.0;
-      for (int k = 0; k < size; ++k) {
-        sum += a[(i * size) + k] * b[(k * size) + j];
-      }
-      c[(i * size) + j] = sum;
-    }
+  const auto n = static_cast<size_t>(size);
+  std::fill_n(c.begin(), n * n, 0.0);
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, n, kLeafRowsPerThread), [&](const tbb::blocked_range<size_t>& r) {
+    ppc::core::Gemm(r.size(), n, n, &a[r.begin() * n], n, b.data(), n, &c[r.begin() * n], n);
   });
 }
 
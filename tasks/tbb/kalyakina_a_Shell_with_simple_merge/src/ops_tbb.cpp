@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
 #include "oneapi/tbb/parallel_for.h"
 #include "oneapi/tbb/task_arena.h"
 
@@ -43,28 +44,6 @@ void kalyakina_a_shell_with_simple_merge_tbb::ShellSortTBB::ShellSort(unsigned i
   }
 }
 
-void kalyakina_a_shell_with_simple_merge_tbb::ShellSortTBB::SimpleMergeSort(unsigned int left, unsigned int middle,
-                                                                            unsigned int right) {
-  std::vector<int> first_part(middle - left);
-  std::copy(output_.begin() + left, output_.begin() + middle, first_part.begin());
-  unsigned int l = 0;
-  unsigned int r = middle;
-  unsigned int j = left;
-  for (; (l < first_part.size()) && (r < right); j++) {
-    if (first_part[l] < output_[r]) {
-      output_[j] = first_part[l++];
-    } else {
-      output_[j] = output_[r++];
-    }
-  }
-  while (l < first_part.size()) {
-    output_[j++] = first_part[l++];
-  }
-  while (r < right) {
-    output_[j++] = output_[r++];
-  }
-}
-
 bool kalyakina_a_shell_with_simple_merge_tbb::ShellSortTBB::PreProcessingImpl() {
   // Init value for input and output
   input_ = std::vector<int>(task_data->inputs_count[0]);
@@ -106,25 +85,22 @@ bool kalyakina_a_shell_with_simple_merge_tbb::ShellSortTBB::RunImpl() {
                                 }
                               });
   });
-  num = std::ceil(static_cast<double>(num) / 2);
-  unsigned int step = 1;
-  while (step < bounds.size()) {
-    step *= 2;
-    arena.execute([&] {
-      oneapi::tbb::parallel_for(
-          oneapi::tbb::blocked_range<unsigned int>(0, num), [&](oneapi::tbb::blocked_range<unsigned int> &r) {
-            for (unsigned int i = r.begin(); i != r.end(); i++) {
-              unsigned int middle = (step / 2) + (step * i);
-              if (middle < bounds.size()) {
-                SimpleMergeSort(
-                    bounds[i * step].first, bounds[middle].first,
-                    bounds[(bounds.size() - 1 < (i + 1) * step - 1) ? bounds.size() - 1 : ((i + 1) * step) - 1].second);
-              }
-            }
-          });
-    });
-    num = std::ceil(static_cast<double>(num) / 2);
+  std::vector<size_t> run_bounds;
+  for (const auto &bound : bounds) {
+    run_bounds.push_back(bound.first);
   }
+  run_bounds.push_back(output_.size());
+  const auto runs = ppc::core::MakeRuns<int>(output_, run_bounds);
+  std::vector<int> merged(output_.size());
+  arena.execute([&] {
+    oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<unsigned int>(0, num),
+                              [&](const oneapi::tbb::blocked_range<unsigned int> &r) {
+                                for (unsigned int i = r.begin(); i != r.end(); i++) {
+                                  ppc::core::MultiwayMergePart<int>(runs, merged, i, num);
+                                }
+                              });
+  });
+  output_.swap(merged);
   return true;
 }
 
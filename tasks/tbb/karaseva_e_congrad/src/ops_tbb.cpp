@@ -6,11 +6,22 @@
 #include <cmath>
 #include <cstddef>
 #include <functional>
+#include <span>
 #include <vector>
 
+#include "core/solver/include/cg.hpp"
+#include "core/sparse/include/sparse_tbb.hpp"
+
 namespace karaseva_e_congrad_tbb {
 
 bool TestTaskTBB::PreProcessingImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    sparse_ = true;
+    size_ = matrix_.View().rows;
+    b_.assign(matrix_.Rhs().begin(), matrix_.Rhs().end());
+    x_ = std::vector<double>(size_, 0.0);
+    return true;
+  }
   // Initialize problem size from input data
   size_ = task_data->inputs_count[1];
 
@@ -25,10 +36,17 @@ bool TestTaskTBB::PreProcessingImpl() {
   // Initial guess x0 = 0
   x_ = std::vector<double>(size_, 0.0);
 
+  sparse_ = !ppc::core::solver::IsPlainCg(solver_options_);
+  if (sparse_) {
+    matrix_.LoadDense(A_, size_);
+  }
   return true;
 }
 
 bool TestTaskTBB::ValidationImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data)) {
+    return matrix_.LoadCsrSystem(*task_data);
+  }
   const bool valid_input = task_data->inputs_count[0] == task_data->inputs_count[1] * task_data->inputs_count[1];
   const bool valid_output = task_data->outputs_count[0] == task_data->inputs_count[1];
   return valid_input && valid_output;
@@ -83,6 +101,11 @@ void UpdateSearchDirection(std::vector<double>& p, const std::vector<double>& r,
 }  // namespace
 
 bool TestTaskTBB::RunImpl() {
+  if (sparse_) {
+    const auto result =
+        ppc::core::solver::SolveCg(matrix_.View(), b_, x_, solver_options_, ppc::core::sparse::TbbBackend{});
+    return result.converged;
+  }
   std::vector<double> r(size_);
   std::vector<double> p(size_);
   std::vector<double> ap(size_);
@@ -1,8 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <random>
 #include <vector>
 
 #include "core/task/include/task.hpp"
@@ -160,3 +162,30 @@ TEST(khovansky_d_double_radix_batcher_tbb, large_array) {
   test_task_tbb.PostProcessingImpl();
   EXPECT_EQ(exp_out, out);
 }
+
+TEST(khovansky_d_double_radix_batcher_tbb, random_large_array) {
+  constexpr size_t kSize = 300000;
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+  std::vector<double> in(kSize);
+  for (size_t i = 0; i < kSize; ++i) {
+    // every third value is repeated
+    in[i] = (i % 3 == 0) ? static_cast<double>(i % 100) : dist(gen);
+  }
+  std::vector<double> exp_out = in;
+  std::ranges::sort(exp_out);
+
+  std::vector<double> out(kSize);
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_tbb->inputs_count.emplace_back(in.size());
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_tbb->outputs_count.emplace_back(out.size());
+
+  khovansky_d_double_radix_batcher_tbb::RadixTBB test_task_tbb(task_data_tbb);
+  ASSERT_EQ(test_task_tbb.ValidationImpl(), true);
+  test_task_tbb.PreProcessingImpl();
+  test_task_tbb.RunImpl();
+  test_task_tbb.PostProcessingImpl();
+  EXPECT_EQ(exp_out, out);
+}
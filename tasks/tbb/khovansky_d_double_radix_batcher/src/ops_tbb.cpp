@@ -1,13 +1,12 @@
 #include "tbb/khovansky_d_double_radix_batcher/include/ops_tbb.hpp"
 
 #include <oneapi/tbb/blocked_range.h>
-#include <oneapi/tbb/combinable.h>
 #include <oneapi/tbb/parallel_for.h>
-#include <oneapi/tbb/parallel_invoke.h>
+#include <oneapi/tbb/task_arena.h>
 #include <tbb/tbb.h>
 
 #include <algorithm>
-#include <cmath>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -37,76 +36,111 @@ double DecodeUint64ToDouble(uint64_t encoded) {
   return result;
 }
 
-void RadixSort(std::vector<uint64_t>& array) {
-  const int bits_in_byte = 8;
-  const int total_bits = 64;
-  const int bucket_count = 256;
-
-  std::vector<uint64_t> buffer(array.size(), 0);
-  std::vector<int> frequency(bucket_count, 0);
+constexpr int kDigitBits = 8;
+constexpr int kPassesCount = 64 / kDigitBits;
+constexpr size_t kBucketsCount = size_t(1) << kDigitBits;
+// Write-combining buffer holds one cache line of every bucket
+constexpr size_t kCombiningSize = 64 / sizeof(uint64_t);
+constexpr size_t kMinBlockSize = size_t(1) << 14;
 
-  for (int shift = 0; shift < total_bits; shift += bits_in_byte) {
-    tbb::combinable<std::vector<int>> local_freq([&]() { return std::vector<int>(bucket_count, 0); });
-
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, array.size()), [&](const tbb::blocked_range<size_t>& range) {
-      auto& local = local_freq.local();
-      for (size_t i = range.begin(); i < range.end(); ++i) {
-        auto bucket = static_cast<uint8_t>((array[i] >> shift) & 0xFF);
-        local[bucket]++;
-      }
-    });
+using Histogram = std::array<size_t, kBucketsCount>;
 
-    std::ranges::fill(frequency, 0);
-    local_freq.combine_each([&](const std::vector<int>& local) {
-      for (int i = 0; i < bucket_count; ++i) {
-        frequency[i] += local[i];
-      }
-    });
+size_t Digit(uint64_t value, int pass) { return (value >> (pass * kDigitBits)) & (kBucketsCount - 1); }
 
-    for (int i = 1; i < bucket_count; ++i) {
-      frequency[i] += frequency[i - 1];
-    }
-
-    for (int i = static_cast<int>(array.size()) - 1; i >= 0; i--) {
-      auto bucket = static_cast<uint8_t>((array[i] >> shift) & 0xFF);
-      buffer[--frequency[bucket]] = array[i];
-    }
-
-    array.swap(buffer);
+Histogram BlockHistogram(const uint64_t* block, size_t size, int pass) {
+  Histogram histogram{};
+  for (size_t i = 0; i < size; ++i) {
+    histogram[Digit(block[i], pass)]++;
   }
+  return histogram;
 }
 
-void BatcherOddEvenMerge(std::vector<uint64_t>& array, int left, int right, int max_depth, int depth = 0) {
-  if (right - left <= 1) {
-    return;
+// Stable scatter of block into dst starting from per-bucket offsets. Elements are staged in per-bucket
+// cache-line buffers, so 256 output streams are written by full lines instead of single elements.
+void ScatterBlock(const uint64_t* block, size_t size, int pass, Histogram offsets, uint64_t* dst) {
+  alignas(64) std::array<std::array<uint64_t, kCombiningSize>, kBucketsCount> combining;
+  std::array<uint8_t, kBucketsCount> filled{};
+  for (size_t i = 0; i < size; ++i) {
+    const size_t digit = Digit(block[i], pass);
+    combining[digit][filled[digit]++] = block[i];
+    if (filled[digit] == kCombiningSize) {
+      std::memcpy(dst + offsets[digit], combining[digit].data(), sizeof(combining[digit]));
+      offsets[digit] += kCombiningSize;
+      filled[digit] = 0;
+    }
+  }
+  for (size_t digit = 0; digit < kBucketsCount; ++digit) {
+    std::memcpy(dst + offsets[digit], combining[digit].data(), filled[digit] * sizeof(uint64_t));
   }
+}
 
-  int mid = left + ((right - left) / 2);
+// LSD radix sort over fixed blocks: every pass counts digits per block, turns the counts into per-block
+// prefix offsets (bucket-major, block-minor, which keeps the sort stable) and scatters all blocks in parallel
+void RadixSort(std::vector<uint64_t>& array) {
+  const size_t size = array.size();
+  const size_t max_blocks = 4 * static_cast<size_t>(tbb::this_task_arena::max_concurrency());
+  const size_t blocks_count = std::clamp<size_t>(size / kMinBlockSize, 1, max_blocks);
+  auto block_begin = [&](size_t block) { return size * block / blocks_count; };
+
+  // Digit counts do not depend on the order of elements, so the counts of the input find constant-digit passes
+  std::vector<std::array<Histogram, kPassesCount>> input_histograms(blocks_count);
+  tbb::parallel_for(size_t(0), blocks_count, [&](size_t block) {
+    for (int pass = 0; pass < kPassesCount; ++pass) {
+      input_histograms[block][pass] =
+          BlockHistogram(array.data() + block_begin(block), block_begin(block + 1) - block_begin(block), pass);
+    }
+  });
+
+  std::vector<uint64_t> buffer(size);
+  std::vector<Histogram> offsets(blocks_count);
+  bool is_initial_order = true;
+  for (int pass = 0; pass < kPassesCount; ++pass) {
+    Histogram total{};
+    for (const auto& histograms : input_histograms) {
+      for (size_t digit = 0; digit < kBucketsCount; ++digit) {
+        total[digit] += histograms[pass][digit];
+      }
+    }
+    if (std::ranges::find(total, size) != total.end()) {
+      continue;
+    }
 
-  if (depth < max_depth) {
-    tbb::parallel_invoke([&] { BatcherOddEvenMerge(array, left, mid, depth + 1); },
-                         [&] { BatcherOddEvenMerge(array, mid, right, depth + 1); });
-  } else {
-    BatcherOddEvenMerge(array, left, mid, depth + 1);
-    BatcherOddEvenMerge(array, mid, right, depth + 1);
-  }
+    if (is_initial_order) {
+      for (size_t block = 0; block < blocks_count; ++block) {
+        offsets[block] = input_histograms[block][pass];
+      }
+    } else {
+      tbb::parallel_for(size_t(0), blocks_count, [&](size_t block) {
+        offsets[block] =
+            BlockHistogram(array.data() + block_begin(block), block_begin(block + 1) - block_begin(block), pass);
+      });
+    }
 
-  for (int i = left; i + 1 < right; i += 2) {
-    if (array[i] > array[i + 1]) {
-      std::swap(array[i], array[i + 1]);
+    size_t offset = 0;
+    for (size_t digit = 0; digit < kBucketsCount; ++digit) {
+      for (size_t block = 0; block < blocks_count; ++block) {
+        const size_t count = offsets[block][digit];
+        offsets[block][digit] = offset;
+        offset += count;
+      }
     }
+
+    tbb::parallel_for(size_t(0), blocks_count, [&](size_t block) {
+      ScatterBlock(array.data() + block_begin(block), block_begin(block + 1) - block_begin(block), pass,
+                   offsets[block], buffer.data());
+    });
+    array.swap(buffer);
+    is_initial_order = false;
   }
 }
 
 void RadixBatcherSort(std::vector<double>& data) {
   std::vector<uint64_t> transformed_data(data.size(), 0);
 
-  int max_parallel_depth = int(std::log2(data.size()) + 1);
-
   tbb::parallel_for(size_t(0), data.size(), [&](size_t i) { transformed_data[i] = EncodeDoubleToUint64(data[i]); });
 
+  // Radix passes leave the data fully sorted, so no merge stage is needed
   RadixSort(transformed_data);
-  BatcherOddEvenMerge(transformed_data, 0, static_cast<int>(transformed_data.size()), max_parallel_depth);
 
   tbb::parallel_for(size_t(0), data.size(), [&](size_t i) { data[i] = DecodeUint64ToDouble(transformed_data[i]); });
 }
@@ -1,8 +1,5 @@
 #include "tbb/kolodkin_g_multiplication_matrix_CRS/include/ops_tbb.hpp"
 
-#include <oneapi/tbb/parallel_for.h>
-#include <tbb/tbb.h>
-
 #include <cmath>
 #include <complex>
 #include <cstddef>
@@ -10,6 +7,8 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse_tbb.hpp"
+
 void kolodkin_g_multiplication_matrix_tbb::SparseMatrixCRS::AddValue(int row, Complex value, int col) {
   bool found = false;
   for (int j = rowPtr[row]; j < rowPtr[row + 1]; j++) {
@@ -142,33 +141,18 @@ bool kolodkin_g_multiplication_matrix_tbb::TestTaskTBB::ValidationImpl() {
 }
 
 bool kolodkin_g_multiplication_matrix_tbb::TestTaskTBB::RunImpl() {
-  SparseMatrixCRS c(A_.numRows, B_.numCols);
-
-  std::vector<std::vector<std::pair<int, Complex>>> local_results(A_.numRows);
-
-  tbb::parallel_for(tbb::blocked_range<unsigned int>(0, A_.numRows), [&](const tbb::blocked_range<unsigned int>& r) {
-    for (unsigned int i = r.begin(); i < r.end(); ++i) {
-      for (unsigned int j = A_.rowPtr[i]; j < (unsigned int)A_.rowPtr[i + 1]; ++j) {
-        unsigned int col_a = A_.colIndices[j];
-        Complex value_a = A_.values[j];
-
-        for (unsigned int k = B_.rowPtr[col_a]; k < (unsigned int)B_.rowPtr[col_a + 1]; ++k) {
-          unsigned int col_b = B_.colIndices[k];
-          Complex value_b = B_.values[k];
-          local_results[i].emplace_back(col_b, value_a * value_b);
-        }
-      }
-    }
-  });
-
-  for (size_t row_index = 0; row_index < local_results.size(); ++row_index) {
-    for (const auto& [col_index, value] : local_results[row_index]) {
-      c.AddValue(static_cast<int>(row_index), value, col_index);
-    }
-  }
+  using View = ppc::core::sparse::CsrView<Complex, int>;
+  const auto view = [](const SparseMatrixCRS& m) {
+    return View{.rows = static_cast<size_t>(m.numRows), .cols = static_cast<size_t>(m.numCols), .row_ptr = m.rowPtr,
+                .col_idx = m.colIndices, .values = m.values};
+  };
+  auto product = ppc::core::sparse::SpGemm(view(A_), view(B_), ppc::core::sparse::TbbBackend{});
 
+  SparseMatrixCRS c(A_.numRows, B_.numCols);
+  c.rowPtr = std::move(product.row_ptr);
+  c.colIndices = std::move(product.col_idx);
+  c.values = std::move(product.values);
   output_ = ParseMatrixIntoVec(c);
-
   return true;
 }
 
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
@@ -485,4 +486,61 @@ TEST(korotin_e_crs_multiplication_tbb, test_rnd_16_32_64) {
   ASSERT_EQ(c_ri, out_ri);
   ASSERT_EQ(c_col, out_col);
   ASSERT_EQ(c_val, out_val);
-}
\ No newline at end of file
+}
+TEST(korotin_e_crs_multiplication_tbb, test_large_sparse_tridiagonal_by_diagonal) {
+  const unsigned int n = 20000;
+  std::vector<unsigned int> a_ri(n + 1, 0);
+  std::vector<unsigned int> a_col;
+  std::vector<double> a_val;
+  for (unsigned int i = 0; i < n; i++) {
+    for (unsigned int j = (i == 0 ? 0 : i - 1); j <= std::min(i + 1, n - 1); j++) {
+      a_col.push_back(j);
+      a_val.push_back(static_cast<double>(i + j + 1));
+    }
+    a_ri[i + 1] = a_col.size();
+  }
+  std::vector<unsigned int> b_ri(n + 1, 0);
+  std::vector<unsigned int> b_col(n);
+  std::vector<double> b_val(n, 2.0);
+  for (unsigned int i = 0; i < n; i++) {
+    b_col[i] = i;
+    b_ri[i + 1] = i + 1;
+  }
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(a_ri.data()));
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(a_col.data()));
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(a_val.data()));
+  task_data_tbb->inputs_count.emplace_back(a_ri.size());
+  task_data_tbb->inputs_count.emplace_back(a_col.size());
+  task_data_tbb->inputs_count.emplace_back(a_val.size());
+
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(b_ri.data()));
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(b_col.data()));
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(b_val.data()));
+  task_data_tbb->inputs_count.emplace_back(b_ri.size());
+  task_data_tbb->inputs_count.emplace_back(b_col.size());
+  task_data_tbb->inputs_count.emplace_back(b_val.size());
+
+  std::vector<unsigned int> out_ri(a_ri.size(), 0);
+  std::vector<unsigned int> out_col(a_col.size());
+  std::vector<double> out_val(a_val.size());
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out_ri.data()));
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out_col.data()));
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out_val.data()));
+  task_data_tbb->outputs_count.emplace_back(out_ri.size());
+
+  korotin_e_crs_multiplication_tbb::CrsMultiplicationTBB test_task_tbb(task_data_tbb);
+  ASSERT_EQ(test_task_tbb.Validation(), true);
+  test_task_tbb.PreProcessing();
+  test_task_tbb.Run();
+  test_task_tbb.PostProcessing();
+
+  // A * 2I has the pattern of A and doubled values
+  for (double &val : a_val) {
+    val *= 2.0;
+  }
+  ASSERT_EQ(a_ri, out_ri);
+  ASSERT_EQ(a_col, out_col);
+  ASSERT_EQ(a_val, out_val);
+}
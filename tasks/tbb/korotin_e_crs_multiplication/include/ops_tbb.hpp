@@ -17,13 +17,10 @@ class CrsMultiplicationTBB : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  void MulTask(size_t l, size_t r, std::vector<double> &local_val, std::vector<unsigned int> &local_col,
-               std::vector<unsigned int> &temp_r_i, const std::vector<unsigned int> &tr_i,
-               const std::vector<unsigned int> &tcol, const std::vector<double> &tval);
-
   std::vector<double> A_val_, B_val_, output_val_;
   std::vector<unsigned int> A_col_, A_rI_, B_col_, B_rI_, output_col_, output_rI_;
   unsigned int A_N_, A_Nz_, B_N_, B_Nz_;
+  size_t B_cols_ = 0;
 };
 
 std::vector<double> GetRandomMatrix(unsigned int m, unsigned int n);
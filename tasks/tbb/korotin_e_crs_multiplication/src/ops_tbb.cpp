@@ -1,13 +1,11 @@
 #include "tbb/korotin_e_crs_multiplication/include/ops_tbb.hpp"
 
-#include <tbb/tbb.h>
-
 #include <algorithm>
-#include <cmath>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
-#include "oneapi/tbb/task_group.h"
+#include "core/sparse/include/sparse_tbb.hpp"
 
 bool korotin_e_crs_multiplication_tbb::CrsMultiplicationTBB::PreProcessingImpl() {
   A_N_ = task_data->inputs_count[0];
@@ -31,6 +29,8 @@ bool korotin_e_crs_multiplication_tbb::CrsMultiplicationTBB::PreProcessingImpl()
 
   val_ptr = reinterpret_cast<double *>(task_data->inputs[5]);
   B_val_ = std::vector<double>(val_ptr, val_ptr + B_Nz_);
+  // B does not carry its width, the largest column index bounds it
+  B_cols_ = B_col_.empty() ? 0 : static_cast<size_t>(*std::ranges::max_element(B_col_)) + 1;
 
   unsigned int output_size = task_data->outputs_count[0];
   output_rI_ = std::vector<unsigned int>(output_size);
@@ -47,98 +47,18 @@ bool korotin_e_crs_multiplication_tbb::CrsMultiplicationTBB::ValidationImpl() {
              task_data->inputs_count[3] - 2;
 }
 
-void korotin_e_crs_multiplication_tbb::CrsMultiplicationTBB::MulTask(size_t l, size_t r, std::vector<double> &local_val,
-                                                                     std::vector<unsigned int> &local_col,
-                                                                     std::vector<unsigned int> &temp_r_i,
-                                                                     const std::vector<unsigned int> &tr_i,
-                                                                     const std::vector<unsigned int> &tcol,
-                                                                     const std::vector<double> &tval) {
-  for (size_t k = l; k < r; ++k) {
-    for (size_t s = 0; s < tr_i.size() - 1; ++s) {
-      double sum = 0;
-      unsigned int ai = A_rI_[k];
-      unsigned int bt = tr_i[s];
-      while (ai < A_rI_[k + 1] && bt < tr_i[s + 1]) {
-        if (A_col_[ai] == tcol[bt]) {
-          sum += A_val_[ai] * tval[bt];
-          ai++;
-          bt++;
-        } else if (A_col_[ai] < tcol[bt]) {
-          ai++;
-        } else {
-          bt++;
-        }
-      }
-      if (sum != 0) {
-        local_val.push_back(sum);
-        local_col.push_back(s);
-        temp_r_i[k + 1]++;
-      }
-    }
-  }
-}
-
 bool korotin_e_crs_multiplication_tbb::CrsMultiplicationTBB::RunImpl() {
-  std::vector<unsigned int> tr_i(*std::ranges::max_element(B_col_.begin(), B_col_.end()) + 2, 0);
-  unsigned int i = 0;
-  unsigned int j = 0;
-  for (i = 0; i < B_Nz_; i++) {
-    tr_i[B_col_[i] + 1]++;
-  }
-  for (i = 1; i < tr_i.size(); i++) {
-    tr_i[i] += tr_i[i - 1];
-  }
-
-  std::vector<unsigned int> tcol(B_Nz_, 0);
-  std::vector<double> tval(B_Nz_, 0);
-  for (i = 0; i < B_N_ - 1; i++) {
-    for (j = B_rI_[i]; j < B_rI_[i + 1]; j++) {
-      tval[tr_i[B_col_[j]]] = B_val_[j];
-      tcol[tr_i[B_col_[j]]] = i;
-      tr_i[B_col_[j]]++;
-    }
-  }
-  for (i = tr_i.size() - 1; i > 0; i--) {
-    tr_i[i] = tr_i[i - 1];
-  }
-  tr_i[0] = 0;
-
-  std::ranges::fill(output_rI_.begin(), output_rI_.end(), 0);
-  output_col_.clear();
-  output_val_.clear();
-  unsigned int magic_const = 4;
-  std::vector<std::vector<double>> local_val(magic_const);
-  std::vector<std::vector<unsigned int>> local_col(magic_const);
-  std::vector<unsigned int> temp_r_i(A_N_, 0);
-  tbb::task_group tg;
-
-  std::vector<size_t> delta(magic_const, (A_N_ - 1) / magic_const);
-  for (i = 0; i < (A_N_ - 1) % magic_const; ++i) {
-    delta[i]++;
-  }
-  for (i = 1; i < magic_const; ++i) {
-    delta[i] += delta[i - 1];
-  }
-
-  tg.run([this, &delta, &local_val, &local_col, &temp_r_i, &tr_i, &tcol, &tval] {
-    MulTask(0, delta[0], local_val[0], local_col[0], temp_r_i, tr_i, tcol, tval);
-  });
-  for (i = 1; i < magic_const; ++i) {
-    tg.run([this, &delta, &local_val, &local_col, &temp_r_i, &tr_i, &tcol, &tval, i] {
-      MulTask(delta[i - 1], delta[i], local_val[i], local_col[i], temp_r_i, tr_i, tcol, tval);
-    });
-  }
-
-  tg.wait();
-
-  for (unsigned int t = 0; t < magic_const; ++t) {
-    output_val_.insert(output_val_.end(), local_val[t].begin(), local_val[t].end());
-    output_col_.insert(output_col_.end(), local_col[t].begin(), local_col[t].end());
-  }
-
-  for (i = 1; i < A_N_; ++i) {
-    output_rI_[i] += output_rI_[i - 1] + temp_r_i[i];
-  }
+  using View = ppc::core::sparse::CsrView<double, unsigned int>;
+  const size_t rows = A_N_ - 1;
+  const size_t inner = B_N_ - 1;
+  const View a{.rows = rows, .cols = inner, .row_ptr = A_rI_, .col_idx = A_col_, .values = A_val_};
+  const View b{.rows = inner, .cols = B_cols_, .row_ptr = B_rI_, .col_idx = B_col_, .values = B_val_};
+
+  // Sums which cancel out to zero are not stored
+  auto c = ppc::core::sparse::SpGemm(a, b, ppc::core::sparse::TbbBackend{}, {.drop_zeros = true});
+  output_rI_ = std::move(c.row_ptr);
+  output_col_ = std::move(c.col_idx);
+  output_val_ = std::move(c.values);
   return true;
 }
 
@@ -17,6 +17,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
 #include "core/util/include/util.hpp"
 
 namespace {
@@ -116,42 +117,17 @@ bool koshkin_m_radix_int_simple_merge::TbbT::RunImpl() {
                               });
   });
 
-  for (std::size_t blcnt = blocks.size(), dx = 1; blcnt > 1; blcnt /= 2, dx *= 2) {
-    const auto bsize = blocks[0].size();
-    const auto after = blcnt / 2;
-
-    const auto merge_and_subst = [&](std::vector<int> &a, std::vector<int> &b) {
-      std::vector<int> c(a.size() + b.size());
-      std::ranges::merge(a, b, c.begin());
-      a = std::move(c);
-      b.clear();
-    };
-    if (bsize > 64) {
-      arena.execute([&] {
-        oneapi::tbb::parallel_for(
-            oneapi::tbb::blocked_range<std::size_t>(0, after, after / tbb::this_task_arena::max_concurrency()),
-            [&](const auto &r) {
-              for (std::size_t g = r.begin(); g < r.end(); ++g) {
-                merge_and_subst(blocks[2 * dx * g], blocks[(2 * dx * g) + dx]);
-              }
-            });
-      });
-    } else {
-      for (std::size_t g = 0; g < after; ++g) {
-        merge_and_subst(blocks[2 * dx * g], blocks[(2 * dx * g) + dx]);
-      }
-    }
+  const std::vector<std::span<const int>> runs(blocks.begin(), blocks.end());
+  const std::size_t parts = blocks.size();
+  out_.resize(in_.size());
 
-    if (after % 2 != 0) {
-      if (after == 1) {
-        merge_and_subst(blocks.front(), blocks.back());
-      } else {
-        merge_and_subst(blocks[2 * dx * (after - 2)], blocks[2 * dx * (after - 1)]);
+  arena.execute([&] {
+    oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<std::size_t>(0, parts, 1), [&](const auto &r) {
+      for (std::size_t part = r.begin(); part < r.end(); part++) {
+        ppc::core::MultiwayMergePart<int>(runs, out_, part, parts);
       }
-    }
-  }
-
-  out_ = std::move(blocks.front());
+    });
+  });
 
   return true;
 }
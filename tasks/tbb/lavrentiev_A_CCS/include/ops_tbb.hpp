@@ -1,27 +1,19 @@
 #pragma once
 
-#include <cmath>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
 #include "core/task/include/task.hpp"
 
 namespace lavrentiev_a_ccs_tbb {
-struct Sparse {
-  std::pair<int, int> size;
-  std::vector<std::pair<double, int>> elements_and_rows;
-  std::vector<int> columnsSum;
-};
+
+using Sparse = ppc::core::sparse::CcsMatrix<double, int>;
 
 class CCSTBB : public ppc::core::Task {
  private:
-  [[nodiscard]] bool IsEmpty() const;
   static Sparse ConvertToSparse(std::pair<int, int> size, const std::vector<double>& values);
-  static Sparse Transpose(const Sparse& sparse);
-  static Sparse MatMul(const Sparse& matrix1, const Sparse& matrix2);
-  static int GetElementsCount(int index, const std::vector<int>& columns_sum);
   static std::vector<double> ConvertFromSparse(const Sparse& matrix);
-  static int CalculateStartIndex(int index, const std::vector<int>& columns_sum);
 
   Sparse A_;
   Sparse B_;
@@ -5,12 +5,10 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <cstdint>
-#include <ctime>
 #include <functional>
-#include <random>
 #include <vector>
 
+#include "core/random/include/philox.hpp"
 #include "core/util/include/util.hpp"
 #include "oneapi/tbb/parallel_reduce.h"
 #include "oneapi/tbb/task_arena.h"
@@ -50,44 +48,19 @@ bool TestTaskTBB::PreProcessingImpl() {
 bool TestTaskTBB::RunImpl() {
   const size_t d = integrationBounds_.size() / 2;  // dimensions
 
-  // init random numbers generator
-  std::random_device rd;
-  std::seed_seq seed{rd(), static_cast<unsigned int>(std::time(nullptr))};
-  const size_t num_threads = ppc::util::GetPPCNumThreads();
-  std::vector<std::mt19937::result_type> seeds(num_threads);
-  seed.generate(seeds.begin(), seeds.end());
-
   // volume of integration region
   double volume = 1.0;
   for (size_t j = 0; j < d; ++j) {
     volume *= (integrationBounds_[(2 * j) + 1] - integrationBounds_[2 * j]);
   }
 
-  // tbb parallel reduction
+  // tbb parallel reduction, chunks jump to their own samples of one sequence
   oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
   double total_sum = arena.execute([&] {
     return oneapi::tbb::parallel_reduce(
-        oneapi::tbb::blocked_range<std::size_t>(0, iterations_, iterations_ / arena.max_concurrency()), 0.0,
+        oneapi::tbb::blocked_range<std::size_t>(0, iterations_, 1024), 0.0,
         [&](const oneapi::tbb::blocked_range<std::size_t>& range, double sum) {
-          static thread_local std::mt19937 local_rnd;
-          static thread_local bool initialized = false;
-          if (!initialized) {
-            const size_t idx = reinterpret_cast<uintptr_t>(&local_rnd) % num_threads;
-            local_rnd.seed(seeds[idx]);
-            initialized = true;
-          }
-          std::uniform_real_distribution<> dis(0.0, 1.0);
-          std::vector<double> point(d);
-
-          for (size_t i = range.begin(); i < range.end(); ++i) {
-            for (size_t j = 0; j < d; ++j) {
-              const double min = integrationBounds_[2 * j];
-              const double max = integrationBounds_[(2 * j) + 1];
-              point[j] = min + (max - min) * dis(local_rnd);
-            }
-            sum += integrand_(point);
-          }
-          return sum;
+          return sum + SampleSum(range.begin(), range.end());
         },
         std::plus<>());
   });
@@ -96,6 +69,22 @@ bool TestTaskTBB::RunImpl() {
   return true;
 }
 
+double TestTaskTBB::SampleSum(std::size_t first, std::size_t last) const {
+  const size_t d = integrationBounds_.size() / 2;  // dimensions
+
+  // sample i takes the uniforms [i * d, (i + 1) * d) of the fixed sequence
+  auto rnd = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, d);
+  std::vector<double> point(d);
+  double sum = 0.0;
+  for (size_t i = first; i < last; ++i) {
+    for (size_t j = 0; j < d; ++j) {
+      point[j] = rnd.Uniform(integrationBounds_[2 * j], integrationBounds_[(2 * j) + 1]);
+    }
+    sum += integrand_(point);
+  }
+  return sum;
+}
+
 bool TestTaskTBB::PostProcessingImpl() {
   auto* output_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
   *output_ptr = result_;
@@ -5,15 +5,17 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+#include "oneapi/tbb/parallel_for.h"
 #include "oneapi/tbb/task_arena.h"
-#include "oneapi/tbb/task_group.h"
 
 namespace mezhuev_m_bitwise_integer_sort_tbb {
 
 namespace {
-void SeparateNumbers(const std::vector<int>& input, std::vector<int>& negative, std::vector<int>& positive) {
+void SeparateNumbers(std::span<const int> input, std::vector<int>& negative, std::vector<int>& positive) {
   for (int num : input) {
     if (num < 0) {
       negative.push_back(-num);
@@ -54,6 +56,18 @@ void ProcessNumbers(std::vector<int>& numbers, int max_value) {
   }
 }
 
+// Sorts one block: magnitudes of negative and positive numbers are sorted separately
+void SortBlock(std::span<const int> block, std::span<int> out, int max_value) {
+  std::vector<int> negative;
+  std::vector<int> positive;
+  SeparateNumbers(block, negative, positive);
+  ProcessNumbers(positive, max_value);
+  ProcessNumbers(negative, max_value);
+
+  auto it = std::ranges::transform(negative.rbegin(), negative.rend(), out.begin(), [](int num) { return -num; }).out;
+  std::ranges::copy(positive, it);
+}
+
 }  // namespace
 
 bool SortTBB::PreProcessingImpl() {
@@ -82,29 +96,23 @@ bool SortTBB::RunImpl() {
     return true;
   }
 
-  std::vector<int> negative;
-  std::vector<int> positive;
-
-  SeparateNumbers(input_, negative, positive);
-
-  oneapi::tbb::task_arena arena(1);
-  arena.execute([&] {
-    tbb::task_group tg;
-
-    tg.run([&] { ProcessNumbers(positive, max_value_); });
-    tg.run([&] { ProcessNumbers(negative, max_value_); });
-
-    tg.wait();
-  });
-
-  std::ranges::reverse(negative);
-  for (int& num : negative) {
-    num = -num;
+  const auto blocks = std::max<size_t>(
+      1, std::min(input_.size(), static_cast<size_t>(oneapi::tbb::this_task_arena::max_concurrency())));
+  std::vector<size_t> bounds(blocks + 1);
+  for (size_t i = 0; i <= blocks; ++i) {
+    bounds[i] = i * input_.size() / blocks;
   }
+  std::vector<int> sorted_blocks(input_.size());
+  tbb::parallel_for(size_t{0}, blocks, [&](size_t i) {
+    const size_t size = bounds[i + 1] - bounds[i];
+    SortBlock(std::span(input_).subspan(bounds[i], size), std::span(sorted_blocks).subspan(bounds[i], size),
+              max_value_);
+  });
 
-  output_.clear();
-  output_.insert(output_.end(), negative.begin(), negative.end());
-  output_.insert(output_.end(), positive.begin(), positive.end());
+  const auto runs = ppc::core::MakeRuns<int>(sorted_blocks, bounds);
+  output_.resize(input_.size());
+  tbb::parallel_for(size_t{0}, blocks,
+                    [&](size_t part) { ppc::core::MultiwayMergePart<int>(runs, output_, part, blocks); });
 
   return true;
 }
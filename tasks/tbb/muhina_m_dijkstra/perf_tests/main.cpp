@@ -8,9 +8,11 @@
 #include <functional>
 #include <memory>
 #include <queue>
+#include <random>
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/graph.hpp"
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
 #include "tbb/muhina_m_dijkstra/include/ops_tbb.hpp"
@@ -74,6 +76,22 @@ std::vector<int> Dijkstra(const std::vector<std::vector<std::pair<size_t, int>>>
 
   return distances;
 }
+// Graph of num_vertices vertices with degree random out-edges of weight 1..100 each
+ppc::core::graph::CsrGraph GenerateSparseGraph(size_t num_vertices, size_t degree) {
+  std::mt19937 gen(6);
+  std::uniform_int_distribution<std::uint32_t> target(0, num_vertices - 1);
+  std::uniform_int_distribution<int> weight(1, 100);
+  ppc::core::graph::CsrGraph graph;
+  for (size_t u = 0; u < num_vertices; ++u) {
+    for (size_t e = 0; e < degree; ++e) {
+      graph.targets.push_back(target(gen));
+      graph.weights.push_back(weight(gen));
+    }
+    graph.offsets.push_back(static_cast<std::uint32_t>(graph.targets.size()));
+  }
+  return graph;
+}
+
 }  // namespace
 
 TEST(muhina_m_dijkstra_tbb, test_pipeline_run) {
@@ -156,3 +174,40 @@ TEST(muhina_m_dijkstra_tbb, test_task_run) {
     EXPECT_EQ(distances[i], expected_distances[i]);
   }
 }
+
+// Delta-stepping of the task has to beat the serial binary heap Dijkstra on a graph with 4M edges. The graph
+// is given as CSR inputs, which the task reads in place
+TEST(muhina_m_dijkstra_tbb, test_task_run_sparse_graph) {
+  auto graph = GenerateSparseGraph(200000, 20);
+  std::vector<int> distances(graph.NumVertices(), INT_MAX);
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->AddInput(graph.offsets.data(), graph.offsets.size());
+  task_data_tbb->AddInput(graph.targets.data(), graph.targets.size());
+  task_data_tbb->AddInput(graph.weights.data(), graph.weights.size());
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t*>(distances.data()));
+  task_data_tbb->outputs_count.emplace_back(distances.size());
+
+  auto test_task_tbb = std::make_shared<muhina_m_dijkstra_tbb::TestTaskTBB>(task_data_tbb);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_tbb);
+  perf_analyzer->TaskRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  std::vector<int> expected(graph.NumVertices());
+  const auto start = std::chrono::high_resolution_clock::now();
+  ppc::core::graph::Dijkstra(graph.View(), 0, expected);
+  const std::chrono::duration<double> serial = std::chrono::high_resolution_clock::now() - start;
+  EXPECT_EQ(distances, expected);
+  EXPECT_LT(perf_results->median_sec, serial.count()) << "serial dijkstra: " << serial.count() << " s";
+}
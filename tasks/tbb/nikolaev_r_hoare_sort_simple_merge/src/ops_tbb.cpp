@@ -9,8 +9,9 @@
 #include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+#include "oneapi/tbb/parallel_for.h"
 #include "oneapi/tbb/task_arena.h"
-#include "oneapi/tbb/task_group.h"
 
 bool nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB::PreProcessingImpl() {
   vect_size_ = task_data->inputs_count[0];
@@ -26,41 +27,22 @@ bool nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB::Validation
 }
 
 bool nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB::RunImpl() {
-  size_t num_segments = ppc::util::GetPPCNumThreads();
-
-  num_segments = std::min(num_segments, vect_size_);
-
-  size_t segment_size = vect_size_ / num_segments;
-  size_t remainder = vect_size_ % num_segments;
-
-  std::vector<std::pair<size_t, size_t>> segments;
-  size_t start = 0;
-
-  for (size_t i = 0; i < num_segments; ++i) {
-    size_t current_segment_size = segment_size + (i < remainder ? 1 : 0);
-    size_t end = start + current_segment_size - 1;
-    segments.emplace_back(start, end);
-    start = end + 1;
+  const size_t blocks = std::max<size_t>(1, std::min<size_t>(ppc::util::GetPPCNumThreads(), vect_size_));
+  std::vector<size_t> bounds(blocks + 1);
+  for (size_t i = 0; i <= blocks; i++) {
+    bounds[i] = i * vect_size_ / blocks;
   }
 
-  oneapi::tbb::task_arena arena(static_cast<int>(num_segments));
-  arena.execute([this, &segments]() {
-    oneapi::tbb::task_group tg;
+  std::vector<double> merged(vect_size_);
+  oneapi::tbb::task_arena arena(static_cast<int>(blocks));
+  arena.execute([&] {
+    oneapi::tbb::parallel_for(size_t{0}, blocks, [&](size_t i) { QuickSort(bounds[i], bounds[i + 1] - 1); });
 
-    for (const auto &seg : segments) {
-      tg.run([this, seg]() { QuickSort(seg.first, seg.second); });
-    }
-
-    tg.wait();
+    const auto runs = ppc::core::MakeRuns<double>(vect_, bounds);
+    oneapi::tbb::parallel_for(size_t{0}, blocks,
+                              [&](size_t part) { ppc::core::MultiwayMergePart<double>(runs, merged, part, blocks); });
   });
-
-  size_t merged_end = segments[0].second;
-  for (size_t i = 1; i < segments.size(); ++i) {
-    std::inplace_merge(vect_.begin(), vect_.begin() + static_cast<std::vector<double>::difference_type>(merged_end + 1),
-                       vect_.begin() + static_cast<std::vector<double>::difference_type>(segments[i].second + 1));
-    merged_end = segments[i].second;
-  }
-
+  vect_.swap(merged);
   return true;
 }
 
@@ -1,11 +1,11 @@
 #pragma once
 
-#include <oneapi/tbb/mutex.h>
-
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/graph.hpp"
 #include "core/task/include/task.hpp"
 
 namespace plekhanov_d_dijkstra_tbb {
@@ -19,16 +19,11 @@ class TestTaskTBB : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<int> graph_data_;
+  ppc::core::graph::TaskGraph graph_;
+  bool valid_graph_ = false;
+  std::vector<std::uint32_t> sources_;
   std::vector<int> distances_;
-  oneapi::tbb::mutex mutex_;
-  size_t start_vertex_;
   size_t num_vertices_;
-  static const int kEndOfVertexList;
-
-  [[nodiscard]] int FindMinDistanceVertexTBB(const std::vector<bool>& visited) const;
-  void RelaxEdgesTBB(int u, const std::vector<std::vector<std::pair<int, int>>>& graph,
-                     const std::vector<bool>& visited);
 };
 
 }  // namespace plekhanov_d_dijkstra_tbb
\ No newline at end of file
@@ -9,9 +9,11 @@
 #include <functional>
 #include <memory>
 #include <queue>
+#include <random>
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/graph.hpp"
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
 #include "tbb/plekhanov_d_dijkstra/include/ops_tbb.hpp"
@@ -71,6 +73,22 @@ std::vector<int> CalculateExpectedResult(const std::vector<std::vector<std::pair
   return distances;
 }
 
+// Graph of num_vertices vertices with degree random out-edges of weight 1..100 each
+ppc::core::graph::CsrGraph CreateSparseGraph(size_t num_vertices, size_t degree) {
+  std::mt19937 gen(6);
+  std::uniform_int_distribution<std::uint32_t> target(0, num_vertices - 1);
+  std::uniform_int_distribution<int> weight(1, 100);
+  ppc::core::graph::CsrGraph graph;
+  for (size_t u = 0; u < num_vertices; ++u) {
+    for (size_t e = 0; e < degree; ++e) {
+      graph.targets.push_back(target(gen));
+      graph.weights.push_back(weight(gen));
+    }
+    graph.offsets.push_back(static_cast<std::uint32_t>(graph.targets.size()));
+  }
+  return graph;
+}
+
 }  // namespace
 
 }  // namespace plekhanov_d_dijkstra_tbb
@@ -164,4 +182,41 @@ TEST(plekhanov_d_dijkstra_tbb, test_task_run) {
   ppc::core::Perf::PrintPerfStatistic(perf_results);
   std::vector<int> expected = plekhanov_d_dijkstra_tbb::CalculateExpectedResult(adj_list, start_vertex);
   EXPECT_EQ(distances, expected);
+}
+
+// Delta-stepping of the task has to beat the serial binary heap Dijkstra on a graph with 4M edges. The graph
+// is given as CSR inputs, which the task reads in place
+TEST(plekhanov_d_dijkstra_tbb, test_task_run_sparse_graph) {
+  auto graph = plekhanov_d_dijkstra_tbb::CreateSparseGraph(200000, 20);
+  std::vector<int> distances(graph.NumVertices(), INT_MAX);
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->AddInput(graph.offsets.data(), graph.offsets.size());
+  task_data_tbb->AddInput(graph.targets.data(), graph.targets.size());
+  task_data_tbb->AddInput(graph.weights.data(), graph.weights.size());
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(distances.data()));
+  task_data_tbb->outputs_count.emplace_back(distances.size());
+
+  auto test_task_tbb = std::make_shared<plekhanov_d_dijkstra_tbb::TestTaskTBB>(task_data_tbb);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_tbb);
+  perf_analyzer->TaskRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  std::vector<int> expected(graph.NumVertices());
+  const auto start = std::chrono::high_resolution_clock::now();
+  ppc::core::graph::Dijkstra(graph.View(), 0, expected);
+  const std::chrono::duration<double> serial = std::chrono::high_resolution_clock::now() - start;
+  EXPECT_EQ(distances, expected);
+  EXPECT_LT(perf_results->median_sec, serial.count()) << "serial dijkstra: " << serial.count() << " s";
 }
\ No newline at end of file
@@ -5,11 +5,10 @@
 
 #include <algorithm>
 #include <cstdlib>
-#include <ctime>
 #include <functional>
-#include <random>
 #include <vector>
 
+#include "core/random/include/philox.hpp"
 #include "oneapi/tbb/parallel_reduce.h"
 #include "oneapi/tbb/task_arena.h"
 
@@ -36,29 +35,10 @@ bool sharamygina_i_multi_dim_monte_carlo_tbb::MultiDimMonteCarloTask::Validation
 bool sharamygina_i_multi_dim_monte_carlo_tbb::MultiDimMonteCarloTask::RunImpl() {
   size_t dimension = boundaries_.size() / 2;
 
-  int max_concurrency = tbb::this_task_arena::max_concurrency();
-  int grain_size = (number_of_iterations_ + max_concurrency - 1) / max_concurrency;
-  grain_size = std::max(grain_size, 1);
-
-  double result = tbb::parallel_reduce(
-      tbb::blocked_range<int>(0, number_of_iterations_, grain_size), 0.0,
-      [&](const tbb::blocked_range<int>& r, double local_sum) {
-        std::mt19937 engine(
-            static_cast<unsigned long>(std::time(nullptr) ^ tbb::this_task_arena::current_thread_index()));
-        std::uniform_real_distribution<double> distribution(0.0, 1.0);
-
-        for (int j = r.begin(); j != r.end(); ++j) {
-          std::vector<double> random_point(dimension);
-          for (size_t i = 0; i < dimension; ++i) {
-            double low = boundaries_[2 * i];
-            double high = boundaries_[(2 * i) + 1];
-            double t = distribution(engine);
-            random_point[i] = low + (high - low) * t;
-          }
-          local_sum += integrating_function_(random_point);
-        }
-        return local_sum;
-      },
+  // chunks jump to their own samples of one sequence, so the result does not depend on the number of threads
+  double accumulator = tbb::parallel_reduce(
+      tbb::blocked_range<size_t>(0, number_of_iterations_, 1024), 0.0,
+      [&](const tbb::blocked_range<size_t>& r, double local_sum) { return local_sum + SampleSum(r.begin(), r.end()); },
       std::plus<>());
 
   double volume = 1.0;
@@ -67,11 +47,27 @@ bool sharamygina_i_multi_dim_monte_carlo_tbb::MultiDimMonteCarloTask::RunImpl()
     volume *= edge_length;
   }
 
-  final_result_ = (result / static_cast<double>(number_of_iterations_)) * volume;
+  final_result_ = (accumulator / static_cast<double>(number_of_iterations_)) * volume;
 
   return true;
 }
 
+double sharamygina_i_multi_dim_monte_carlo_tbb::MultiDimMonteCarloTask::SampleSum(size_t first, size_t last) const {
+  size_t dimension = boundaries_.size() / 2;
+
+  auto engine = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, dimension);
+  std::vector<double> random_point(dimension);
+  double accumulator = 0.0;
+
+  for (size_t n = first; n < last; ++n) {
+    for (size_t i = 0; i < dimension; ++i) {
+      random_point[i] = engine.Uniform(boundaries_[2 * i], boundaries_[(2 * i) + 1]);
+    }
+    accumulator += integrating_function_(random_point);
+  }
+  return accumulator;
+}
+
 bool sharamygina_i_multi_dim_monte_carlo_tbb::MultiDimMonteCarloTask::PostProcessingImpl() {
   auto* output_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
   output_ptr[0] = final_result_;
@@ -1,14 +1,15 @@
 ﻿#include "tbb/shlyakov_m_shell_sort/include/ops_tbb.hpp"
 
+#include <oneapi/tbb/parallel_for.h>
 #include <oneapi/tbb/task_arena.h>
-#include <oneapi/tbb/task_group.h>
 
 #include <algorithm>
 #include <core/util/include/util.hpp>
 #include <cstddef>
-#include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+
 namespace shlyakov_m_shell_sort_tbb {
 
 bool TestTaskTBB::PreProcessingImpl() {
@@ -23,43 +24,34 @@ bool TestTaskTBB::PreProcessingImpl() {
 bool TestTaskTBB::ValidationImpl() { return task_data->inputs_count[0] == task_data->outputs_count[0]; }
 
 bool TestTaskTBB::RunImpl() {
-  const int n = static_cast<int>(input_.size());
-  if (n < 2) {
+  const int array_size = static_cast<int>(input_.size());
+  if (array_size < 2) {
     return true;
   }
 
-  const int max_threads = ppc::util::GetPPCNumThreads();
-  int threads = std::min(max_threads, n);
-  const int seg_size = (n + threads - 1) / threads;
+  const int num_threads = std::max(1, std::min(ppc::util::GetPPCNumThreads(), array_size));
+  const int sub_arr_size = (array_size + num_threads - 1) / num_threads;
 
-  std::vector<std::pair<int, int>> segs;
-  segs.reserve(threads);
-  for (int idx = 0; idx < threads; ++idx) {
-    const int l = idx * seg_size;
-    const int r = std::min(n - 1, l + seg_size - 1);
-    segs.emplace_back(l, r);
+  std::vector<std::size_t> bounds(num_threads + 1);
+  for (int i = 0; i <= num_threads; ++i) {
+    bounds[i] = static_cast<std::size_t>(std::min(i * sub_arr_size, array_size));
   }
 
-  tbb::task_arena arena(threads);
+  tbb::task_arena arena(num_threads);
   arena.execute([&] {
-    tbb::task_group tg;
-    for (const auto& seg : segs) {
-      const int l = seg.first;
-      const int r = seg.second;
-      tg.run([this, l, r] { ShellSort(l, r, input_); });
-    }
-    tg.wait();
-  });
-
-  std::vector<int> buf;
-  int end = segs.front().second;
-  for (std::size_t i = 1; i < segs.size(); ++i) {
-    const int r = segs[i].second;
-    Merge(0, end, r, input_, buf);
-    end = r;
-  }
+    tbb::parallel_for(0, num_threads, [&](int i) {
+      const int left = static_cast<int>(bounds[i]);
+      const int right = static_cast<int>(bounds[i + 1]) - 1;
+      if (left < right) {
+        ShellSort(left, right, input_);
+      }
+    });
 
-  output_ = input_;
+    const auto runs = ppc::core::MakeRuns<int>(input_, bounds);
+    output_.resize(input_.size());
+    tbb::parallel_for(0, num_threads,
+                      [&](int part) { ppc::core::MultiwayMergePart<int>(runs, output_, part, num_threads); });
+  });
   return true;
 }
 
@@ -83,31 +75,6 @@ void ShellSort(int left, int right, std::vector<int>& arr) {
   }
 }
 
-void Merge(int left, int mid, int right, std::vector<int>& arr, std::vector<int>& buffer) {
-  const int merge_size = right - left + 1;
-  if (buffer.size() < static_cast<std::size_t>(merge_size)) {
-    buffer.resize(static_cast<std::size_t>(merge_size));
-  }
-
-  int i = left;
-  int j = mid + 1;
-  int k = 0;
-
-  while (i <= mid && j <= right) {
-    buffer[k++] = (arr[i] <= arr[j]) ? arr[i++] : arr[j++];
-  }
-  while (i <= mid) {
-    buffer[k++] = arr[i++];
-  }
-  while (j <= right) {
-    buffer[k++] = arr[j++];
-  }
-
-  for (int idx = 0; idx < merge_size; ++idx) {
-    arr[left + idx] = buffer[idx];
-  }
-}
-
 bool TestTaskTBB::PostProcessingImpl() {
   for (std::size_t idx = 0; idx < output_.size(); ++idx) {
     reinterpret_cast<int*>(task_data->outputs[0])[idx] = output_[idx];
@@ -52,8 +52,6 @@ class JarvisTBBParallel : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
-  static void MakeJarvisPassageTBB(std::vector<shulpin_i_jarvis_tbb::Point>& input,
-                                   std::vector<shulpin_i_jarvis_tbb::Point>& output);
 
  private:
   std::vector<shulpin_i_jarvis_tbb::Point> input_tbb_, output_tbb_;
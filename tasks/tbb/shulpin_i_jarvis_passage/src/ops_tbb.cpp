@@ -1,17 +1,14 @@
 #include "tbb/shulpin_i_jarvis_passage/include/ops_tbb.hpp"
 
-#include <oneapi/tbb/concurrent_unordered_set.h>
-#include <oneapi/tbb/concurrent_vector.h>
-#include <oneapi/tbb/parallel_reduce.h>
-
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <cstdint>
-#include <cstring>
-#include <utility>
+#include <unordered_set>
 #include <vector>
 
+#include "core/hull/include/hull.hpp"
+#include "core/sparse/include/sparse_tbb.hpp"
+
 namespace {
 int Orientation(const shulpin_i_jarvis_tbb::Point& p, const shulpin_i_jarvis_tbb::Point& q,
                 const shulpin_i_jarvis_tbb::Point& r) {
@@ -81,65 +78,6 @@ bool shulpin_i_jarvis_tbb::JarvisSequential::PostProcessingImpl() {
   return true;
 }
 
-void shulpin_i_jarvis_tbb::JarvisTBBParallel::MakeJarvisPassageTBB(
-    std::vector<shulpin_i_jarvis_tbb::Point>& input_jar, std::vector<shulpin_i_jarvis_tbb::Point>& output_jar) {
-  int n = static_cast<int>(input_jar.size());
-
-  int start = 0;
-  for (int i = 1; i < n; ++i) {
-    if (input_jar[i].x < input_jar[start].x ||
-        (input_jar[i].x == input_jar[start].x && input_jar[i].y < input_jar[start].y)) {
-      start = i;
-    }
-  }
-
-  std::vector<Point> hull;
-  hull.reserve(n);
-  tbb::concurrent_unordered_set<Point, PointHash, PointEqual> visited;
-
-  int current = start;
-  do {
-    const Point& cur_pt = input_jar[current];
-    if (visited.insert(cur_pt).second) {
-      hull.push_back(cur_pt);
-    }
-
-    struct BlockCandidate {
-      int index;
-      Point pt;
-    };
-    tbb::concurrent_vector<BlockCandidate> local_cands;
-    int initial = (current + 1) % n;
-
-    tbb::parallel_for(tbb::blocked_range<int>(0, n), [&](const tbb::blocked_range<int>& r) {
-      int best = initial;
-      for (int i = r.begin(); i < r.end(); ++i) {
-        if (i == current) {
-          continue;
-        }
-        int orient = Orientation(cur_pt, input_jar[i], input_jar[best]);
-        if (orient == 2) {
-          best = i;
-        }
-      }
-      local_cands.push_back({best, input_jar[best]});
-    });
-
-    int candidate = local_cands[0].index;
-    for (size_t i = 1; i < local_cands.size(); ++i) {
-      int idx = local_cands[i].index;
-      int orient = Orientation(cur_pt, input_jar[idx], input_jar[candidate]);
-      if (orient == 2) {
-        candidate = idx;
-      }
-    }
-
-    current = candidate;
-  } while (current != start);
-
-  output_jar = std::move(hull);
-}
-
 bool shulpin_i_jarvis_tbb::JarvisTBBParallel::PreProcessingImpl() {
   std::vector<shulpin_i_jarvis_tbb::Point> tmp_input;
 
@@ -160,7 +98,11 @@ bool shulpin_i_jarvis_tbb::JarvisTBBParallel::ValidationImpl() {
 }
 
 bool shulpin_i_jarvis_tbb::JarvisTBBParallel::RunImpl() {
-  MakeJarvisPassageTBB(input_tbb_, output_tbb_);
+  // Counterclockwise from the leftmost point with every point on the boundary, the way the passage walks it
+  const ppc::core::sparse::TbbBackend backend;
+  const auto hull = ppc::core::hull::ConvexHull<Point>(input_tbb_, backend, ppc::core::hull::HullPoints::kBoundary);
+  output_tbb_ =
+      ppc::core::hull::OrientHull(hull, ppc::core::hull::LeftBottomLess{}, ppc::core::hull::Winding::kCounterclockwise);
   return true;
 }
 
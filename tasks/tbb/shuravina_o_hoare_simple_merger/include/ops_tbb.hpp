@@ -18,11 +18,9 @@ class HoareSortTBB : public ppc::core::Task {
 
  private:
   std::vector<int> data_;
-  static constexpr std::size_t kThreshold = 10000;
 
   void SequentialQuickSort(int* arr, std::size_t left, std::size_t right);
   static std::size_t Partition(int* arr, std::size_t left, std::size_t right);
-  void ParallelQuickSort(int* arr, std::size_t left, std::size_t right);
 
   bool ValidationImpl() override;
   bool PreProcessingImpl() override;
@@ -8,8 +8,10 @@
 #include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
 #include "core/task/include/task.hpp"
-#include "oneapi/tbb/parallel_invoke.h"
+#include "oneapi/tbb/parallel_for.h"
+#include "oneapi/tbb/task_arena.h"
 
 namespace shuravina_o_hoare_simple_merger_tbb {
 
@@ -66,7 +68,22 @@ bool HoareSortTBB::RunImpl() {
   }
 
   try {
-    ParallelQuickSort(data_.data(), 0, data_.size() - 1);
+    const auto size = data_.size();
+    const auto blocks = std::min(size, static_cast<std::size_t>(oneapi::tbb::this_task_arena::max_concurrency()));
+    std::vector<std::size_t> bounds(blocks + 1);
+    for (std::size_t i = 0; i <= blocks; ++i) {
+      bounds[i] = i * size / blocks;
+    }
+
+    oneapi::tbb::parallel_for(std::size_t{0}, blocks, [&](std::size_t i) {
+      SequentialQuickSort(data_.data() + bounds[i], 0, bounds[i + 1] - bounds[i] - 1);
+    });
+
+    const auto runs = ppc::core::MakeRuns<int>(data_, bounds);
+    std::vector<int> merged(size);
+    oneapi::tbb::parallel_for(std::size_t{0}, blocks,
+                              [&](std::size_t part) { ppc::core::MultiwayMergePart<int>(runs, merged, part, blocks); });
+    data_.swap(merged);
     return true;
   } catch (const std::exception& e) {
     std::cerr << "Run error: " << e.what() << '\n';
@@ -137,33 +154,4 @@ void HoareSortTBB::SequentialQuickSort(int* arr, std::size_t left, std::size_t r
   }
 }
 
-void HoareSortTBB::ParallelQuickSort(int* arr, std::size_t left, std::size_t right) {
-  if (left >= right) {
-    return;
-  }
-
-  if (right - left < kThreshold) {
-    SequentialQuickSort(arr, left, right);
-    return;
-  }
-
-  std::size_t p = Partition(arr, left, right);
-
-  try {
-    if (p > 0 && left < p - 1 && p < right) {
-      tbb::parallel_invoke([&] { ParallelQuickSort(arr, left, p - 1); }, [&] { ParallelQuickSort(arr, p, right); });
-    } else if (p > 0 && left < p - 1) {
-      ParallelQuickSort(arr, left, p - 1);
-    } else if (p < right) {
-      ParallelQuickSort(arr, p, right);
-    }
-  } catch (const std::exception& e) {
-    std::cerr << "Exception in ParallelQuickSort: " << e.what() << '\n';
-    throw;
-  } catch (...) {
-    std::cerr << "Unknown exception in ParallelQuickSort\n";
-    throw;
-  }
-}
-
 }  // namespace shuravina_o_hoare_simple_merger_tbb
\ No newline at end of file
@@ -1,9 +1,5 @@
 #include "../include/ops_tbb.hpp"
 
-#include <oneapi/tbb/parallel_sort.h>
-#include <oneapi/tbb/task_arena.h>
-#include <tbb/tbb.h>
-
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
@@ -11,12 +7,10 @@
 #include <utility>
 #include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/hull/include/hull.hpp"
+#include "core/sparse/include/sparse_tbb.hpp"
 
 namespace {
-double CrossProduct(const Point &p0, const Point &p1, const Point &p2) {
-  return ((p1[0] - p0[0]) * (p2[1] - p0[1])) - ((p1[1] - p0[1]) * (p2[0] - p0[0]));
-}
 
 bool ComparePoints(const Point &p0, const Point &p1, const Point &p2) {
   const auto dx1 = p1[0] - p0[0];
@@ -64,8 +58,8 @@ bool GrahamConvexHullTBB::PreProcessingImpl() {
 
   auto *p_src = reinterpret_cast<double *>(task_data->inputs[0]);
   for (int i = 0; i < points_count_ * 2; i += 2) {
-    input_[i / 2][0] = p_src[i];
-    input_[i / 2][1] = p_src[i + 1];
+    input_[i / 2].x = p_src[i];
+    input_[i / 2].y = p_src[i + 1];
   }
 
   res_.clear();
@@ -74,28 +68,12 @@ bool GrahamConvexHullTBB::PreProcessingImpl() {
   return true;
 }
 
-void GrahamConvexHullTBB::PerformSort() {
-  oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
-  const auto pivot = *std::ranges::min_element(input_, [](auto &a, auto &b) { return a[1] < b[1]; });
-  arena.execute([&] {
-    tbb::parallel_sort(input_.begin(), input_.end(),
-                       [&](const Point &p1, const Point &p2) { return ComparePoints(pivot, p1, p2); });
-  });
-}
-
 bool GrahamConvexHullTBB::RunImpl() {
-  PerformSort();
-
-  res_.push_back(input_[0]);
-  res_.push_back(input_[1]);
-
-  for (int i = 2; i < points_count_; ++i) {
-    while (res_.size() > 1 && CrossProduct(res_[res_.size() - 2], res_.back(), input_[i]) <= 0) {
-      res_.pop_back();
-    }
-    res_.push_back(input_[i]);
-  }
-
+  res_ = ppc::core::hull::ConvexHull<Point>(input_, ppc::core::sparse::TbbBackend{});
+  // The scan starts from the first of the lowest input points
+  const auto pivot = *std::ranges::min_element(input_, {}, &Point::y);
+  const auto first = std::ranges::find_if(res_, [&](const Point &p) { return ppc::core::hull::SamePoint(p, pivot); });
+  std::ranges::rotate(res_, first);
   return true;
 }
 
@@ -104,8 +82,8 @@ bool GrahamConvexHullTBB::PostProcessingImpl() {
   *reinterpret_cast<int *>(task_data->outputs[0]) = res_points_count;
   auto *p_out = reinterpret_cast<double *>(task_data->outputs[1]);
   for (int i = 0; i < res_points_count; i++) {
-    p_out[2 * i] = res_[i][0];
-    p_out[(2 * i) + 1] = res_[i][1];
+    p_out[2 * i] = res_[i].x;
+    p_out[(2 * i) + 1] = res_[i].y;
   }
   return true;
 }
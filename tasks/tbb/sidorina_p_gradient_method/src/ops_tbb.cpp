@@ -1,6 +1,25 @@
 #include "tbb/sidorina_p_gradient_method/include/ops_tbb.hpp"
 
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "core/solver/include/cg.hpp"
+#include "core/sparse/include/sparse_tbb.hpp"
+
 bool sidorina_p_gradient_method_tbb::GradientMethod::PreProcessingImpl() {
+  // CSR inputs: row_ptr, col_idx and values at 2..4, b at 5 and the initial solution at 6
+  if (ppc::core::solver::HasCsrInputs(*task_data, 2)) {
+    const size_t csr_end = 2 + ppc::core::solver::kCsrInputsCount;
+    sparse_ = true;
+    size_ = *reinterpret_cast<int*>(task_data->inputs[0]);
+    tolerance_ = *reinterpret_cast<double*>(task_data->inputs[1]);
+    b_.assign(matrix_.Rhs().begin(), matrix_.Rhs().end());
+    const auto solution = task_data->Input<const double>(csr_end + 1);
+    solution_.assign(solution.begin(), solution.end());
+    result_.resize(size_);
+    return true;
+  }
   size_ = *reinterpret_cast<int*>(task_data->inputs[0]);
   tolerance_ = *reinterpret_cast<double*>(task_data->inputs[1]);
   auto* a_ptr = reinterpret_cast<double*>(task_data->inputs[2]);
@@ -13,10 +32,23 @@ bool sidorina_p_gradient_method_tbb::GradientMethod::PreProcessingImpl() {
   unsigned int solution_size = task_data->inputs_count[4];
   solution_.assign(solution_ptr, solution_ptr + solution_size);
   result_.resize(size_);
+  sparse_ = !ppc::core::solver::IsPlainCg(solver_options_);
+  if (sparse_) {
+    // SolveCg stops on a direction along which A is not positive definite, the O(n^3) Cholesky check is not needed
+    matrix_.LoadDense(a_, size_);
+    return true;
+  }
   return Cholesky(a_, size_, size_);
 }
 
 bool sidorina_p_gradient_method_tbb::GradientMethod::ValidationImpl() {
+  if (ppc::core::solver::HasCsrInputs(*task_data, 2)) {
+    const size_t csr_end = 2 + ppc::core::solver::kCsrInputsCount;
+    const int size = *reinterpret_cast<int*>(task_data->inputs[0]);
+    return size > 0 && !task_data->outputs.empty() && task_data->inputs_count.size() > csr_end + 1 &&
+           matrix_.LoadCsrSystem(*task_data, 2) && matrix_.View().rows == static_cast<size_t>(size) &&
+           static_cast<int>(task_data->inputs_count[csr_end + 1]) == size;
+  }
   if (*reinterpret_cast<int*>(task_data->inputs[0]) <= 0 || static_cast<int>(task_data->inputs_count[2]) <= 0 ||
       static_cast<int>(task_data->inputs_count[3]) <= 0 || static_cast<int>(task_data->inputs_count[4]) <= 0) {
     return false;
@@ -46,6 +78,12 @@ bool sidorina_p_gradient_method_tbb::GradientMethod::ValidationImpl() {
 }
 
 bool sidorina_p_gradient_method_tbb::GradientMethod::RunImpl() {
+  if (sparse_) {
+    ppc::core::solver::CgOptions options = solver_options_;
+    options.tolerance = tolerance_;
+    result_ = solution_;
+    return ppc::core::solver::SolveCg(matrix_.View(), b_, result_, options, ppc::core::sparse::TbbBackend{}).converged;
+  }
   result_ = ConjugateGradientMethod(a_, b_, solution_, tolerance_, size_);
   return true;
 }
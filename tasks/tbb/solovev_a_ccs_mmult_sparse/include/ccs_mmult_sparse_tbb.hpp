@@ -37,9 +37,6 @@ class TBBMatMultCcs : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  void ComputeColumnSizes();
-  void FillMatrixValues();
-
   MatrixInCcsSparse *M1_ = nullptr;
   MatrixInCcsSparse *M2_ = nullptr;
   MatrixInCcsSparse *M3_ = nullptr;
@@ -1,59 +1,10 @@
 #include "tbb/solovev_a_ccs_mmult_sparse/include/ccs_mmult_sparse_tbb.hpp"
 
-#include <oneapi/tbb/blocked_range.h>
-#include <oneapi/tbb/parallel_for.h>
-
 #include <complex>
-#include <vector>
-
-void solovev_a_matrix_tbb::TBBMatMultCcs::ComputeColumnSizes() {
-  tbb::parallel_for(tbb::blocked_range<int>(0, M3_->c_n), [&](const tbb::blocked_range<int>& r) {
-    for (int m2_c = r.begin(); m2_c != r.end(); ++m2_c) {
-      std::vector<int> available_el(M3_->r_n, 0);
-      for (int m2_i = M2_->col_p[m2_c]; m2_i < M2_->col_p[m2_c + 1]; ++m2_i) {
-        int m2_r = M2_->row[m2_i];
-        for (int m1_i = M1_->col_p[m2_r]; m1_i < M1_->col_p[m2_r + 1]; ++m1_i) {
-          available_el[M1_->row[m1_i]] = 1;
-        }
-      }
-
-      int n_z_c_cnt = 0;
-      for (int m3_r = 0; m3_r < M3_->r_n; ++m3_r) {
-        n_z_c_cnt += available_el[m3_r];
-      }
-
-      M3_->col_p[m2_c + 1] = n_z_c_cnt;
-    }
-  });
-}
-
-void solovev_a_matrix_tbb::TBBMatMultCcs::FillMatrixValues() {
-  tbb::parallel_for(tbb::blocked_range<int>(0, M3_->c_n), [&](const tbb::blocked_range<int>& r) {
-    for (int m2_c = r.begin(); m2_c != r.end(); ++m2_c) {
-      std::vector<int> available_el(M3_->r_n, 0);
-      std::vector<std::complex<double>> cask(M3_->r_n, std::complex<double>(0.0, 0.0));
+#include <cstddef>
+#include <span>
 
-      for (int m2_i = M2_->col_p[m2_c]; m2_i < M2_->col_p[m2_c + 1]; ++m2_i) {
-        int m2_r = M2_->row[m2_i];
-        std::complex<double> m2_val = M2_->val[m2_i];
-
-        for (int m1_i = M1_->col_p[m2_r]; m1_i < M1_->col_p[m2_r + 1]; ++m1_i) {
-          int m1_row = M1_->row[m1_i];
-          cask[m1_row] += M1_->val[m1_i] * m2_val;
-          available_el[m1_row] = 1;
-        }
-      }
-
-      int c_pos = M3_->col_p[m2_c];
-      for (int m3_r = 0; m3_r < M3_->r_n; ++m3_r) {
-        if (available_el[m3_r]) {
-          M3_->row[c_pos] = m3_r;
-          M3_->val[c_pos++] = cask[m3_r];
-        }
-      }
-    }
-  });
-}
+#include "core/sparse/include/sparse_tbb.hpp"
 
 bool solovev_a_matrix_tbb::TBBMatMultCcs::PreProcessingImpl() {
   M1_ = reinterpret_cast<MatrixInCcsSparse*>(task_data->inputs[0]);
@@ -69,24 +20,24 @@ bool solovev_a_matrix_tbb::TBBMatMultCcs::ValidationImpl() {
 }
 
 bool solovev_a_matrix_tbb::TBBMatMultCcs::RunImpl() {
+  // col_p, row and val may be longer than the stored matrix, only their used prefix is multiplied
+  using View = ppc::core::sparse::CcsView<std::complex<double>, int>;
+  const auto view = [](const MatrixInCcsSparse* m) {
+    const auto nnz = static_cast<size_t>(m->col_p[m->c_n]);
+    return View{.rows = static_cast<size_t>(m->r_n),
+                .cols = static_cast<size_t>(m->c_n),
+                .col_ptr = std::span<const int>(m->col_p).first(m->c_n + 1),
+                .row_idx = std::span<const int>(m->row).first(nnz),
+                .values = std::span<const std::complex<double>>(m->val).first(nnz)};
+  };
+  const auto product = ppc::core::sparse::SpGemm(view(M1_), view(M2_), ppc::core::sparse::TbbBackend{});
+
   M3_->r_n = M1_->r_n;
   M3_->c_n = M2_->c_n;
-  M3_->col_p.resize(M3_->c_n + 1);
-  M3_->col_p[0] = 0;
-
-  ComputeColumnSizes();
-
-  for (int i = 1; i <= M3_->c_n; ++i) {
-    M3_->col_p[i] += M3_->col_p[i - 1];
-  }
-
-  int n_z_full = M3_->col_p[M3_->c_n];
-  M3_->n_z = n_z_full;
-  M3_->row.resize(n_z_full);
-  M3_->val.resize(n_z_full);
-
-  FillMatrixValues();
-
+  M3_->n_z = static_cast<int>(product.values.size());
+  M3_->col_p.assign(product.col_ptr.begin(), product.col_ptr.end());
+  M3_->row.assign(product.row_idx.begin(), product.row_idx.end());
+  M3_->val.assign(product.values.begin(), product.values.end());
   return true;
 }
 
@@ -1,11 +1,34 @@
 #include "tbb/solovyev_d_shell_sort_simple/include/ops_tbb.hpp"
 
 #include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/task_arena.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+
+namespace {
+// Shell sort with gaps n/2, n/4, ..., 1 of one block
+void ShellSort(std::span<int> block) {
+  const int size = static_cast<int>(block.size());
+  for (int gap = size / 2; gap > 0; gap /= 2) {
+    for (int f = gap; f < size; f++) {
+      int val = block[f];
+      int j = f;
+      while (j >= gap && block[j - gap] > val) {
+        block[j] = block[j - gap];
+        j -= gap;
+      }
+      block[j] = val;
+    }
+  }
+}
+}  // namespace
+
 bool solovyev_d_shell_sort_simple_tbb::TaskTBB::PreProcessingImpl() {
   size_t input_size = task_data->inputs_count[0];
   auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
@@ -19,19 +42,21 @@ bool solovyev_d_shell_sort_simple_tbb::TaskTBB::ValidationImpl() {
 }
 
 bool solovyev_d_shell_sort_simple_tbb::TaskTBB::RunImpl() {
-  for (int gap = static_cast<int>(input_.size()) / 2; gap > 0; gap /= 2) {
-    tbb::parallel_for(0, gap, [this, gap](int i) {
-      for (size_t f = gap + i; f < input_.size(); f += gap) {
-        int val = input_[f];
-        int j = static_cast<int>(f);
-        while (j >= gap && input_[j - gap] > val) {
-          input_[j] = input_[j - gap];
-          j -= gap;
-        }
-        input_[j] = val;
-      }
-    });
+  const auto blocks = std::max<size_t>(
+      1, std::min(input_.size(), static_cast<size_t>(oneapi::tbb::this_task_arena::max_concurrency())));
+  std::vector<size_t> bounds(blocks + 1);
+  for (size_t i = 0; i <= blocks; i++) {
+    bounds[i] = i * input_.size() / blocks;
   }
+  tbb::parallel_for(size_t{0}, blocks, [this, &bounds](size_t i) {
+    ShellSort(std::span(input_).subspan(bounds[i], bounds[i + 1] - bounds[i]));
+  });
+
+  const auto runs = ppc::core::MakeRuns<int>(input_, bounds);
+  std::vector<int> merged(input_.size());
+  tbb::parallel_for(size_t{0}, blocks,
+                    [&](size_t part) { ppc::core::MultiwayMergePart<int>(runs, merged, part, blocks); });
+  input_.swap(merged);
   return true;
 }
 
@@ -15,6 +15,7 @@
 #include <span>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
 #include "core/util/include/util.hpp"
 
 namespace {
@@ -78,7 +79,7 @@ bool sorochkin_d_radix_double_sort_simple_merge_tbb::SortTask::PreProcessingImpl
 }
 
 bool sorochkin_d_radix_double_sort_simple_merge_tbb::SortTask::RunImpl() {
-  output_ = input_;
+  std::vector<double> sorted = input_;
 
   const auto size = input_.size();
   if (size == 0) {
@@ -96,7 +97,7 @@ bool sorochkin_d_radix_double_sort_simple_merge_tbb::SortTask::RunImpl() {
   std::vector<std::span<double>> chunks(numthreads);
   std::ranges::generate(chunks, [&, i = 0]() mutable {
     const auto j = i++;
-    return std::span{output_}.subspan(offsets[j], distrib[j]);
+    return std::span{sorted}.subspan(offsets[j], distrib[j]);
   });
 
   oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
@@ -110,33 +111,16 @@ bool sorochkin_d_radix_double_sort_simple_merge_tbb::SortTask::RunImpl() {
         });
   });
 
-  for (std::size_t i = 1, j = numthreads; j > 1; i *= 2, j /= 2) {
-    const auto multithreaded = chunks.front().size() > 48;
-    const auto jh = j / 2;
-    const auto merge = [&](std::span<double> &master, std::span<double> &slave) {
-      std::inplace_merge(master.begin(), slave.begin(), slave.end());
-      master = std::span{master.begin(), slave.end()};
-    };
-    const auto run = [&](const tbb::blocked_range<std::size_t> &r) {
-      for (std::size_t k = r.begin(); k < r.end(); ++k) {
-        const auto idx = 2 * i * k;
-        merge(chunks[idx], chunks[idx + i]);
+  const std::vector<std::span<const double>> runs(chunks.begin(), chunks.end());
+  output_.resize(size);
+
+  arena.execute([&] {
+    oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<std::size_t>(0, numthreads, 1), [&](const auto &r) {
+      for (std::size_t part = r.begin(); part < r.end(); part++) {
+        ppc::core::MultiwayMergePart<double>(runs, output_, part, numthreads);
       }
-    };
-    if (multithreaded) {
-      arena.execute([&] {
-        oneapi::tbb::parallel_for(
-            oneapi::tbb::blocked_range<std::size_t>(0, jh, jh / tbb::this_task_arena::max_concurrency()), run);
-      });
-    } else {
-      run(tbb::blocked_range<std::size_t>(0, jh));
-    }
-    if (jh == 1) {
-      merge(chunks.front(), chunks.back());
-    } else if (jh % 2 != 0) {
-      merge(chunks[2 * i * (jh - 2)], chunks[2 * i * (jh - 1)]);
-    }
-  }
+    });
+  });
 
   return true;
 }
@@ -9,7 +9,6 @@ namespace sotskov_a_shell_sorting_with_simple_merging_tbb {
 
 void ShellSortWithSimpleMerging(std::vector<int>& arr);
 void ShellSort(std::vector<int>& arr, int left, int right);
-void ParallelMerge(std::vector<int>& arr, int left, int mid, int right);
 
 class TestTaskTBB : public ppc::core::Task {
  public:
@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
 #include "core/util/include/util.hpp"
 
 void sotskov_a_shell_sorting_with_simple_merging_tbb::ShellSort(std::vector<int>& arr, int left, int right) {
@@ -30,30 +31,17 @@ void sotskov_a_shell_sorting_with_simple_merging_tbb::ShellSort(std::vector<int>
   }
 }
 
-void sotskov_a_shell_sorting_with_simple_merging_tbb::ParallelMerge(std::vector<int>& arr, int left, int mid,
-                                                                    int right) {
-  std::vector<int> temp(right - left + 1);
-  int i = left;
-  int j = mid + 1;
-  int k = 0;
-
-  while (i <= mid && j <= right) {
-    temp[k++] = (arr[i] < arr[j]) ? arr[i++] : arr[j++];
-  }
-  while (i <= mid) {
-    temp[k++] = arr[i++];
-  }
-  while (j <= right) {
-    temp[k++] = arr[j++];
-  }
-  std::ranges::copy(temp, arr.begin() + left);
-}
-
 void sotskov_a_shell_sorting_with_simple_merging_tbb::ShellSortWithSimpleMerging(std::vector<int>& arr) {
   int array_size = static_cast<int>(arr.size());
   int num_threads = ppc::util::GetPPCNumThreads();
   int chunk_size = std::max(1, (array_size + num_threads - 1) / num_threads);
 
+  std::vector<std::size_t> bounds(num_threads + 1);
+  for (int i = 0; i <= num_threads; ++i) {
+    bounds[i] = std::min(i * chunk_size, array_size);
+  }
+  std::vector<int> merged(arr.size());
+
   oneapi::tbb::task_arena arena(num_threads);
   arena.execute([&] {
     oneapi::tbb::parallel_for(0, num_threads, [&](int thread_index) {
@@ -64,17 +52,12 @@ void sotskov_a_shell_sorting_with_simple_merging_tbb::ShellSortWithSimpleMerging
       }
     });
 
-    for (int size = chunk_size; size < array_size; size *= 2) {
-      oneapi::tbb::parallel_for(0, (array_size + 2 * size - 1) / (2 * size), [&](int i) {
-        int left = i * 2 * size;
-        int mid = std::min(left + size - 1, array_size - 1);
-        int right = std::min(left + (2 * size - 1), array_size - 1);
-        if (mid < right) {
-          ParallelMerge(arr, left, mid, right);
-        }
-      });
-    }
+    const auto runs = ppc::core::MakeRuns<int>(arr, bounds);
+    oneapi::tbb::parallel_for(0, num_threads, [&](int part) {
+      ppc::core::MultiwayMergePart<int>(runs, merged, part, num_threads);
+    });
   });
+  arr.swap(merged);
 }
 
 bool sotskov_a_shell_sorting_with_simple_merging_tbb::TestTaskTBB::PreProcessingImpl() {
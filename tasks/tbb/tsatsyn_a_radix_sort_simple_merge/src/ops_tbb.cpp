@@ -1,9 +1,8 @@
 #include "tbb/tsatsyn_a_radix_sort_simple_merge/include/ops_tbb.hpp"
 
 #include <oneapi/tbb/blocked_range.h>
-#include <oneapi/tbb/combinable.h>
 #include <oneapi/tbb/parallel_for.h>
-#include <oneapi/tbb/parallel_invoke.h>
+#include <oneapi/tbb/task_arena.h>
 #include <tbb/tbb.h>
 
 #include <algorithm>
@@ -11,9 +10,12 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <cstring>
+#include <span>
+#include <utility>
 #include <vector>
 
+#include "core/merge/include/multiway_merge.hpp"
+
 namespace {
 inline int CalculateBits(const std::vector<uint64_t>& data, bool is_pozitive) {
   if (data.empty()) {
@@ -31,6 +33,41 @@ inline int CalculateBits(const std::vector<uint64_t>& data, bool is_pozitive) {
 
   return num_bits;
 }
+
+// One LSD pass over bit: values with the bit set go first when negative_order is set, last otherwise
+void SplitByBit(std::vector<uint64_t>& data, int bit, bool negative_order) {
+  std::vector<uint64_t> group0;
+  std::vector<uint64_t> group1;
+  for (uint64_t b : data) {
+    if (((b >> bit) & 1) != 0U) {
+      group1.push_back(b);
+    } else {
+      group0.push_back(b);
+    }
+  }
+  const auto& tail = negative_order ? group0 : group1;
+  data = std::move(negative_order ? group1 : group0);
+  data.insert(data.end(), tail.begin(), tail.end());
+}
+
+// Radix sort of one block: values are split by sign and sorted by their bits, negative ones first
+void SortBlock(std::span<const double> block, std::span<double> out) {
+  std::vector<uint64_t> pozitive_copy;
+  std::vector<uint64_t> negative_copy;
+  for (const double val : block) {
+    (val > 0.0 ? pozitive_copy : negative_copy).push_back(std::bit_cast<uint64_t>(val));
+  }
+  const int pozitive_bits = CalculateBits(pozitive_copy, true);
+  const int negative_bits = CalculateBits(negative_copy, false);
+  for (int bit = 0; bit < pozitive_bits; bit++) {
+    SplitByBit(pozitive_copy, bit, false);
+  }
+  for (int bit = 0; bit < negative_bits; bit++) {
+    SplitByBit(negative_copy, bit, true);
+  }
+  auto it = std::ranges::transform(negative_copy, out.begin(), [](uint64_t b) { return std::bit_cast<double>(b); }).out;
+  std::ranges::transform(pozitive_copy, it, [](uint64_t b) { return std::bit_cast<double>(b); });
+}
 }  // namespace
 bool tsatsyn_a_radix_sort_simple_merge_tbb::TestTaskTBB::PreProcessingImpl() {
   // Init value for input and output
@@ -46,78 +83,26 @@ bool tsatsyn_a_radix_sort_simple_merge_tbb::TestTaskTBB::ValidationImpl() {
 }
 
 bool tsatsyn_a_radix_sort_simple_merge_tbb::TestTaskTBB::RunImpl() {
-  std::vector<uint64_t> pozitive_copy;
-  std::vector<uint64_t> negative_copy;
-  tbb::combinable<std::vector<uint64_t>> pos_comb;
-  tbb::combinable<std::vector<uint64_t>> neg_comb;
-  tbb::parallel_for(tbb::blocked_range<size_t>(0, input_data_.size()), [&](const auto& r) {
-    auto& pos = pos_comb.local();
-    auto& neg = neg_comb.local();
+  const size_t blocks = std::max<size_t>(
+      1, std::min(input_data_.size(), static_cast<size_t>(tbb::this_task_arena::max_concurrency())));
+  std::vector<size_t> bounds(blocks + 1);
+  for (size_t i = 0; i <= blocks; i++) {
+    bounds[i] = i * input_data_.size() / blocks;
+  }
+  std::vector<double> sorted_blocks(input_data_.size());
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, blocks, 1), [&](const auto& r) {
     for (size_t i = r.begin(); i < r.end(); ++i) {
-      double val = input_data_[i];
-      auto* bits = reinterpret_cast<uint64_t*>(&val);
-      (val > 0.0 ? pos : neg).push_back(*bits);
+      const size_t size = bounds[i + 1] - bounds[i];
+      SortBlock(std::span(input_data_).subspan(bounds[i], size), std::span(sorted_blocks).subspan(bounds[i], size));
     }
   });
-  auto merge_vectors = [](auto& comb) {
-    std::vector<uint64_t> res;
-    comb.combine_each([&](const auto& v) { res.insert(res.end(), v.begin(), v.end()); });
-    return res;
-  };
-
-  pozitive_copy = merge_vectors(pos_comb);
-  negative_copy = merge_vectors(neg_comb);
-  int pozitive_bits = CalculateBits(pozitive_copy, true);
-  int negative_bits = CalculateBits(negative_copy, false);
-  for (int bit = 0; bit < pozitive_bits; bit++) {
-    std::vector<uint64_t> group0;
-    std::vector<uint64_t> group1;
-    for (uint64_t b : pozitive_copy) {
-      if (((b >> bit) & 1) != 0U) {
-        group1.push_back(b);
-      } else {
-        group0.push_back(b);
-      }
-    }
-    pozitive_copy.clear();
-    pozitive_copy.insert(pozitive_copy.end(), group0.begin(), group0.end());
-    pozitive_copy.insert(pozitive_copy.end(), group1.begin(), group1.end());
-  }
 
-  for (int bit = 0; bit < negative_bits; bit++) {
-    std::vector<uint64_t> group0;
-    std::vector<uint64_t> group1;
-    for (uint64_t b : negative_copy) {
-      if (((b >> bit) & 1) != 0U) {
-        group1.push_back(b);
-      } else {
-        group0.push_back(b);
-      }
+  const auto runs = ppc::core::MakeRuns<double>(sorted_blocks, bounds);
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, blocks, 1), [&](const auto& r) {
+    for (size_t part = r.begin(); part < r.end(); ++part) {
+      ppc::core::MultiwayMergePart<double>(runs, output_, part, blocks);
     }
-    negative_copy.clear();
-    negative_copy.insert(negative_copy.end(), group1.begin(), group1.end());
-    negative_copy.insert(negative_copy.end(), group0.begin(), group0.end());
-  }
-  tbb::parallel_invoke(
-      [&] {
-        tbb::parallel_for(tbb::blocked_range<size_t>(0, negative_copy.size()), [&](const auto& r) {
-          for (size_t i = r.begin(); i < r.end(); ++i) {
-            double tmp = NAN;
-            memcpy(&tmp, &negative_copy[i], sizeof(tmp));
-            output_[i] = tmp;
-          }
-        });
-      },
-      [&] {
-        const size_t offset = negative_copy.size();
-        tbb::parallel_for(tbb::blocked_range<size_t>(0, pozitive_copy.size()), [&](const auto& r) {
-          for (size_t i = r.begin(); i < r.end(); ++i) {
-            double tmp = NAN;
-            memcpy(&tmp, &pozitive_copy[i], sizeof(tmp));
-            output_[offset + i] = tmp;
-          }
-        });
-      });
+  });
   return true;
 }
 
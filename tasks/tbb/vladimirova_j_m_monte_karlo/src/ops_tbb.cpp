@@ -8,16 +8,27 @@
 #include <cmath>
 #include <cstddef>
 #include <functional>
-#include <random>
 #include <vector>
 
-namespace {
+#include "core/random/include/philox.hpp"
 
-thread_local std::mt19937 gen(std::random_device{}());
+namespace {
 
-double CreateRandomVal(double min_v, double max_v) {
-  std::uniform_real_distribution<double> dis(min_v, max_v);
-  return dis(gen);
+// Number of samples [first, last) of the sequence fixed by the default seed at which func holds;
+// sample i takes the uniforms [i * bounds.size(), (i + 1) * bounds.size()) of the sequence
+size_t CountHits(bool (*func)(std::vector<double>, size_t),
+                 const std::vector<vladimirova_j_m_monte_karlo_tbb::BoundariesIntegral> &bounds, size_t first,
+                 size_t last) {
+  auto gen = ppc::core::random::SampleStream(ppc::core::random::kDefaultSeed, first, bounds.size());
+  std::vector<double> random_val(bounds.size());
+  size_t hits = 0;
+  for (size_t i = first; i < last; i++) {
+    for (size_t j = 0; j < bounds.size(); j++) {
+      random_val[j] = gen.Uniform(bounds[j].min, bounds[j].max);
+    }
+    hits += static_cast<size_t>(func(random_val, bounds.size()));
+  }
+  return hits;
 }
 
 }  // namespace
@@ -61,14 +72,7 @@ bool vladimirova_j_m_monte_karlo_tbb::TestTaskTBB::RunImpl() {
   size_t total_successful_points = tbb::parallel_reduce(
       tbb::blocked_range<size_t>(0, accuracy_), 0,
       [&](const tbb::blocked_range<size_t> &r, size_t local_successful_point) {
-        std::vector<double> local_random_val(var_size_);
-        for (size_t i = r.begin(); i < r.end(); i++) {
-          for (size_t j = 0; j < var_size_; j++) {
-            local_random_val[j] = CreateRandomVal(var_integr_[j].min, var_integr_[j].max);
-          }
-          local_successful_point += static_cast<size_t>(func_(local_random_val, var_size_));
-        }
-        return local_successful_point;
+        return local_successful_point + CountHits(func_, var_integr_, r.begin(), r.end());
       },
       std::plus<>());
 